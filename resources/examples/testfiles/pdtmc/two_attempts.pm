@@ -0,0 +1,22 @@
+// A task that is attempted twice with different success probabilities
+
+dtmc
+
+const double p;
+const double q;
+
+module attempts
+
+	s : [0..3] init 0;
+	// 0 first attempt
+	// 1 second attempt
+	// 2 success
+	// 3 failure
+
+	[] s=0 -> p : (s'=2) + (1-p) : (s'=1);
+	[] s=1 -> q : (s'=2) + (1-q) : (s'=3);
+	[] s>=2 -> 1 : true;
+
+endmodule
+
+label "success" = s=2;
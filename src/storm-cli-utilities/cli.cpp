@@ -8,6 +8,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Metrics.h"
 
 #include <type_traits>
 #include <ctime>
@@ -204,6 +205,16 @@ namespace storm {
             if (resources.isTimeoutSet()) {
                 storm::utility::resources::setCPULimit(resources.getTimeoutInSeconds());
             }
+            
+            // Let computations that write checkpoints save their progress before a timeout or an interrupt terminates the process.
+            if (resources.isCheckpointSet()) {
+                storm::utility::resources::installSignalHandler();
+            }
+            
+            // If requested, start exporting metrics such that the run can be monitored.
+            if (resources.isExportMetricsSet()) {
+                storm::utility::metrics::startExport(resources.getMetricsTarget(), resources.getMetricsIntervalInSeconds());
+            }
         }
         
         void setLogLevel() {
@@ -14,7 +14,15 @@
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
 
+#include <algorithm>
 #include <type_traits>
+#include <iostream>
+#include <map>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/trim.hpp>
 
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -25,8 +33,13 @@
 #include "storm/models/ModelBase.h"
 
 #include "storm/exceptions/OptionParserException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/modelchecker/results/CheckResultCache.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -45,6 +58,8 @@
 #include "storm/storage/Qvbs.h"
 
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Metrics.h"
+#include "storm/utility/MemoryUsage.h"
 
 namespace storm {
     namespace cli {
@@ -64,8 +79,9 @@ namespace storm {
         void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input, storm::builder::BuilderType const& builderType) {
             if (ioSettings.isPrismOrJaniInputSet()) {
                 storm::utility::Stopwatch modelParsingWatch(true);
+                storm::utility::metrics::ScopedPhase parsingPhase("parsing");
                 if (ioSettings.isPrismInputSet()) {
-                    input.model = storm::api::parseProgram(ioSettings.getPrismInputFilename(), storm::settings::getModule<storm::settings::modules::BuildSettings>().isPrismCompatibilityEnabled());
+                    input.model = storm::api::parseProgram(ioSettings.getPrismInputFilename(), storm::settings::getModule<storm::settings::modules::BuildSettings>().isPrismCompatibilityEnabled(), true, ioSettings.isPrismRecursiveDescentParserSet());
                 } else {
                     storm::jani::ModelFeatures supportedFeatures = storm::api::getSupportedJaniFeatures(builderType);
                     boost::optional<std::vector<std::string>> propertyFilter;
@@ -129,13 +145,12 @@ namespace storm {
             }
         }
         
-        SymbolicInput preprocessSymbolicInput(SymbolicInput const& input, storm::builder::BuilderType const& builderType) {
+        SymbolicInput preprocessSymbolicInput(SymbolicInput const& input, storm::builder::BuilderType const& builderType, std::string const& constantDefinitionString) {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             
             SymbolicInput output = input;
             
             // Substitute constant definitions in symbolic input.
-            std::string constantDefinitionString = ioSettings.getConstantDefinitionString();
             std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
             if (output.model) {
                 constantDefinitions = output.model.get().parseConstantDefinitions(constantDefinitionString);
@@ -174,6 +189,10 @@ namespace storm {
             return output;
         }
         
+        SymbolicInput preprocessSymbolicInput(SymbolicInput const& input, storm::builder::BuilderType const& builderType) {
+            return preprocessSymbolicInput(input, builderType, storm::settings::getModule<storm::settings::modules::IOSettings>().getConstantDefinitionString());
+        }
+        
         void exportSymbolicInput(SymbolicInput const& input) {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             if (input.model && input.model.get().isJaniModel()) {
@@ -205,6 +224,7 @@ namespace storm {
             storm::storage::QvbsBenchmark benchmark(ioSettings.getQvbsModelName());
             STORM_PRINT_AND_LOG(benchmark.getInfo(ioSettings.getQvbsInstanceIndex(), ioSettings.getQvbsPropertyFilter()));
             storm::utility::Stopwatch modelParsingWatch(true);
+            storm::utility::metrics::ScopedPhase parsingPhase("parsing");
             storm::jani::ModelFeatures supportedFeatures = storm::api::getSupportedJaniFeatures(builderType);
             auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(ioSettings.getQvbsInstanceIndex()), supportedFeatures, ioSettings.getQvbsPropertyFilter());
             input.model = std::move(janiInput.first);
@@ -237,6 +257,9 @@ namespace storm {
             SymbolicInput input;
             if (ioSettings.isQvbsInputSet()) {
                 input = parseAndPreprocessSymbolicInputQvbs(ioSettings, builderType);
+            } else if (ioSettings.isServerSet()) {
+                // The server substitutes the constants that are given with each query.
+                input = parseSymbolicInput(builderType);
             } else {
                 input = parseSymbolicInput(builderType);
                 input = preprocessSymbolicInput(input, builderType);
@@ -258,12 +281,12 @@ namespace storm {
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& input) {
-            return storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), storm::settings::getModule<storm::settings::modules::BuildSettings>().isBuildFullModelSet());
+        std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& input, bool buildFullModel = false) {
+            return storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), buildFullModel || storm::settings::getModule<storm::settings::modules::BuildSettings>().isBuildFullModelSet());
         }
         
         template <typename ValueType>
-        std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
+        std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings, bool buildFullModel = false) {
             storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
             options.setBuildChoiceLabels(buildSettings.isBuildChoiceLabelsSet());
             options.setBuildStateValuations(buildSettings.isBuildStateValuationsSet());
@@ -274,7 +297,7 @@ namespace storm {
                 options.setBuildChoiceOrigins(false);
             }
             options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
-            if (buildSettings.isBuildFullModelSet()) {
+            if (buildFullModel || buildSettings.isBuildFullModelSet()) {
                 options.clearTerminalStates();
                 options.setApplyMaximalProgressAssumption(false);
                 options.setBuildAllLabels(true);
@@ -298,17 +321,18 @@ namespace storm {
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        std::shared_ptr<storm::models::ModelBase> buildModel(storm::settings::modules::CoreSettings::Engine const& engine, SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings) {
+        std::shared_ptr<storm::models::ModelBase> buildModel(storm::settings::modules::CoreSettings::Engine const& engine, SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings, bool buildFullModel = false) {
             storm::utility::Stopwatch modelBuildingWatch(true);
+            storm::utility::metrics::ScopedPhase buildingPhase("building");
 
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
             std::shared_ptr<storm::models::ModelBase> result;
             if (input.model) {
                 auto builderType = getBuilderType(engine, buildSettings.isJitSet());
                 if (builderType == storm::builder::BuilderType::Dd) {
-                    result = buildModelDd<DdType, ValueType>(input);
+                    result = buildModelDd<DdType, ValueType>(input, buildFullModel);
                 } else if (builderType == storm::builder::BuilderType::Explicit || builderType == storm::builder::BuilderType::Jit) {
-                    result = buildModelSparse<ValueType>(input, buildSettings);
+                    result = buildModelSparse<ValueType>(input, buildSettings, buildFullModel);
                 }
             } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
                 STORM_LOG_THROW(engine == storm::settings::modules::CoreSettings::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
@@ -470,6 +494,7 @@ namespace storm {
         template <storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             storm::utility::Stopwatch preprocessingWatch(true);
+            storm::utility::metrics::ScopedPhase preprocessingPhase("preprocessing");
             
             std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
             if (model->isSparseModel()) {
@@ -629,6 +654,15 @@ namespace storm {
             }
         }
         
+        void printPropertyMemoryUsage(std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
+            storm::utility::memory::MemoryUsageBreakdown breakdown("Memory usage of the property");
+            if (result) {
+                breakdown.add("Result", result->getMemoryUsage());
+            }
+            breakdown.add("Largest solver cache", storm::utility::memory::getPeakSolverCacheUsage());
+            breakdown.printToStream(std::cout);
+        }
+        
         struct PostprocessingIdentity {
             void operator()(std::unique_ptr<storm::modelchecker::CheckResult> const&) {
                 // Intentionally left empty.
@@ -638,9 +672,12 @@ namespace storm {
         template<typename ValueType>
         void verifyProperties(SymbolicInput const& input, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
             auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            bool printMemoryBreakdown = storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintMemoryBreakdownSet();
             for (auto const& property : properties) {
                 printModelCheckingProperty(property);
+                storm::utility::memory::resetPeakSolverCacheUsage();
                 storm::utility::Stopwatch watch(true);
+                storm::utility::metrics::ScopedPhase checkingPhase("checking");
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
                 try {
                     result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
@@ -648,8 +685,12 @@ namespace storm {
                     STORM_LOG_WARN("Cannot handle property: " << ex.what());
                 }
                 watch.stop();
+                storm::utility::metrics::incrementCounter("storm_checked_properties_total", "Number of properties that were checked.");
                 postprocessingCallback(result);
                 printResult<ValueType>(result, property, &watch);
+                if (printMemoryBreakdown) {
+                    printPropertyMemoryUsage(result);
+                }
             }
         }
         
@@ -745,20 +786,38 @@ namespace storm {
             });
         }
         
+        inline storm::Environment createVerificationEnvironment(void const* model) {
+            storm::Environment env;
+            auto const& mcSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+            if (mcSettings.isCacheSubformulasSet()) {
+                auto cache = std::make_shared<storm::modelchecker::CheckResultCache>(mcSettings.getSubformulaCacheMemoryLimit() * 1024 * 1024);
+                // Only cache results of the input model as model checkers may create temporary models internally.
+                cache->restrictToModel(model);
+                env.modelchecker().setResultCache(cache);
+            }
+            return env;
+        }
+
+        inline void printResultCacheStatistics(storm::Environment const& env) {
+            if (env.modelchecker().getResultCache() && storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                env.modelchecker().getResultCache()->printStatistics(std::cout);
+            }
+        }
+
         template <typename ValueType>
-        void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+        void verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
             verifyProperties<ValueType>(input,
-                                        [&sparseModel] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                                        [&sparseModel,&env] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
                                             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task);
+                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, task);
                                             
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
                                             if (filterForInitialStates) {
                                                 filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
                                             } else {
-                                                filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(states, false));
+                                                filter = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, storm::api::createTask<ValueType>(states, false));
                                             }
                                             if (result && filter) {
                                                 result->filter(filter->asQualitativeCheckResult());
@@ -768,19 +827,19 @@ namespace storm {
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        void verifyWithHybridEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
-            verifyProperties<ValueType>(input, [&model] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+        void verifyWithHybridEngine(storm::Environment const& env, std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+            verifyProperties<ValueType>(input, [&model,&env] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                 bool filterForInitialStates = states->isInitialFormula();
                 auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
                 
                 auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
-                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithHybridEngine<DdType, ValueType>(symbolicModel, task);
+                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithHybridEngine<DdType, ValueType>(env, symbolicModel, task);
                 
                 std::unique_ptr<storm::modelchecker::CheckResult> filter;
                 if (filterForInitialStates) {
                     filter = std::make_unique<storm::modelchecker::SymbolicQualitativeCheckResult<DdType>>(symbolicModel->getReachableStates(), symbolicModel->getInitialStates());
                 } else {
-                    filter = storm::api::verifyWithHybridEngine<DdType, ValueType>(symbolicModel, storm::api::createTask<ValueType>(states, false));
+                    filter = storm::api::verifyWithHybridEngine<DdType, ValueType>(env, symbolicModel, storm::api::createTask<ValueType>(states, false));
                 }
                 if (result && filter) {
                     result->filter(filter->asQualitativeCheckResult());
@@ -790,19 +849,19 @@ namespace storm {
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        void verifyWithDdEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
-            verifyProperties<ValueType>(input, [&model] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+        void verifyWithDdEngine(storm::Environment const& env, std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+            verifyProperties<ValueType>(input, [&model,&env] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                 bool filterForInitialStates = states->isInitialFormula();
                 auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
                 
                 auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
-                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithDdEngine<DdType, ValueType>(symbolicModel, storm::api::createTask<ValueType>(formula, true));
+                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithDdEngine<DdType, ValueType>(env, symbolicModel, storm::api::createTask<ValueType>(formula, true));
                 
                 std::unique_ptr<storm::modelchecker::CheckResult> filter;
                 if (filterForInitialStates) {
                     filter = std::make_unique<storm::modelchecker::SymbolicQualitativeCheckResult<DdType>>(symbolicModel->getReachableStates(), symbolicModel->getInitialStates());
                 } else {
-                    filter = storm::api::verifyWithDdEngine<DdType, ValueType>(symbolicModel, storm::api::createTask<ValueType>(states, false));
+                    filter = storm::api::verifyWithDdEngine<DdType, ValueType>(env, symbolicModel, storm::api::createTask<ValueType>(states, false));
                 }
                 if (result && filter) {
                     result->filter(filter->asQualitativeCheckResult());
@@ -821,32 +880,39 @@ namespace storm {
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueType, double>::value, void>::type verifySymbolicModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
+        typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueType, double>::value, void>::type verifySymbolicModel(storm::Environment const& env, std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
             storm::settings::modules::CoreSettings::Engine engine = coreSettings.getEngine();;
             if (engine == storm::settings::modules::CoreSettings::Engine::Hybrid) {
-                verifyWithHybridEngine<DdType, ValueType>(model, input);
+                verifyWithHybridEngine<DdType, ValueType>(env, model, input);
             } else if (engine == storm::settings::modules::CoreSettings::Engine::Dd) {
-                verifyWithDdEngine<DdType, ValueType>(model, input);
+                verifyWithDdEngine<DdType, ValueType>(env, model, input);
             } else {
                 verifyWithAbstractionRefinementEngine<DdType, ValueType>(model, input);
             }
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        typename std::enable_if<DdType == storm::dd::DdType::CUDD && !std::is_same<ValueType, double>::value, void>::type verifySymbolicModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
+        typename std::enable_if<DdType == storm::dd::DdType::CUDD && !std::is_same<ValueType, double>::value, void>::type verifySymbolicModel(storm::Environment const& env, std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "CUDD does not support the selected data-type.");
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
+        void verifyModel(storm::Environment const& env, std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
             if (model->isSparseModel()) {
-                verifyWithSparseEngine<ValueType>(model, input);
+                verifyWithSparseEngine<ValueType>(env, model, input);
             } else {
                 STORM_LOG_ASSERT(model->isSymbolicModel(), "Unexpected model type.");
-                verifySymbolicModel<DdType, ValueType>(model, input, coreSettings);
+                verifySymbolicModel<DdType, ValueType>(env, model, input, coreSettings);
             }
         }
         
+        template <storm::dd::DdType DdType, typename ValueType>
+        void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
+            storm::Environment env = createVerificationEnvironment(model.get());
+            verifyModel<DdType, ValueType>(env, model, input, coreSettings);
+            printResultCacheStatistics(env);
+        }
+        
         template <storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
         std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModelWithValueTypeAndDdlib(SymbolicInput const& input, storm::settings::modules::CoreSettings::Engine engine) {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
@@ -869,10 +935,207 @@ namespace storm {
                     model->printModelInformationToStream(std::cout);
                 }
                 exportModel<DdType, BuildValueType>(model, input);
+                if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintMemoryBreakdownSet()) {
+                    model->printMemoryUsageToStream(std::cout);
+                    if (model->isSparseModel() && storm::utility::memory::getStateStorageUsage() > 0) {
+                        std::cout << "  State storage of the builder (freed after building): " << storm::utility::memory::formatBytes(storm::utility::memory::getStateStorageUsage()) << std::endl;
+                    }
+                }
             }
             return model;
         }
         
+        /*!
+         * Keeps the models built for the input in memory and answers queries that are read line by line from an input
+         * stream. The supported queries are
+         *
+         *   check <properties>    checks the properties (given as for --prop) on the model for the current constants,
+         *   constants <values>    sets the constant definitions (given as for --const) for subsequent checks,
+         *   models                lists the models that are kept in memory,
+         *   clear                 removes all models from memory,
+         *   quit                  stops the server.
+         *
+         * Each answer is terminated by a line that is either "ok" or starts with "error:". A model is built (and
+         * preprocessed) only once per constant definition (regardless of the order of the definitions) and all queries
+         * on it share one environment such that results cached by the model checkers (e.g. via --cache-subformulas)
+         * are reused across queries.
+         */
+        template <storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
+        class ModelServer {
+        public:
+            /*!
+             * Creates a server for the given input whose constants are not yet substituted.
+             */
+            ModelServer(SymbolicInput const& input, storm::settings::modules::CoreSettings::Engine const& engine) : input(input), engine(engine) {
+                auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+                builderType = getBuilderType(engine, buildSettings.isJitSet());
+                STORM_LOG_THROW(engine != storm::settings::modules::CoreSettings::Engine::Exploration && engine != storm::settings::modules::CoreSettings::Engine::AbstractionRefinement, storm::exceptions::NotSupportedException, "The server mode requires an engine that builds the model.");
+                STORM_LOG_THROW(!storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet(), storm::exceptions::NotSupportedException, "Bisimulation depends on the properties and is therefore not supported in server mode.");
+                constantDefinitionString = normalizeConstantDefinitionString(storm::settings::getModule<storm::settings::modules::IOSettings>().getConstantDefinitionString());
+            }
+
+            /*!
+             * Answers the queries read from the given input stream until the stream ends or the server is stopped.
+             */
+            void run(std::istream& in, std::ostream& out) {
+                out << "Server ready." << std::endl;
+                std::string line;
+                while (std::getline(in, line)) {
+                    if (!handleQuery(line, out)) {
+                        break;
+                    }
+                }
+            }
+
+            /*!
+             * Answers the given query. All output (including the results printed by the model checking routines) is
+             * written to the given stream.
+             *
+             * @return False iff the server is to be stopped.
+             */
+            bool handleQuery(std::string const& query, std::ostream& out) {
+                std::string trimmedQuery = boost::algorithm::trim_copy(query);
+                if (trimmedQuery.empty() || trimmedQuery.front() == '#') {
+                    return true;
+                }
+                std::size_t separator = trimmedQuery.find_first_of(" \t");
+                std::string command = trimmedQuery.substr(0, separator);
+                std::string argument = separator == std::string::npos ? "" : boost::algorithm::trim_copy(trimmedQuery.substr(separator));
+
+                bool keepRunning = true;
+                OutputRedirection redirection(out);
+                try {
+                    if (command == "check") {
+                        STORM_LOG_THROW(!argument.empty(), storm::exceptions::InvalidArgumentException, "Missing properties.");
+                        check(argument, out);
+                    } else if (command == "constants") {
+                        constantDefinitionString = normalizeConstantDefinitionString(argument);
+                    } else if (command == "models") {
+                        for (auto const& entry : models) {
+                            out << "'" << entry.first << "': ";
+                            entry.second.model->printModelInformationToStream(out);
+                        }
+                    } else if (command == "clear") {
+                        models.clear();
+                    } else if (command == "quit" || command == "exit") {
+                        keepRunning = false;
+                    } else {
+                        STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown command '" << command << "'.");
+                    }
+                    out << "ok" << std::endl;
+                } catch (std::exception const& e) {
+                    out << "error: " << e.what() << std::endl;
+                }
+                out.flush();
+                return keepRunning;
+            }
+
+        private:
+            struct ServedModel {
+                std::shared_ptr<storm::models::ModelBase> model;
+                storm::Environment env;
+            };
+
+            /*!
+             * Redirects std::cout (to which the model checking routines print) to the given stream while it is alive.
+             */
+            class OutputRedirection {
+            public:
+                OutputRedirection(std::ostream& out) : originalBuffer(&out == &std::cout ? nullptr : std::cout.rdbuf(out.rdbuf())) {
+                    // Intentionally left empty.
+                }
+
+                ~OutputRedirection() {
+                    if (originalBuffer) {
+                        std::cout.rdbuf(originalBuffer);
+                    }
+                }
+
+            private:
+                std::streambuf* originalBuffer;
+            };
+
+            /*!
+             * Brings the given constant definitions into a canonical form (sorted definitions without whitespace) such
+             * that equivalent definitions refer to the same model.
+             */
+            static std::string normalizeConstantDefinitionString(std::string const& constantDefinitionString) {
+                std::vector<std::string> definitions;
+                boost::split(definitions, constantDefinitionString, boost::is_any_of(","));
+                std::vector<std::string> normalizedDefinitions;
+                for (auto const& definition : definitions) {
+                    std::size_t equalityPosition = definition.find('=');
+                    if (equalityPosition == std::string::npos) {
+                        std::string trimmedDefinition = boost::algorithm::trim_copy(definition);
+                        if (!trimmedDefinition.empty()) {
+                            normalizedDefinitions.push_back(std::move(trimmedDefinition));
+                        }
+                    } else {
+                        normalizedDefinitions.push_back(boost::algorithm::trim_copy(definition.substr(0, equalityPosition)) + "=" + boost::algorithm::trim_copy(definition.substr(equalityPosition + 1)));
+                    }
+                }
+                std::sort(normalizedDefinitions.begin(), normalizedDefinitions.end());
+                return boost::algorithm::join(normalizedDefinitions, ",");
+            }
+
+            void check(std::string const& propertyString, std::ostream& out) {
+                SymbolicInput query = input;
+                if (query.model) {
+                    query.properties = storm::api::parsePropertiesForSymbolicModelDescription(propertyString, query.model.get(), boost::none);
+                } else {
+                    query.properties = storm::api::parseProperties(propertyString, boost::none);
+                }
+                query = preprocessSymbolicInput(query, builderType, constantDefinitionString);
+                ServedModel const& servedModel = getModel(query, out);
+                verifyModel<DdType, VerificationValueType>(servedModel.env, servedModel.model, query, storm::settings::getModule<storm::settings::modules::CoreSettings>());
+            }
+
+            ServedModel const& getModel(SymbolicInput const& query, std::ostream& out) {
+                auto modelIt = models.find(constantDefinitionString);
+                if (modelIt != models.end()) {
+                    return modelIt->second;
+                }
+
+                // As the model is to be used for arbitrary properties, it has to comprise all labels and reward models.
+                SymbolicInput modelInput = query;
+                modelInput.properties.clear();
+                modelInput.preprocessedProperties = boost::none;
+                std::shared_ptr<storm::models::ModelBase> model = buildModel<DdType, BuildValueType>(engine, modelInput, storm::settings::getModule<storm::settings::modules::IOSettings>(), true);
+                STORM_LOG_THROW(model, storm::exceptions::InvalidSettingsException, "No input model.");
+                auto preprocessingResult = preprocessModel<DdType, BuildValueType, VerificationValueType>(model, modelInput);
+                if (preprocessingResult.second) {
+                    model = preprocessingResult.first;
+                }
+                model->printModelInformationToStream(out);
+
+                ServedModel& servedModel = models[constantDefinitionString];
+                servedModel.model = model;
+                servedModel.env = createVerificationEnvironment(model.get());
+                return servedModel;
+            }
+
+            // The input whose constants are not yet substituted.
+            SymbolicInput input;
+            storm::settings::modules::CoreSettings::Engine engine;
+            storm::builder::BuilderType builderType;
+
+            // The constant definitions for subsequent checks.
+            std::string constantDefinitionString;
+
+            // The models built so far, indexed by the definitions of their constants.
+            std::map<std::string, ServedModel> models;
+        };
+
+        /*!
+         * Serves the given (not yet preprocessed) input, reading queries from the standard input.
+         */
+        template <storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
+        void serveInput(SymbolicInput const& input) {
+            auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+            ModelServer<DdType, BuildValueType, VerificationValueType> server(input, coreSettings.getEngine());
+            server.run(std::cin, std::cout);
+        }
+
         template <storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
         void processInputWithValueTypeAndDdlib(SymbolicInput const& input) {
             auto coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
@@ -881,7 +1144,9 @@ namespace storm {
             // For several engines, no model building step is performed, but the verification is started right away.
             storm::settings::modules::CoreSettings::Engine engine = coreSettings.getEngine();
             
-            if (engine == storm::settings::modules::CoreSettings::Engine::AbstractionRefinement && abstractionSettings.getAbstractionRefinementMethod() == storm::settings::modules::AbstractionSettings::Method::Games) {
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isServerSet()) {
+                serveInput<DdType, BuildValueType, VerificationValueType>(input);
+            } else if (engine == storm::settings::modules::CoreSettings::Engine::AbstractionRefinement && abstractionSettings.getAbstractionRefinementMethod() == storm::settings::modules::AbstractionSettings::Method::Games) {
                 verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input);
             } else if (engine == storm::settings::modules::CoreSettings::Engine::Exploration) {
                 verifyWithExplorationEngine<VerificationValueType>(input);
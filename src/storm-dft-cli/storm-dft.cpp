@@ -194,8 +194,13 @@ void processOptions() {
         if (faultTreeSettings.isApproximationErrorSet()) {
             approximationError = faultTreeSettings.getApproximationError();
         }
+        bool useSmtBounds = false;
+#ifdef STORM_HAVE_Z3
+        useSmtBounds = faultTreeSettings.useSmtBoundsForApproximation();
+#endif
         storm::api::analyzeDFT<ValueType>(*dft, props, faultTreeSettings.useSymmetryReduction(), faultTreeSettings.useModularisation(), relevantEvents,
-                                          faultTreeSettings.isAllowDCForRelevantEvents(), approximationError, faultTreeSettings.getApproximationHeuristic(), true);
+                                          faultTreeSettings.isAllowDCForRelevantEvents(), approximationError, faultTreeSettings.getApproximationHeuristic(), true,
+                                          useSmtBounds);
     }
 }
 
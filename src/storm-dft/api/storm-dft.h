@@ -74,14 +74,16 @@ namespace storm {
          * @param approximationError Allowed approximation error.  Value 0 indicates no approximation.
          * @param approximationHeuristic Heuristic used for state space exploration.
          * @param printOutput If true, model information, timings, results, etc. are printed.
+         * @param useSmtBounds If true, the approximation of expected times uses bounds on the number of failures computed via SMT.
          * @return Results.
          */
         template<typename ValueType>
         typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results
         analyzeDFT(storm::storage::DFT<ValueType> const& dft, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties, bool symred = true,
                    bool allowModularisation = true, std::set<size_t> const& relevantEvents = {}, bool allowDCForRelevantEvents = true, double approximationError = 0.0,
-                   storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH, bool printOutput = false) {
-            storm::modelchecker::DFTModelChecker<ValueType> modelChecker(printOutput);
+                   storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH, bool printOutput = false,
+                   bool useSmtBounds = false) {
+            storm::modelchecker::DFTModelChecker<ValueType> modelChecker(printOutput, useSmtBounds);
             typename storm::modelchecker::DFTModelChecker<ValueType>::dft_results results = modelChecker.check(dft, properties, symred, allowModularisation, relevantEvents,
                                                                                                                allowDCForRelevantEvents, approximationError,
                                                                                                                approximationHeuristic);
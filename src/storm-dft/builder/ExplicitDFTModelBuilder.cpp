@@ -123,13 +123,13 @@ namespace storm {
                 // Initialize
                 switch (usedHeuristic) {
                     case storm::builder::ApproximationHeuristic::DEPTH:
-                        explorationQueue = storm::storage::BucketPriorityQueue<ExplorationHeuristic>(dft.nrElements()+1, 0, 0.9, false);
+                        explorationQueue = storm::storage::BucketPriorityQueue(dft.nrElements()+1, 0, 0.9, false);
                         break;
                     case storm::builder::ApproximationHeuristic::PROBABILITY:
-                        explorationQueue = storm::storage::BucketPriorityQueue<ExplorationHeuristic>(200, 0, 0.9, true);
+                        explorationQueue = storm::storage::BucketPriorityQueue(200, 0, 0.9, true);
                         break;
                     case storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                        explorationQueue = storm::storage::BucketPriorityQueue<ExplorationHeuristic>(200, 0, 0.9, true);
+                        explorationQueue = storm::storage::BucketPriorityQueue(200, 0, 0.9, true);
                         break;
                     default:
                         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
@@ -184,7 +184,7 @@ namespace storm {
                 }
                 heuristic->markExpand();
                 statesNotExplored[initialStateIndex].second = heuristic;
-                explorationQueue.push(heuristic);
+                explorationQueue.push(heuristic->getId(), heuristic->getPriority(), heuristic->isExpand());
             } else {
                 initializeNextIteration();
             }
@@ -246,7 +246,7 @@ namespace storm {
             // TODO: remove
             for (auto const& skippedState : skippedStates) {
                 statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
-                explorationQueue.push(skippedState.second.second);
+                explorationQueue.push(skippedState.second.first->getId(), skippedState.second.second->getPriority(), skippedState.second.second->isExpand());
             }
 
             // Initialize matrix builder again
@@ -348,12 +348,13 @@ namespace storm {
             // TODO: do not empty queue every time but break before
             while (!explorationQueue.empty()) {
                 // Get the first state in the queue
-                ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-                StateType currentId = currentExplorationHeuristic->getId();
+                StateType currentId = explorationQueue.pop();
                 auto itFind = statesNotExplored.find(currentId);
                 STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
                 DFTStatePointer currentState = itFind->second.first;
-                STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
+                ExplorationHeuristicPointer currentExplorationHeuristic = itFind->second.second;
+                STORM_LOG_ASSERT(currentExplorationHeuristic, "Exploration heuristic is not initialized");
+                STORM_LOG_ASSERT(currentExplorationHeuristic->getId() == currentId, "Ids of exploration heuristic and state do not match");
                 STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
                 // Remove it from the list of not explored states
                 statesNotExplored.erase(itFind);
@@ -445,12 +446,11 @@ namespace storm {
                                         heuristic->setBounds(lowerBound, upperBound);
                                     }
 
-                                    explorationQueue.push(heuristic);
+                                    explorationQueue.push(heuristic->getId(), heuristic->getPriority(), heuristic->isExpand());
                                 } else if (!iter->second.second->isExpand()) {
-                                    double oldPriority = iter->second.second->getPriority();
                                     if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
                                         // Update priority queue
-                                        explorationQueue.update(iter->second.second, oldPriority);
+                                        explorationQueue.update(stateProbabilityPair.first, iter->second.second->getPriority());
                                     }
                                 }
                             }
@@ -693,6 +693,17 @@ namespace storm {
             }
         }
 
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::setLeastFailureBound(uint64_t bound) {
+            leastFailureBound = bound;
+            activeFailureRates.clear();
+            for (auto const& be : dft.getBasicElements()) {
+                if (be->type() == storm::storage::DFTElementType::BE_EXP) {
+                    activeFailureRates.emplace_back(be->id(), std::static_pointer_cast<storm::storage::BEExponential<ValueType> const>(be)->activeFailureRate());
+                }
+            }
+        }
+
         template<typename ValueType, typename StateType>
         ValueType ExplicitDFTModelBuilder<ValueType, StateType>::getLowerBound(DFTStatePointer const& state) const {
             // Get the lower bound by considering the failure of all possible BEs
@@ -700,6 +711,25 @@ namespace storm {
             for (state->getFailableElements().init(false); !state->getFailableElements().isEnd(); state->getFailableElements().next()) {
                 lowerBound += state->getBERate(state->getFailableElements().get());
             }
+
+            if (leastFailureBound > 1 && !storm::utility::isZero(lowerBound)) {
+                // At least leastFailureBound BEs have to fail before the top level element fails. After the first
+                // failure, each further failure occurs with a rate of at most the sum of the active rates of the
+                // remaining BEs. This yields a lower bound on the expected time until failure.
+                size_t nrFailedBEs = 0;
+                ValueType maxRate = storm::utility::zero<ValueType>();
+                for (auto const& beRate : activeFailureRates) {
+                    if (state->hasFailed(beRate.first)) {
+                        ++nrFailedBEs;
+                    } else if (state->isOperational(beRate.first)) {
+                        maxRate += beRate.second;
+                    }
+                }
+                if (nrFailedBEs + 1 < leastFailureBound && !storm::utility::isZero(maxRate)) {
+                    ValueType remainingFailures = storm::utility::convertNumber<ValueType>(static_cast<double>(leastFailureBound - nrFailedBEs - 1));
+                    lowerBound = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() / lowerBound + remainingFailures / maxRate);
+                }
+            }
             STORM_LOG_TRACE("Lower bound is " << lowerBound << " for state " << state->getId());
             return lowerBound;
         }
@@ -169,6 +169,15 @@ namespace storm {
              */
             void buildModel(size_t iteration, double approximationThreshold = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH);
 
+            /*!
+             * Set a lower bound on the number of BE failures that are necessary for the top level element to fail,
+             * e.g., as computed by DFTASFChecker::getLeastFailureBound. The bound tightens the lower bound
+             * approximation of the expected time for skipped states.
+             *
+             * @param bound The number of BE failures.
+             */
+            void setLeastFailureBound(uint64_t bound);
+
             /*!
              * Get the built model.
              *
@@ -320,7 +329,7 @@ namespace storm {
             storm::storage::sparse::StateStorage<StateType> stateStorage;
 
             // A priority queue of states that still need to be explored.
-            storm::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
+            storm::storage::BucketPriorityQueue explorationQueue;
 
             // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
             std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
@@ -333,6 +342,12 @@ namespace storm {
 
             // List of independent subtrees and the BEs contained in them.
             std::vector<std::vector<size_t>> subtreeBEs;
+
+            // Lower bound on the number of BE failures necessary for the top level element to fail.
+            uint64_t leastFailureBound = 0;
+
+            // Ids and active failure rates of all BEs that can fail.
+            std::vector<std::pair<size_t, ValueType>> activeFailureRates;
         };
 
     }
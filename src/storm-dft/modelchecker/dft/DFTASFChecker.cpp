@@ -513,6 +513,7 @@ namespace storm {
             for (auto const &constraint : constraints) {
                 solver->add(constraint->toExpression(varNames, manager));
             }
+            indicatorVariables.clear();
 
         }
 
@@ -534,16 +535,32 @@ namespace storm {
         storm::solver::SmtSolver::CheckResult DFTASFChecker::checkTleFailsWithLeq(uint64_t bound) {
             STORM_LOG_ASSERT(solver, "SMT Solver was not initialized, call toSolver() before checking queries");
 
-            // Set backtracking marker to check several properties without reconstructing DFT encoding
-            solver->push();
             // Constraint that toplevel element can fail with less or equal 'bound' failures
-            std::shared_ptr<SmtConstraint> tleNeverFailedConstr = std::make_shared<IsLessEqualConstant>(
+            std::shared_ptr<SmtConstraint> tleFailedConstr = std::make_shared<IsLessEqualConstant>(
                     timePointVariables.at(dft.getTopLevelIndex()), bound);
+            return solver->checkWithAssumptions({getIndicator("tle_leq_" + std::to_string(bound), tleFailedConstr)});
+        }
+
+        storm::solver::SmtSolver::CheckResult DFTASFChecker::checkTleFailsWithGeq(uint64_t bound) {
+            STORM_LOG_ASSERT(solver, "SMT Solver was not initialized, call toSolver() before checking queries");
+
+            // Constraint that toplevel element fails with greater or equal 'bound' failures
+            std::vector<std::shared_ptr<SmtConstraint>> tleFailedConstrs;
+            tleFailedConstrs.push_back(std::make_shared<IsGreaterEqualConstant>(timePointVariables.at(dft.getTopLevelIndex()), bound));
+            tleFailedConstrs.push_back(std::make_shared<IsLessConstant>(timePointVariables.at(dft.getTopLevelIndex()), notFailed));
+            return solver->checkWithAssumptions({getIndicator("tle_geq_" + std::to_string(bound), std::make_shared<And>(tleFailedConstrs))});
+        }
+
+        storm::expressions::Expression DFTASFChecker::getIndicator(std::string const& name, std::shared_ptr<SmtConstraint> const& constraint) {
+            auto it = indicatorVariables.find(name);
+            if (it != indicatorVariables.end()) {
+                return it->second;
+            }
             std::shared_ptr<storm::expressions::ExpressionManager> manager = solver->getManager().getSharedPointer();
-            solver->add(tleNeverFailedConstr->toExpression(varNames, manager));
-            storm::solver::SmtSolver::CheckResult res = solver->check();
-            solver->pop();
-            return res;
+            storm::expressions::Expression indicator = manager->declareBooleanVariable(name).getExpression();
+            solver->add(storm::expressions::implies(indicator, constraint->toExpression(varNames, manager)));
+            indicatorVariables.emplace(name, indicator);
+            return indicator;
         }
 
         void DFTASFChecker::setSolverTimeout(uint_fast64_t milliseconds) {
@@ -688,28 +705,55 @@ namespace storm {
         uint64_t DFTASFChecker::getLeastFailureBound(uint_fast64_t timeout) {
             STORM_LOG_TRACE("Compute lower bound for number of BE failures necessary for the DFT to fail");
             STORM_LOG_ASSERT(solver, "SMT Solver was not initialized, call toSolver() before checking queries");
-            uint64_t bound = 0;
-            while (bound < notFailed) {
+            // The TLE can fail with at most 'bound' failures for all bounds greater or equal than the least failure bound.
+            // All values smaller than 'lower' are known to be UNSAT, 'upper' is the smallest value known to be SAT (or notFailed).
+            uint64_t lower = 0;
+            uint64_t upper = notFailed;
+            uint64_t candidate = 0;
+            uint64_t step = 1;
+            // If the solver returns 'Unknown', the search stops with the largest bound known to be correct so far
+            bool unknown = false;
+            // Galloping search for a satisfiable bound
+            while (candidate < notFailed) {
+                setSolverTimeout(timeout * 1000);
+                storm::solver::SmtSolver::CheckResult tmp_res = checkTleFailsWithLeq(candidate);
+                unsetSolverTimeout();
+                if (tmp_res == storm::solver::SmtSolver::CheckResult::Sat) {
+                    upper = candidate;
+                    break;
+                } else if (tmp_res == storm::solver::SmtSolver::CheckResult::Unknown) {
+                    STORM_LOG_DEBUG("Lower bound: Solver returned 'Unknown'");
+                    unknown = true;
+                    break;
+                }
+                lower = candidate + 1;
+                candidate += step;
+                step *= 2;
+            }
+            // Binary search between the last unsatisfiable and the first satisfiable bound
+            while (!unknown && lower < upper) {
+                uint64_t middle = lower + (upper - lower) / 2;
                 setSolverTimeout(timeout * 1000);
-                storm::solver::SmtSolver::CheckResult tmp_res = checkTleFailsWithLeq(bound);
+                storm::solver::SmtSolver::CheckResult tmp_res = checkTleFailsWithLeq(middle);
                 unsetSolverTimeout();
                 switch (tmp_res) {
                     case storm::solver::SmtSolver::CheckResult::Sat:
-                        if (!dft.getDependencies().empty()) {
-                            return correctLowerBound(bound, timeout);
-                        } else {
-                            return bound;
-                        }
+                        upper = middle;
+                        break;
                     case storm::solver::SmtSolver::CheckResult::Unknown:
                         STORM_LOG_DEBUG("Lower bound: Solver returned 'Unknown'");
-                        return bound;
+                        unknown = true;
+                        break;
                     default:
-                        ++bound;
+                        lower = middle + 1;
                         break;
                 }
-
             }
-            return bound;
+            // Dependencies can trigger further failures, so the bound has to be corrected even if the search stopped early
+            if (lower < notFailed && !dft.getDependencies().empty()) {
+                return correctLowerBound(lower, timeout);
+            }
+            return lower;
         }
 
         uint64_t DFTASFChecker::getAlwaysFailedBound(uint_fast64_t timeout) {
@@ -718,27 +762,54 @@ namespace storm {
             if (checkTleNeverFailed() == storm::solver::SmtSolver::CheckResult::Sat) {
                 return notFailed;
             }
-            uint64_t bound = notFailed - 1;
-            while (bound >= 0) {
+            // The TLE can fail with at least 'bound' failures for all bounds smaller or equal than the always failed bound.
+            // All values greater than 'upper' are known to be UNSAT, 'lower' is the greatest value known to be SAT.
+            uint64_t upper = notFailed - 1;
+            uint64_t lower = 0;
+            uint64_t distance = 0;
+            uint64_t step = 1;
+            // Galloping search (downwards) for a satisfiable bound
+            while (true) {
+                uint64_t candidate = distance < notFailed - 1 ? notFailed - 1 - distance : 0;
                 setSolverTimeout(timeout * 1000);
-                storm::solver::SmtSolver::CheckResult tmp_res = checkTleFailsWithEq(bound);
+                storm::solver::SmtSolver::CheckResult tmp_res = checkTleFailsWithGeq(candidate);
+                unsetSolverTimeout();
+                if (tmp_res == storm::solver::SmtSolver::CheckResult::Sat) {
+                    lower = candidate;
+                    break;
+                } else if (tmp_res == storm::solver::SmtSolver::CheckResult::Unknown) {
+                    STORM_LOG_DEBUG("Upper bound: Solver returned 'Unknown'");
+                    return upper;
+                } else if (candidate == 0) {
+                    // The TLE can not fail at all
+                    return 0;
+                }
+                upper = candidate - 1;
+                distance += step;
+                step *= 2;
+            }
+            // Binary search between the last satisfiable and the first unsatisfiable bound
+            while (lower < upper) {
+                uint64_t middle = lower + (upper - lower + 1) / 2;
+                setSolverTimeout(timeout * 1000);
+                storm::solver::SmtSolver::CheckResult tmp_res = checkTleFailsWithGeq(middle);
                 unsetSolverTimeout();
                 switch (tmp_res) {
                     case storm::solver::SmtSolver::CheckResult::Sat:
-                        if (!dft.getDependencies().empty()) {
-                            return correctUpperBound(bound, timeout);
-                        } else {
-                            return bound;
-                        }
+                        lower = middle;
+                        break;
                     case storm::solver::SmtSolver::CheckResult::Unknown:
                         STORM_LOG_DEBUG("Upper bound: Solver returned 'Unknown'");
-                        return bound;
+                        return upper;
                     default:
-                        --bound;
+                        upper = middle - 1;
                         break;
                 }
             }
-            return bound;
+            if (!dft.getDependencies().empty()) {
+                return correctUpperBound(lower, timeout);
+            }
+            return lower;
         }
     }
 }
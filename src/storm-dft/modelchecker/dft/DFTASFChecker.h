@@ -72,15 +72,26 @@ namespace storm {
             storm::solver::SmtSolver::CheckResult checkTleFailsWithEq(uint64_t bound);
 
             /**
-             * Check if there exists a sequence of BE failures of at least given length such that the TLE of the DFT fails
+             * Check if there exists a sequence of BE failures of at most given length such that the TLE of the DFT fails.
+             * The bound is only assumed for this query, so information learned by the solver is kept for subsequent queries.
              *
              * @param bound the length of the sequence
              * @return "Sat" if such a sequence exists, "Unsat" if it does not, otherwise "Unknown"
              */
             storm::solver::SmtSolver::CheckResult checkTleFailsWithLeq(uint64_t bound);
 
+            /**
+             * Check if there exists a sequence of BE failures of at least given length such that the TLE of the DFT fails.
+             * The bound is only assumed for this query, so information learned by the solver is kept for subsequent queries.
+             *
+             * @param bound the length of the sequence
+             * @return "Sat" if such a sequence exists, "Unsat" if it does not, otherwise "Unknown"
+             */
+            storm::solver::SmtSolver::CheckResult checkTleFailsWithGeq(uint64_t bound);
+
             /**
              * Get the minimal number of BEs necessary for the TLE to fail (lower bound for number of failures to check)
+             * The bound is found by a galloping search over checkTleFailsWithLeq, followed by a binary search.
              *
              * @param timeout timeout for each query in seconds, defaults to 10 seconds
              * @return the minimal number
@@ -90,6 +101,7 @@ namespace storm {
             /**
              * Get the number of BE failures for which the TLE always fails (upper bound for number of failures to check).
              * Note that the returned value may be higher than the real one when dependencies are present.
+             * The bound is found by a galloping search (downwards) over checkTleFailsWithGeq, followed by a binary search.
              *
              * @param timeout timeout for each query in seconds, defaults to 10 seconds
              * @return the number
@@ -151,6 +163,16 @@ namespace storm {
              */
             uint64_t correctUpperBound(uint64_t bound, uint_fast64_t timeout);
 
+            /**
+             * Helper function that returns a Boolean variable which implies the given constraint.
+             * The implication is added to the solver upon the first request, afterwards the constraint can be enabled by assuming the variable.
+             *
+             * @param name name of the variable
+             * @param constraint the constraint
+             * @return the variable as an expression
+             */
+            storm::expressions::Expression getIndicator(std::string const& name, std::shared_ptr<SmtConstraint> const& constraint);
+
             uint64_t getClaimVariableIndex(uint64_t spareIndex, uint64_t childIndex) const;
 
             /**
@@ -242,6 +264,7 @@ namespace storm {
             std::unordered_map<uint64_t, uint64_t> dependencyVariables;
             std::unordered_map<uint64_t, uint64_t> markovianVariables;
             std::vector<uint64_t> tmpTimePointVariables;
+            std::unordered_map<std::string, storm::expressions::Expression> indicatorVariables;
             uint64_t notFailed;
         };
     }
@@ -7,15 +7,33 @@
 #include "storm/utility/DirectEncodingExporter.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
 #include "storm-dft/storage/dft/DFTIsomorphism.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm-dft/modelchecker/dft/DFTASFChecker.h"
 
 
 namespace storm {
     namespace modelchecker {
 
+        /*!
+         * Computes the minimal number of BE failures necessary for the top level element to fail via the SMT encoding.
+         */
+        template<typename ValueType>
+        uint64_t computeLeastFailureBound(storm::storage::DFT<ValueType> const& dft) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Analysis by SMT not supported for this data type.");
+            return 0;
+        }
+
+        template<>
+        uint64_t computeLeastFailureBound(storm::storage::DFT<double> const& dft) {
+            storm::modelchecker::DFTASFChecker smtChecker(dft);
+            smtChecker.toSolver();
+            return smtChecker.getLeastFailureBound();
+        }
+
         template<typename ValueType>
         typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::check(storm::storage::DFT<ValueType> const& origDft, std::vector<std::shared_ptr<const storm::logic::Formula>> const& properties, bool symred, bool allowModularisation, std::set<size_t> const& relevantEvents, bool allowDCForRelevantEvents, double approximationError, storm::builder::ApproximationHeuristic approximationHeuristic) {
             totalTimer.start();
@@ -286,6 +304,19 @@ namespace storm {
 
                 bool probabilityFormula = property->isProbabilityOperatorFormula();
                 STORM_LOG_ASSERT((property->isTimeOperatorFormula() && !probabilityFormula) || (!property->isTimeOperatorFormula() && probabilityFormula), "Probability formula not initialized correctly");
+                if (!probabilityFormula && useSmtBounds) {
+                    // Bound the number of failures to tighten the lower bound for skipped states
+                    smtTimer.start();
+                    try {
+                        uint64_t leastFailureBound = computeLeastFailureBound(dft);
+                        STORM_LOG_DEBUG("At least " << leastFailureBound << " BE failures are necessary for the top level element to fail.");
+                        builder.setLeastFailureBound(leastFailureBound);
+                    } catch (storm::exceptions::NotSupportedException const& e) {
+                        // The approximation is still sound without the bound
+                        STORM_LOG_WARN("SMT bounds are not used: " << e.what());
+                    }
+                    smtTimer.stop();
+                }
                 size_t iteration = 0;
                 do {
                     // Iteratively build finer models
@@ -433,6 +464,9 @@ namespace storm {
             os << "Exploration:\t" << explorationTimer << std::endl;
             os << "Building:\t" << buildingTimer << std::endl;
             os << "Bisimulation:\t" << bisimulationTimer<< std::endl;
+            if (useSmtBounds) {
+                os << "SMT bounds:\t" << smtTimer << std::endl;
+            }
             os << "Modelchecking:\t" << modelCheckingTimer << std::endl;
             os << "Total:\t\t" << totalTimer << std::endl;
         }
@@ -40,8 +40,12 @@ namespace storm {
 
             /*!
              * Constructor.
+             *
+             * @param printOutput Flag indicating if information should be printed.
+             * @param useSmtBounds Flag indicating if bounds on the number of failures computed via SMT should be used
+             *                     to tighten the approximation of expected times.
              */
-            DFTModelChecker(bool printOutput) : printInfo(printOutput) {
+            DFTModelChecker(bool printOutput, bool useSmtBounds = false) : printInfo(printOutput), useSmtBounds(useSmtBounds) {
             }
 
             /*!
@@ -80,12 +84,15 @@ namespace storm {
 
             bool printInfo;
 
+            bool useSmtBounds;
+
             // Timing values
             storm::utility::Stopwatch buildingTimer;
             storm::utility::Stopwatch explorationTimer;
             storm::utility::Stopwatch bisimulationTimer;
             storm::utility::Stopwatch modelCheckingTimer;
             storm::utility::Stopwatch totalTimer;
+            storm::utility::Stopwatch smtTimer;
 
             /*!
              * Internal helper for model checking a DFT.
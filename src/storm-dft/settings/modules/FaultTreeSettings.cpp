@@ -28,6 +28,7 @@ namespace storm {
             const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
 #ifdef STORM_HAVE_Z3
             const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
+            const std::string FaultTreeSettings::approximationSmtOptionName = "approximationsmt";
 #endif
 
             FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
@@ -55,6 +56,7 @@ namespace storm {
                         storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build()).build());
 #ifdef STORM_HAVE_Z3
                 this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, approximationSmtOptionName, true, "Use SMT to bound the number of failures when approximating expected times.").build());
 #endif
             }
 
@@ -121,6 +123,10 @@ namespace storm {
                 return this->getOption(solveWithSmtOptionName).getHasOptionBeenSet();
             }
 
+            bool FaultTreeSettings::useSmtBoundsForApproximation() const {
+                return this->getOption(approximationSmtOptionName).getHasOptionBeenSet();
+            }
+
 #endif
 
             void FaultTreeSettings::finalize() {
@@ -112,6 +112,13 @@ namespace storm {
                  */
                 bool solveWithSMT() const;
 
+                /*!
+                 * Retrieves whether bounds on the number of failures computed via SMT should be used for approximating expected times.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool useSmtBoundsForApproximation() const;
+
 #endif
 
                 bool check() const override;
@@ -136,6 +143,7 @@ namespace storm {
                 static const std::string firstDependencyOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
+                static const std::string approximationSmtOptionName;
 #endif
 
             };
@@ -1,44 +1,27 @@
 #include "BucketPriorityQueue.h"
 #include "storm/utility/macros.h"
-#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/OutOfRangeException.h"
 
 #include <cmath>
+#include <functional>
+#include <limits>
 
 namespace storm {
     namespace storage {
 
-        template<typename PriorityType>
-        BucketPriorityQueue<PriorityType>::BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio, bool higher) : buckets(nrBuckets), currentBucket(nrBuckets), nrUnsortedItems(0), lowerValue(lowerValue), higher(higher), logBase(std::log(ratio)), nrBuckets(nrBuckets) {
-            compare = ([](PriorityTypePointer a, PriorityTypePointer b) {
-                return *a < *b;
-            });
+        BucketPriorityQueue::BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio, bool higher) : buckets(nrBuckets), currentBucket(nrBuckets), nrItems(0), lowerValue(lowerValue), higher(higher), logBase(std::log(ratio)), nrBuckets(nrBuckets) {
+            // Intentionally left empty
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::fix() {
-            if (currentBucket < nrBuckets && nrUnsortedItems > buckets[currentBucket].size() / 10) {
-                // Sort current bucket
-                std::make_heap(buckets[currentBucket].begin(), buckets[currentBucket].end(), compare);
-                nrUnsortedItems = 0;
-            }
-        }
-
-        template<typename PriorityType>
-        bool BucketPriorityQueue<PriorityType>::empty() const {
-            return currentBucket == nrBuckets && immediateBucket.empty();
+        bool BucketPriorityQueue::empty() const {
+            return nrItems == 0;
         }
 
-        template<typename PriorityType>
-        size_t BucketPriorityQueue<PriorityType>::size() const {
-            size_t size = immediateBucket.size();
-            for (size_t i = currentBucket; currentBucket < nrBuckets; ++i) {
-                size += buckets[i].size();
-            }
-            return size;
+        size_t BucketPriorityQueue::size() const {
+            return nrItems;
         }
 
-        template<typename PriorityType>
-        typename BucketPriorityQueue<PriorityType>::PriorityTypePointer const& BucketPriorityQueue<PriorityType>::top() const {
+        BucketPriorityQueue::IdType BucketPriorityQueue::top() const {
             if (!immediateBucket.empty()) {
                 return immediateBucket.back();
             }
@@ -46,108 +29,166 @@ namespace storm {
             return buckets[currentBucket].front();
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::push(PriorityTypePointer const& item) {
-            if (item->isExpand()) {
-                immediateBucket.push_back(item);
+        void BucketPriorityQueue::push(uint64_t stateId, double priority, bool expand) {
+            IdType id = toIdType(stateId);
+            ++nrItems;
+            if (expand) {
+                immediateBucket.push_back(id);
                 return;
             }
-            size_t bucket = getBucket(item->getPriority());
+            if (id >= priorities.size()) {
+                priorities.resize(id + 1);
+                positions.resize(id + 1);
+            }
+            priorities[id] = priority;
+            insert(id, getBucket(priority));
+        }
+
+        void BucketPriorityQueue::update(uint64_t stateId, double priority) {
+            IdType id = toIdType(stateId);
+            STORM_LOG_ASSERT(id < priorities.size(), "Id " << id << " is not contained in the queue");
+            size_t oldBucket = getBucket(priorities[id]);
+            priorities[id] = priority;
+            size_t newBucket = getBucket(priority);
+            STORM_LOG_ASSERT(positions[id] < buckets[oldBucket].size() && buckets[oldBucket][positions[id]] == id, "Id " << id << " not found");
+
+            if (oldBucket == newBucket) {
+                if (newBucket == currentBucket) {
+                    // Restore heap property
+                    siftUp(positions[id]);
+                    siftDown(positions[id]);
+                }
+                // Otherwise, there is no change as the bucket is not sorted yet
+            } else {
+                remove(id, oldBucket);
+                insert(id, newBucket);
+            }
+        }
+
+        BucketPriorityQueue::IdType BucketPriorityQueue::pop() {
+            STORM_LOG_ASSERT(!empty(), "BucketPriorityQueue is empty");
+            --nrItems;
+            if (!immediateBucket.empty()) {
+                IdType item = immediateBucket.back();
+                immediateBucket.pop_back();
+                return item;
+            }
+            std::vector<IdType>& bucket = buckets[currentBucket];
+            IdType item = bucket.front();
+            swapPositions(bucket, 0, bucket.size() - 1);
+            bucket.pop_back();
+            if (bucket.empty()) {
+                advanceCurrentBucket();
+            } else {
+                siftDown(0);
+            }
+            return item;
+        }
+
+        BucketPriorityQueue::IdType BucketPriorityQueue::toIdType(uint64_t id) {
+            STORM_LOG_THROW(id <= std::numeric_limits<IdType>::max(), storm::exceptions::OutOfRangeException, "Id " << id << " exceeds the maximal id " << std::numeric_limits<IdType>::max() << " supported by the priority queue.");
+            return static_cast<IdType>(id);
+        }
+
+        void BucketPriorityQueue::insert(IdType id, size_t bucket) {
+            STORM_LOG_ASSERT(buckets[bucket].size() < std::numeric_limits<IdType>::max(), "Bucket " << bucket << " is too large");
+            positions[id] = buckets[bucket].size();
+            buckets[bucket].push_back(id);
             if (bucket < currentBucket) {
+                // All buckets before the current one are empty, so the heap consists of the single item
                 currentBucket = bucket;
-                nrUnsortedItems = 0;
+            } else if (bucket == currentBucket) {
+                siftUp(positions[id]);
             }
-            buckets[bucket].push_back(item);
+        }
+
+        void BucketPriorityQueue::remove(IdType id, size_t bucket) {
+            size_t position = positions[id];
+            swapPositions(buckets[bucket], position, buckets[bucket].size() - 1);
+            buckets[bucket].pop_back();
             if (bucket == currentBucket) {
-                // Inserted in first bucket
-                if (AUTOSORT) {
-                    std::push_heap(buckets[currentBucket].begin(), buckets[currentBucket].end(), compare);
-                } else {
-                    ++nrUnsortedItems;
+                if (buckets[bucket].empty()) {
+                    advanceCurrentBucket();
+                } else if (position < buckets[bucket].size()) {
+                    // Restore heap property for the swapped item
+                    siftUp(position);
+                    siftDown(position);
                 }
             }
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::update(PriorityTypePointer const& item, double oldPriority) {
-            STORM_LOG_ASSERT(!item->isExpand(), "Item is marked for expansion");
-            size_t newBucket = getBucket(item->getPriority());
-            size_t oldBucket = getBucket(oldPriority);
-
-            if (oldBucket == newBucket) {
-                if (currentBucket < newBucket) {
-                    // No change as the bucket is not sorted yet
-                } else {
-                    if (AUTOSORT) {
-                        // Sort first bucket
-                        fix();
-                    } else {
-                        ++nrUnsortedItems;
-                    }
+        void BucketPriorityQueue::advanceCurrentBucket() {
+            for ( ; currentBucket < nrBuckets; ++currentBucket) {
+                if (!buckets[currentBucket].empty()) {
+                    makeHeap();
+                    return;
                 }
+            }
+        }
+
+        void BucketPriorityQueue::siftUp(size_t position) {
+            if (higher) {
+                siftUp(position, std::less<double>());
             } else {
-                // Move to new bucket
-                STORM_LOG_ASSERT(newBucket < oldBucket, "Will update item "<< item->getId() << " from " << oldBucket << " to higher bucket " << newBucket);
-                if (newBucket < currentBucket) {
-                    currentBucket = newBucket;
-                    nrUnsortedItems = 0;
-                }
-                // Remove old entry by swap-and-pop
-                if (buckets[oldBucket].size() >= 2) {
-                    // Find old index by linear search
-                    // Notice: using a map to remember index was not efficient
-                    size_t oldIndex = 0;
-                    for ( ; oldIndex < buckets[oldBucket].size(); ++oldIndex) {
-                        if (buckets[oldBucket][oldIndex]->getId() == item->getId()) {
-                            break;
-                        }
-                    }
-                    STORM_LOG_ASSERT(oldIndex < buckets[oldBucket].size(), "Id " << item->getId() << " not found");
-                    std::iter_swap(buckets[oldBucket].begin() + oldIndex, buckets[oldBucket].end() - 1);
-                }
-                buckets[oldBucket].pop_back();
-                // Insert new element
-                buckets[newBucket].push_back(item);
-                if (newBucket == currentBucket) {
-                    if (AUTOSORT) {
-                        // Sort in first bucket
-                        std::push_heap(buckets[currentBucket].begin(), buckets[currentBucket].end(), compare);
-                    } else {
-                        ++nrUnsortedItems;
-                    }
-                }
+                siftUp(position, std::greater<double>());
             }
         }
 
+        void BucketPriorityQueue::siftDown(size_t position) {
+            if (higher) {
+                siftDown(position, std::less<double>());
+            } else {
+                siftDown(position, std::greater<double>());
+            }
+        }
 
-        template<typename PriorityType>
-        typename BucketPriorityQueue<PriorityType>::PriorityTypePointer BucketPriorityQueue<PriorityType>::pop() {
-            if (!immediateBucket.empty()) {
-                PriorityTypePointer item = immediateBucket.back();
-                immediateBucket.pop_back();
-                return item;
+        void BucketPriorityQueue::makeHeap() {
+            size_t size = buckets[currentBucket].size();
+            for (size_t position = size / 2; position > 0; --position) {
+                siftDown(position - 1);
             }
-            STORM_LOG_ASSERT(!empty(), "BucketPriorityQueue is empty");
-            std::pop_heap(buckets[currentBucket].begin(), buckets[currentBucket].end(), compare);
-            PriorityTypePointer item = buckets[currentBucket].back();
-            buckets[currentBucket].pop_back();
-            if (buckets[currentBucket].empty()) {
-                // Find next bucket with elements
-                for ( ; currentBucket < nrBuckets; ++currentBucket) {
-                    if (!buckets[currentBucket].empty()) {
-                        nrUnsortedItems = buckets[currentBucket].size();
-                        if (AUTOSORT) {
-                            fix();
-                        }
-                        break;
-                    }
+        }
+
+        template<typename Compare>
+        void BucketPriorityQueue::siftUp(size_t position, Compare const& compare) {
+            std::vector<IdType>& heap = buckets[currentBucket];
+            while (position > 0) {
+                size_t parent = (position - 1) / 2;
+                if (!compare(priorities[heap[parent]], priorities[heap[position]])) {
+                    break;
                 }
+                swapPositions(heap, parent, position);
+                position = parent;
             }
-            return item;
         }
 
-        template<typename PriorityType>
-        size_t BucketPriorityQueue<PriorityType>::getBucket(double priority) const {
+        template<typename Compare>
+        void BucketPriorityQueue::siftDown(size_t position, Compare const& compare) {
+            std::vector<IdType>& heap = buckets[currentBucket];
+            size_t size = heap.size();
+            while (true) {
+                size_t child = 2 * position + 1;
+                if (child >= size) {
+                    break;
+                }
+                if (child + 1 < size && compare(priorities[heap[child]], priorities[heap[child + 1]])) {
+                    ++child;
+                }
+                if (!compare(priorities[heap[position]], priorities[heap[child]])) {
+                    break;
+                }
+                swapPositions(heap, position, child);
+                position = child;
+            }
+        }
+
+        void BucketPriorityQueue::swapPositions(std::vector<IdType>& bucket, size_t first, size_t second) {
+            std::swap(bucket[first], bucket[second]);
+            positions[bucket[first]] = first;
+            positions[bucket[second]] = second;
+        }
+
+        size_t BucketPriorityQueue::getBucket(double priority) const {
             STORM_LOG_ASSERT(priority >= lowerValue, "Priority " << priority << " is too low");
 
             // For possible values greater 1
@@ -168,45 +209,31 @@ namespace storm {
             return newBucket;
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::print(std::ostream& out) const {
+        void BucketPriorityQueue::print(std::ostream& out) const {
             out << "Bucket priority queue with size " << buckets.size() << ", lower value: " << lowerValue << " and logBase: " << logBase << std::endl;
             out << "Immediate bucket: ";
             for (auto item : immediateBucket) {
-                out << item->getId() << ", ";
+                out << item << ", ";
             }
             out << std::endl;
-            out << "Current bucket (" << currentBucket << ") has " << nrUnsortedItems  << " unsorted items" << std::endl;
+            out << "Current bucket: " << currentBucket << std::endl;
             for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
                 if (!buckets[bucket].empty()) {
                     out << "Bucket " << bucket << ":" << std::endl;
                     for (auto item : buckets[bucket]) {
-                        out << "\t" << item->getId() << ": " << item->getPriority() << std::endl;
+                        out << "\t" << item << ": " << priorities[item] << std::endl;
                     }
                 }
             }
         }
 
-        template<typename PriorityType>
-        void BucketPriorityQueue<PriorityType>::printSizes(std::ostream& out) const {
+        void BucketPriorityQueue::printSizes(std::ostream& out) const {
             out << "Bucket sizes: " << immediateBucket.size() << " | ";
             for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
                 out << buckets[bucket].size() << " ";
             }
-            std::cout << std::endl;
+            out << std::endl;
         }
 
-        // Template instantiations
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristic<double>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicDepth<double>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicProbability<double>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicBoundDifference<double>>;
-
-#ifdef STORM_HAVE_CARL
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristic<storm::RationalFunction>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicDepth<storm::RationalFunction>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicProbability<storm::RationalFunction>>;
-        template class BucketPriorityQueue<storm::builder::DFTExplorationHeuristicBoundDifference<storm::RationalFunction>>;
-#endif
     }
 }
@@ -1,41 +1,40 @@
 #pragma once
 
-#include <algorithm>
-#include <functional>
-#include <unordered_map>
+#include <cstdint>
+#include <ostream>
 #include <vector>
 
-#include "storm-dft/builder/DftExplorationHeuristic.h"
-
 namespace storm {
     namespace storage {
 
         /*!
          * Priority queue based on buckets.
          * Can be used to keep track of states during state space exploration.
-         * @tparam PriorityType Underlying priority data type
+         * The queue only stores the (32-bit) ids of the items. Their priorities are kept in a parallel array indexed by the id.
+         * Additionally, the position of each item within its bucket is stored such that an item can be moved to another bucket in constant time.
+         * The first non-empty bucket is organized as a binary heap.
          */
-        template<class PriorityType>
         class BucketPriorityQueue {
 
-            using PriorityTypePointer = std::shared_ptr<PriorityType>;
-
         public:
+            using IdType = uint32_t;
+
             /*!
              * Create new priority queue.
-             * @param nrBuckets
-             * @param lowerValue
-             * @param ratio
-             * @param higher
+             * @param nrBuckets Number of buckets.
+             * @param lowerValue Minimal priority.
+             * @param ratio Ratio between the priorities of two consecutive buckets.
+             * @param higher If true, items with higher priorities are preferred. Otherwise, items with lower priorities are preferred.
              */
             explicit BucketPriorityQueue(size_t nrBuckets, double lowerValue, double ratio, bool higher);
 
             BucketPriorityQueue(BucketPriorityQueue const& queue) = default;
+            BucketPriorityQueue& operator=(BucketPriorityQueue const& queue) = default;
+            BucketPriorityQueue(BucketPriorityQueue&& queue) = default;
+            BucketPriorityQueue& operator=(BucketPriorityQueue&& queue) = default;
 
             virtual ~BucketPriorityQueue() = default;
 
-            void fix();
-
             /*!
              * Check whether queue is empty.
              * @return True iff queue is empty.
@@ -50,28 +49,30 @@ namespace storm {
 
             /*!
              * Get element with highest priority.
-             * @return Top element.
+             * @return Id of top element.
              */
-            PriorityTypePointer const& top() const;
+            IdType top() const;
 
             /*!
              * Add element.
-             * @param item Element.
+             * @param id Id of the element. The element must not be contained in the queue and the id must be representable as IdType.
+             * @param priority Priority of the element.
+             * @param expand If true, the element is considered immediately (before all elements which are not marked for expansion).
              */
-            void push(PriorityTypePointer const& item);
+            void push(uint64_t id, double priority, bool expand = false);
 
             /*!
-             * Update existing element.
-             * @param item Element with changes.
-             * @param oldPriority Old priority.
+             * Update the priority of an existing element which is not marked for expansion.
+             * @param id Id of the element.
+             * @param priority New priority.
              */
-            void update(PriorityTypePointer const& item, double oldPriority);
+            void update(uint64_t id, double priority);
 
             /*!
              * Get element with highest priority and remove it from the queue.
-             * @return Top element.
+             * @return Id of top element.
              */
-            PriorityTypePointer pop();
+            IdType pop();
 
             /*!
              * Print info about priority queue.
@@ -87,6 +88,13 @@ namespace storm {
 
         private:
 
+            /*!
+             * Convert the given id to IdType.
+             * @param id Id.
+             * @return Id as IdType.
+             */
+            static IdType toIdType(uint64_t id);
+
             /*!
              * Get bucket for given priority.
              * @param priority Priority.
@@ -94,28 +102,58 @@ namespace storm {
              */
             size_t getBucket(double priority) const;
 
+            /*!
+             * Insert the element in the given bucket.
+             */
+            void insert(IdType id, size_t bucket);
+
+            /*!
+             * Remove the element from the given bucket by swap-and-pop.
+             */
+            void remove(IdType id, size_t bucket);
+
+            /*!
+             * Set the current bucket to the first non-empty bucket (starting from the current one) and build the heap for it.
+             */
+            void advanceCurrentBucket();
+
+            void siftUp(size_t position);
+            void siftDown(size_t position);
+            void makeHeap();
+
+            // Heap operations on the current bucket.
+            // The comparison is a template argument such that it is inlined instead of being called indirectly.
+            template<typename Compare>
+            void siftUp(size_t position, Compare const& compare);
+
+            template<typename Compare>
+            void siftDown(size_t position, Compare const& compare);
+
+            void swapPositions(std::vector<IdType>& bucket, size_t first, size_t second);
+
             // List of buckets
-            std::vector<std::vector<PriorityTypePointer>> buckets;
+            std::vector<std::vector<IdType>> buckets;
 
             // Bucket containing all items which should be considered immediately
-            std::vector<PriorityTypePointer> immediateBucket;
+            std::vector<IdType> immediateBucket;
+
+            // Priority for each id
+            std::vector<double> priorities;
+
+            // Position of each id within its bucket
+            std::vector<IdType> positions;
 
             // Index of first bucket which contains items
             size_t currentBucket;
 
-            // Number of unsorted items in current bucket
-            size_t nrUnsortedItems;
-
-            // Comparison function for priorities
-            std::function<bool(PriorityTypePointer, PriorityTypePointer)> compare;
+            // Number of items in the queue
+            size_t nrItems;
 
             // Minimal value
             double lowerValue;
 
             bool higher;
 
-            bool AUTOSORT = false;
-
             double logBase;
 
             // Number of available buckets
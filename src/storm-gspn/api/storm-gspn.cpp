@@ -2,6 +2,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/utility/file.h"
+#include "storm-gspn/settings/modules/GSPNSettings.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
 #include "storm-conv/settings/modules/JaniExportSettings.h"
 #include "storm-conv/api/storm-conv.h"
@@ -49,6 +50,7 @@ namespace storm {
             if (exportSettings.isDisplayStatsSet()) {
                 std::cout << "============GSPN Statistics==============" << std::endl;
                 gspn.writeStatsToStream(std::cout);
+                storm::gspn::PlaceInvariants(gspn).writeStatsToStream(std::cout);
                 std::cout << "=========================================" << std::endl;
             }
 
@@ -63,10 +65,16 @@ namespace storm {
                 auto const& jani = storm::settings::getModule<storm::settings::modules::JaniExportSettings>();
                 storm::converter::JaniConversionOptions options(jani);
 
-                storm::builder::JaniGSPNBuilder builder(gspn);
+                storm::builder::JaniGSPNBuilder builder(gspn, storm::settings::getModule<storm::settings::modules::GSPNSettings>().isEliminatePlacesSet());
                 storm::jani::Model* model = builder.build("gspn_automaton");
 
                 auto properties = janiProperyGetter(builder);
+                auto eliminatedPlacesSubstitution = builder.getEliminatedPlacesSubstitution();
+                if (!eliminatedPlacesSubstitution.empty()) {
+                    for (auto& property : properties) {
+                        property = property.substitute(eliminatedPlacesSubstitution);
+                    }
+                }
                 if (exportSettings.isAddJaniPropertiesSet()) {
                     auto deadlockProperties = builder.getDeadlockProperties(model);
                     properties.insert(properties.end(), deadlockProperties.begin(), deadlockProperties.end());
@@ -5,6 +5,9 @@
 #include "storm/logic/Formulas.h"
 
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
 namespace storm {
     namespace builder {
 
@@ -29,19 +32,69 @@ namespace storm {
 
         void JaniGSPNBuilder::addVariables(storm::jani::Model* model) {
             for (auto const& place : gspn.getPlaces()) {
+                if (placeInvariants && placeInvariants->isEliminated(place.getID())) {
+                    continue;
+                }
                 storm::jani::Variable* janiVar = nullptr;
-                if (!place.hasRestrictedCapacity()) {
+                boost::optional<uint64_t> upperBound;
+                if (placeInvariants) {
+                    upperBound = placeInvariants->getUpperBound(place.getID());
+                } else if (place.hasRestrictedCapacity()) {
+                    upperBound = place.getCapacity();
+                }
+                if (!upperBound) {
                     // Effectively no capacity limit known
                     janiVar = new storm::jani::UnboundedIntegerVariable(place.getName(), expressionManager->getVariable(place.getName()), expressionManager->integer(place.getNumberOfInitialTokens()));
                 } else {
-                    assert(place.hasRestrictedCapacity());
-                    janiVar = new storm::jani::BoundedIntegerVariable(place.getName(), expressionManager->getVariable(place.getName()), expressionManager->integer(place.getNumberOfInitialTokens()), expressionManager->integer(0), expressionManager->integer(place.getCapacity()));
+                    // The bound is the capacity or the (possibly tighter) bound derived from the place invariants.
+                    janiVar = new storm::jani::BoundedIntegerVariable(place.getName(), expressionManager->getVariable(place.getName()), expressionManager->integer(place.getNumberOfInitialTokens()), expressionManager->integer(0), expressionManager->integer(upperBound.get()));
                 }
                 assert(janiVar != nullptr);
                 assert(vars.count(place.getID()) == 0);
                 vars[place.getID()] = &model->addVariable(*janiVar);
+                placeExpressions[place.getID()] = vars[place.getID()]->getExpressionVariable().getExpression();
                 delete janiVar;
             }
+
+            // Express the eliminated places over the remaining ones.
+            for (auto const& place : gspn.getPlaces()) {
+                if (vars.count(place.getID()) == 0) {
+                    auto const& representation = placeInvariants->getEliminatedPlaceRepresentation(place.getID());
+                    storm::expressions::Expression placeExpression = expressionManager->integer(representation.first);
+                    for (auto const& placeWeight : representation.second) {
+                        placeExpression = placeExpression + expressionManager->integer(placeWeight.second) * placeExpressions.at(placeWeight.first);
+                    }
+                    placeExpressions[place.getID()] = placeExpression.simplify();
+                }
+            }
+            STORM_LOG_INFO_COND(!placeInvariants, "Eliminated " << (gspn.getNumberOfPlaces() - vars.size()) << " of " << gspn.getNumberOfPlaces() << " places using place invariants.");
+        }
+
+        storm::jani::Variable const& JaniGSPNBuilder::getPlaceVariable(uint64_t placeId) const {
+            auto it = vars.find(placeId);
+            STORM_LOG_THROW(it != vars.end(), storm::exceptions::InvalidArgumentException, "No variable for place with id " << placeId << ". The place might have been eliminated.");
+            return *it->second;
+        }
+
+        storm::expressions::Expression const& JaniGSPNBuilder::getPlaceExpression(uint64_t placeId) const {
+            auto it = placeExpressions.find(placeId);
+            STORM_LOG_THROW(it != placeExpressions.end(), storm::exceptions::InvalidArgumentException, "No place with id " << placeId << ".");
+            return it->second;
+        }
+
+        std::map<storm::expressions::Variable, storm::expressions::Expression> JaniGSPNBuilder::getEliminatedPlacesSubstitution() const {
+            std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+            for (auto const& place : gspn.getPlaces()) {
+                if (vars.count(place.getID()) == 0 && placeExpressions.count(place.getID()) > 0) {
+                    substitution.emplace(expressionManager->getVariable(place.getName()), placeExpressions.at(place.getID()));
+                }
+            }
+            return substitution;
+        }
+
+        storm::gspn::PlaceInvariants const& JaniGSPNBuilder::getPlaceInvariants() const {
+            STORM_LOG_THROW(placeInvariants, storm::exceptions::InvalidOperationException, "The place invariants are only computed if places are eliminated.");
+            return placeInvariants.get();
         }
 
         uint64_t JaniGSPNBuilder::addLocation(storm::jani::Automaton& automaton) {
@@ -76,10 +129,10 @@ namespace storm {
                     }
                     storm::expressions::Expression destguard = expressionManager->boolean(true);
                     for (auto const& inPlaceEntry : trans.getInputPlaces()) {
-                        destguard = destguard && (vars[inPlaceEntry.first]->getExpressionVariable() >= inPlaceEntry.second);
+                        destguard = destguard && (placeExpressions.at(inPlaceEntry.first) >= inPlaceEntry.second);
                     }
                     for (auto const& inhibPlaceEntry : trans.getInhibitionPlaces()) {
-                        destguard = destguard && (vars[inhibPlaceEntry.first]->getExpressionVariable() < inhibPlaceEntry.second);
+                        destguard = destguard && (placeExpressions.at(inhibPlaceEntry.first) < inhibPlaceEntry.second);
                     }
                     totalWeight = totalWeight + storm::expressions::ite(destguard, expressionManager->rational(trans.getWeight()), expressionManager->rational(0.0));
 
@@ -99,15 +152,18 @@ namespace storm {
                     storm::expressions::Expression destguard = expressionManager->boolean(true);
                     std::vector<storm::jani::Assignment> assignments;
                     for (auto const& inPlaceEntry : trans.getInputPlaces()) {
-                        destguard = destguard && (vars[inPlaceEntry.first]->getExpressionVariable() >= inPlaceEntry.second);
-                        if (trans.getOutputPlaces().count(inPlaceEntry.first) == 0) {
+                        destguard = destguard && (placeExpressions.at(inPlaceEntry.first) >= inPlaceEntry.second);
+                        if (trans.getOutputPlaces().count(inPlaceEntry.first) == 0 && vars.count(inPlaceEntry.first) > 0) {
                             assignments.emplace_back(storm::jani::LValue(*vars[inPlaceEntry.first]), (vars[inPlaceEntry.first])->getExpressionVariable() - inPlaceEntry.second);
                         }
                     }
                     for (auto const& inhibPlaceEntry : trans.getInhibitionPlaces()) {
-                        destguard = destguard && (vars[inhibPlaceEntry.first]->getExpressionVariable() < inhibPlaceEntry.second);
+                        destguard = destguard && (placeExpressions.at(inhibPlaceEntry.first) < inhibPlaceEntry.second);
                     }
                     for (auto const& outputPlaceEntry : trans.getOutputPlaces()) {
+                        if (vars.count(outputPlaceEntry.first) == 0) {
+                            continue;
+                        }
                         if (trans.getInputPlaces().count(outputPlaceEntry.first) == 0) {
                             assignments.emplace_back(storm::jani::LValue(*vars[outputPlaceEntry.first]), (vars[outputPlaceEntry.first])->getExpressionVariable() + outputPlaceEntry.second );
                         } else {
@@ -142,15 +198,18 @@ namespace storm {
                 
                 std::vector<storm::jani::Assignment> assignments;
                 for (auto const& inPlaceEntry : trans.getInputPlaces()) {
-                    guard = guard && (vars[inPlaceEntry.first]->getExpressionVariable() >= inPlaceEntry.second);
-                    if (trans.getOutputPlaces().count(inPlaceEntry.first) == 0) {
+                    guard = guard && (placeExpressions.at(inPlaceEntry.first) >= inPlaceEntry.second);
+                    if (trans.getOutputPlaces().count(inPlaceEntry.first) == 0 && vars.count(inPlaceEntry.first) > 0) {
                         assignments.emplace_back(storm::jani::LValue(*vars[inPlaceEntry.first]), (vars[inPlaceEntry.first])->getExpressionVariable() - inPlaceEntry.second);
                     }
                 }
                 for (auto const& inhibPlaceEntry : trans.getInhibitionPlaces()) {
-                    guard = guard && (vars[inhibPlaceEntry.first]->getExpressionVariable() < inhibPlaceEntry.second);
+                    guard = guard && (placeExpressions.at(inhibPlaceEntry.first) < inhibPlaceEntry.second);
                 }
                 for (auto const& outputPlaceEntry : trans.getOutputPlaces()) {
+                    if (vars.count(outputPlaceEntry.first) == 0) {
+                        continue;
+                    }
                     if (trans.getInputPlaces().count(outputPlaceEntry.first) == 0) {
                         assignments.emplace_back(storm::jani::LValue(*vars[outputPlaceEntry.first]), (vars[outputPlaceEntry.first])->getExpressionVariable() + outputPlaceEntry.second );
                     } else {
@@ -171,7 +230,7 @@ namespace storm {
                         firstArgumentOfMinExpression = false;
                     }
                     for (auto const& inPlaceEntry : trans.getInputPlaces()) {
-                        storm::expressions::Expression enablingDegreeInPlace = vars[inPlaceEntry.first]->getExpressionVariable() / expressionManager->integer(inPlaceEntry.second); // Integer division!
+                        storm::expressions::Expression enablingDegreeInPlace = placeExpressions.at(inPlaceEntry.first) / expressionManager->integer(inPlaceEntry.second); // Integer division!
                         if (firstArgumentOfMinExpression == true) {
                             enablingDegree = enablingDegreeInPlace;
                         } else {
@@ -208,7 +267,7 @@ namespace storm {
                 bool firstPlace = true;
                 if (!ignoreEmptyPlaces) {
                     for (auto const& placeIdMult : transition->getInputPlaces()) {
-                        storm::expressions::Expression placeBlocksTransition = (vars.at(placeIdMult.first)->getExpressionVariable() < expressionManager->integer(placeIdMult.second));
+                        storm::expressions::Expression placeBlocksTransition = (placeExpressions.at(placeIdMult.first) < expressionManager->integer(placeIdMult.second));
                         if (firstPlace) {
                             transitionDisabled = placeBlocksTransition;
                             firstPlace = false;
@@ -219,7 +278,7 @@ namespace storm {
                 }
                 if (!ignoreInhibitorArcs) {
                     for (auto const& placeIdMult : transition->getInhibitionPlaces()) {
-                        storm::expressions::Expression placeBlocksTransition = (vars.at(placeIdMult.first)->getExpressionVariable() >= expressionManager->integer(placeIdMult.second));
+                        storm::expressions::Expression placeBlocksTransition = (placeExpressions.at(placeIdMult.first) >= expressionManager->integer(placeIdMult.second));
                         if (firstPlace) {
                             transitionDisabled = placeBlocksTransition;
                             firstPlace = false;
@@ -232,7 +291,7 @@ namespace storm {
                     for (auto const& placeIdMult : transition->getOutputPlaces()) {
                         auto const& place = gspn.getPlace(placeIdMult.first);
                         if (place->hasRestrictedCapacity()) {
-                            storm::expressions::Expression placeBlocksTransition = (vars.at(placeIdMult.first)->getExpressionVariable() + expressionManager->integer(placeIdMult.second) > expressionManager->integer(place->getCapacity()));
+                            storm::expressions::Expression placeBlocksTransition = (placeExpressions.at(placeIdMult.first) + expressionManager->integer(placeIdMult.second) > expressionManager->integer(place->getCapacity()));
                             if (firstPlace) {
                                 transitionDisabled = placeBlocksTransition;
                                 firstPlace = false;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm-gspn/storage/gspn/PlaceInvariants.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -9,9 +10,19 @@ namespace storm {
     namespace builder {
         class JaniGSPNBuilder {
         public:
-            JaniGSPNBuilder(storm::gspn::GSPN const& gspn)
+            /*!
+             * Creates a builder for the given GSPN.
+             *
+             * @param eliminatePlaces If set, the place invariants of the GSPN are computed. No variables are created
+             * for places whose number of tokens is determined by the other places. Instead, such places are replaced by
+             * the corresponding linear expression. Moreover, the bounds of the remaining place variables are tightened
+             * using the invariants. Otherwise, the bounds are given by the capacities of the places.
+             */
+            JaniGSPNBuilder(storm::gspn::GSPN const& gspn, bool eliminatePlaces = false)
                     : gspn(gspn), expressionManager(gspn.getExpressionManager()) {
-
+                if (eliminatePlaces) {
+                    placeInvariants = storm::gspn::PlaceInvariants(gspn);
+                }
             }
 
             virtual ~JaniGSPNBuilder() {
@@ -20,9 +31,26 @@ namespace storm {
 
             storm::jani::Model* build(std::string const& automatonName = "gspn_automaton");
 
-            storm::jani::Variable const& getPlaceVariable(uint64_t placeId) const {
-                return *vars.at(placeId);
-            }
+            /*!
+             * Retrieves the variable of the given place. The place must not be eliminated.
+             */
+            storm::jani::Variable const& getPlaceVariable(uint64_t placeId) const;
+
+            /*!
+             * Retrieves the expression describing the number of tokens at the given place.
+             */
+            storm::expressions::Expression const& getPlaceExpression(uint64_t placeId) const;
+
+            /*!
+             * Retrieves a substitution that replaces the variables of eliminated places by their expressions. This
+             * substitution has to be applied to properties that refer to places.
+             */
+            std::map<storm::expressions::Variable, storm::expressions::Expression> getEliminatedPlacesSubstitution() const;
+
+            /*!
+             * Retrieves the place invariants of the GSPN. They are only computed if places are eliminated.
+             */
+            storm::gspn::PlaceInvariants const& getPlaceInvariants() const;
 
             /*!
              * Get standard properties (reachability, time bounded reachability, expected time) for a given atomic formula.
@@ -51,7 +79,9 @@ namespace storm {
             const uint64_t janiVersion = 1;
             storm::gspn::GSPN const& gspn;
             std::map<uint64_t, storm::jani::Variable const*> vars;
+            std::map<uint64_t, storm::expressions::Expression> placeExpressions;
             std::shared_ptr<storm::expressions::ExpressionManager> expressionManager;
+            boost::optional<storm::gspn::PlaceInvariants> placeInvariants;
         };
     }
 }
@@ -21,6 +21,7 @@ namespace storm {
             const std::string GSPNSettings::capacityOptionName = "capacity";
             const std::string GSPNSettings::constantsOptionName = "constants";
             const std::string GSPNSettings::constantsOptionShortName = "const";
+            const std::string GSPNSettings::eliminatePlacesOptionName = "eliminateplaces";
 
             
             
@@ -29,6 +30,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, capacitiesFileOptionName, false, "Capacaties as invariants for places.").setShortName(capacitiesFileOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "path to file").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, capacityOptionName, false, "Global capacity as invariants for all places.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "capacity").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, constantsOptionName, false, "Specifies the constant replacements to use.").setShortName(constantsOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of constants and their value, e.g. a=1,b=2,c=3.").setDefaultValueString("").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, eliminatePlacesOptionName, false, "Eliminates places whose number of tokens is determined by place invariants when translating to JANI. The invariants also bound the remaining places.").setIsAdvanced().build());
             }
             
             bool GSPNSettings::isGspnFileSet() const {
@@ -63,6 +65,10 @@ namespace storm {
                 return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
             }
             
+            bool GSPNSettings::isEliminatePlacesSet() const {
+                return this->getOption(eliminatePlacesOptionName).getHasOptionBeenSet();
+            }
+
             void GSPNSettings::finalize() {
                 
             }
@@ -54,6 +54,10 @@ namespace storm {
                  */
                 std::string getConstantDefinitionString() const;
 
+                /*!
+                 * Retrieves whether places that are determined by the place invariants are eliminated in the JANI translation.
+                 */
+                bool isEliminatePlacesSet() const;
                 
                 bool check() const override;
                 void finalize() override;
@@ -68,6 +72,7 @@ namespace storm {
                 static const std::string capacityOptionName;
                 static const std::string constantsOptionName;
                 static const std::string constantsOptionShortName;
+                static const std::string eliminatePlacesOptionName;
             };
         }
     }
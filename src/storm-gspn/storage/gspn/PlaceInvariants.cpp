@@ -0,0 +1,321 @@
+#include "storm-gspn/storage/gspn/PlaceInvariants.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "storm/storage/BitVector.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace gspn {
+
+        namespace {
+            // Coefficients are kept below this value such that combining two rows can not overflow.
+            int64_t const maxCoefficient = 1ll << 30;
+
+            int64_t gcd(int64_t a, int64_t b) {
+                a = std::abs(a);
+                b = std::abs(b);
+                while (b != 0) {
+                    int64_t t = a % b;
+                    a = b;
+                    b = t;
+                }
+                return a;
+            }
+
+            /*!
+             * Divides the row by the gcd of its entries.
+             *
+             * @return False iff an entry of the normalized row exceeds the maximal coefficient.
+             */
+            bool normalize(std::vector<int64_t>& row) {
+                int64_t divisor = 0;
+                for (auto const& entry : row) {
+                    divisor = gcd(divisor, entry);
+                }
+                if (divisor > 1) {
+                    for (auto& entry : row) {
+                        entry /= divisor;
+                    }
+                }
+                return std::all_of(row.begin(), row.end(), [] (int64_t const& entry) { return std::abs(entry) < maxCoefficient; });
+            }
+
+            /*!
+             * Sets target to factor1 * target + factor2 * other and normalizes the result.
+             */
+            bool combine(std::vector<int64_t>& target, int64_t factor1, std::vector<int64_t> const& other, int64_t factor2) {
+                for (uint64_t i = 0; i < target.size(); ++i) {
+                    target[i] = factor1 * target[i] + factor2 * other[i];
+                }
+                return normalize(target);
+            }
+
+            int64_t weightedTokenSum(std::vector<int64_t> const& invariant, std::vector<uint64_t> const& tokens) {
+                int64_t result = 0;
+                for (uint64_t place = 0; place < invariant.size(); ++place) {
+                    result += invariant[place] * static_cast<int64_t>(tokens[place]);
+                }
+                return result;
+            }
+        }
+
+        PlaceInvariants::PlaceInvariants(GSPN const& gspn, uint64_t maxNumberOfSemiPositiveInvariants) : numberOfPlaces(gspn.getNumberOfPlaces()) {
+            // Build the incidence matrix with one row per place and one column per transition.
+            std::vector<storm::gspn::Transition const*> transitions;
+            for (auto const& transition : gspn.getImmediateTransitions()) {
+                transitions.push_back(&transition);
+            }
+            for (auto const& transition : gspn.getTimedTransitions()) {
+                transitions.push_back(&transition);
+            }
+            std::vector<std::vector<int64_t>> incidence(numberOfPlaces, std::vector<int64_t>(transitions.size(), 0));
+            for (uint64_t transitionIndex = 0; transitionIndex < transitions.size(); ++transitionIndex) {
+                for (auto const& placeMultiplicity : transitions[transitionIndex]->getInputPlaces()) {
+                    incidence[placeMultiplicity.first][transitionIndex] -= placeMultiplicity.second;
+                }
+                for (auto const& placeMultiplicity : transitions[transitionIndex]->getOutputPlaces()) {
+                    incidence[placeMultiplicity.first][transitionIndex] += placeMultiplicity.second;
+                }
+            }
+
+            initialTokens.reserve(numberOfPlaces);
+            for (auto const& place : gspn.getPlaces()) {
+                STORM_LOG_ASSERT(place.getID() == initialTokens.size(), "Unexpected place id.");
+                initialTokens.push_back(place.getNumberOfInitialTokens());
+            }
+
+            computeInvariants(incidence);
+            computeSemiPositiveInvariants(incidence, maxNumberOfSemiPositiveInvariants);
+            computeUpperBounds(gspn);
+            computeEliminatedPlaces(gspn);
+        }
+
+        void PlaceInvariants::computeInvariants(std::vector<std::vector<int64_t>> const& incidence) {
+            // Fraction-free Gaussian elimination on [C | I]. The identity parts of the rows whose incidence part
+            // becomes zero form a basis of the invariants.
+            uint64_t numberOfTransitions = incidence.empty() ? 0 : incidence.front().size();
+            std::vector<std::vector<int64_t>> rows;
+            for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+                std::vector<int64_t> row(incidence[place]);
+                row.resize(numberOfTransitions + numberOfPlaces, 0);
+                row[numberOfTransitions + place] = 1;
+                rows.push_back(std::move(row));
+            }
+
+            for (uint64_t column = 0; column < numberOfTransitions; ++column) {
+                auto pivotIt = std::find_if(rows.begin(), rows.end(), [&column] (std::vector<int64_t> const& row) { return row[column] != 0; });
+                if (pivotIt == rows.end()) {
+                    continue;
+                }
+                std::vector<int64_t> pivot = std::move(*pivotIt);
+                rows.erase(pivotIt);
+
+                std::vector<std::vector<int64_t>> newRows;
+                for (auto& row : rows) {
+                    // Rows that would overflow are dropped, which only loses some invariants.
+                    if (row[column] == 0 || combine(row, pivot[column], pivot, -row[column])) {
+                        newRows.push_back(std::move(row));
+                    }
+                }
+                rows = std::move(newRows);
+            }
+
+            for (auto const& row : rows) {
+                invariants.emplace_back(row.begin() + numberOfTransitions, row.end());
+            }
+        }
+
+        void PlaceInvariants::computeSemiPositiveInvariants(std::vector<std::vector<int64_t>> const& incidence, uint64_t maxNumberOfSemiPositiveInvariants) {
+            // The Farkas algorithm: eliminate one transition after the other by combining rows with entries of opposite
+            // signs. Only rows with a minimal support are kept.
+            uint64_t numberOfTransitions = incidence.empty() ? 0 : incidence.front().size();
+            std::vector<std::vector<int64_t>> rows;
+            for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+                std::vector<int64_t> row(incidence[place]);
+                row.resize(numberOfTransitions + numberOfPlaces, 0);
+                row[numberOfTransitions + place] = 1;
+                rows.push_back(std::move(row));
+            }
+
+            bool limitReached = false;
+            for (uint64_t column = 0; column < numberOfTransitions; ++column) {
+                std::vector<std::vector<int64_t>> newRows;
+                std::vector<uint64_t> positiveRows, negativeRows;
+                for (uint64_t rowIndex = 0; rowIndex < rows.size(); ++rowIndex) {
+                    if (rows[rowIndex][column] == 0) {
+                        newRows.push_back(std::move(rows[rowIndex]));
+                    } else if (rows[rowIndex][column] > 0) {
+                        positiveRows.push_back(rowIndex);
+                    } else {
+                        negativeRows.push_back(rowIndex);
+                    }
+                }
+                for (auto const& positiveRow : positiveRows) {
+                    for (auto const& negativeRow : negativeRows) {
+                        if (newRows.size() >= maxNumberOfSemiPositiveInvariants) {
+                            limitReached = true;
+                            break;
+                        }
+                        std::vector<int64_t> newRow = rows[positiveRow];
+                        if (combine(newRow, -rows[negativeRow][column], rows[negativeRow], rows[positiveRow][column])) {
+                            newRows.push_back(std::move(newRow));
+                        }
+                    }
+                }
+
+                // Remove rows whose support (over the places) is not minimal.
+                std::vector<storm::storage::BitVector> supports;
+                for (auto const& row : newRows) {
+                    storm::storage::BitVector support(numberOfPlaces);
+                    for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+                        support.set(place, row[numberOfTransitions + place] != 0);
+                    }
+                    supports.push_back(std::move(support));
+                }
+                std::vector<uint64_t> order(newRows.size());
+                for (uint64_t index = 0; index < order.size(); ++index) {
+                    order[index] = index;
+                }
+                std::stable_sort(order.begin(), order.end(), [&supports] (uint64_t const& first, uint64_t const& second) { return supports[first].getNumberOfSetBits() < supports[second].getNumberOfSetBits(); });
+                rows.clear();
+                std::vector<uint64_t> keptRows;
+                for (auto const& index : order) {
+                    bool isMinimal = std::none_of(keptRows.begin(), keptRows.end(), [&] (uint64_t const& keptRow) { return supports[keptRow].isSubsetOf(supports[index]); });
+                    if (isMinimal) {
+                        keptRows.push_back(index);
+                        rows.push_back(std::move(newRows[index]));
+                    }
+                }
+            }
+            STORM_LOG_WARN_COND(!limitReached, "Reached the limit of " << maxNumberOfSemiPositiveInvariants << " semi-positive place invariants. Some place bounds might not be found.");
+
+            for (auto const& row : rows) {
+                semiPositiveInvariants.emplace_back(row.begin() + numberOfTransitions, row.end());
+            }
+        }
+
+        void PlaceInvariants::computeUpperBounds(GSPN const& gspn) {
+            upperBounds.assign(numberOfPlaces, boost::none);
+            for (auto const& invariant : semiPositiveInvariants) {
+                int64_t weightedInitialTokens = weightedTokenSum(invariant, initialTokens);
+                for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+                    if (invariant[place] > 0) {
+                        uint64_t bound = weightedInitialTokens / invariant[place];
+                        if (!upperBounds[place] || bound < upperBounds[place].get()) {
+                            upperBounds[place] = bound;
+                        }
+                    }
+                }
+            }
+
+            restrictedByCapacity.assign(numberOfPlaces, false);
+            for (auto const& place : gspn.getPlaces()) {
+                if (place.hasRestrictedCapacity() && (!upperBounds[place.getID()] || place.getCapacity() < upperBounds[place.getID()].get())) {
+                    restrictedByCapacity[place.getID()] = true;
+                    upperBounds[place.getID()] = place.getCapacity();
+                }
+            }
+        }
+
+        void PlaceInvariants::computeEliminatedPlaces(GSPN const& gspn) {
+            // Bring the invariants into reduced row echelon form such that every row has a pivot place that does not
+            // occur in any other row. Pivots are only chosen among places that can be eliminated.
+            std::vector<std::vector<int64_t>> rows = invariants;
+            std::vector<boost::optional<uint64_t>> pivots(rows.size(), boost::none);
+            for (uint64_t rowIndex = 0; rowIndex < rows.size(); ++rowIndex) {
+                if (rows[rowIndex].empty()) {
+                    continue;
+                }
+                boost::optional<uint64_t> pivot;
+                for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+                    if (rows[rowIndex][place] != 0 && !restrictedByCapacity[place]) {
+                        if (!pivot || (std::abs(rows[rowIndex][place]) == 1 && std::abs(rows[rowIndex][pivot.get()]) != 1)) {
+                            pivot = place;
+                        }
+                    }
+                }
+                if (!pivot) {
+                    continue;
+                }
+                pivots[rowIndex] = pivot;
+                for (uint64_t otherRowIndex = 0; otherRowIndex < rows.size(); ++otherRowIndex) {
+                    if (otherRowIndex != rowIndex && !rows[otherRowIndex].empty() && rows[otherRowIndex][pivot.get()] != 0) {
+                        if (!combine(rows[otherRowIndex], rows[rowIndex][pivot.get()], rows[rowIndex], -rows[otherRowIndex][pivot.get()])) {
+                            // Drop the row as its coefficients become too large.
+                            rows[otherRowIndex].clear();
+                            pivots[otherRowIndex] = boost::none;
+                        }
+                    }
+                }
+            }
+
+            // A pivot place with coefficient +-1 is determined by the non-pivot places of its row.
+            for (uint64_t rowIndex = 0; rowIndex < rows.size(); ++rowIndex) {
+                if (!pivots[rowIndex] || std::abs(rows[rowIndex][pivots[rowIndex].get()]) != 1) {
+                    continue;
+                }
+                uint64_t pivot = pivots[rowIndex].get();
+                int64_t sign = rows[rowIndex][pivot];
+                std::map<uint64_t, int64_t> weights;
+                for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+                    if (place != pivot && rows[rowIndex][place] != 0) {
+                        weights[place] = -sign * rows[rowIndex][place];
+                    }
+                }
+                eliminatedPlaces[pivot] = std::make_pair(sign * weightedTokenSum(rows[rowIndex], initialTokens), std::move(weights));
+            }
+            STORM_LOG_INFO("Place invariants of GSPN " << gspn.getName() << " determine " << eliminatedPlaces.size() << " of " << numberOfPlaces << " places.");
+        }
+
+        std::vector<std::vector<int64_t>> const& PlaceInvariants::getInvariants() const {
+            return invariants;
+        }
+
+        std::vector<std::vector<int64_t>> const& PlaceInvariants::getSemiPositiveInvariants() const {
+            return semiPositiveInvariants;
+        }
+
+        boost::optional<uint64_t> PlaceInvariants::getUpperBound(uint64_t placeId) const {
+            STORM_LOG_THROW(placeId < numberOfPlaces, storm::exceptions::InvalidArgumentException, "No place with id " << placeId << ".");
+            return upperBounds[placeId];
+        }
+
+        bool PlaceInvariants::isEliminated(uint64_t placeId) const {
+            return eliminatedPlaces.count(placeId) > 0;
+        }
+
+        std::pair<int64_t, std::map<uint64_t, int64_t>> const& PlaceInvariants::getEliminatedPlaceRepresentation(uint64_t placeId) const {
+            auto it = eliminatedPlaces.find(placeId);
+            STORM_LOG_THROW(it != eliminatedPlaces.end(), storm::exceptions::InvalidArgumentException, "Place with id " << placeId << " is not eliminated.");
+            return it->second;
+        }
+
+        uint64_t PlaceInvariants::getNumberOfEliminatedPlaces() const {
+            return eliminatedPlaces.size();
+        }
+
+        bool PlaceInvariants::satisfiesInvariants(Marking const& marking) const {
+            STORM_LOG_THROW(marking.getNumberOfPlaces() == numberOfPlaces, storm::exceptions::InvalidArgumentException, "The marking does not match the number of places.");
+            std::vector<uint64_t> tokens;
+            tokens.reserve(numberOfPlaces);
+            for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+                tokens.push_back(marking.getNumberOfTokensAt(place));
+                if (upperBounds[place] && tokens.back() > upperBounds[place].get()) {
+                    return false;
+                }
+            }
+            return std::all_of(invariants.begin(), invariants.end(), [&] (std::vector<int64_t> const& invariant) { return weightedTokenSum(invariant, tokens) == weightedTokenSum(invariant, initialTokens); });
+        }
+
+        void PlaceInvariants::writeStatsToStream(std::ostream& stream) const {
+            uint64_t boundedPlaces = std::count_if(upperBounds.begin(), upperBounds.end(), [] (boost::optional<uint64_t> const& bound) { return static_cast<bool>(bound); });
+            stream << "Place invariants:   \t" << invariants.size() << std::endl;
+            stream << "Semi-positive inv.: \t" << semiPositiveInvariants.size() << std::endl;
+            stream << "Bounded places:     \t" << boundedPlaces << std::endl;
+            stream << "Eliminated places:  \t" << eliminatedPlaces.size() << std::endl;
+        }
+    }
+}
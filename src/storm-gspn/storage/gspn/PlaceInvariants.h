@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm-gspn/storage/gspn/Marking.h"
+
+namespace storm {
+    namespace gspn {
+
+        /*!
+         * Computes place invariants (P-invariants) of a GSPN, i.e., weight vectors y over the places such that the
+         * weighted sum of tokens y*m is the same in every reachable marking m. These are the solutions of y^T * C = 0
+         * where C is the incidence matrix of the net (output minus input multiplicities). Inhibitor arcs and capacities
+         * only restrict the firing of transitions and thus do not affect the invariants.
+         *
+         * The invariants are used to
+         *  - derive upper bounds on the number of tokens of a place from semi-positive invariants (y >= 0),
+         *  - identify places whose number of tokens is determined by the remaining places and
+         *  - cheaply check whether a marking is consistent with the initial marking.
+         */
+        class PlaceInvariants {
+        public:
+            /*!
+             * Computes the invariants of the given GSPN.
+             *
+             * @param gspn The GSPN.
+             * @param maxNumberOfSemiPositiveInvariants The maximal number of (intermediate) semi-positive invariants
+             * that are considered in the Farkas algorithm. Exceeding candidates are dropped which only weakens the
+             * derived bounds.
+             */
+            PlaceInvariants(GSPN const& gspn, uint64_t maxNumberOfSemiPositiveInvariants = 10000);
+
+            /*!
+             * Retrieves a basis of the invariants. Every vector contains one weight per place.
+             */
+            std::vector<std::vector<int64_t>> const& getInvariants() const;
+
+            /*!
+             * Retrieves the minimal-support semi-positive invariants that were found.
+             */
+            std::vector<std::vector<int64_t>> const& getSemiPositiveInvariants() const;
+
+            /*!
+             * Retrieves the upper bound on the number of tokens at the given place. The bound takes both the
+             * semi-positive invariants and the capacity of the place into account.
+             *
+             * @return The bound or none if the place is not covered by a semi-positive invariant and has no capacity.
+             */
+            boost::optional<uint64_t> getUpperBound(uint64_t placeId) const;
+
+            /*!
+             * Retrieves whether the number of tokens at the given place is determined by the other places, i.e., by
+             * the places that are not eliminated. Places whose capacity is smaller than the bound derived from the
+             * invariants are never eliminated, as their capacity restricts the net.
+             */
+            bool isEliminated(uint64_t placeId) const;
+
+            /*!
+             * Retrieves the representation of an eliminated place: the number of tokens at the place is the sum of
+             * the returned constant and the weighted number of tokens at the places in the returned map. Only places
+             * that are not eliminated occur in the map.
+             */
+            std::pair<int64_t, std::map<uint64_t, int64_t>> const& getEliminatedPlaceRepresentation(uint64_t placeId) const;
+
+            uint64_t getNumberOfEliminatedPlaces() const;
+
+            /*!
+             * Checks whether the given marking satisfies all invariants and bounds. Every reachable marking does.
+             */
+            bool satisfiesInvariants(Marking const& marking) const;
+
+            void writeStatsToStream(std::ostream& stream) const;
+
+        private:
+            void computeInvariants(std::vector<std::vector<int64_t>> const& incidence);
+            void computeSemiPositiveInvariants(std::vector<std::vector<int64_t>> const& incidence, uint64_t maxNumberOfSemiPositiveInvariants);
+            void computeUpperBounds(GSPN const& gspn);
+            void computeEliminatedPlaces(GSPN const& gspn);
+
+            uint64_t numberOfPlaces;
+            std::vector<uint64_t> initialTokens;
+
+            std::vector<std::vector<int64_t>> invariants;
+            std::vector<std::vector<int64_t>> semiPositiveInvariants;
+            std::vector<boost::optional<uint64_t>> upperBounds;
+            // Whether the capacity of a place is smaller than the bound derived from the invariants.
+            std::vector<bool> restrictedByCapacity;
+            std::map<uint64_t, std::pair<int64_t, std::map<uint64_t, int64_t>>> eliminatedPlaces;
+        };
+    }
+}
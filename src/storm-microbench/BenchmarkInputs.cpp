@@ -0,0 +1,138 @@
+#include "storm-microbench/BenchmarkInputs.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "storm/api/builder.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm-parsers/api/model_descriptions.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace microbench {
+
+        BenchmarkInputOptions& getInputOptions() {
+            static BenchmarkInputOptions options;
+            return options;
+        }
+
+        storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t stateCount, uint64_t choicesPerState, uint64_t entriesPerRow, uint64_t seed) {
+            STORM_LOG_THROW(stateCount > 0 && choicesPerState > 0 && entriesPerRow > 0, storm::exceptions::InvalidArgumentException, "Random matrices need at least one state, choice and entry per row.");
+            std::mt19937_64 generator(seed);
+
+            // Most successors are close to the state (within a window), some are chosen uniformly.
+            uint64_t const window = 64;
+            std::uniform_int_distribution<uint64_t> globalDistribution(0, stateCount - 1);
+            std::uniform_int_distribution<uint64_t> localDistribution(0, 2 * window);
+            std::bernoulli_distribution isLocalDistribution(0.9);
+
+            bool nondeterministic = choicesPerState > 1;
+            storm::storage::SparseMatrixBuilder<double> builder(stateCount * choicesPerState, stateCount, stateCount * choicesPerState * entriesPerRow, true, nondeterministic, nondeterministic ? stateCount : 0);
+            std::vector<uint64_t> columns;
+            columns.reserve(entriesPerRow);
+            uint64_t row = 0;
+            for (uint64_t state = 0; state < stateCount; ++state) {
+                if (nondeterministic) {
+                    builder.newRowGroup(row);
+                }
+                for (uint64_t choice = 0; choice < choicesPerState; ++choice, ++row) {
+                    columns.clear();
+                    for (uint64_t entry = 0; entry < entriesPerRow; ++entry) {
+                        if (isLocalDistribution(generator)) {
+                            uint64_t offset = localDistribution(generator);
+                            columns.push_back(std::min(stateCount - 1, state + offset >= window ? state + offset - window : 0));
+                        } else {
+                            columns.push_back(globalDistribution(generator));
+                        }
+                    }
+                    std::sort(columns.begin(), columns.end());
+                    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+                    double probability = 1.0 / columns.size();
+                    for (auto const& column : columns) {
+                        builder.addNextValue(row, column, probability);
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        storm::storage::BitVector createRandomBitVector(uint64_t size, double density, uint64_t seed) {
+            std::mt19937_64 generator(seed);
+            std::bernoulli_distribution isSetDistribution(density);
+            storm::storage::BitVector result(size);
+            for (uint64_t index = 0; index < size; ++index) {
+                if (isSetDistribution(generator)) {
+                    result.set(index);
+                }
+            }
+            return result;
+        }
+
+        static storm::storage::BitVector getEvery64thState(uint64_t stateCount) {
+            storm::storage::BitVector result(stateCount);
+            for (uint64_t state = 0; state < stateCount; state += 64) {
+                result.set(state);
+            }
+            return result;
+        }
+
+        MatrixInput const& getRandomInput(uint64_t stateCount, bool nondeterministic) {
+            static std::map<std::pair<uint64_t, bool>, MatrixInput> inputs;
+            auto inputIt = inputs.find(std::make_pair(stateCount, nondeterministic));
+            if (inputIt == inputs.end()) {
+                BenchmarkInputOptions const& options = getInputOptions();
+                MatrixInput input;
+                input.matrix = createRandomMatrix(stateCount, nondeterministic ? options.choicesPerState : 1, options.entriesPerRow);
+                input.targetStates = getEvery64thState(stateCount);
+                inputIt = inputs.emplace(std::make_pair(stateCount, nondeterministic), std::move(input)).first;
+            }
+            return inputIt->second;
+        }
+
+        MatrixInput const& getModelInput() {
+            static std::unique_ptr<MatrixInput> input;
+            if (!input) {
+                BenchmarkInputOptions const& options = getInputOptions();
+                STORM_LOG_THROW(!options.modelFile.empty(), storm::exceptions::InvalidArgumentException, "No model file was given.");
+                storm::storage::SymbolicModelDescription modelDescription(storm::api::parseProgram(options.modelFile));
+                modelDescription = modelDescription.preprocess(options.constants);
+                std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(modelDescription, storm::builder::BuilderOptions(false, true));
+
+                input = std::make_unique<MatrixInput>();
+                input->matrix = model->getTransitionMatrix();
+                if (options.targetLabel.empty()) {
+                    input->targetStates = getEvery64thState(model->getNumberOfStates());
+                } else {
+                    STORM_LOG_THROW(model->hasLabel(options.targetLabel), storm::exceptions::InvalidArgumentException, "The model has no label '" << options.targetLabel << "'.");
+                    input->targetStates = model->getStates(options.targetLabel);
+                }
+            }
+            return *input;
+        }
+
+        void setThroughputCounters(benchmark::State& state, uint64_t entriesPerIteration, uint64_t bytesPerIteration) {
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytesPerIteration));
+            state.counters["entries/s"] = benchmark::Counter(static_cast<double>(entriesPerIteration), benchmark::Counter::kIsIterationInvariantRate);
+            state.counters["time/entry"] = benchmark::Counter(static_cast<double>(entriesPerIteration), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+        }
+
+        void registerMatrixBenchmark(std::string const& name, void (*kernel)(benchmark::State&, MatrixInput const&), bool nondeterministic) {
+            BenchmarkInputOptions const& options = getInputOptions();
+            for (auto const& size : options.sizes) {
+                benchmark::RegisterBenchmark((name + "/random").c_str(), [kernel, nondeterministic] (benchmark::State& state) {
+                    kernel(state, getRandomInput(static_cast<uint64_t>(state.range(0)), nondeterministic));
+                })->Arg(static_cast<int64_t>(size));
+            }
+            if (!options.modelFile.empty()) {
+                benchmark::RegisterBenchmark((name + "/model").c_str(), [kernel] (benchmark::State& state) {
+                    kernel(state, getModelInput());
+                });
+            }
+        }
+
+    }
+}
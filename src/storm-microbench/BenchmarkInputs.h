@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace microbench {
+
+        /*!
+         * The options that determine the inputs of the microbenchmarks.
+         */
+        struct BenchmarkInputOptions {
+            // The numbers of states of the synthetic inputs.
+            std::vector<uint64_t> sizes = {1ull << 10, 1ull << 15, 1ull << 20};
+
+            // The number of choices per state of the synthetic nondeterministic inputs.
+            uint64_t choicesPerState = 4;
+
+            // The (maximal) number of entries per row of the synthetic inputs.
+            uint64_t entriesPerRow = 8;
+
+            // The PRISM file from which the model-derived inputs are built. If empty, no such inputs are used.
+            std::string modelFile;
+
+            // The definitions of the undefined constants of the PRISM file.
+            std::string constants;
+
+            // The label of the target states of the model (e.g. for prob01). If empty, every 64th state is a target.
+            std::string targetLabel;
+        };
+
+        /*!
+         * An input for the kernels that operate on matrices.
+         */
+        struct MatrixInput {
+            // The (transition) matrix.
+            storm::storage::SparseMatrix<double> matrix;
+
+            // Target states, i.e. a subset of the row groups of the matrix.
+            storm::storage::BitVector targetStates;
+        };
+
+        /*!
+         * Retrieves the (global) input options. They have to be set before the benchmarks are registered.
+         */
+        BenchmarkInputOptions& getInputOptions();
+
+        /*!
+         * Creates a random matrix whose columns mostly lie close to the diagonal (as is typical for matrices obtained
+         * from state space exploration). Each row is a probability distribution.
+         *
+         * @param stateCount The number of row groups (and columns).
+         * @param choicesPerState The number of rows per row group. If this is one, the matrix has the trivial row grouping.
+         * @param entriesPerRow The maximal number of entries per row (duplicate columns are merged).
+         * @param seed The seed of the random number generator.
+         */
+        storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t stateCount, uint64_t choicesPerState, uint64_t entriesPerRow, uint64_t seed = 42);
+
+        /*!
+         * Creates a random bit vector in which every bit is set with the given probability.
+         */
+        storm::storage::BitVector createRandomBitVector(uint64_t size, double density, uint64_t seed = 42);
+
+        /*!
+         * Retrieves the synthetic input of the given size. The input is created on first use.
+         *
+         * @param stateCount The number of states.
+         * @param nondeterministic If set, every state has the configured number of choices.
+         */
+        MatrixInput const& getRandomInput(uint64_t stateCount, bool nondeterministic);
+
+        /*!
+         * Retrieves the input that is derived from the configured model. The model is built on first use.
+         */
+        MatrixInput const& getModelInput();
+
+        /*!
+         * Sets the throughput counters of the given benchmark. This yields the processed bytes per second, the
+         * processed entries per second and the time per entry (next to the time per iteration that is always reported).
+         *
+         * @param entriesPerIteration The number of entries (e.g. matrix entries or bits) processed in one iteration.
+         * @param bytesPerIteration The number of bytes that are (at least) read or written in one iteration.
+         */
+        void setThroughputCounters(benchmark::State& state, uint64_t entriesPerIteration, uint64_t bytesPerIteration);
+
+        /*!
+         * Registers a benchmark of a matrix kernel for all synthetic inputs and (if configured) the model-derived input.
+         *
+         * @param name The name of the benchmark.
+         * @param kernel The function that runs the benchmark on the given input.
+         * @param nondeterministic Whether the synthetic inputs are nondeterministic.
+         */
+        void registerMatrixBenchmark(std::string const& name, void (*kernel)(benchmark::State&, MatrixInput const&), bool nondeterministic);
+
+        void registerSparseMatrixBenchmarks();
+        void registerBitVectorBenchmarks();
+        void registerGraphBenchmarks();
+        void registerParserBenchmarks();
+
+    }
+}
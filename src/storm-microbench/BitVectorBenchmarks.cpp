@@ -0,0 +1,88 @@
+#include "storm-microbench/BenchmarkInputs.h"
+
+#include <random>
+
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+    namespace microbench {
+
+        // The number of bytes of a bit vector with the given number of bits.
+        static uint64_t getBitVectorBytes(uint64_t size) {
+            return ((size + 63) / 64) * sizeof(uint64_t);
+        }
+
+        static void binaryOperations(benchmark::State& state) {
+            uint64_t size = static_cast<uint64_t>(state.range(0));
+            storm::storage::BitVector first = createRandomBitVector(size, 0.5, 1);
+            storm::storage::BitVector second = createRandomBitVector(size, 0.5, 2);
+            for (auto _ : state) {
+                storm::storage::BitVector result = (first & second) | ~first;
+                benchmark::DoNotOptimize(result.getNumberOfSetBits());
+            }
+            // Each of the three operations reads its operand(s) and writes its result.
+            setThroughputCounters(state, 3 * size, 8 * getBitVectorBytes(size));
+        }
+
+        static void numberOfSetBits(benchmark::State& state) {
+            uint64_t size = static_cast<uint64_t>(state.range(0));
+            storm::storage::BitVector vector = createRandomBitVector(size, 0.5);
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(vector.getNumberOfSetBits());
+            }
+            setThroughputCounters(state, size, getBitVectorBytes(size));
+        }
+
+        static void iterateSetBits(benchmark::State& state, double density) {
+            uint64_t size = static_cast<uint64_t>(state.range(0));
+            storm::storage::BitVector vector = createRandomBitVector(size, density);
+            for (auto _ : state) {
+                uint64_t sum = 0;
+                for (auto const& index : vector) {
+                    sum += index;
+                }
+                benchmark::DoNotOptimize(sum);
+            }
+            setThroughputCounters(state, size, getBitVectorBytes(size));
+        }
+
+        static void hashMapFindOrAdd(benchmark::State& state) {
+            // The keys resemble compressed states of a state space exploration: 96 bits of which only a few change.
+            uint64_t const bitsPerKey = 96;
+            uint64_t keyCount = static_cast<uint64_t>(state.range(0));
+            std::mt19937_64 generator(42);
+            std::vector<storm::storage::BitVector> keys;
+            keys.reserve(keyCount);
+            for (uint64_t key = 0; key < keyCount; ++key) {
+                storm::storage::BitVector bits(bitsPerKey);
+                bits.setFromInt(0, 64, generator());
+                bits.setFromInt(64, 32, key & 0xFFFF);
+                keys.push_back(std::move(bits));
+            }
+
+            for (auto _ : state) {
+                // Every key is added once and then found once.
+                storm::storage::BitVectorHashMap<uint32_t> map(bitsPerKey, keyCount);
+                for (uint64_t key = 0; key < keyCount; ++key) {
+                    map.findOrAdd(keys[key], static_cast<uint32_t>(key));
+                }
+                for (uint64_t key = 0; key < keyCount; ++key) {
+                    benchmark::DoNotOptimize(map.findOrAdd(keys[key], 0));
+                }
+            }
+            setThroughputCounters(state, 2 * keyCount, 2 * keyCount * getBitVectorBytes(bitsPerKey));
+        }
+
+        void registerBitVectorBenchmarks() {
+            for (auto const& size : getInputOptions().sizes) {
+                int64_t bits = static_cast<int64_t>(size);
+                benchmark::RegisterBenchmark("BitVector/binaryOperations", &binaryOperations)->Arg(bits);
+                benchmark::RegisterBenchmark("BitVector/getNumberOfSetBits", &numberOfSetBits)->Arg(bits);
+                benchmark::RegisterBenchmark("BitVector/iterate/dense", &iterateSetBits, 0.5)->Arg(bits);
+                benchmark::RegisterBenchmark("BitVector/iterate/sparse", &iterateSetBits, 0.01)->Arg(bits);
+                benchmark::RegisterBenchmark("BitVectorHashMap/findOrAdd", &hashMapFindOrAdd)->Arg(bits);
+            }
+        }
+
+    }
+}
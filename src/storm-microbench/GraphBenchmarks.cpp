@@ -0,0 +1,35 @@
+#include "storm-microbench/BenchmarkInputs.h"
+
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/graph.h"
+
+namespace storm {
+    namespace microbench {
+
+        static void sccDecomposition(benchmark::State& state, MatrixInput const& input) {
+            storm::storage::SparseMatrix<double> const& matrix = input.matrix;
+            for (auto _ : state) {
+                storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(matrix);
+                benchmark::DoNotOptimize(decomposition.size());
+            }
+            setThroughputCounters(state, matrix.getEntryCount(), matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<storm::storage::SparseMatrix<double>::index_type, double>));
+        }
+
+        static void prob01(benchmark::State& state, MatrixInput const& input) {
+            storm::storage::SparseMatrix<double> backwardTransitions = input.matrix.transpose(true);
+            storm::storage::BitVector phiStates(input.matrix.getRowGroupCount(), true);
+            for (auto _ : state) {
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> result = storm::utility::graph::performProb01(backwardTransitions, phiStates, input.targetStates);
+                benchmark::DoNotOptimize(result.first.getNumberOfSetBits());
+            }
+            // Both backward searches traverse the backward transitions (at most) once.
+            setThroughputCounters(state, 2 * backwardTransitions.getEntryCount(), 2 * backwardTransitions.getEntryCount() * sizeof(storm::storage::MatrixEntry<storm::storage::SparseMatrix<double>::index_type, double>));
+        }
+
+        void registerGraphBenchmarks() {
+            registerMatrixBenchmark("Graph/sccDecomposition", &sccDecomposition, false);
+            registerMatrixBenchmark("Graph/performProb01", &prob01, false);
+        }
+
+    }
+}
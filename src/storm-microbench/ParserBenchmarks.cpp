@@ -0,0 +1,51 @@
+#include "storm-microbench/BenchmarkInputs.h"
+
+#include <sstream>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-parsers/parser/RecursiveDescentPrismParser.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+    namespace microbench {
+
+        /*!
+         * Creates a PRISM program with the given number of commands. Each command has a guard, two updates and
+         * arithmetic expressions such that all parts of the parsers are exercised.
+         */
+        static std::string createPrismProgram(uint64_t commandCount) {
+            std::stringstream stream;
+            stream << "dtmc" << std::endl << std::endl;
+            stream << "const double p = 0.5;" << std::endl;
+            stream << "const int N = " << commandCount << ";" << std::endl << std::endl;
+            stream << "module main" << std::endl;
+            stream << "    x : [0..N] init 0;" << std::endl;
+            stream << "    y : bool init false;" << std::endl;
+            for (uint64_t command = 0; command < commandCount; ++command) {
+                stream << "    [a" << (command % 16) << "] x=" << command << " & (y | x<N-1) -> p : (x'=min(x+1, N)) & (y'=!y) + 1-p : (x'=max(x-" << (command % 7) << ", 0));" << std::endl;
+            }
+            stream << "endmodule" << std::endl << std::endl;
+            stream << "label \"done\" = x=N;" << std::endl;
+            return stream.str();
+        }
+
+        template<typename ParserType>
+        static void parsePrismProgram(benchmark::State& state) {
+            uint64_t commandCount = static_cast<uint64_t>(state.range(0));
+            std::string input = createPrismProgram(commandCount);
+            for (auto _ : state) {
+                storm::prism::Program program = ParserType::parseFromString(input, "benchmark");
+                benchmark::DoNotOptimize(program.getNumberOfCommands());
+            }
+            setThroughputCounters(state, commandCount, input.size());
+        }
+
+        void registerParserBenchmarks() {
+            for (int64_t commandCount : {1000ll, 100000ll}) {
+                benchmark::RegisterBenchmark("PrismParser/spirit", &parsePrismProgram<storm::parser::PrismParser>)->Arg(commandCount)->Unit(benchmark::kMillisecond);
+                benchmark::RegisterBenchmark("PrismParser/recursiveDescent", &parsePrismProgram<storm::parser::RecursiveDescentPrismParser>)->Arg(commandCount)->Unit(benchmark::kMillisecond);
+            }
+        }
+
+    }
+}
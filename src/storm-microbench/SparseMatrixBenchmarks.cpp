@@ -0,0 +1,70 @@
+#include "storm-microbench/BenchmarkInputs.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace microbench {
+
+        typedef storm::storage::SparseMatrix<double>::index_type IndexType;
+        typedef storm::storage::MatrixEntry<IndexType, double> EntryType;
+
+        // The bytes that a (single) pass over the matrix reads at least: its entries and row indications.
+        static uint64_t getMatrixBytes(storm::storage::SparseMatrix<double> const& matrix) {
+            return matrix.getEntryCount() * sizeof(EntryType) + (matrix.getRowCount() + 1) * sizeof(IndexType);
+        }
+
+        static void multiplyWithVector(benchmark::State& state, MatrixInput const& input) {
+            storm::storage::SparseMatrix<double> const& matrix = input.matrix;
+            std::vector<double> x(matrix.getColumnCount(), 1.0);
+            std::vector<double> result(matrix.getRowCount());
+            for (auto _ : state) {
+                matrix.multiplyWithVector(x, result);
+                benchmark::DoNotOptimize(result.data());
+                benchmark::ClobberMemory();
+            }
+            setThroughputCounters(state, matrix.getEntryCount(), getMatrixBytes(matrix) + (x.size() + result.size()) * sizeof(double));
+        }
+
+        static void multiplyAndReduce(benchmark::State& state, MatrixInput const& input) {
+            storm::storage::SparseMatrix<double> const& matrix = input.matrix;
+            std::vector<double> x(matrix.getColumnCount(), 1.0);
+            std::vector<double> result(matrix.getRowGroupCount());
+            for (auto _ : state) {
+                matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, nullptr, result, nullptr);
+                benchmark::DoNotOptimize(result.data());
+                benchmark::ClobberMemory();
+            }
+            setThroughputCounters(state, matrix.getEntryCount(), getMatrixBytes(matrix) + (matrix.getRowGroupCount() + 1) * sizeof(IndexType) + (x.size() + result.size()) * sizeof(double));
+        }
+
+        static void transpose(benchmark::State& state, MatrixInput const& input) {
+            storm::storage::SparseMatrix<double> const& matrix = input.matrix;
+            for (auto _ : state) {
+                storm::storage::SparseMatrix<double> transposed = matrix.transpose(true);
+                benchmark::DoNotOptimize(transposed.getEntryCount());
+            }
+            // The entries are read once and written once.
+            setThroughputCounters(state, matrix.getEntryCount(), 2 * getMatrixBytes(matrix));
+        }
+
+        static void getSubmatrix(benchmark::State& state, MatrixInput const& input) {
+            storm::storage::SparseMatrix<double> const& matrix = input.matrix;
+            storm::storage::BitVector constraint = createRandomBitVector(matrix.getRowGroupCount(), 0.5);
+            uint64_t resultBytes = 0;
+            for (auto _ : state) {
+                storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, constraint, constraint);
+                resultBytes = getMatrixBytes(submatrix);
+                benchmark::DoNotOptimize(submatrix.getEntryCount());
+            }
+            setThroughputCounters(state, matrix.getEntryCount(), getMatrixBytes(matrix) + resultBytes);
+        }
+
+        void registerSparseMatrixBenchmarks() {
+            registerMatrixBenchmark("SparseMatrix/multiplyWithVector", &multiplyWithVector, false);
+            registerMatrixBenchmark("SparseMatrix/multiplyAndReduce", &multiplyAndReduce, true);
+            registerMatrixBenchmark("SparseMatrix/transpose", &transpose, true);
+            registerMatrixBenchmark("SparseMatrix/getSubmatrix", &getSubmatrix, true);
+        }
+
+    }
+}
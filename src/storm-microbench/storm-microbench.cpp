@@ -0,0 +1,88 @@
+#include <iostream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "storm-microbench/BenchmarkInputs.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+
+#include <boost/algorithm/string.hpp>
+
+/*!
+ * Parses the options that determine the inputs of the benchmarks and removes them from the arguments. All other
+ * arguments are left for Google Benchmark.
+ *
+ * @return True iff the options could be parsed.
+ */
+bool parseInputOptions(int& argc, char** argv, storm::microbench::BenchmarkInputOptions& options) {
+    int remaining = 1;
+    for (int index = 1; index < argc; ++index) {
+        std::string argument(argv[index]);
+        std::size_t separator = argument.find('=');
+        std::string name = argument.substr(0, separator);
+        std::string value = separator == std::string::npos ? "" : argument.substr(separator + 1);
+        try {
+            if (name == "--model") {
+                options.modelFile = value;
+            } else if (name == "--constants") {
+                options.constants = value;
+            } else if (name == "--target") {
+                options.targetLabel = value;
+            } else if (name == "--sizes") {
+                std::vector<std::string> sizes;
+                boost::split(sizes, value, boost::is_any_of(","));
+                options.sizes.clear();
+                for (auto const& size : sizes) {
+                    options.sizes.push_back(std::stoull(size));
+                }
+            } else if (name == "--choices") {
+                options.choicesPerState = std::stoull(value);
+            } else if (name == "--entries") {
+                options.entriesPerRow = std::stoull(value);
+            } else {
+                argv[remaining++] = argv[index];
+            }
+        } catch (std::logic_error const&) {
+            std::cerr << "Illegal value '" << value << "' for option '" << name << "'." << std::endl;
+            return false;
+        }
+    }
+    argc = remaining;
+    return true;
+}
+
+/*!
+ * Runs microbenchmarks of the storage and solver primitives and of the PRISM parsers. Next to the options of Google Benchmark, the following
+ * options are available:
+ *   --sizes=n1,n2,...   The numbers of states of the synthetic inputs.
+ *   --choices=n         The number of choices per state of the synthetic nondeterministic inputs.
+ *   --entries=n         The maximal number of entries per row of the synthetic inputs.
+ *   --model=file        A PRISM file (e.g. from the QVBS) from which additional inputs are built.
+ *   --constants=defs    The definitions of the undefined constants of the PRISM file.
+ *   --target=label      The label of the target states of the model.
+ */
+int main(int argc, char** argv) {
+    storm::utility::setUp();
+    storm::settings::initializeAll("Storm-microbench", "storm-microbench");
+
+    storm::microbench::BenchmarkInputOptions& options = storm::microbench::getInputOptions();
+    if (!parseInputOptions(argc, argv, options)) {
+        return 1;
+    }
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    storm::microbench::registerSparseMatrixBenchmarks();
+    storm::microbench::registerBitVectorBenchmarks();
+    storm::microbench::registerGraphBenchmarks();
+    storm::microbench::registerParserBenchmarks();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    storm::utility::cleanUp();
+    return 0;
+}
@@ -0,0 +1,161 @@
+#include "storm-pars/analysis/MonotonicityChecker.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace analysis {
+
+        std::ostream& operator<<(std::ostream& out, Monotonicity const& monotonicity) {
+            switch (monotonicity) {
+                case Monotonicity::Constant:
+                    out << "constant";
+                    break;
+                case Monotonicity::Increasing:
+                    out << "increasing";
+                    break;
+                case Monotonicity::Decreasing:
+                    out << "decreasing";
+                    break;
+                case Monotonicity::Unknown:
+                    out << "unknown";
+                    break;
+            }
+            return out;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        MonotonicityChecker<ParametricType, ConstantType>::MonotonicityChecker(storm::storage::SparseMatrix<ParametricType> const& transitionMatrix, storm::storage::BitVector const& consideredStates, std::vector<ParametricType> const* stateRewards) {
+            STORM_LOG_ASSERT(transitionMatrix.hasTrivialRowGrouping(), "Expected a deterministic transition matrix.");
+            for (auto const& state : consideredStates) {
+                this->consideredStates.push_back(state);
+                std::vector<ParametricEntry> entriesOfState;
+                for (auto const& entry : transitionMatrix.getRow(state)) {
+                    if (!storm::utility::isConstant(entry.getValue())) {
+                        ParametricEntry parametricEntry{entry.getColumn(), entry.getValue(), {}, storm::utility::parametric::isMultiLinearPolynomial(entry.getValue())};
+                        storm::utility::parametric::gatherOccurringVariables(entry.getValue(), parametricEntry.variables);
+                        entriesOfState.push_back(std::move(parametricEntry));
+                    }
+                }
+                parametricEntries.push_back(std::move(entriesOfState));
+
+                if (stateRewards && !storm::utility::isConstant((*stateRewards)[state])) {
+                    ParametricType const& reward = (*stateRewards)[state];
+                    ParametricEntry parametricReward{state, reward, {}, storm::utility::parametric::isMultiLinearPolynomial(reward)};
+                    storm::utility::parametric::gatherOccurringVariables(reward, parametricReward.variables);
+                    parametricRewards.push_back(std::move(parametricReward));
+                } else {
+                    parametricRewards.push_back(boost::none);
+                }
+            }
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        std::map<typename MonotonicityChecker<ParametricType, ConstantType>::VariableType, Monotonicity> MonotonicityChecker<ParametricType, ConstantType>::checkMonotonicity(storm::storage::ParameterRegion<ParametricType> const& region, std::vector<ConstantType> const& lowerBounds, std::vector<ConstantType> const& upperBounds, storm::storage::BitVector const& statesWithUpperBound) const {
+            std::map<VariableType, Monotonicity> result;
+            for (auto const& variable : region.getVariables()) {
+                bool increasing = true;
+                bool decreasing = true;
+                for (uint64_t stateIndex = 0; stateIndex < consideredStates.size() && (increasing || decreasing); ++stateIndex) {
+                    // Collect the bounds of the successors whose probability increases (decreases) with the parameter.
+                    bool hasIncreasingSuccessor = false, hasDecreasingSuccessor = false;
+                    bool increasingSuccessorsHaveUpperBound = true, decreasingSuccessorsHaveUpperBound = true;
+                    ConstantType minLowerOfIncreasing = storm::utility::zero<ConstantType>(), maxUpperOfIncreasing = storm::utility::zero<ConstantType>();
+                    ConstantType minLowerOfDecreasing = storm::utility::zero<ConstantType>(), maxUpperOfDecreasing = storm::utility::zero<ConstantType>();
+                    for (auto const& entry : parametricEntries[stateIndex]) {
+                        Sign sign = getDerivativeSign(entry, variable, region);
+                        if (sign == Sign::Unknown) {
+                            increasing = false;
+                            decreasing = false;
+                            break;
+                        } else if (sign == Sign::Nonnegative) {
+                            if (!hasIncreasingSuccessor || lowerBounds[entry.column] < minLowerOfIncreasing) {
+                                minLowerOfIncreasing = lowerBounds[entry.column];
+                            }
+                            if (!statesWithUpperBound.get(entry.column)) {
+                                increasingSuccessorsHaveUpperBound = false;
+                            } else if (!hasIncreasingSuccessor || upperBounds[entry.column] > maxUpperOfIncreasing) {
+                                maxUpperOfIncreasing = upperBounds[entry.column];
+                            }
+                            hasIncreasingSuccessor = true;
+                        } else if (sign == Sign::Nonpositive) {
+                            if (!hasDecreasingSuccessor || lowerBounds[entry.column] < minLowerOfDecreasing) {
+                                minLowerOfDecreasing = lowerBounds[entry.column];
+                            }
+                            if (!statesWithUpperBound.get(entry.column)) {
+                                decreasingSuccessorsHaveUpperBound = false;
+                            } else if (!hasDecreasingSuccessor || upperBounds[entry.column] > maxUpperOfDecreasing) {
+                                maxUpperOfDecreasing = upperBounds[entry.column];
+                            }
+                            hasDecreasingSuccessor = true;
+                        }
+                    }
+
+                    // As the outgoing probabilities sum up to one, the local derivative vanishes if the probabilities
+                    // only change in one direction.
+                    if (hasIncreasingSuccessor && hasDecreasingSuccessor) {
+                        increasing &= decreasingSuccessorsHaveUpperBound && maxUpperOfDecreasing <= minLowerOfIncreasing;
+                        decreasing &= increasingSuccessorsHaveUpperBound && maxUpperOfIncreasing <= minLowerOfDecreasing;
+                    }
+
+                    if (parametricRewards[stateIndex]) {
+                        Sign rewardSign = getDerivativeSign(parametricRewards[stateIndex].get(), variable, region);
+                        increasing &= rewardSign == Sign::Zero || rewardSign == Sign::Nonnegative;
+                        decreasing &= rewardSign == Sign::Zero || rewardSign == Sign::Nonpositive;
+                    }
+                }
+
+                if (increasing && decreasing) {
+                    result.emplace(variable, Monotonicity::Constant);
+                } else if (increasing) {
+                    result.emplace(variable, Monotonicity::Increasing);
+                } else if (decreasing) {
+                    result.emplace(variable, Monotonicity::Decreasing);
+                } else {
+                    result.emplace(variable, Monotonicity::Unknown);
+                }
+            }
+            return result;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        typename MonotonicityChecker<ParametricType, ConstantType>::Sign MonotonicityChecker<ParametricType, ConstantType>::getDerivativeSign(ParametricEntry const& entry, VariableType const& variable, storm::storage::ParameterRegion<ParametricType> const& region) const {
+            if (entry.variables.find(variable) == entry.variables.end()) {
+                return Sign::Zero;
+            }
+            if (!entry.isMultiLinear) {
+                return Sign::Unknown;
+            }
+
+            // The derivative of a multilinear polynomial does not depend on the variable itself and is multilinear in
+            // the remaining variables. Hence, its extremal values are attained at the vertices of the region.
+            std::set<VariableType> otherVariables = entry.variables;
+            otherVariables.erase(variable);
+            bool hasPositiveValue = false, hasNegativeValue = false;
+            for (auto& vertex : region.getVerticesOfRegion(otherVariables)) {
+                vertex[variable] = region.getLowerBoundary(variable);
+                CoefficientType lowerValue = storm::utility::parametric::evaluate(entry.function, vertex);
+                vertex[variable] = region.getUpperBoundary(variable);
+                CoefficientType upperValue = storm::utility::parametric::evaluate(entry.function, vertex);
+                if (lowerValue < upperValue) {
+                    hasPositiveValue = true;
+                } else if (upperValue < lowerValue) {
+                    hasNegativeValue = true;
+                }
+            }
+
+            if (hasPositiveValue && hasNegativeValue) {
+                return Sign::Unknown;
+            } else if (hasPositiveValue) {
+                return Sign::Nonnegative;
+            } else if (hasNegativeValue) {
+                return Sign::Nonpositive;
+            }
+            return Sign::Zero;
+        }
+
+        template class MonotonicityChecker<storm::RationalFunction, double>;
+        template class MonotonicityChecker<storm::RationalFunction, storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <map>
+#include <set>
+#include <ostream>
+#include <vector>
+
+#include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/parametric.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace analysis {
+
+        enum class Monotonicity { Constant, Increasing, Decreasing, Unknown };
+
+        std::ostream& operator<<(std::ostream& out, Monotonicity const& monotonicity);
+
+        /*!
+         * Checks whether the reachability probabilities (or expected rewards) of a parametric DTMC are monotone in a
+         * parameter on a given region.
+         *
+         * The value of a state s is monotonically increasing in a parameter p if for every considered state s the
+         * local derivative sum_{s'} dP(s,s')/dp * f(s') (plus the derivative of the reward of s) is nonnegative, where f
+         * denotes the values of the states. As the outgoing probabilities of each state sum up to one, this is the case
+         * if the successors s' whose transition probability increases with p have a value that is at least as high as
+         * the value of the successors whose transition probability decreases. The values of the successors are compared
+         * by means of given lower and upper bounds for the values within the region, i.e., by the order of the states
+         * that is induced by these bounds.
+         *
+         * The sign of dP(s,s')/dp is determined by evaluating the transition function at the vertices of the region,
+         * which is only sound for multilinear polynomials. Transitions with other functions yield an unknown sign.
+         * It is assumed that the outgoing transitions of every state sum up to one (for every valuation in the region).
+         */
+        template<typename ParametricType, typename ConstantType>
+        class MonotonicityChecker {
+        public:
+            typedef typename storm::utility::parametric::VariableType<ParametricType>::type VariableType;
+            typedef typename storm::utility::parametric::CoefficientType<ParametricType>::type CoefficientType;
+
+            /*!
+             * @param transitionMatrix The transition matrix of the parametric DTMC.
+             * @param consideredStates The states for which the local derivative is checked (usually the maybe states).
+             * @param stateRewards If given, the rewards of the states (w.r.t. all states of the model).
+             */
+            MonotonicityChecker(storm::storage::SparseMatrix<ParametricType> const& transitionMatrix, storm::storage::BitVector const& consideredStates, std::vector<ParametricType> const* stateRewards = nullptr);
+
+            /*!
+             * Checks the monotonicity of each parameter of the region.
+             *
+             * @param lowerBounds Lower bounds for the values of all states within the region.
+             * @param upperBounds Upper bounds for the values of all states within the region. Only the entries of states
+             * in statesWithUpperBound are considered.
+             */
+            std::map<VariableType, Monotonicity> checkMonotonicity(storm::storage::ParameterRegion<ParametricType> const& region, std::vector<ConstantType> const& lowerBounds, std::vector<ConstantType> const& upperBounds, storm::storage::BitVector const& statesWithUpperBound) const;
+
+        private:
+            // The sign of a derivative within the region.
+            enum class Sign { Zero, Nonnegative, Nonpositive, Unknown };
+
+            struct ParametricEntry {
+                uint64_t column;
+                ParametricType function;
+                std::set<VariableType> variables;
+                bool isMultiLinear;
+            };
+
+            /*!
+             * Computes the sign of the derivative of the given function w.r.t. the given variable within the region.
+             */
+            Sign getDerivativeSign(ParametricEntry const& entry, VariableType const& variable, storm::storage::ParameterRegion<ParametricType> const& region) const;
+
+            std::vector<uint64_t> consideredStates;
+
+            // The non-constant transitions (and rewards) of each considered state.
+            std::vector<std::vector<ParametricEntry>> parametricEntries;
+            std::vector<boost::optional<ParametricEntry>> parametricRewards;
+        };
+    }
+}
@@ -27,13 +27,25 @@
 namespace storm {
     namespace modelchecker {
         
+        namespace detail {
+            template <typename ParametricType>
+            bool isSubRegion(storm::storage::ParameterRegion<ParametricType> const& subRegion, storm::storage::ParameterRegion<ParametricType> const& region) {
+                for (auto const& variable : region.getVariables()) {
+                    if (subRegion.getLowerBoundary(variable) < region.getLowerBoundary(variable) || region.getUpperBoundary(variable) < subRegion.getUpperBoundary(variable)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseDtmcParameterLiftingModelChecker() : SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>(std::make_unique<storm::solver::GeneralMinMaxLinearEquationSolverFactory<ConstantType>>()) {
             // Intentionally left empty
         }
         
         template <typename SparseModelType, typename ConstantType>
-        SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseDtmcParameterLiftingModelChecker(std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>>&& solverFactory) : solverFactory(std::move(solverFactory)), solvingRequiresUpperRewardBounds(false), regionSplitEstimationsEnabled(false) {
+        SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseDtmcParameterLiftingModelChecker(std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>>&& solverFactory) : solverFactory(std::move(solverFactory)), solvingRequiresUpperRewardBounds(false), useMonotonicity(false), generateRowLabels(false), lastNumberOfLiftedChoices(0), regionSplitEstimationsEnabled(false) {
             // Intentionally left empty
         }
         
@@ -111,6 +123,7 @@ namespace storm {
                 std::vector<typename SparseModelType::ValueType> b = this->parametricModel->getTransitionMatrix().getConstrainedRowSumVector(storm::storage::BitVector(this->parametricModel->getTransitionMatrix().getRowCount(), true), psiStates);
                 
                 parameterLifter = std::make_unique<storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>>(this->parametricModel->getTransitionMatrix(), b, maybeStates, maybeStates);
+                initializeMonotonicityChecker(b, false, false);
             }
             
             // We know some bounds for the results so set them
@@ -143,6 +156,7 @@ namespace storm {
                 std::vector<typename SparseModelType::ValueType> b = this->parametricModel->getTransitionMatrix().getConstrainedRowSumVector(storm::storage::BitVector(this->parametricModel->getTransitionMatrix().getRowCount(), true), statesWithProbability01.second);
                 
                 parameterLifter = std::make_unique<storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>>(this->parametricModel->getTransitionMatrix(), b, maybeStates, maybeStates, regionSplitEstimationsEnabled);
+                initializeMonotonicityChecker(b, false, regionSplitEstimationsEnabled);
             }
             
             // We know some bounds for the results so set them
@@ -183,6 +197,7 @@ namespace storm {
                 std::vector<typename SparseModelType::ValueType> b = rewardModel.getTotalRewardVector(this->parametricModel->getTransitionMatrix());
                 
                 parameterLifter = std::make_unique<storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>>(this->parametricModel->getTransitionMatrix(), b, maybeStates, maybeStates, regionSplitEstimationsEnabled);
+                initializeMonotonicityChecker(b, true, regionSplitEstimationsEnabled);
             }
             
             // We only know a lower bound for the result
@@ -245,18 +260,27 @@ namespace storm {
         std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
             
             if (maybeStates.empty()) {
+                lastFixedParameters.clear();
+                lastNumberOfLiftedChoices = 0;
                 return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(resultsForNonMaybeStates);
             }
             
-            parameterLifter->specifyRegion(region, dirForParameters);
+            // Parameters that are monotone on the region are not lifted
+            std::set<VariableType> fixedParameters;
+            storm::storage::ParameterRegion<typename SparseModelType::ValueType> consideredRegion = monotonicityChecker ? fixMonotoneParameters(region, dirForParameters, fixedParameters) : region;
+            auto& lifter = getParameterLifter(fixedParameters);
+            lifter.specifyRegion(consideredRegion, dirForParameters);
+            lastFixedParameters = fixedParameters;
+            lastNumberOfLiftedChoices = lifter.getMatrix().getRowCount();
+            bool resultsAreBounds = !stepBound.is_initialized();
             
             if (stepBound) {
                 assert(*stepBound > 0);
                 x = std::vector<ConstantType>(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
-                auto multiplier = storm::solver::MultiplierFactory<ConstantType>().create(env, parameterLifter->getMatrix());
-                multiplier->repeatedMultiplyAndReduce(env, dirForParameters, x, &parameterLifter->getVector(), *stepBound);
+                auto multiplier = storm::solver::MultiplierFactory<ConstantType>().create(env, lifter.getMatrix());
+                multiplier->repeatedMultiplyAndReduce(env, dirForParameters, x, &lifter.getVector(), *stepBound);
             } else {
-                auto solver = solverFactory->create(env, parameterLifter->getMatrix());
+                auto solver = solverFactory->create(env, lifter.getMatrix());
                 solver->setHasUniqueSolution();
                 solver->setHasNoEndComponents();
                 if (lowerResultBound) solver->setLowerBound(lowerResultBound.get());
@@ -265,21 +289,21 @@ namespace storm {
                 } else if (solvingRequiresUpperRewardBounds) {
                     // For the min-case, we use DS-MPI, for the max-case variant 2 of the Baier et al. paper (CAV'17).
                     std::vector<ConstantType> oneStepProbs;
-                    oneStepProbs.reserve(parameterLifter->getMatrix().getRowCount());
-                    for (uint64_t row = 0; row < parameterLifter->getMatrix().getRowCount(); ++row) {
-                        oneStepProbs.push_back(storm::utility::one<ConstantType>() - parameterLifter->getMatrix().getRowSum(row));
+                    oneStepProbs.reserve(lifter.getMatrix().getRowCount());
+                    for (uint64_t row = 0; row < lifter.getMatrix().getRowCount(); ++row) {
+                        oneStepProbs.push_back(storm::utility::one<ConstantType>() - lifter.getMatrix().getRowSum(row));
                     }
                     if (dirForParameters == storm::OptimizationDirection::Minimize) {
-                        storm::modelchecker::helper::DsMpiMdpUpperRewardBoundsComputer<ConstantType> dsmpi(parameterLifter->getMatrix(), parameterLifter->getVector(), oneStepProbs);
+                        storm::modelchecker::helper::DsMpiMdpUpperRewardBoundsComputer<ConstantType> dsmpi(lifter.getMatrix(), lifter.getVector(), oneStepProbs);
                         solver->setUpperBounds(dsmpi.computeUpperBounds());
                     } else {
-                        storm::modelchecker::helper::BaierUpperRewardBoundsComputer<ConstantType> baier(parameterLifter->getMatrix(), parameterLifter->getVector(), oneStepProbs);
+                        storm::modelchecker::helper::BaierUpperRewardBoundsComputer<ConstantType> baier(lifter.getMatrix(), lifter.getVector(), oneStepProbs);
                         solver->setUpperBound(baier.computeUpperBound());
                     }
                 }
                 solver->setTrackScheduler(true);
-                if (storm::solver::minimize(dirForParameters) && minSchedChoices) solver->setInitialScheduler(std::move(minSchedChoices.get()));
-                if (storm::solver::maximize(dirForParameters) && maxSchedChoices) solver->setInitialScheduler(std::move(maxSchedChoices.get()));
+                if (storm::solver::minimize(dirForParameters) && minSchedChoices && minSchedFixedParameters == fixedParameters) solver->setInitialScheduler(std::move(minSchedChoices.get()));
+                if (storm::solver::maximize(dirForParameters) && maxSchedChoices && maxSchedFixedParameters == fixedParameters) solver->setInitialScheduler(std::move(maxSchedChoices.get()));
                 if (this->currentCheckTask->isBoundSet() && solver->hasInitialScheduler()) {
                     // If we reach this point, we know that after applying the hint, the x-values can only become larger (if we maximize) or smaller (if we minimize).
                     std::unique_ptr<storm::solver::TerminationCondition<ConstantType>> termCond;
@@ -292,18 +316,22 @@ namespace storm {
                         termCond = std::make_unique<storm::solver::TerminateIfFilteredExtremumExceedsThreshold<ConstantType>> (relevantStatesInSubsystem, true, this->currentCheckTask->getBoundThreshold(), true);
                     }
                     solver->setTerminationCondition(std::move(termCond));
+                    // The solver might terminate before the values converged
+                    resultsAreBounds = false;
                 }
             
                 // Invoke the solver
                 x.resize(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
-                solver->solveEquations(env, dirForParameters, x, parameterLifter->getVector());
+                solver->solveEquations(env, dirForParameters, x, lifter.getVector());
                 if(storm::solver::minimize(dirForParameters)) {
                     minSchedChoices = solver->getSchedulerChoices();
+                    minSchedFixedParameters = fixedParameters;
                 } else {
                     maxSchedChoices = solver->getSchedulerChoices();
+                    maxSchedFixedParameters = fixedParameters;
                 }
                 if (isRegionSplitEstimateSupported()) {
-                    computeRegionSplitEstimates(x, solver->getSchedulerChoices(), region, dirForParameters);
+                    computeRegionSplitEstimates(lifter, x, solver->getSchedulerChoices(), consideredRegion, dirForParameters);
                 }
             }
             
@@ -314,19 +342,22 @@ namespace storm {
                 result[maybeState] = *maybeStateResIt;
                 ++maybeStateResIt;
             }
+            if (monotonicityChecker && resultsAreBounds) {
+                storeStateBounds(region, dirForParameters, result);
+            }
             return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(result));
         }
         
         template <typename SparseModelType, typename ConstantType>
-        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::computeRegionSplitEstimates(std::vector<ConstantType> const& quantitativeResult, std::vector<uint_fast64_t> const& schedulerChoices, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::computeRegionSplitEstimates(storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType> const& lifter, std::vector<ConstantType> const& quantitativeResult, std::vector<uint_fast64_t> const& schedulerChoices, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
             std::map<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType, double> deltaLower, deltaUpper;
             for (auto const& p : region.getVariables()) {
                 deltaLower.insert(std::make_pair(p, 0.0));
                 deltaUpper.insert(std::make_pair(p, 0.0));
             }
-            auto const& choiceValuations = parameterLifter->getRowLabels();
-            auto const& matrix = parameterLifter->getMatrix();
-            auto const& vector = parameterLifter->getVector();
+            auto const& choiceValuations = lifter.getRowLabels();
+            auto const& matrix = lifter.getMatrix();
+            auto const& vector = lifter.getVector();
             
             std::vector<ConstantType> stateResults;
             for (uint64_t state = 0; state < schedulerChoices.size(); ++state) {
@@ -386,8 +417,19 @@ namespace storm {
             stepBound = boost::none;
             instantiationChecker = nullptr;
             parameterLifter = nullptr;
+            monotonicityChecker = nullptr;
+            parametricVector.clear();
+            generateRowLabels = false;
+            reducedParameterLifters.clear();
+            stateBoundsRegion = boost::none;
+            lowerStateBounds.clear();
+            upperStateBounds.clear();
+            lastFixedParameters.clear();
+            lastNumberOfLiftedChoices = 0;
             minSchedChoices = boost::none;
             maxSchedChoices = boost::none;
+            minSchedFixedParameters.clear();
+            maxSchedFixedParameters.clear();
             x.clear();
             lowerResultBound = boost::none;
             upperResultBound = boost::none;
@@ -426,6 +468,109 @@ namespace storm {
             return result;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::setUseMonotonicity(bool value) {
+            useMonotonicity = value;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::isUseMonotonicitySet() const {
+            return useMonotonicity;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::set<typename SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::VariableType> const& SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getLastFixedParameters() const {
+            return lastFixedParameters;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        uint_fast64_t SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getLastNumberOfLiftedChoices() const {
+            return lastNumberOfLiftedChoices;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::initializeMonotonicityChecker(std::vector<typename SparseModelType::ValueType> const& parametricVector, bool vectorHasRewards, bool generateRowLabels) {
+            if (useMonotonicity) {
+                this->parametricVector = parametricVector;
+                this->generateRowLabels = generateRowLabels;
+                monotonicityChecker = std::make_unique<storm::analysis::MonotonicityChecker<typename SparseModelType::ValueType, ConstantType>>(this->parametricModel->getTransitionMatrix(), maybeStates, vectorHasRewards ? &this->parametricVector : nullptr);
+            }
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        storm::storage::ParameterRegion<typename SparseModelType::ValueType> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::fixMonotoneParameters(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::set<VariableType>& fixedParameters) const {
+            // Obtain bounds for the values of the states within the region.
+            std::vector<ConstantType> lowerBounds = resultsForNonMaybeStates;
+            std::vector<ConstantType> upperBounds = resultsForNonMaybeStates;
+            storm::storage::BitVector statesWithUpperBound = ~maybeStates;
+            storm::utility::vector::setVectorValues(lowerBounds, maybeStates, lowerResultBound ? lowerResultBound.get() : storm::utility::zero<ConstantType>());
+            if (upperResultBound) {
+                storm::utility::vector::setVectorValues(upperBounds, maybeStates, upperResultBound.get());
+                statesWithUpperBound = storm::storage::BitVector(maybeStates.size(), true);
+            }
+            if (stateBoundsRegion && detail::isSubRegion(region, stateBoundsRegion.get())) {
+                if (!lowerStateBounds.empty()) {
+                    lowerBounds = lowerStateBounds;
+                }
+                if (!upperStateBounds.empty()) {
+                    upperBounds = upperStateBounds;
+                    statesWithUpperBound = storm::storage::BitVector(maybeStates.size(), true);
+                }
+            }
+            
+            auto lowerBoundaries = region.getLowerBoundaries();
+            auto upperBoundaries = region.getUpperBoundaries();
+            for (auto const& variableMonotonicity : monotonicityChecker->checkMonotonicity(region, lowerBounds, upperBounds, statesWithUpperBound)) {
+                auto const& variable = variableMonotonicity.first;
+                if (variableMonotonicity.second == storm::analysis::Monotonicity::Unknown) {
+                    continue;
+                }
+                bool useUpperBoundary = (variableMonotonicity.second == storm::analysis::Monotonicity::Increasing && storm::solver::maximize(dirForParameters)) || (variableMonotonicity.second == storm::analysis::Monotonicity::Decreasing && storm::solver::minimize(dirForParameters));
+                if (useUpperBoundary) {
+                    lowerBoundaries[variable] = upperBoundaries[variable];
+                } else {
+                    upperBoundaries[variable] = lowerBoundaries[variable];
+                }
+                fixedParameters.insert(variable);
+                STORM_LOG_TRACE("Parameter " << variable << " is " << variableMonotonicity.second << " on region " << region << ".");
+            }
+            return storm::storage::ParameterRegion<typename SparseModelType::ValueType>(std::move(lowerBoundaries), std::move(upperBoundaries));
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::storeStateBounds(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::vector<ConstantType> const& values) {
+            // Results computed with imprecise arithmetic are not necessarily bounds for the actual values.
+            if (!storm::NumberTraits<ConstantType>::IsExact) {
+                return;
+            }
+            // We keep the results for the largest region seen so far as they are valid for the most subregions.
+            if (!stateBoundsRegion || (detail::isSubRegion(stateBoundsRegion.get(), region) && !detail::isSubRegion(region, stateBoundsRegion.get()))) {
+                stateBoundsRegion = region;
+                lowerStateBounds.clear();
+                upperStateBounds.clear();
+            }
+            if (detail::isSubRegion(region, stateBoundsRegion.get()) && detail::isSubRegion(stateBoundsRegion.get(), region)) {
+                if (storm::solver::minimize(dirForParameters)) {
+                    lowerStateBounds = values;
+                } else {
+                    upperStateBounds = values;
+                }
+            }
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>& SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getParameterLifter(std::set<VariableType> const& fixedParameters) {
+            if (fixedParameters.empty()) {
+                return *parameterLifter;
+            }
+            auto lifterIt = reducedParameterLifters.find(fixedParameters);
+            if (lifterIt == reducedParameterLifters.end()) {
+                auto lifter = std::make_unique<storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>>(this->parametricModel->getTransitionMatrix(), parametricVector, maybeStates, maybeStates, generateRowLabels, fixedParameters);
+                lifterIt = reducedParameterLifters.emplace(fixedParameters, std::move(lifter)).first;
+            }
+            return *lifterIt->second;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         bool SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::isRegionSplitEstimateSupported() const {
             return regionSplitEstimationsEnabled && !stepBound;
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <vector>
+#include <map>
 #include <memory>
+#include <set>
 #include <boost/optional.hpp>
 
+#include "storm-pars/analysis/MonotonicityChecker.h"
 #include "storm-pars/transformer/ParameterLifter.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
@@ -18,6 +21,8 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingModelChecker<SparseModelType, ConstantType> {
         public:
+            typedef typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType VariableType;
+
             SparseDtmcParameterLiftingModelChecker();
             SparseDtmcParameterLiftingModelChecker(std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>>&& solverFactory);
             virtual ~SparseDtmcParameterLiftingModelChecker() = default;
@@ -30,6 +35,27 @@ namespace storm {
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
 
+            /*!
+             * Sets whether the monotonicity of the parameters is exploited: Before parameter lifting is applied on a region, it is
+             * checked which parameters are monotone on that region. These parameters are fixed to the boundary of the region that
+             * yields the optimal value and only the remaining parameters are lifted.
+             *
+             * The states are ordered via the (trivial) bounds for the results and, if the exact arithmetic is used, via
+             * previously computed results for an enclosing region. Monotonicity is not considered for cumulative reward formulas.
+             */
+            void setUseMonotonicity(bool value = true);
+            bool isUseMonotonicitySet() const;
+
+            /*!
+             * Retrieves the parameters that were fixed (and thus not lifted) in the most recent computation of a bound.
+             */
+            std::set<VariableType> const& getLastFixedParameters() const;
+
+            /*!
+             * Retrieves the number of choices of the lifted model that was solved in the most recent computation of a bound.
+             */
+            uint_fast64_t getLastNumberOfLiftedChoices() const;
+
             virtual bool isRegionSplitEstimateSupported() const override;
             virtual std::map<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType, double> getRegionSplitEstimate() const override;
             
@@ -44,12 +70,25 @@ namespace storm {
                 
             virtual std::unique_ptr<CheckResult> computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) override;
             
-            void computeRegionSplitEstimates(std::vector<ConstantType> const& quantitativeResult, std::vector<uint_fast64_t> const& schedulerChoices, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+            void computeRegionSplitEstimates(storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType> const& lifter, std::vector<ConstantType> const& quantitativeResult, std::vector<uint_fast64_t> const& schedulerChoices, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
             
             virtual void reset() override;
                 
         private:
-
+            void initializeMonotonicityChecker(std::vector<typename SparseModelType::ValueType> const& parametricVector, bool vectorHasRewards, bool generateRowLabels);
+            
+            /*!
+             * Fixes the parameters that are monotone on the given region to their optimal value w.r.t. the given direction.
+             *
+             * @param fixedParameters the parameters that are fixed are inserted into this set
+             * @return the region in which the lower and the upper boundary of the fixed parameters coincide.
+             */
+            storm::storage::ParameterRegion<typename SparseModelType::ValueType> fixMonotoneParameters(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::set<VariableType>& fixedParameters) const;
+            
+            // Stores the given results if they can serve as bounds for the values within subregions of the given region.
+            void storeStateBounds(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::vector<ConstantType> const& values);
+            
+            storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>& getParameterLifter(std::set<VariableType> const& fixedParameters);
             
             storm::storage::BitVector maybeStates;
             std::vector<ConstantType> resultsForNonMaybeStates;
@@ -61,8 +100,21 @@ namespace storm {
             std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>> solverFactory;
             bool solvingRequiresUpperRewardBounds;
             
+            // Data for exploiting the monotonicity of the parameters.
+            bool useMonotonicity;
+            std::unique_ptr<storm::analysis::MonotonicityChecker<typename SparseModelType::ValueType, ConstantType>> monotonicityChecker;
+            std::vector<typename SparseModelType::ValueType> parametricVector;
+            bool generateRowLabels;
+            std::map<std::set<VariableType>, std::unique_ptr<storm::transformer::ParameterLifter<typename SparseModelType::ValueType, ConstantType>>> reducedParameterLifters;
+            boost::optional<storm::storage::ParameterRegion<typename SparseModelType::ValueType>> stateBoundsRegion;
+            std::vector<ConstantType> lowerStateBounds, upperStateBounds;
+            std::set<VariableType> lastFixedParameters;
+            uint_fast64_t lastNumberOfLiftedChoices;
+            
             // Results from the most recent solver call.
             boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
+            // The parameters that were not lifted when computing the scheduler choices above.
+            std::set<VariableType> minSchedFixedParameters, maxSchedFixedParameters;
             std::vector<ConstantType> x;
             boost::optional<ConstantType> lowerResultBound, upperResultBound;
             
@@ -24,6 +24,7 @@ namespace storm {
             const std::string RegionSettings::checkEngineOptionName = "engine";
             const std::string RegionSettings::printNoIllustrationOptionName = "noillustration";
             const std::string RegionSettings::printFullResultOptionName = "printfullresult";
+            const std::string RegionSettings::monotonicityOptionName = "monotonicity";
             
             RegionSettings::RegionSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, regionOptionName, false, "Sets the region(s) considered for analysis.").setShortName(regionShortOptionName)
@@ -49,6 +50,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, monotonicityOptionName, true, "If set, parameters that are monotone on a region are fixed to the optimal boundary instead of being lifted (parametric DTMCs only).").setIsAdvanced().build());
             }
             
             bool RegionSettings::isRegionSet() const {
@@ -150,6 +153,10 @@ namespace storm {
                 return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
             }
             
+            bool RegionSettings::isUseMonotonicitySet() const {
+                return this->getOption(monotonicityOptionName).getHasOptionBeenSet();
+            }
+            
 
         } // namespace modules
     } // namespace settings
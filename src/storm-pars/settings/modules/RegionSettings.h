@@ -92,6 +92,11 @@ namespace storm {
                  */
                 bool isPrintFullResultSet() const;
                 
+                /*!
+                 * Retrieves whether the monotonicity of the parameters is to be exploited
+                 */
+                bool isUseMonotonicitySet() const;
+                
                 bool check() const override;
                 
                 const static std::string moduleName;
@@ -106,6 +111,7 @@ namespace storm {
 				const static std::string checkEngineOptionName;
 				const static std::string printNoIllustrationOptionName;
 				const static std::string printFullResultOptionName;
+				const static std::string monotonicityOptionName;
             };
             
         } // namespace modules
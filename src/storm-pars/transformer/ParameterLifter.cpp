@@ -12,7 +12,7 @@ namespace storm {
     namespace transformer {
 
         template<typename ParametricType, typename ConstantType>
-        ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns, bool generateRowLabels) {
+        ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns, bool generateRowLabels, std::set<VariableType> const& fixedParameters) {
         
             
             // get a mapping from old column indices to new ones
@@ -60,12 +60,24 @@ namespace storm {
                 }
                 ++pVectorEntryCount;
                 
+                // Fixed parameters are not lifted
+                std::set<VariableType> occurringFixedVariables;
+                for (auto const& fixedVar : fixedParameters) {
+                    if (occurringVariables.erase(fixedVar) > 0) {
+                        occurringFixedVariables.insert(fixedVar);
+                    }
+                }
+                
                 // Compute the (abstract) valuation for each row
                 auto rowValuations = getVerticesOfAbstractRegion(occurringVariables);
                 
-                for (auto const& val : rowValuations) {
+                for (auto const& rowVal : rowValuations) {
                     if (generateRowLabels) {
-                        rowLabels.push_back(val);
+                        rowLabels.push_back(rowVal);
+                    }
+                    AbstractValuation val(rowVal);
+                    for (auto const& fixedVar : occurringFixedVariables) {
+                        val.addParameterLower(fixedVar);
                     }
                     
                     // Insert matrix entries for each valuation. For non-constant entries, a dummy value is inserted and the function and the valuation are collected.
@@ -89,7 +101,11 @@ namespace storm {
                         vector.push_back(storm::utility::one<ConstantType>());
                         AbstractValuation vectorVal(val);
                         for(auto const& vectorVar : vectorEntryVariables) {
-                            if (occurringVariables.find(vectorVar) == occurringVariables.end()) {
+                            if (fixedParameters.find(vectorVar) != fixedParameters.end()) {
+                                if (occurringFixedVariables.find(vectorVar) == occurringFixedVariables.end()) {
+                                    vectorVal.addParameterLower(vectorVar);
+                                }
+                            } else if (occurringVariables.find(vectorVar) == occurringVariables.end()) {
                                 assert(!generateRowLabels);
                                 vectorVal.addParameterUnspecified(vectorVar);
                             }
@@ -38,8 +38,11 @@ namespace storm {
              * @param pVector the parametric vector (the vector size should equal the row count of the matrix)
              * @param selectedRows a Bitvector that specifies which rows of the matrix and the vector are considered.
              * @param selectedColumns a Bitvector that specifies which columns of the matrix are considered.
+             * @param fixedParameters parameters that are not lifted but always set to the lower boundary of the specified region.
+             * This is useful for parameters whose optimal value is known (e.g. due to monotonicity). In this case, the lower and the upper
+             * boundary of the specified region should coincide for these parameters.
              */
-            ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns,  bool generateRowLabels = false);
+            ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns,  bool generateRowLabels = false, std::set<VariableType> const& fixedParameters = std::set<VariableType>());
             
             void specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
             
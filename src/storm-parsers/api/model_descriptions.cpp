@@ -1,6 +1,7 @@
 #include "model_descriptions.h"
 
 #include "storm-parsers/parser/PrismParser.h"
+#include "storm-parsers/parser/RecursiveDescentPrismParser.h"
 #include "storm-parsers/parser/JaniParser.h"
 
 #include "storm/storage/jani/Model.h"
@@ -13,8 +14,8 @@
 namespace storm {
     namespace api {
         
-        storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility, bool simplify) {
-            storm::prism::Program program = storm::parser::PrismParser::parse(filename, prismCompatibility);
+        storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility, bool simplify, bool useRecursiveDescentParser) {
+            storm::prism::Program program = useRecursiveDescentParser ? storm::parser::RecursiveDescentPrismParser::parse(filename, prismCompatibility) : storm::parser::PrismParser::parse(filename, prismCompatibility);
             if (simplify) {
                 program = program.simplify().simplify();
             }
@@ -17,7 +17,12 @@ namespace storm {
     
     namespace api {
         
-        storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility = false, bool simplify = true);
+        /*!
+         * Parses the given PRISM file. Unless requested otherwise, the Spirit-based PrismParser is used.
+         *
+         * @param useRecursiveDescentParser If set, the file is parsed by the RecursiveDescentPrismParser instead.
+         */
+        storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility = false, bool simplify = true, bool useRecursiveDescentParser = false);
         
         std::pair<storm::jani::Model, std::map<std::string, storm::jani::Property>> parseJaniModel(std::string const& filename);
         std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseJaniModel(std::string const& filename, storm::jani::ModelFeatures const& allowedFeatures, boost::optional<std::vector<std::string>> const& propertyFilter = boost::none);
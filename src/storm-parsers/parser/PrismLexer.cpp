@@ -0,0 +1,272 @@
+#include "storm-parsers/parser/PrismLexer.h"
+
+#include <unordered_map>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        static bool isWordStart(char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        static bool isDigit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        static bool isWordCharacter(char c) {
+            return isWordStart(c) || isDigit(c);
+        }
+
+        static PrismTokenType getWordType(std::string const& word) {
+            static const std::unordered_map<std::string, PrismTokenType> reservedWords = {
+                {"dtmc", PrismTokenType::Dtmc}, {"ctmc", PrismTokenType::Ctmc}, {"mdp", PrismTokenType::Mdp}, {"ctmdp", PrismTokenType::Ctmdp},
+                {"ma", PrismTokenType::Ma}, {"pomdp", PrismTokenType::Pomdp}, {"pta", PrismTokenType::Pta}, {"const", PrismTokenType::Const},
+                {"int", PrismTokenType::Int}, {"bool", PrismTokenType::Bool}, {"module", PrismTokenType::Module}, {"endmodule", PrismTokenType::EndModule},
+                {"rewards", PrismTokenType::Rewards}, {"endrewards", PrismTokenType::EndRewards}, {"true", PrismTokenType::True}, {"false", PrismTokenType::False},
+                {"min", PrismTokenType::Min}, {"max", PrismTokenType::Max}, {"floor", PrismTokenType::Floor}, {"ceil", PrismTokenType::Ceil},
+                {"init", PrismTokenType::Init}, {"endinit", PrismTokenType::EndInit}, {"invariant", PrismTokenType::Invariant}, {"endinvariant", PrismTokenType::EndInvariant}
+            };
+            auto it = reservedWords.find(word);
+            return it == reservedWords.end() ? PrismTokenType::Identifier : it->second;
+        }
+
+        std::vector<PrismToken> PrismLexer::tokenize(std::string const& input, std::string const& filename) {
+            std::vector<PrismToken> tokens;
+
+            uint64_t const size = input.size();
+            uint64_t position = 0;
+            uint32_t line = 1;
+            if (size >= 3 && input[0] == '\xEF' && input[1] == '\xBB' && input[2] == '\xBF') {
+                position = 3;
+            }
+
+            auto addToken = [&tokens, &line] (PrismTokenType type, uint64_t begin, uint64_t end) {
+                tokens.push_back(PrismToken{type, begin, static_cast<uint32_t>(end - begin), line});
+            };
+            auto peek = [&input, size] (uint64_t index) {
+                return index < size ? input[index] : '\0';
+            };
+
+            while (position < size) {
+                char c = input[position];
+                uint64_t begin = position;
+
+                if (c == '\n') {
+                    ++line;
+                    ++position;
+                } else if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+                    ++position;
+                } else if (c == '/' && peek(position + 1) == '/') {
+                    while (position < size && input[position] != '\n') {
+                        ++position;
+                    }
+                } else if (isWordStart(c)) {
+                    while (position < size && isWordCharacter(input[position])) {
+                        ++position;
+                    }
+                    addToken(getWordType(input.substr(begin, position - begin)), begin, position);
+                } else if (isDigit(c) || (c == '.' && isDigit(peek(position + 1)))) {
+                    // Numbers with a dot or an exponent are rational literals, all others are integer literals. As for
+                    // the strict real policies of Spirit, the exponent does not require a dot (e.g. '1e-3'). A dot that
+                    // is not followed by a digit is not part of the number (e.g. in the range '[0..N]').
+                    bool isRational = false;
+                    while (position < size && isDigit(input[position])) {
+                        ++position;
+                    }
+                    if (peek(position) == '.' && isDigit(peek(position + 1))) {
+                        isRational = true;
+                        ++position;
+                        while (position < size && isDigit(input[position])) {
+                            ++position;
+                        }
+                    }
+                    char e = peek(position);
+                    if (e == 'e' || e == 'E') {
+                        uint64_t exponentPosition = position + 1;
+                        if (peek(exponentPosition) == '+' || peek(exponentPosition) == '-') {
+                            ++exponentPosition;
+                        }
+                        if (isDigit(peek(exponentPosition))) {
+                            isRational = true;
+                            position = exponentPosition;
+                            while (position < size && isDigit(input[position])) {
+                                ++position;
+                            }
+                        }
+                    }
+                    addToken(isRational ? PrismTokenType::RationalLiteral : PrismTokenType::IntegerLiteral, begin, position);
+                } else {
+                    char n = peek(position + 1);
+                    PrismTokenType type;
+                    uint64_t length = 1;
+                    switch (c) {
+                        case '(': type = PrismTokenType::LeftParenthesis; break;
+                        case ')': type = PrismTokenType::RightParenthesis; break;
+                        case '[': type = PrismTokenType::LeftBracket; break;
+                        case ']':
+                            if (n == '|') {
+                                type = PrismTokenType::RightRestrictedParallel;
+                                length = 2;
+                            } else {
+                                type = PrismTokenType::RightBracket;
+                            }
+                            break;
+                        case '{': type = PrismTokenType::LeftBrace; break;
+                        case '}': type = PrismTokenType::RightBrace; break;
+                        case ';': type = PrismTokenType::Semicolon; break;
+                        case ':': type = PrismTokenType::Colon; break;
+                        case ',': type = PrismTokenType::Comma; break;
+                        case '\'': type = PrismTokenType::Prime; break;
+                        case '"': type = PrismTokenType::Quote; break;
+                        case '?': type = PrismTokenType::QuestionMark; break;
+                        case '+': type = PrismTokenType::Plus; break;
+                        case '*': type = PrismTokenType::Times; break;
+                        case '/': type = PrismTokenType::Divide; break;
+                        case '^': type = PrismTokenType::Power; break;
+                        case '%': type = PrismTokenType::Modulo; break;
+                        case '&': type = PrismTokenType::And; break;
+                        case '-':
+                            if (n == '>') {
+                                type = PrismTokenType::Arrow;
+                                length = 2;
+                            } else {
+                                type = PrismTokenType::Minus;
+                            }
+                            break;
+                        case '!':
+                            if (n == '=') {
+                                type = PrismTokenType::NotEqual;
+                                length = 2;
+                            } else {
+                                type = PrismTokenType::Not;
+                            }
+                            break;
+                        case '=':
+                            if (n == '>') {
+                                type = PrismTokenType::Implies;
+                                length = 2;
+                            } else {
+                                type = PrismTokenType::Equal;
+                            }
+                            break;
+                        case '<':
+                            // Note that '<-' (as used for renaming actions) is deliberately not a token as it would
+                            // break expressions like 'x<-1'.
+                            if (n == '=') {
+                                type = PrismTokenType::LessOrEqual;
+                                length = 2;
+                            } else {
+                                type = PrismTokenType::Less;
+                            }
+                            break;
+                        case '>':
+                            if (n == '=') {
+                                type = PrismTokenType::GreaterOrEqual;
+                                length = 2;
+                            } else {
+                                type = PrismTokenType::Greater;
+                            }
+                            break;
+                        case '|':
+                            if (n == '|' && peek(position + 2) == '|') {
+                                type = PrismTokenType::InterleavingParallel;
+                                length = 3;
+                            } else if (n == '|') {
+                                type = PrismTokenType::SynchronizingParallel;
+                                length = 2;
+                            } else if (n == '[') {
+                                type = PrismTokenType::LeftRestrictedParallel;
+                                length = 2;
+                            } else {
+                                type = PrismTokenType::Or;
+                            }
+                            break;
+                        case '.':
+                            STORM_LOG_THROW(n == '.', storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << line << ": unexpected character '.'.");
+                            type = PrismTokenType::DoubleDot;
+                            length = 2;
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << line << ": unexpected character '" << c << "'.");
+                    }
+                    position += length;
+                    addToken(type, begin, position);
+                }
+            }
+            tokens.push_back(PrismToken{PrismTokenType::EndOfInput, size, 0, line});
+            return tokens;
+        }
+
+        std::string PrismLexer::toString(PrismTokenType const& type) {
+            switch (type) {
+                case PrismTokenType::Identifier: return "identifier";
+                case PrismTokenType::IntegerLiteral: return "integer literal";
+                case PrismTokenType::RationalLiteral: return "rational literal";
+                case PrismTokenType::Dtmc: return "'dtmc'";
+                case PrismTokenType::Ctmc: return "'ctmc'";
+                case PrismTokenType::Mdp: return "'mdp'";
+                case PrismTokenType::Ctmdp: return "'ctmdp'";
+                case PrismTokenType::Ma: return "'ma'";
+                case PrismTokenType::Pomdp: return "'pomdp'";
+                case PrismTokenType::Pta: return "'pta'";
+                case PrismTokenType::Const: return "'const'";
+                case PrismTokenType::Int: return "'int'";
+                case PrismTokenType::Bool: return "'bool'";
+                case PrismTokenType::Module: return "'module'";
+                case PrismTokenType::EndModule: return "'endmodule'";
+                case PrismTokenType::Rewards: return "'rewards'";
+                case PrismTokenType::EndRewards: return "'endrewards'";
+                case PrismTokenType::True: return "'true'";
+                case PrismTokenType::False: return "'false'";
+                case PrismTokenType::Min: return "'min'";
+                case PrismTokenType::Max: return "'max'";
+                case PrismTokenType::Floor: return "'floor'";
+                case PrismTokenType::Ceil: return "'ceil'";
+                case PrismTokenType::Init: return "'init'";
+                case PrismTokenType::EndInit: return "'endinit'";
+                case PrismTokenType::Invariant: return "'invariant'";
+                case PrismTokenType::EndInvariant: return "'endinvariant'";
+                case PrismTokenType::LeftParenthesis: return "'('";
+                case PrismTokenType::RightParenthesis: return "')'";
+                case PrismTokenType::LeftBracket: return "'['";
+                case PrismTokenType::RightBracket: return "']'";
+                case PrismTokenType::LeftBrace: return "'{'";
+                case PrismTokenType::RightBrace: return "'}'";
+                case PrismTokenType::Semicolon: return "';'";
+                case PrismTokenType::Colon: return "':'";
+                case PrismTokenType::Comma: return "','";
+                case PrismTokenType::Prime: return "'''";
+                case PrismTokenType::Quote: return "'\"'";
+                case PrismTokenType::QuestionMark: return "'?'";
+                case PrismTokenType::Plus: return "'+'";
+                case PrismTokenType::Minus: return "'-'";
+                case PrismTokenType::Times: return "'*'";
+                case PrismTokenType::Divide: return "'/'";
+                case PrismTokenType::Power: return "'^'";
+                case PrismTokenType::Modulo: return "'%'";
+                case PrismTokenType::Not: return "'!'";
+                case PrismTokenType::And: return "'&'";
+                case PrismTokenType::Or: return "'|'";
+                case PrismTokenType::Implies: return "'=>'";
+                case PrismTokenType::Equal: return "'='";
+                case PrismTokenType::NotEqual: return "'!='";
+                case PrismTokenType::Less: return "'<'";
+                case PrismTokenType::LessOrEqual: return "'<='";
+                case PrismTokenType::Greater: return "'>'";
+                case PrismTokenType::GreaterOrEqual: return "'>='";
+                case PrismTokenType::Arrow: return "'->'";
+                case PrismTokenType::DoubleDot: return "'..'";
+                case PrismTokenType::InterleavingParallel: return "'|||'";
+                case PrismTokenType::SynchronizingParallel: return "'||'";
+                case PrismTokenType::LeftRestrictedParallel: return "'|['";
+                case PrismTokenType::RightRestrictedParallel: return "']|'";
+                case PrismTokenType::EndOfInput: return "end of input";
+            }
+            return "unknown token";
+        }
+
+    }
+}
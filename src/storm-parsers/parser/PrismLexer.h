@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * The token types of the PRISM language. The words that are reserved in PRISM get their own type. All other
+         * words (including the ones that only have a special meaning in some contexts, e.g. 'formula' or 'label') are
+         * identifiers.
+         */
+        enum class PrismTokenType {
+            Identifier, IntegerLiteral, RationalLiteral,
+
+            // Reserved words.
+            Dtmc, Ctmc, Mdp, Ctmdp, Ma, Pomdp, Pta, Const, Int, Bool, Module, EndModule, Rewards, EndRewards, True, False, Min, Max, Floor, Ceil, Init, EndInit, Invariant, EndInvariant,
+
+            // Symbols.
+            LeftParenthesis, RightParenthesis, LeftBracket, RightBracket, LeftBrace, RightBrace, Semicolon, Colon, Comma, Prime, Quote, QuestionMark,
+            Plus, Minus, Times, Divide, Power, Modulo, Not, And, Or, Implies, Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual,
+            Arrow, DoubleDot, InterleavingParallel, SynchronizingParallel, LeftRestrictedParallel, RightRestrictedParallel,
+
+            EndOfInput
+        };
+
+        struct PrismToken {
+            PrismTokenType type;
+
+            // The position and length of the token within the input.
+            uint64_t begin;
+            uint32_t length;
+
+            // The line in which the token appears (starting at 1).
+            uint32_t line;
+        };
+
+        /*!
+         * Splits PRISM input into tokens. Whitespace and comments (from "//" to the end of the line) are skipped.
+         */
+        class PrismLexer {
+        public:
+            /*!
+             * Tokenizes the given input. A leading byte order mark is skipped. The last token is always of type
+             * EndOfInput.
+             *
+             * @param input The input to tokenize.
+             * @param filename The name of the file from which the input was read. This is used for error reporting.
+             * @return The tokens of the input.
+             */
+            static std::vector<PrismToken> tokenize(std::string const& input, std::string const& filename);
+
+            /*!
+             * Retrieves a textual description of the given token type that can be used in error messages.
+             */
+            static std::string toString(PrismTokenType const& type);
+        };
+
+    }
+}
@@ -0,0 +1,1010 @@
+#include "storm-parsers/parser/RecursiveDescentPrismParser.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/prism/Compositions.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/file.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidTypeException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        storm::prism::Program RecursiveDescentPrismParser::parse(std::string const& filename, bool prismCompatibility) {
+            // Open file and read its content into a string.
+            std::ifstream inputFileStream;
+            storm::utility::openFile(filename, inputFileStream);
+            std::stringstream buffer;
+            buffer << inputFileStream.rdbuf();
+            storm::utility::closeFile(inputFileStream);
+
+            return parseFromString(buffer.str(), filename, prismCompatibility);
+        }
+
+        storm::prism::Program RecursiveDescentPrismParser::parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility) {
+            RecursiveDescentPrismParser parser(input, filename, prismCompatibility);
+
+            // In the first pass, we only declare the identifiers, so that they can be used before their declaration.
+            parser.declareIdentifiers();
+
+            // In the second pass, we parse the program.
+            parser.position = 0;
+            storm::prism::Program result = parser.parseProgram();
+
+            STORM_LOG_TRACE("Parsed PRISM input: " << result);
+
+            return result;
+        }
+
+        RecursiveDescentPrismParser::RecursiveDescentPrismParser(std::string const& input, std::string const& filename, bool prismCompatibility) : input(input), filename(filename), prismCompatibility(prismCompatibility), tokens(PrismLexer::tokenize(input, filename)), position(0), manager(new storm::expressions::ExpressionManager()), modelType(storm::prism::Program::ModelType::UNDEFINED), currentCommandIndex(0), currentUpdateIndex(0) {
+            // The silent action always has index zero.
+            actionIndices.emplace("", 0);
+        }
+
+        void RecursiveDescentPrismParser::declareIdentifiers() {
+            parseModelTypeAndObservables();
+            while (peek().type != PrismTokenType::EndOfInput) {
+                PrismToken const& token = peek();
+                switch (token.type) {
+                    case PrismTokenType::Const:
+                        declareConstant();
+                        break;
+                    case PrismTokenType::Module:
+                        declareModule();
+                        break;
+                    case PrismTokenType::Rewards:
+                        skipUntil(PrismTokenType::EndRewards);
+                        break;
+                    case PrismTokenType::Init:
+                        skipUntil(PrismTokenType::EndInit);
+                        break;
+                    case PrismTokenType::Identifier:
+                        if (isWord(token, "global")) {
+                            next();
+                            declareVariableDefinition(nullptr);
+                        } else if (isWord(token, "formula") || isWord(token, "label")) {
+                            skipUntil(PrismTokenType::Semicolon);
+                        } else if (isWord(token, "system")) {
+                            skipUntilWord("endsystem");
+                        } else {
+                            throwUnexpectedToken(token, "declaration");
+                        }
+                        break;
+                    default:
+                        throwUnexpectedToken(token, "declaration");
+                }
+            }
+            STORM_LOG_THROW(observables.empty(), storm::exceptions::WrongFormatException, "Some variables marked as observable, but never declared");
+        }
+
+        void RecursiveDescentPrismParser::parseModelTypeAndObservables() {
+            // As for the Spirit-based parser, the model type is mandatory and has to be given first, optionally followed
+            // by the observables.
+            parseModelType();
+            if (isWord(peek(), "observables")) {
+                parseObservables();
+            }
+        }
+
+        void RecursiveDescentPrismParser::declareConstant() {
+            next();
+            storm::expressions::Type type = parseConstantType();
+            PrismToken const& nameToken = peek();
+            declareVariable(expectIdentifier(), type, true, nameToken);
+            skipUntil(PrismTokenType::Semicolon);
+        }
+
+        void RecursiveDescentPrismParser::declareVariableDefinition(ModuleVariableNames* moduleVariableNames) {
+            PrismToken const& nameToken = peek();
+            std::string name = expectIdentifier();
+            expect(PrismTokenType::Colon);
+
+            if (peek().type == PrismTokenType::Bool) {
+                declareVariable(name, manager->getBooleanType(), false, nameToken);
+                if (moduleVariableNames) {
+                    moduleVariableNames->booleanVariables.push_back(name);
+                }
+            } else if (peek().type == PrismTokenType::LeftBracket) {
+                declareVariable(name, manager->getIntegerType(), false, nameToken);
+                if (moduleVariableNames) {
+                    moduleVariableNames->integerVariables.push_back(name);
+                }
+            } else if (isWord(peek(), "clock") && moduleVariableNames) {
+                declareVariable(name, manager->getRationalType(), false, nameToken);
+                moduleVariableNames->clockVariables.push_back(name);
+            } else {
+                throwUnexpectedToken(peek(), "variable type");
+            }
+            isObservable(name);
+            skipUntil(PrismTokenType::Semicolon);
+        }
+
+        void RecursiveDescentPrismParser::declareModule() {
+            PrismToken const& moduleToken = next();
+            std::string moduleName = expectIdentifier();
+            if (accept(PrismTokenType::Equal)) {
+                declareRenamedModule(moduleName, moduleToken);
+                return;
+            }
+
+            ModuleVariableNames& variableNames = moduleVariableNames[moduleName];
+            variableNames = ModuleVariableNames();
+            while (peek().type == PrismTokenType::Identifier && peek(1).type == PrismTokenType::Colon) {
+                declareVariableDefinition(&variableNames);
+            }
+            if (peek().type == PrismTokenType::Invariant) {
+                skipUntil(PrismTokenType::EndInvariant);
+            }
+
+            // Skip the commands, but record the action names in the order of their appearance.
+            while (!accept(PrismTokenType::EndModule)) {
+                PrismTokenType closingType = PrismTokenType::RightBracket;
+                if (accept(PrismTokenType::LeftBracket)) {
+                    closingType = PrismTokenType::RightBracket;
+                } else if (accept(PrismTokenType::Less)) {
+                    closingType = PrismTokenType::Greater;
+                } else {
+                    throwUnexpectedToken(peek(), "command");
+                }
+                std::string actionName;
+                if (peek().type == PrismTokenType::Identifier) {
+                    actionName = expectIdentifier();
+                }
+                expect(closingType);
+                getActionIndex(actionName);
+                variableNames.actionNames.push_back(actionName);
+                skipUntil(PrismTokenType::Semicolon);
+            }
+        }
+
+        void RecursiveDescentPrismParser::declareRenamedModule(std::string const& moduleName, PrismToken const& moduleToken) {
+            std::string oldModuleName = expectIdentifier();
+            std::map<std::string, std::string> renaming = parseModuleRenaming();
+            expect(PrismTokenType::EndModule);
+
+            auto oldVariableNamesIt = moduleVariableNames.find(oldModuleName);
+            STORM_LOG_THROW(oldVariableNamesIt != moduleVariableNames.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << moduleToken.line << ": No module named '" << oldModuleName << "' to rename.");
+            ModuleVariableNames const& oldVariableNames = oldVariableNamesIt->second;
+
+            // Register all (renamed) variables for later use.
+            ModuleVariableNames variableNames;
+            auto declareRenamedVariables = [&] (std::vector<std::string> const& oldNames, std::vector<std::string>& newNames, storm::expressions::Type const& type, std::string const& kind) {
+                for (auto const& oldName : oldNames) {
+                    auto const& renamingPair = renaming.find(oldName);
+                    STORM_LOG_THROW(renamingPair != renaming.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << moduleToken.line << ": " << kind << " variable '" << oldName << " was not renamed.");
+                    declareVariable(renamingPair->second, type, false, moduleToken);
+                    isObservable(renamingPair->second);
+                    newNames.push_back(renamingPair->second);
+                }
+            };
+            declareRenamedVariables(oldVariableNames.booleanVariables, variableNames.booleanVariables, manager->getBooleanType(), "Boolean");
+            declareRenamedVariables(oldVariableNames.integerVariables, variableNames.integerVariables, manager->getIntegerType(), "Integer");
+            declareRenamedVariables(oldVariableNames.clockVariables, variableNames.clockVariables, manager->getRationalType(), "Clock");
+
+            // Record the (renamed) actions of the commands, such that the action indices are assigned in the same order
+            // as by the Spirit-based parser.
+            for (auto const& oldActionName : oldVariableNames.actionNames) {
+                auto const& renamingPair = renaming.find(oldActionName);
+                std::string const& newActionName = renamingPair == renaming.end() ? oldActionName : renamingPair->second;
+                getActionIndex(newActionName);
+                variableNames.actionNames.push_back(newActionName);
+            }
+            moduleVariableNames[moduleName] = std::move(variableNames);
+        }
+
+        std::map<std::string, std::string> RecursiveDescentPrismParser::parseModuleRenaming() {
+            std::map<std::string, std::string> renaming;
+            expect(PrismTokenType::LeftBracket);
+            do {
+                std::string oldName = expectIdentifier();
+                expect(PrismTokenType::Equal);
+                renaming.emplace(oldName, expectIdentifier());
+            } while (accept(PrismTokenType::Comma));
+            expect(PrismTokenType::RightBracket);
+            return renaming;
+        }
+
+        storm::expressions::Type RecursiveDescentPrismParser::parseConstantType() {
+            if (accept(PrismTokenType::Bool)) {
+                return manager->getBooleanType();
+            } else if (isWord(peek(), "double") && peek(1).type == PrismTokenType::Identifier) {
+                next();
+                return manager->getRationalType();
+            }
+            accept(PrismTokenType::Int);
+            return manager->getIntegerType();
+        }
+
+        void RecursiveDescentPrismParser::skipUntil(PrismTokenType const& type) {
+            while (peek().type != type) {
+                if (peek().type == PrismTokenType::EndOfInput) {
+                    throwUnexpectedToken(peek(), PrismLexer::toString(type));
+                }
+                ++position;
+            }
+            ++position;
+        }
+
+        void RecursiveDescentPrismParser::skipUntilWord(std::string const& word) {
+            while (!isWord(peek(), word)) {
+                if (peek().type == PrismTokenType::EndOfInput) {
+                    throwUnexpectedToken(peek(), "'" + word + "'");
+                }
+                ++position;
+            }
+            ++position;
+        }
+
+        storm::prism::Program RecursiveDescentPrismParser::parseProgram() {
+            parseModelTypeAndObservables();
+            while (peek().type != PrismTokenType::EndOfInput) {
+                PrismToken const& token = peek();
+                switch (token.type) {
+                    case PrismTokenType::Const:
+                        constants.push_back(parseConstant());
+                        break;
+                    case PrismTokenType::Module:
+                        modules.push_back(parseModule());
+                        break;
+                    case PrismTokenType::Rewards:
+                        rewardModels.push_back(parseRewardModel());
+                        break;
+                    case PrismTokenType::Init:
+                        parseInitialConstruct();
+                        break;
+                    case PrismTokenType::Identifier:
+                        if (isWord(token, "global")) {
+                            next();
+                            parseVariable(globalBooleanVariables, globalIntegerVariables, nullptr);
+                        } else if (isWord(token, "formula")) {
+                            formulas.push_back(parseFormula());
+                        } else if (isWord(token, "label")) {
+                            labels.push_back(parseLabel());
+                        } else if (isWord(token, "system")) {
+                            // The system composition construct has to be the last construct of the program.
+                            parseSystemCompositionConstruct();
+                            if (peek().type != PrismTokenType::EndOfInput) {
+                                throwUnexpectedToken(peek(), PrismLexer::toString(PrismTokenType::EndOfInput));
+                            }
+                        } else {
+                            throwUnexpectedToken(token, "declaration");
+                        }
+                        break;
+                    default:
+                        throwUnexpectedToken(token, "declaration");
+                }
+            }
+
+            return storm::prism::Program(manager, modelType, constants, globalBooleanVariables, globalIntegerVariables, formulas, modules, actionIndices, rewardModels, labels, initialConstruct, systemCompositionConstruct, prismCompatibility, filename, 1, true);
+        }
+
+        void RecursiveDescentPrismParser::parseModelType() {
+            switch (peek().type) {
+                case PrismTokenType::Dtmc: modelType = storm::prism::Program::ModelType::DTMC; break;
+                case PrismTokenType::Ctmc: modelType = storm::prism::Program::ModelType::CTMC; break;
+                case PrismTokenType::Mdp: modelType = storm::prism::Program::ModelType::MDP; break;
+                case PrismTokenType::Ctmdp: modelType = storm::prism::Program::ModelType::CTMDP; break;
+                case PrismTokenType::Ma: modelType = storm::prism::Program::ModelType::MA; break;
+                case PrismTokenType::Pomdp: modelType = storm::prism::Program::ModelType::POMDP; break;
+                case PrismTokenType::Pta: modelType = storm::prism::Program::ModelType::PTA; break;
+                default: throwUnexpectedToken(peek(), "model type");
+            }
+            next();
+        }
+
+        void RecursiveDescentPrismParser::parseObservables() {
+            next();
+            do {
+                observables.insert(expectIdentifier());
+            } while (accept(PrismTokenType::Comma));
+            if (!isWord(peek(), "endobservables")) {
+                throwUnexpectedToken(peek(), "'endobservables'");
+            }
+            next();
+        }
+
+        storm::prism::Constant RecursiveDescentPrismParser::parseConstant() {
+            PrismToken const& constToken = next();
+            parseConstantType();
+            PrismToken const& nameToken = peek();
+            storm::expressions::Variable variable = getVariable(expectIdentifier(), nameToken);
+            if (accept(PrismTokenType::Equal)) {
+                storm::expressions::Expression expression = parseExpression();
+                expect(PrismTokenType::Semicolon);
+                return storm::prism::Constant(variable, expression, filename, constToken.line);
+            }
+            expect(PrismTokenType::Semicolon);
+            return storm::prism::Constant(variable, filename, constToken.line);
+        }
+
+        storm::prism::Formula RecursiveDescentPrismParser::parseFormula() {
+            PrismToken const& formulaToken = next();
+            PrismToken const& nameToken = peek();
+            std::string name = expectIdentifier();
+            expect(PrismTokenType::Equal);
+            storm::expressions::Expression expression = parseExpression();
+            expect(PrismTokenType::Semicolon);
+
+            // Formulas are only declared now as their type is only known after parsing their expression. This
+            // prevents formulas from depending on formulas that are defined later.
+            storm::expressions::Variable variable;
+            if (expression.hasIntegerType()) {
+                variable = declareVariable(name, manager->getIntegerType(), false, nameToken);
+            } else if (expression.hasBooleanType()) {
+                variable = declareVariable(name, manager->getBooleanType(), false, nameToken);
+            } else {
+                STORM_LOG_ASSERT(expression.hasNumericalType(), "Unexpected type for formula expression of formula " << name);
+                variable = declareVariable(name, manager->getRationalType(), false, nameToken);
+            }
+            return storm::prism::Formula(variable, expression, filename, formulaToken.line);
+        }
+
+        void RecursiveDescentPrismParser::parseVariable(std::vector<storm::prism::BooleanVariable>& booleanVariables, std::vector<storm::prism::IntegerVariable>& integerVariables, std::vector<storm::prism::ClockVariable>* clockVariables) {
+            PrismToken const& nameToken = peek();
+            std::string name = expectIdentifier();
+            expect(PrismTokenType::Colon);
+            storm::expressions::Variable variable = getVariable(name, nameToken);
+            bool observable = isObservable(name);
+
+            if (accept(PrismTokenType::Bool)) {
+                storm::expressions::Expression initialValueExpression;
+                if (accept(PrismTokenType::Init)) {
+                    initialValueExpression = parseExpression();
+                }
+                expect(PrismTokenType::Semicolon);
+                booleanVariables.emplace_back(variable, initialValueExpression, observable, filename, nameToken.line);
+            } else if (accept(PrismTokenType::LeftBracket)) {
+                storm::expressions::Expression lowerBoundExpression = parseExpression();
+                expect(PrismTokenType::DoubleDot);
+                storm::expressions::Expression upperBoundExpression = parseExpression();
+                expect(PrismTokenType::RightBracket);
+                storm::expressions::Expression initialValueExpression;
+                if (accept(PrismTokenType::Init)) {
+                    initialValueExpression = parseExpression();
+                }
+                expect(PrismTokenType::Semicolon);
+                integerVariables.emplace_back(variable, lowerBoundExpression, upperBoundExpression, initialValueExpression, observable, filename, nameToken.line);
+            } else if (isWord(peek(), "clock") && clockVariables) {
+                next();
+                expect(PrismTokenType::Semicolon);
+                clockVariables->emplace_back(variable, observable, filename, nameToken.line);
+            } else {
+                throwUnexpectedToken(peek(), "variable type");
+            }
+        }
+
+        storm::prism::Module RecursiveDescentPrismParser::parseModule() {
+            PrismToken const& moduleToken = next();
+            std::string moduleName = expectIdentifier();
+            if (accept(PrismTokenType::Equal)) {
+                return parseRenamedModule(moduleName, moduleToken);
+            }
+
+            std::vector<storm::prism::BooleanVariable> booleanVariables;
+            std::vector<storm::prism::IntegerVariable> integerVariables;
+            std::vector<storm::prism::ClockVariable> clockVariables;
+            while (peek().type == PrismTokenType::Identifier && peek(1).type == PrismTokenType::Colon) {
+                parseVariable(booleanVariables, integerVariables, &clockVariables);
+            }
+
+            storm::expressions::Expression invariant;
+            if (accept(PrismTokenType::Invariant)) {
+                invariant = parseExpression();
+                expect(PrismTokenType::EndInvariant);
+            }
+
+            std::vector<storm::prism::Command> commands;
+            while (!accept(PrismTokenType::EndModule)) {
+                commands.push_back(parseCommand());
+            }
+
+            moduleToIndexMap[moduleName] = modules.size();
+            return storm::prism::Module(moduleName, booleanVariables, integerVariables, clockVariables, invariant, commands, filename, moduleToken.line);
+        }
+
+        storm::prism::Module RecursiveDescentPrismParser::parseRenamedModule(std::string const& moduleName, PrismToken const& moduleToken) {
+            std::string oldModuleName = expectIdentifier();
+            std::map<std::string, std::string> renaming = parseModuleRenaming();
+            expect(PrismTokenType::EndModule);
+
+            // Check whether the module to rename actually exists.
+            auto const& moduleIndexPair = moduleToIndexMap.find(oldModuleName);
+            STORM_LOG_THROW(moduleIndexPair != moduleToIndexMap.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << moduleToken.line << ": No module named '" << oldModuleName << "' to rename.");
+            storm::prism::Module const& moduleToRename = modules[moduleIndexPair->second];
+            uint_fast64_t const line = moduleToken.line;
+
+            // Add a mapping from the new module name to its (future) index.
+            moduleToIndexMap[moduleName] = modules.size();
+
+            // Create a mapping from identifiers to the expressions they need to be replaced with.
+            std::map<storm::expressions::Variable, storm::expressions::Expression> expressionRenaming;
+            for (auto const& namePair : renaming) {
+                auto substitutedExpressionIt = identifiers.find(namePair.second);
+                // If the mapped-to-value is an expression, we need to replace it.
+                if (substitutedExpressionIt != identifiers.end() && manager->hasVariable(namePair.first)) {
+                    expressionRenaming.emplace(manager->getVariable(namePair.first), substitutedExpressionIt->second);
+                }
+            }
+
+            // Rename the boolean variables.
+            std::vector<storm::prism::BooleanVariable> booleanVariables;
+            for (auto const& variable : moduleToRename.getBooleanVariables()) {
+                auto const& renamingPair = renaming.find(variable.getName());
+                STORM_LOG_THROW(renamingPair != renaming.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << line << ": Boolean variable '" << variable.getName() << " was not renamed.");
+                bool observable = isObservable(renamingPair->second);
+                booleanVariables.push_back(storm::prism::BooleanVariable(getVariable(renamingPair->second, moduleToken), variable.hasInitialValue() ? variable.getInitialValueExpression().substitute(expressionRenaming) : variable.getInitialValueExpression(), observable, filename, line));
+            }
+
+            // Rename the integer variables.
+            std::vector<storm::prism::IntegerVariable> integerVariables;
+            for (auto const& variable : moduleToRename.getIntegerVariables()) {
+                auto const& renamingPair = renaming.find(variable.getName());
+                STORM_LOG_THROW(renamingPair != renaming.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << line << ": Integer variable '" << variable.getName() << " was not renamed.");
+                bool observable = isObservable(renamingPair->second);
+                integerVariables.push_back(storm::prism::IntegerVariable(getVariable(renamingPair->second, moduleToken), variable.getLowerBoundExpression().substitute(expressionRenaming), variable.getUpperBoundExpression().substitute(expressionRenaming), variable.hasInitialValue() ? variable.getInitialValueExpression().substitute(expressionRenaming) : variable.getInitialValueExpression(), observable, filename, line));
+            }
+
+            // Rename the clock variables.
+            std::vector<storm::prism::ClockVariable> clockVariables;
+            for (auto const& variable : moduleToRename.getClockVariables()) {
+                auto const& renamingPair = renaming.find(variable.getName());
+                STORM_LOG_THROW(renamingPair != renaming.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << line << ": Clock variable '" << variable.getName() << " was not renamed.");
+                bool observable = isObservable(renamingPair->second);
+                clockVariables.push_back(storm::prism::ClockVariable(getVariable(renamingPair->second, moduleToken), observable, filename, line));
+            }
+
+            // Rename invariant (if present).
+            storm::expressions::Expression invariant;
+            if (moduleToRename.hasInvariant()) {
+                invariant = moduleToRename.getInvariant().substitute(expressionRenaming);
+            }
+
+            // Rename commands.
+            std::vector<storm::prism::Command> commands;
+            for (auto const& command : moduleToRename.getCommands()) {
+                std::vector<storm::prism::Update> updates;
+                for (auto const& update : command.getUpdates()) {
+                    std::vector<storm::prism::Assignment> assignments;
+                    for (auto const& assignment : update.getAssignments()) {
+                        auto const& renamingPair = renaming.find(assignment.getVariableName());
+                        if (renamingPair != renaming.end()) {
+                            assignments.emplace_back(getVariable(renamingPair->second, moduleToken), assignment.getExpression().substitute(expressionRenaming), filename, line);
+                        } else {
+                            assignments.emplace_back(assignment.getVariable(), assignment.getExpression().substitute(expressionRenaming), filename, line);
+                        }
+                    }
+                    updates.emplace_back(currentUpdateIndex, update.getLikelihoodExpression().substitute(expressionRenaming), assignments, filename, line);
+                    ++currentUpdateIndex;
+                }
+
+                std::string newActionName = command.getActionName();
+                auto const& renamingPair = renaming.find(command.getActionName());
+                if (renamingPair != renaming.end()) {
+                    newActionName = renamingPair->second;
+                }
+
+                commands.emplace_back(currentCommandIndex, command.isMarkovian(), getActionIndex(newActionName), newActionName, command.getGuardExpression().substitute(expressionRenaming), updates, filename, line);
+                ++currentCommandIndex;
+            }
+
+            return storm::prism::Module(moduleName, booleanVariables, integerVariables, clockVariables, invariant, commands, oldModuleName, renaming, filename, line);
+        }
+
+        storm::prism::Command RecursiveDescentPrismParser::parseCommand() {
+            PrismToken const& commandToken = peek();
+            bool markovian = false;
+            PrismTokenType closingType = PrismTokenType::RightBracket;
+            if (accept(PrismTokenType::LeftBracket)) {
+                closingType = PrismTokenType::RightBracket;
+            } else if (accept(PrismTokenType::Less)) {
+                markovian = true;
+                closingType = PrismTokenType::Greater;
+            } else {
+                throwUnexpectedToken(commandToken, "command");
+            }
+            std::string actionName;
+            if (peek().type == PrismTokenType::Identifier) {
+                actionName = expectIdentifier();
+            }
+            expect(closingType);
+
+            storm::expressions::Expression guardExpression = parseExpression();
+            expect(PrismTokenType::Arrow);
+            std::vector<storm::prism::Update> updates;
+            updates.push_back(parseUpdate());
+            while (accept(PrismTokenType::Plus)) {
+                updates.push_back(parseUpdate());
+            }
+            expect(PrismTokenType::Semicolon);
+
+            uint_fast64_t actionIndex = getActionIndex(actionName);
+            ++currentCommandIndex;
+            return storm::prism::Command(currentCommandIndex - 1, markovian, actionIndex, actionName, guardExpression, updates, filename, commandToken.line);
+        }
+
+        storm::prism::Update RecursiveDescentPrismParser::parseUpdate() {
+            PrismToken const& updateToken = peek();
+
+            // The likelihood may be omitted, in which case the update directly starts with its assignments.
+            bool startsWithAssignment = peek().type == PrismTokenType::LeftParenthesis && peek(1).type == PrismTokenType::Identifier && peek(2).type == PrismTokenType::Prime;
+            bool isEmptyAssignment = peek().type == PrismTokenType::True && (peek(1).type == PrismTokenType::Semicolon || peek(1).type == PrismTokenType::Plus);
+            storm::expressions::Expression likelihoodExpression;
+            if (startsWithAssignment || isEmptyAssignment) {
+                likelihoodExpression = manager->rational(1);
+            } else {
+                likelihoodExpression = parseExpression();
+                expect(PrismTokenType::Colon);
+            }
+
+            std::vector<storm::prism::Assignment> assignments;
+            if (!accept(PrismTokenType::True)) {
+                do {
+                    assignments.push_back(parseAssignment());
+                } while (accept(PrismTokenType::And));
+            }
+
+            ++currentUpdateIndex;
+            return storm::prism::Update(currentUpdateIndex - 1, likelihoodExpression, assignments, filename, updateToken.line);
+        }
+
+        storm::prism::Assignment RecursiveDescentPrismParser::parseAssignment() {
+            PrismToken const& assignmentToken = expect(PrismTokenType::LeftParenthesis);
+            PrismToken const& nameToken = peek();
+            storm::expressions::Variable variable = getVariable(expectIdentifier(), nameToken);
+            expect(PrismTokenType::Prime);
+            expect(PrismTokenType::Equal);
+            storm::expressions::Expression expression = parseExpression();
+            expect(PrismTokenType::RightParenthesis);
+            return storm::prism::Assignment(variable, expression, filename, assignmentToken.line);
+        }
+
+        storm::prism::RewardModel RecursiveDescentPrismParser::parseRewardModel() {
+            PrismToken const& rewardsToken = next();
+            std::string rewardModelName;
+            if (accept(PrismTokenType::Quote)) {
+                rewardModelName = expectIdentifier();
+                expect(PrismTokenType::Quote);
+            }
+
+            std::vector<storm::prism::StateReward> stateRewards;
+            std::vector<storm::prism::StateActionReward> stateActionRewards;
+            std::vector<storm::prism::TransitionReward> transitionRewards;
+            // As for the Spirit-based parser, a reward model needs to have at least one reward definition.
+            if (peek().type == PrismTokenType::EndRewards) {
+                throwUnexpectedToken(peek(), "reward definition");
+            }
+            while (!accept(PrismTokenType::EndRewards)) {
+                PrismToken const& rewardToken = peek();
+                if (accept(PrismTokenType::LeftBracket)) {
+                    std::string actionName;
+                    if (peek().type == PrismTokenType::Identifier) {
+                        actionName = expectIdentifier();
+                    }
+                    expect(PrismTokenType::RightBracket);
+                    auto const& nameIndexPair = actionIndices.find(actionName);
+                    STORM_LOG_THROW(nameIndexPair != actionIndices.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << rewardToken.line << ": Reward refers to illegal action '" << actionName << "'.");
+
+                    storm::expressions::Expression statePredicateExpression = parseExpression();
+                    if (accept(PrismTokenType::Arrow)) {
+                        storm::expressions::Expression targetStatePredicateExpression = parseExpression();
+                        expect(PrismTokenType::Colon);
+                        storm::expressions::Expression rewardValueExpression = parseExpression();
+                        expect(PrismTokenType::Semicolon);
+                        transitionRewards.emplace_back(nameIndexPair->second, actionName, statePredicateExpression, targetStatePredicateExpression, rewardValueExpression, filename, rewardToken.line);
+                    } else {
+                        expect(PrismTokenType::Colon);
+                        storm::expressions::Expression rewardValueExpression = parseExpression();
+                        expect(PrismTokenType::Semicolon);
+                        stateActionRewards.emplace_back(nameIndexPair->second, actionName, statePredicateExpression, rewardValueExpression, filename, rewardToken.line);
+                    }
+                } else {
+                    storm::expressions::Expression statePredicateExpression = parseExpression();
+                    expect(PrismTokenType::Colon);
+                    storm::expressions::Expression rewardValueExpression = parseExpression();
+                    expect(PrismTokenType::Semicolon);
+                    stateRewards.emplace_back(statePredicateExpression, rewardValueExpression, filename, rewardToken.line);
+                }
+            }
+
+            return storm::prism::RewardModel(rewardModelName, stateRewards, stateActionRewards, transitionRewards, filename, rewardsToken.line);
+        }
+
+        storm::prism::Label RecursiveDescentPrismParser::parseLabel() {
+            PrismToken const& labelToken = next();
+            accept(PrismTokenType::Quote);
+            std::string labelName = expectIdentifier();
+            accept(PrismTokenType::Quote);
+            expect(PrismTokenType::Equal);
+            storm::expressions::Expression statePredicateExpression = parseExpression();
+            expect(PrismTokenType::Semicolon);
+            return storm::prism::Label(labelName, statePredicateExpression, filename, labelToken.line);
+        }
+
+        void RecursiveDescentPrismParser::parseInitialConstruct() {
+            PrismToken const& initToken = next();
+            STORM_LOG_THROW(!initialConstruct, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << initToken.line << ": Program must not define two initial constructs.");
+            storm::expressions::Expression initialStatesExpression = parseExpression();
+            expect(PrismTokenType::EndInit);
+            initialConstruct = storm::prism::InitialConstruct(initialStatesExpression, filename, initToken.line);
+        }
+
+        void RecursiveDescentPrismParser::parseSystemCompositionConstruct() {
+            PrismToken const& systemToken = next();
+            STORM_LOG_THROW(!systemCompositionConstruct, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << systemToken.line << ": Program must not define two system composition constructs.");
+            std::shared_ptr<storm::prism::Composition> composition = parseParallelComposition();
+            if (!isWord(peek(), "endsystem")) {
+                throwUnexpectedToken(peek(), "'endsystem'");
+            }
+            next();
+            systemCompositionConstruct = storm::prism::SystemCompositionConstruct(composition, filename, systemToken.line);
+        }
+
+        std::shared_ptr<storm::prism::Composition> RecursiveDescentPrismParser::parseParallelComposition() {
+            std::shared_ptr<storm::prism::Composition> result = parseHidingOrRenamingComposition();
+            while (true) {
+                if (accept(PrismTokenType::InterleavingParallel)) {
+                    result = std::make_shared<storm::prism::InterleavingParallelComposition>(result, parseHidingOrRenamingComposition());
+                } else if (accept(PrismTokenType::SynchronizingParallel)) {
+                    result = std::make_shared<storm::prism::SynchronizingParallelComposition>(result, parseHidingOrRenamingComposition());
+                } else if (accept(PrismTokenType::LeftRestrictedParallel)) {
+                    std::set<std::string> synchronizingActions = parseActionNameList();
+                    expect(PrismTokenType::RightRestrictedParallel);
+                    result = std::make_shared<storm::prism::RestrictedParallelComposition>(result, synchronizingActions, parseHidingOrRenamingComposition());
+                } else {
+                    return result;
+                }
+            }
+        }
+
+        std::shared_ptr<storm::prism::Composition> RecursiveDescentPrismParser::parseHidingOrRenamingComposition() {
+            std::shared_ptr<storm::prism::Composition> subcomposition = parseAtomicComposition();
+            if (accept(PrismTokenType::Divide)) {
+                expect(PrismTokenType::LeftBrace);
+                std::set<std::string> actionsToHide = parseActionNameList();
+                expect(PrismTokenType::RightBrace);
+                return std::make_shared<storm::prism::HidingComposition>(subcomposition, actionsToHide);
+            } else if (accept(PrismTokenType::LeftBrace)) {
+                // The arrow '<-' is not a token on its own, as this would break expressions like 'x<-1'.
+                std::map<std::string, std::string> renaming;
+                do {
+                    std::string oldName = expectIdentifier();
+                    expect(PrismTokenType::Less);
+                    expect(PrismTokenType::Minus);
+                    renaming.emplace(oldName, expectIdentifier());
+                    accept(PrismTokenType::Comma);
+                } while (!accept(PrismTokenType::RightBrace));
+                return std::make_shared<storm::prism::RenamingComposition>(subcomposition, renaming);
+            }
+            return subcomposition;
+        }
+
+        std::shared_ptr<storm::prism::Composition> RecursiveDescentPrismParser::parseAtomicComposition() {
+            if (accept(PrismTokenType::LeftParenthesis)) {
+                std::shared_ptr<storm::prism::Composition> composition = parseParallelComposition();
+                expect(PrismTokenType::RightParenthesis);
+                return composition;
+            }
+            return std::make_shared<storm::prism::ModuleComposition>(expectIdentifier());
+        }
+
+        std::set<std::string> RecursiveDescentPrismParser::parseActionNameList() {
+            std::set<std::string> actionNames;
+            do {
+                actionNames.insert(expectIdentifier());
+            } while (accept(PrismTokenType::Comma));
+            return actionNames;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseExpression() {
+            storm::expressions::Expression condition = parseOrExpression();
+            PrismToken const& token = peek();
+            if (accept(PrismTokenType::QuestionMark)) {
+                storm::expressions::Expression thenExpression = parseExpression();
+                expect(PrismTokenType::Colon);
+                storm::expressions::Expression elseExpression = parseExpression();
+                try {
+                    return storm::expressions::ite(condition, thenExpression, elseExpression);
+                } catch (storm::exceptions::InvalidTypeException const& e) {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": " << e.what());
+                }
+            }
+            return condition;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseOrExpression() {
+            storm::expressions::Expression result = parseAndExpression();
+            while (peek().type == PrismTokenType::Or || peek().type == PrismTokenType::Implies) {
+                PrismToken const& operatorToken = next();
+                result = createBinaryExpression(operatorToken, result, parseAndExpression());
+            }
+            return result;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseAndExpression() {
+            storm::expressions::Expression result = parseEqualityExpression();
+            while (peek().type == PrismTokenType::And) {
+                PrismToken const& operatorToken = next();
+                result = createBinaryExpression(operatorToken, result, parseEqualityExpression());
+            }
+            return result;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseEqualityExpression() {
+            storm::expressions::Expression result = parseRelationalExpression();
+            while (peek().type == PrismTokenType::Equal || peek().type == PrismTokenType::NotEqual) {
+                PrismToken const& operatorToken = next();
+                result = createBinaryExpression(operatorToken, result, parseRelationalExpression());
+            }
+            return result;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseRelationalExpression() {
+            storm::expressions::Expression result = parsePlusExpression();
+            PrismTokenType type = peek().type;
+            if (type == PrismTokenType::Less || type == PrismTokenType::LessOrEqual || type == PrismTokenType::Greater || type == PrismTokenType::GreaterOrEqual) {
+                PrismToken const& operatorToken = next();
+                result = createBinaryExpression(operatorToken, result, parsePlusExpression());
+            }
+            return result;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parsePlusExpression() {
+            storm::expressions::Expression result = parseMultiplicationExpression();
+            while (peek().type == PrismTokenType::Plus || peek().type == PrismTokenType::Minus) {
+                PrismToken const& operatorToken = next();
+                result = createBinaryExpression(operatorToken, result, parseMultiplicationExpression());
+            }
+            return result;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseMultiplicationExpression() {
+            storm::expressions::Expression result = parsePowerModuloExpression();
+            while (peek().type == PrismTokenType::Times || peek().type == PrismTokenType::Divide) {
+                PrismToken const& operatorToken = next();
+                result = createBinaryExpression(operatorToken, result, parsePowerModuloExpression());
+            }
+            return result;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parsePowerModuloExpression() {
+            storm::expressions::Expression result = parseUnaryExpression();
+            if (peek().type == PrismTokenType::Power || peek().type == PrismTokenType::Modulo) {
+                // As in the ExpressionParser, the right-hand side of an infix power/modulo is a full expression.
+                PrismToken const& operatorToken = next();
+                result = createBinaryExpression(operatorToken, result, parseExpression());
+            }
+            return result;
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseUnaryExpression() {
+            PrismToken const& operatorToken = peek();
+            if (accept(PrismTokenType::Not) || accept(PrismTokenType::Minus)) {
+                storm::expressions::Expression operand = parseAtomicExpression();
+                try {
+                    return operatorToken.type == PrismTokenType::Not ? !operand : -operand;
+                } catch (storm::exceptions::InvalidTypeException const& e) {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << operatorToken.line << ": " << e.what());
+                }
+            }
+            return parseAtomicExpression();
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseAtomicExpression() {
+            PrismToken const& token = next();
+            switch (token.type) {
+                case PrismTokenType::Floor:
+                case PrismTokenType::Ceil: {
+                    expect(PrismTokenType::LeftParenthesis);
+                    storm::expressions::Expression operand = parseExpression();
+                    expect(PrismTokenType::RightParenthesis);
+                    try {
+                        return token.type == PrismTokenType::Floor ? storm::expressions::floor(operand) : storm::expressions::ceil(operand);
+                    } catch (storm::exceptions::InvalidTypeException const& e) {
+                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": " << e.what());
+                    }
+                }
+                case PrismTokenType::Min:
+                case PrismTokenType::Max: {
+                    expect(PrismTokenType::LeftParenthesis);
+                    storm::expressions::Expression result = parseExpression();
+                    expect(PrismTokenType::Comma);
+                    do {
+                        result = createBinaryExpression(token, result, parseExpression());
+                    } while (accept(PrismTokenType::Comma));
+                    expect(PrismTokenType::RightParenthesis);
+                    return result;
+                }
+                case PrismTokenType::LeftParenthesis: {
+                    storm::expressions::Expression result = parseExpression();
+                    expect(PrismTokenType::RightParenthesis);
+                    return result;
+                }
+                case PrismTokenType::True:
+                    return manager->boolean(true);
+                case PrismTokenType::False:
+                    return manager->boolean(false);
+                case PrismTokenType::IntegerLiteral:
+                    return parseIntegerLiteral(token);
+                case PrismTokenType::RationalLiteral:
+                    return parseRationalLiteral(token);
+                case PrismTokenType::Identifier: {
+                    if (peek().type == PrismTokenType::LeftParenthesis) {
+                        if (isWord(token, "round")) {
+                            next();
+                            storm::expressions::Expression operand = parseExpression();
+                            expect(PrismTokenType::RightParenthesis);
+                            try {
+                                return storm::expressions::round(operand);
+                            } catch (storm::exceptions::InvalidTypeException const& e) {
+                                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": " << e.what());
+                            }
+                        } else if (isWord(token, "pow") || isWord(token, "mod") || isWord(token, "func")) {
+                            next();
+                            PrismToken const& operatorToken = isWord(token, "func") ? next() : token;
+                            if (!isWord(operatorToken, "pow") && !isWord(operatorToken, "mod")) {
+                                throwUnexpectedToken(operatorToken, "'pow' or 'mod'");
+                            }
+                            if (&operatorToken != &token) {
+                                expect(PrismTokenType::Comma);
+                            }
+                            storm::expressions::Expression first = parseExpression();
+                            expect(PrismTokenType::Comma);
+                            storm::expressions::Expression second = parseExpression();
+                            expect(PrismTokenType::RightParenthesis);
+                            return createBinaryExpression(operatorToken, first, second);
+                        }
+                    }
+                    auto identifierIt = identifiers.find(getText(token));
+                    STORM_LOG_THROW(identifierIt != identifiers.end(), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": Undeclared identifier '" << getText(token) << "'.");
+                    return identifierIt->second;
+                }
+                default:
+                    throwUnexpectedToken(token, "expression");
+            }
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseRationalLiteral(PrismToken const& token) const {
+            // To obtain the exact value, we parse the digits as an integer and scale it by the (adjusted) exponent.
+            std::string text = getText(token);
+            std::size_t exponentPosition = text.find_first_of("eE");
+            int_fast64_t exponent = exponentPosition == std::string::npos ? 0 : std::stoll(text.substr(exponentPosition + 1));
+            std::string digits = text.substr(0, exponentPosition);
+            std::size_t dotPosition = digits.find('.');
+            if (dotPosition != std::string::npos) {
+                exponent -= static_cast<int_fast64_t>(digits.size() - dotPosition - 1);
+                digits.erase(dotPosition, 1);
+            }
+            std::size_t firstNonZero = digits.find_first_not_of('0');
+            digits = firstNonZero == std::string::npos ? "0" : digits.substr(firstNonZero);
+
+            storm::RationalNumber value = storm::utility::convertNumber<storm::RationalNumber>(digits);
+            if (exponent >= 0) {
+                value *= storm::utility::pow(storm::RationalNumber(10), static_cast<uint_fast64_t>(exponent));
+            } else {
+                value /= storm::utility::pow(storm::RationalNumber(10), static_cast<uint_fast64_t>(-exponent));
+            }
+            return manager->rational(value);
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::parseIntegerLiteral(PrismToken const& token) const {
+            int_fast64_t value;
+            try {
+                value = std::stoll(getText(token));
+            } catch (std::out_of_range const&) {
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": integer literal '" << getText(token) << "' is out of range.");
+            }
+            return manager->integer(value);
+        }
+
+        storm::expressions::Expression RecursiveDescentPrismParser::createBinaryExpression(PrismToken const& operatorToken, storm::expressions::Expression const& left, storm::expressions::Expression const& right) const {
+            try {
+                switch (operatorToken.type) {
+                    case PrismTokenType::Or: return left || right;
+                    case PrismTokenType::Implies: return storm::expressions::implies(left, right);
+                    case PrismTokenType::And: return left && right;
+                    case PrismTokenType::Equal: return left.hasBooleanType() && right.hasBooleanType() ? storm::expressions::iff(left, right) : left == right;
+                    case PrismTokenType::NotEqual: return left != right;
+                    case PrismTokenType::Less: return left < right;
+                    case PrismTokenType::LessOrEqual: return left <= right;
+                    case PrismTokenType::Greater: return left > right;
+                    case PrismTokenType::GreaterOrEqual: return left >= right;
+                    case PrismTokenType::Plus: return left + right;
+                    case PrismTokenType::Minus: return left - right;
+                    case PrismTokenType::Times: return left * right;
+                    case PrismTokenType::Divide: return left / right;
+                    case PrismTokenType::Power: return left ^ right;
+                    case PrismTokenType::Modulo: return left % right;
+                    case PrismTokenType::Min: return storm::expressions::minimum(left, right);
+                    case PrismTokenType::Max: return storm::expressions::maximum(left, right);
+                    case PrismTokenType::Identifier: return isWord(operatorToken, "pow") ? left ^ right : left % right;
+                    default: STORM_LOG_ASSERT(false, "Invalid operation."); break;
+                }
+            } catch (storm::exceptions::InvalidTypeException const& e) {
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << operatorToken.line << ": " << e.what());
+            }
+            return manager->boolean(false);
+        }
+
+        PrismToken const& RecursiveDescentPrismParser::peek(uint64_t offset) const {
+            return tokens[std::min<uint64_t>(position + offset, tokens.size() - 1)];
+        }
+
+        PrismToken const& RecursiveDescentPrismParser::next() {
+            PrismToken const& token = tokens[position];
+            if (token.type != PrismTokenType::EndOfInput) {
+                ++position;
+            }
+            return token;
+        }
+
+        bool RecursiveDescentPrismParser::accept(PrismTokenType const& type) {
+            if (peek().type == type) {
+                next();
+                return true;
+            }
+            return false;
+        }
+
+        PrismToken const& RecursiveDescentPrismParser::expect(PrismTokenType const& type) {
+            if (peek().type != type) {
+                throwUnexpectedToken(peek(), PrismLexer::toString(type));
+            }
+            return next();
+        }
+
+        bool RecursiveDescentPrismParser::isWord(PrismToken const& token, std::string const& word) const {
+            return token.type == PrismTokenType::Identifier && token.length == word.size() && input.compare(token.begin, token.length, word) == 0;
+        }
+
+        std::string RecursiveDescentPrismParser::getText(PrismToken const& token) const {
+            return input.substr(token.begin, token.length);
+        }
+
+        std::string RecursiveDescentPrismParser::expectIdentifier() {
+            return getText(expect(PrismTokenType::Identifier));
+        }
+
+        void RecursiveDescentPrismParser::throwUnexpectedToken(PrismToken const& token, std::string const& expected) const {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": expected " << expected << ", but found " << (token.type == PrismTokenType::EndOfInput ? "end of input" : "'" + getText(token) + "'") << ".");
+        }
+
+        storm::expressions::Variable RecursiveDescentPrismParser::declareVariable(std::string const& name, storm::expressions::Type const& type, bool auxiliary, PrismToken const& token) {
+            STORM_LOG_THROW(!manager->hasVariable(name), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": Duplicate identifier '" << name << "'.");
+            storm::expressions::Variable variable;
+            try {
+                variable = manager->declareVariable(name, type, auxiliary);
+            } catch (storm::exceptions::InvalidArgumentException const&) {
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": illegal identifier '" << name << "'.");
+            }
+            identifiers.emplace(name, variable.getExpression());
+            return variable;
+        }
+
+        storm::expressions::Variable RecursiveDescentPrismParser::getVariable(std::string const& name, PrismToken const& token) const {
+            STORM_LOG_THROW(manager->hasVariable(name), storm::exceptions::WrongFormatException, "Parsing error in " << filename << ", line " << token.line << ": Undeclared variable '" << name << "'.");
+            return manager->getVariable(name);
+        }
+
+        bool RecursiveDescentPrismParser::isObservable(std::string const& name) {
+            return observables.erase(name) > 0;
+        }
+
+        uint_fast64_t RecursiveDescentPrismParser::getActionIndex(std::string const& actionName) {
+            auto nameIndexPair = actionIndices.find(actionName);
+            if (nameIndexPair == actionIndices.end()) {
+                std::size_t nextIndex = actionIndices.size();
+                actionIndices.emplace(actionName, nextIndex);
+                return nextIndex;
+            }
+            return nameIndexPair->second;
+        }
+
+    }
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm-parsers/parser/PrismLexer.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Type.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace expressions {
+        class ExpressionManager;
+    }
+
+    namespace parser {
+
+        /*!
+         * A hand-written parser for the PRISM language that produces the same programs as the Spirit-based
+         * PrismParser, but avoids its backtracking. The input is tokenized once. A first pass over the tokens only
+         * declares the constants and variables (so that they can be used before their declaration) and collects the
+         * action names in the order of their occurrence. The second pass then parses all expressions, commands etc.
+         * with a recursive-descent parser.
+         */
+        class RecursiveDescentPrismParser {
+        public:
+            /*!
+             * Parses the given file into the PRISM storage classes assuming it complies with the PRISM syntax.
+             *
+             * @param filename the name of the file to parse.
+             * @return The resulting PRISM program.
+             */
+            static storm::prism::Program parse(std::string const& filename, bool prismCompatibility = false);
+
+            /*!
+             * Parses the given input into the PRISM storage classes assuming it complies with the PRISM syntax.
+             *
+             * @param input The input string to parse.
+             * @param filename The name of the file from which the input was read.
+             * @return The resulting PRISM program.
+             */
+            static storm::prism::Program parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility = false);
+
+        private:
+            RecursiveDescentPrismParser(std::string const& input, std::string const& filename, bool prismCompatibility);
+
+            // The variables of a module and the action names of its commands (as declared in the first pass), which are
+            // needed to declare the variables and actions of modules that are obtained by renaming.
+            struct ModuleVariableNames {
+                std::vector<std::string> booleanVariables;
+                std::vector<std::string> integerVariables;
+                std::vector<std::string> clockVariables;
+                std::vector<std::string> actionNames;
+            };
+
+            // Methods of the first pass. Some of them (e.g. parsing the renaming of a module) are shared with the second pass.
+            void declareIdentifiers();
+            void declareConstant();
+            void declareVariableDefinition(ModuleVariableNames* moduleVariableNames);
+            void declareModule();
+            void declareRenamedModule(std::string const& moduleName, PrismToken const& moduleToken);
+            std::map<std::string, std::string> parseModuleRenaming();
+            void parseModelTypeAndObservables();
+            void parseModelType();
+            storm::expressions::Type parseConstantType();
+            void skipUntil(PrismTokenType const& type);
+            void skipUntilWord(std::string const& word);
+
+            // Methods of the second pass.
+            storm::prism::Program parseProgram();
+            void parseObservables();
+            storm::prism::Constant parseConstant();
+            storm::prism::Formula parseFormula();
+            void parseVariable(std::vector<storm::prism::BooleanVariable>& booleanVariables, std::vector<storm::prism::IntegerVariable>& integerVariables, std::vector<storm::prism::ClockVariable>* clockVariables);
+            storm::prism::Module parseModule();
+            storm::prism::Module parseRenamedModule(std::string const& moduleName, PrismToken const& moduleToken);
+            storm::prism::Command parseCommand();
+            storm::prism::Update parseUpdate();
+            storm::prism::Assignment parseAssignment();
+            storm::prism::RewardModel parseRewardModel();
+            storm::prism::Label parseLabel();
+            void parseInitialConstruct();
+            void parseSystemCompositionConstruct();
+            std::shared_ptr<storm::prism::Composition> parseParallelComposition();
+            std::shared_ptr<storm::prism::Composition> parseHidingOrRenamingComposition();
+            std::shared_ptr<storm::prism::Composition> parseAtomicComposition();
+            std::set<std::string> parseActionNameList();
+
+            // Methods for parsing expressions. The precedences and associativities are the ones of the ExpressionParser.
+            storm::expressions::Expression parseExpression();
+            storm::expressions::Expression parseOrExpression();
+            storm::expressions::Expression parseAndExpression();
+            storm::expressions::Expression parseEqualityExpression();
+            storm::expressions::Expression parseRelationalExpression();
+            storm::expressions::Expression parsePlusExpression();
+            storm::expressions::Expression parseMultiplicationExpression();
+            storm::expressions::Expression parsePowerModuloExpression();
+            storm::expressions::Expression parseUnaryExpression();
+            storm::expressions::Expression parseAtomicExpression();
+            storm::expressions::Expression parseRationalLiteral(PrismToken const& token) const;
+            storm::expressions::Expression parseIntegerLiteral(PrismToken const& token) const;
+            storm::expressions::Expression createBinaryExpression(PrismToken const& operatorToken, storm::expressions::Expression const& left, storm::expressions::Expression const& right) const;
+
+            // Helpers for accessing the tokens.
+            PrismToken const& peek(uint64_t offset = 0) const;
+            PrismToken const& next();
+            bool accept(PrismTokenType const& type);
+            PrismToken const& expect(PrismTokenType const& type);
+            bool isWord(PrismToken const& token, std::string const& word) const;
+            std::string getText(PrismToken const& token) const;
+            std::string expectIdentifier();
+            [[noreturn]] void throwUnexpectedToken(PrismToken const& token, std::string const& expected) const;
+
+            // Helpers for the identifiers.
+            storm::expressions::Variable declareVariable(std::string const& name, storm::expressions::Type const& type, bool auxiliary, PrismToken const& token);
+            storm::expressions::Variable getVariable(std::string const& name, PrismToken const& token) const;
+            bool isObservable(std::string const& name);
+            uint_fast64_t getActionIndex(std::string const& actionName);
+
+            // The input and the name of the file it was read from.
+            std::string const& input;
+            std::string filename;
+            bool prismCompatibility;
+
+            // The tokens of the input and the index of the current token.
+            std::vector<PrismToken> tokens;
+            uint64_t position;
+
+            // The manager responsible for the variables and expressions of the program.
+            std::shared_ptr<storm::expressions::ExpressionManager> manager;
+
+            // The expressions that the identifiers (constants, variables and formulas) stand for.
+            std::unordered_map<std::string, storm::expressions::Expression> identifiers;
+
+            // The names of the variables that are marked as observable, but were not yet declared.
+            std::set<std::string> observables;
+
+            // The variables and action names of the modules (first pass).
+            std::map<std::string, ModuleVariableNames> moduleVariableNames;
+
+            // The information about the program that is gathered in the second pass.
+            storm::prism::Program::ModelType modelType;
+            std::vector<storm::prism::Constant> constants;
+            std::vector<storm::prism::Formula> formulas;
+            std::vector<storm::prism::BooleanVariable> globalBooleanVariables;
+            std::vector<storm::prism::IntegerVariable> globalIntegerVariables;
+            std::map<std::string, uint_fast64_t> moduleToIndexMap;
+            std::map<std::string, uint_fast64_t> actionIndices;
+            std::vector<storm::prism::Module> modules;
+            std::vector<storm::prism::RewardModel> rewardModels;
+            std::vector<storm::prism::Label> labels;
+            boost::optional<storm::prism::InitialConstruct> initialConstruct;
+            boost::optional<storm::prism::SystemCompositionConstruct> systemCompositionConstruct;
+
+            // Counters to provide unique indexing for commands and updates.
+            uint_fast64_t currentCommandIndex;
+            uint_fast64_t currentUpdateIndex;
+        };
+
+    }
+}
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <future>
+#include <string>
 #include <type_traits>
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
@@ -29,6 +32,7 @@
 #include "storm/settings/modules/AbstractionSettings.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/NotImplementedException.h"
 
@@ -294,6 +298,55 @@ namespace storm {
             return verifyWithSparseEngine(env, model, task);
         }
 
+        /*!
+         * Initializes the members of the model that are otherwise initialized lazily (on read access), such that the
+         * model can afterwards be checked by several threads concurrently.
+         */
+        template<typename ValueType>
+        void prepareForConcurrentVerification(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            model->getTransitionMatrix().getRowGroupIndices();
+            for (auto const& rewardModel : model->getRewardModels()) {
+                if (rewardModel.second.hasTransitionRewards()) {
+                    rewardModel.second.getTransitionRewardMatrix().getRowGroupIndices();
+                }
+            }
+            if (model->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                auto ma = model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+                if (!ma->isClosed()) {
+                    ma->close();
+                }
+            }
+        }
+
+        /*!
+         * Checks the given tasks on the given model concurrently, using the threads of the given pool. Each job works
+         * on its own copy of the given environment, whose sub-environments are created from the settings on the calling
+         * thread. Each job writes its checkpoints (if any) to files with its own prefix. Environments that are created
+         * while checking a task still read the settings, so the model must not be modified and the settings must not
+         * be changed before all returned futures are ready.
+         *
+         * @return For each task, a future that holds its result (or the exception thrown while checking it).
+         */
+        template<typename ValueType>
+        std::vector<std::future<std::unique_ptr<storm::modelchecker::CheckResult>>> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks, storm::utility::ThreadPool& threadPool) {
+            // The caches of rational functions are shared among all functions and are not thread-safe.
+            static_assert(!std::is_same<ValueType, storm::RationalFunction>::value, "Models with rational functions can not be checked concurrently.");
+            prepareForConcurrentVerification(model);
+
+            std::vector<std::future<std::unique_ptr<storm::modelchecker::CheckResult>>> results;
+            results.reserve(tasks.size());
+            for (uint64_t jobIndex = 0; jobIndex < tasks.size(); ++jobIndex) {
+                storm::Environment jobEnv = env;
+                jobEnv.initializeSubEnvironments();
+                if (jobEnv.solver().getCheckpointFilename()) {
+                    jobEnv.solver().setCheckpointFilename(jobEnv.solver().getCheckpointFilename().get() + ".job" + std::to_string(jobIndex));
+                }
+                auto const& task = tasks[jobIndex];
+                results.push_back(threadPool.submit([jobEnv, model, task] () { return verifyWithSparseEngine(jobEnv, model, task); }));
+            }
+            return results;
+        }
+
         template<storm::dd::DdType DdType, typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(storm::Environment const& env, std::shared_ptr<storm::models::symbolic::Dtmc<DdType, ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1,6 +1,8 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include <map>
+#include <limits>
+#include <algorithm>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -34,16 +36,20 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/builder.h"
+#include "storm/utility/mpi.h"
+#include "storm/utility/Metrics.h"
+#include "storm/utility/MemoryUsage.h"
 
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace builder {
                         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), distributedBatchSize(100000) {
             // Intentionally left empty.
         }
         
@@ -140,6 +146,9 @@ namespace storm {
             auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
             uint64_t numberOfExploredStates = 0;
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
+            uint64_t numberOfTransitions = 0;
+            auto timeOfLastMetricsUpdate = timeOfStart;
+            uint64_t numberOfExploredStatesAtLastMetricsUpdate = 0;
             
             // Perform a search through the model.
             while (!statesToExplore.empty()) {
@@ -179,6 +188,7 @@ namespace storm {
                         }
                         
                         transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+                        ++numberOfTransitions;
                         
                         for (auto& rewardModelBuilder : rewardModelBuilders) {
                             if (rewardModelBuilder.hasStateRewards()) {
@@ -233,6 +243,7 @@ namespace storm {
                         for (auto const& stateProbabilityPair : choice) {
                             transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
                         }
+                        numberOfTransitions += choice.size();
                         
                         // Add the rewards to the reward models.
                         auto choiceRewardIt = choice.getRewards().begin();
@@ -247,9 +258,9 @@ namespace storm {
                     ++currentRowGroup;
                 }
                 
+                ++numberOfExploredStates;
                 if (generator->getOptions().isShowProgressSet()) {
                     ++numberOfExploredStatesSinceLastMessage;
-                    ++numberOfExploredStates;
                     
                     auto now = std::chrono::high_resolution_clock::now();
                     auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
@@ -261,8 +272,24 @@ namespace storm {
                         numberOfExploredStatesSinceLastMessage = 0;
                     }
                 }
+                
+                // Only publish the metrics every few thousand states to keep their overhead negligible.
+                if (numberOfExploredStates % 4096 == 0 && storm::utility::metrics::isEnabled()) {
+                    auto now = std::chrono::high_resolution_clock::now();
+                    double secondsSinceLastUpdate = std::chrono::duration<double>(now - timeOfLastMetricsUpdate).count();
+                    storm::utility::metrics::setGauge("storm_explored_states", "Number of states explored by the explicit model builder.", static_cast<double>(numberOfExploredStates));
+                    storm::utility::metrics::setGauge("storm_exploration_states_per_second", "Number of states explored per second since the last update.", static_cast<double>(numberOfExploredStates - numberOfExploredStatesAtLastMetricsUpdate) / std::max(secondsSinceLastUpdate, 1e-9));
+                    storm::utility::metrics::setGauge("storm_exploration_queue_size", "Number of discovered states that are not yet explored.", static_cast<double>(statesToExplore.size()));
+                    storm::utility::metrics::setGauge("storm_state_storage_load_factor", "Fraction of the buckets of the state storage that are occupied.", static_cast<double>(this->stateStorage.stateToId.size()) / static_cast<double>(this->stateStorage.stateToId.capacity()));
+                    storm::utility::metrics::setGauge("storm_matrix_entries", "Number of entries of the transition matrix built so far.", static_cast<double>(numberOfTransitions));
+                    timeOfLastMetricsUpdate = now;
+                    numberOfExploredStatesAtLastMetricsUpdate = numberOfExploredStates;
+                }
             }
             
+            storm::utility::metrics::setGauge("storm_explored_states", "Number of states explored by the explicit model builder.", static_cast<double>(numberOfExploredStates));
+            storm::utility::metrics::setGauge("storm_matrix_entries", "Number of entries of the transition matrix built so far.", static_cast<double>(numberOfTransitions));
+            
             if (markovianStates) {
                 // Since we now know the correct size, cut the bit vector to the correct length.
                 markovianStates->resize(currentRowGroup, false);
@@ -314,6 +341,9 @@ namespace storm {
             
             buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
             
+            // The state storage is freed along with the builder, so its size has to be recorded while it is complete.
+            storm::utility::memory::recordStateStorageUsage(stateStorage.getMemoryUsage());
+            
             // Initialize the model components with the obtained information.
             storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
             
@@ -405,6 +435,263 @@ namespace storm {
             return modelComponents;
         }
         
+#ifdef STORM_HAVE_MPI
+        /*!
+         * Retrieves the rank that owns the given state.
+         */
+        static uint64_t getOwningRank(CompressedState const& state, uint64_t numberOfRanks) {
+            return storm::storage::Murmur3BitVectorHash<uint64_t>()(state) % numberOfRanks;
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        storm::storage::sparse::DistributedModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildDistributed(MPI_Comm communicator) {
+            storm::utility::mpi::initialize();
+            int rankAsInt = 0;
+            int numberOfRanksAsInt = 0;
+            MPI_Comm_rank(communicator, &rankAsInt);
+            MPI_Comm_size(communicator, &numberOfRanksAsInt);
+            uint64_t rank = static_cast<uint64_t>(rankAsInt);
+            uint64_t numberOfRanks = static_cast<uint64_t>(numberOfRanksAsInt);
+
+            storm::models::ModelType modelType;
+            switch (generator->getModelType()) {
+                case storm::generator::ModelType::DTMC:
+                    modelType = storm::models::ModelType::Dtmc;
+                    break;
+                case storm::generator::ModelType::CTMC:
+                    modelType = storm::models::ModelType::Ctmc;
+                    break;
+                case storm::generator::ModelType::MDP:
+                    modelType = storm::models::ModelType::Mdp;
+                    break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Distributed exploration is only supported for DTMCs, CTMCs and MDPs.");
+            }
+            STORM_LOG_THROW(options.distributedBatchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size of the distributed exploration must be positive.");
+            bool deterministicModel = generator->isDeterministicModel();
+            std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
+            for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
+                rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
+            }
+
+            // Owned states are referred to by their local index. All other states are referred to by their index in
+            // the table of remote states, marked by the highest bit.
+            StateType const remoteFlag = static_cast<StateType>(1) << (std::numeric_limits<StateType>::digits - 1);
+            uint64_t const bitsPerState = generator->getStateSize();
+            uint64_t const bucketsPerState = std::max<uint64_t>(1, (bitsPerState + 63) / 64);
+            storm::storage::BitVectorHashMap<StateType> remoteStates(bitsPerState);
+
+            // For each rank, the packed states that still need to be sent to it, the remote indices of the states in
+            // the order in which they were sent to it and the local indices of the states in the order in which they
+            // were received from it. Since each state is sent to its owner at most once by every rank, the latter two
+            // can be matched after the exploration.
+            std::vector<std::vector<uint64_t>> outgoingStates(numberOfRanks);
+            std::vector<std::vector<StateType>> sentStates(numberOfRanks);
+            std::vector<std::vector<StateType>> receivedStates(numberOfRanks);
+
+            auto getOrAddOwnedStateIndex = [&] (CompressedState const& state) {
+                StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+                StateType actualIndex = stateStorage.stateToId.findOrAdd(state, newIndex);
+                if (actualIndex == newIndex) {
+                    STORM_LOG_THROW(newIndex < remoteFlag, storm::exceptions::InvalidOperationException, "Rank " << rank << " owns too many states.");
+                    statesToExplore.emplace_back(state, actualIndex);
+                }
+                return actualIndex;
+            };
+            std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) -> StateType {
+                uint64_t owner = getOwningRank(state, numberOfRanks);
+                if (owner == rank) {
+                    return getOrAddOwnedStateIndex(state);
+                }
+                StateType newIndex = static_cast<StateType>(remoteStates.size());
+                StateType actualIndex = remoteStates.findOrAdd(state, newIndex);
+                if (actualIndex == newIndex) {
+                    STORM_LOG_THROW(newIndex < remoteFlag, storm::exceptions::InvalidOperationException, "Rank " << rank << " refers to too many states of other ranks.");
+                    for (uint64_t bucket = 0; bucket < bucketsPerState; ++bucket) {
+                        uint64_t bits = std::min<uint64_t>(64, bitsPerState - std::min(bitsPerState, 64 * bucket));
+                        outgoingStates[owner].push_back(bits > 0 ? state.getAsInt(64 * bucket, bits) : 0);
+                    }
+                    sentStates[owner].push_back(actualIndex);
+                }
+                return actualIndex | remoteFlag;
+            };
+
+            // Every rank computes the initial states, but only keeps its owned ones.
+            std::vector<StateType> initialStateIndices = generator->getInitialStates(stateToIdCallback);
+            STORM_LOG_THROW(!initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+            this->stateStorage.initialStateIndices.clear();
+            for (auto const& index : initialStateIndices) {
+                if ((index & remoteFlag) == 0) {
+                    this->stateStorage.initialStateIndices.push_back(index);
+                }
+            }
+
+            // The owned rows, whose columns still refer to local or remote indices.
+            std::vector<uint64_t> rowGroupIndices = {0};
+            std::vector<uint64_t> rowIndications = {0};
+            std::vector<std::pair<StateType, ValueType>> entries;
+
+            uint64_t numberOfUnexploredStates = 1;
+            uint64_t numberOfExchanges = 0;
+            while (numberOfUnexploredStates > 0) {
+                // Explore a batch of owned states.
+                for (uint64_t exploredStates = 0; exploredStates < options.distributedBatchSize && !statesToExplore.empty(); ++exploredStates) {
+                    CompressedState currentState = statesToExplore.front().first;
+                    StateType currentIndex = statesToExplore.front().second;
+                    statesToExplore.pop_front();
+                    STORM_LOG_ASSERT(currentIndex == rowGroupIndices.size() - 1, "Owned states are not explored in the order of their indices.");
+
+                    generator->load(currentState);
+                    storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+
+                    // If there is no behavior, we might have to introduce a self-loop.
+                    if (behavior.empty()) {
+                        STORM_LOG_THROW(!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded(), storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
+                        if (behavior.wasExpanded()) {
+                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                        }
+                        entries.emplace_back(currentIndex, storm::utility::one<ValueType>());
+                        rowIndications.push_back(entries.size());
+                        for (auto& rewardModelBuilder : rewardModelBuilders) {
+                            if (rewardModelBuilder.hasStateRewards()) {
+                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                            }
+                            if (rewardModelBuilder.hasStateActionRewards()) {
+                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                            }
+                        }
+                    } else {
+                        auto stateRewardIt = behavior.getStateRewards().begin();
+                        for (auto& rewardModelBuilder : rewardModelBuilders) {
+                            if (rewardModelBuilder.hasStateRewards()) {
+                                rewardModelBuilder.addStateReward(*stateRewardIt);
+                            }
+                            ++stateRewardIt;
+                        }
+                        for (auto const& choice : behavior) {
+                            for (auto const& stateProbabilityPair : choice) {
+                                entries.emplace_back(stateProbabilityPair.first, stateProbabilityPair.second);
+                            }
+                            rowIndications.push_back(entries.size());
+                            auto choiceRewardIt = choice.getRewards().begin();
+                            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                                if (rewardModelBuilder.hasStateActionRewards()) {
+                                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                                }
+                                ++choiceRewardIt;
+                            }
+                        }
+                    }
+                    rowGroupIndices.push_back(rowIndications.size() - 1);
+                }
+
+                // Send the discovered states to their owners.
+                std::vector<int> sendCounts(numberOfRanks);
+                std::vector<int> sendDisplacements(numberOfRanks);
+                std::vector<uint64_t> sendBuffer;
+                for (uint64_t owner = 0; owner < numberOfRanks; ++owner) {
+                    STORM_LOG_THROW(sendBuffer.size() + outgoingStates[owner].size() <= static_cast<uint64_t>(std::numeric_limits<int>::max()), storm::exceptions::InvalidOperationException, "Too many states discovered in one batch. Please decrease the batch size.");
+                    sendDisplacements[owner] = static_cast<int>(sendBuffer.size());
+                    sendCounts[owner] = static_cast<int>(outgoingStates[owner].size());
+                    sendBuffer.insert(sendBuffer.end(), outgoingStates[owner].begin(), outgoingStates[owner].end());
+                    outgoingStates[owner].clear();
+                }
+                std::vector<int> receiveCounts(numberOfRanks);
+                MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, communicator);
+                std::vector<int> receiveDisplacements(numberOfRanks, 0);
+                for (uint64_t source = 1; source < numberOfRanks; ++source) {
+                    receiveDisplacements[source] = receiveDisplacements[source - 1] + receiveCounts[source - 1];
+                }
+                std::vector<uint64_t> receiveBuffer(receiveDisplacements.back() + receiveCounts.back());
+                MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendDisplacements.data(), MPI_UINT64_T, receiveBuffer.data(), receiveCounts.data(), receiveDisplacements.data(), MPI_UINT64_T, communicator);
+
+                // Register the received states (in the order of their sources).
+                for (uint64_t source = 0; source < numberOfRanks; ++source) {
+                    for (uint64_t offset = 0; offset < static_cast<uint64_t>(receiveCounts[source]); offset += bucketsPerState) {
+                        CompressedState state(bitsPerState);
+                        for (uint64_t bucket = 0; bucket < bucketsPerState; ++bucket) {
+                            uint64_t bits = std::min<uint64_t>(64, bitsPerState - std::min(bitsPerState, 64 * bucket));
+                            if (bits > 0) {
+                                state.setFromInt(64 * bucket, bits, receiveBuffer[receiveDisplacements[source] + offset + bucket]);
+                            }
+                        }
+                        receivedStates[source].push_back(getOrAddOwnedStateIndex(state));
+                    }
+                }
+
+                // The exploration terminates if no rank has unexplored states. Since the exchange is a collective
+                // operation, no states can be in transit at this point.
+                uint64_t localUnexploredStates = statesToExplore.size();
+                MPI_Allreduce(&localUnexploredStates, &numberOfUnexploredStates, 1, MPI_UINT64_T, MPI_SUM, communicator);
+                ++numberOfExchanges;
+            }
+
+            // Assign contiguous global indices to the states of each rank.
+            uint64_t numberOfLocalStates = stateStorage.getNumberOfStates();
+            std::vector<uint64_t> stateCounts(numberOfRanks);
+            MPI_Allgather(&numberOfLocalStates, 1, MPI_UINT64_T, stateCounts.data(), 1, MPI_UINT64_T, communicator);
+            std::vector<uint64_t> stateOffsets(numberOfRanks + 1, 0);
+            for (uint64_t otherRank = 0; otherRank < numberOfRanks; ++otherRank) {
+                stateOffsets[otherRank + 1] = stateOffsets[otherRank] + stateCounts[otherRank];
+            }
+            uint64_t firstLocalState = stateOffsets[rank];
+
+            // Tell every rank the local indices of the states it has sent to this rank.
+            std::vector<int> sendCounts(numberOfRanks);
+            std::vector<int> sendDisplacements(numberOfRanks);
+            std::vector<uint64_t> sendBuffer;
+            std::vector<int> receiveCounts(numberOfRanks);
+            std::vector<int> receiveDisplacements(numberOfRanks);
+            uint64_t numberOfReceivedIndices = 0;
+            for (uint64_t otherRank = 0; otherRank < numberOfRanks; ++otherRank) {
+                STORM_LOG_THROW(std::max(sendBuffer.size() + receivedStates[otherRank].size(), numberOfReceivedIndices + sentStates[otherRank].size()) <= static_cast<uint64_t>(std::numeric_limits<int>::max()), storm::exceptions::InvalidOperationException, "Too many states are shared with other ranks.");
+                sendDisplacements[otherRank] = static_cast<int>(sendBuffer.size());
+                sendCounts[otherRank] = static_cast<int>(receivedStates[otherRank].size());
+                sendBuffer.insert(sendBuffer.end(), receivedStates[otherRank].begin(), receivedStates[otherRank].end());
+                receiveDisplacements[otherRank] = static_cast<int>(numberOfReceivedIndices);
+                receiveCounts[otherRank] = static_cast<int>(sentStates[otherRank].size());
+                numberOfReceivedIndices += sentStates[otherRank].size();
+            }
+            std::vector<uint64_t> receiveBuffer(numberOfReceivedIndices);
+            MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendDisplacements.data(), MPI_UINT64_T, receiveBuffer.data(), receiveCounts.data(), receiveDisplacements.data(), MPI_UINT64_T, communicator);
+            std::vector<uint64_t> remoteToGlobalIndex(remoteStates.size());
+            for (uint64_t owner = 0; owner < numberOfRanks; ++owner) {
+                for (uint64_t position = 0; position < sentStates[owner].size(); ++position) {
+                    remoteToGlobalIndex[sentStates[owner][position]] = stateOffsets[owner] + receiveBuffer[receiveDisplacements[owner] + position];
+                }
+            }
+
+            // Build the owned rows with global column indices.
+            uint64_t numberOfLocalRows = rowIndications.size() - 1;
+            storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(numberOfLocalRows, stateOffsets.back(), entries.size(), true, !deterministicModel, numberOfLocalStates);
+            std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+            for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+                if (!deterministicModel) {
+                    transitionMatrixBuilder.newRowGroup(rowGroupIndices[state]);
+                }
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    rowEntries.clear();
+                    for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                        StateType column = entries[entry].first;
+                        rowEntries.emplace_back((column & remoteFlag) ? remoteToGlobalIndex[column & ~remoteFlag] : firstLocalState + column, entries[entry].second);
+                    }
+                    std::sort(rowEntries.begin(), rowEntries.end(), [] (std::pair<uint64_t, ValueType> const& a, std::pair<uint64_t, ValueType> const& b) { return a.first < b.first; });
+                    for (auto const& entry : rowEntries) {
+                        transitionMatrixBuilder.addNextValue(row, entry.first, entry.second);
+                    }
+                }
+            }
+            storm::storage::SparseMatrix<ValueType> transitionMatrix = transitionMatrixBuilder.build(numberOfLocalRows, stateOffsets.back(), numberOfLocalStates);
+            STORM_LOG_DEBUG("Rank " << rank << " explored " << numberOfLocalStates << " of " << stateOffsets.back() << " states with " << numberOfExchanges << " exchanges.");
+
+            std::unordered_map<std::string, RewardModelType> rewardModels;
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                rewardModels.emplace(rewardModelBuilder.getName(), rewardModelBuilder.build(transitionMatrix.getRowCount(), transitionMatrix.getColumnCount(), transitionMatrix.getRowGroupCount()));
+            }
+            return storm::storage::sparse::DistributedModelComponents<ValueType, RewardModelType>(modelType, std::move(transitionMatrix), std::move(stateOffsets), rank, buildStateLabeling(), std::move(rewardModels), !generator->isDiscreteTimeModel());
+        }
+#endif
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
             return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
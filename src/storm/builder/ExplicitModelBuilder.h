@@ -9,6 +9,12 @@
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/variant.hpp>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_MPI
+#include <mpi.h>
+#endif
+
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/prism/Program.h"
@@ -20,6 +26,7 @@
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/DistributedModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
 #include "storm/settings/SettingsManager.h"
 
@@ -57,6 +64,10 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+
+                // The number of states each rank explores in a distributed exploration before the discovered states
+                // are sent to their owners.
+                uint64_t distributedBatchSize;
             };
             
             /*!
@@ -88,6 +99,23 @@ namespace storm {
              *         information (if requested).
              */
             std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
+
+#ifdef STORM_HAVE_MPI
+            /*!
+             * Explores the state space together with the other ranks of the given communicator. This is a collective
+             * operation. Each state is owned by the rank determined by the hash of its compressed representation. A rank
+             * only expands its owned states; discovered states of other ranks are collected and sent to their owners in
+             * batches. The exploration terminates as soon as no rank has unexplored states after an exchange. Finally,
+             * the owned states are assigned contiguous global indices by a prefix sum over the numbers of owned states.
+             *
+             * Only the transition matrix, the state labeling and the reward models are built. The exploration order
+             * is ignored.
+             *
+             * @return The components of the owned states, which can be passed to a distributed solver or written to a
+             *         partitioned file.
+             */
+            storm::storage::sparse::DistributedModelComponents<ValueType, RewardModelType> buildDistributed(MPI_Comm communicator);
+#endif
             
         private:
             /*!
@@ -38,4 +38,9 @@ namespace storm {
     ModelCheckerEnvironment const& Environment::modelchecker() const {
         return internalEnv.get().modelcheckerEnvironment.get();
     }
+    
+    void Environment::initializeSubEnvironments() {
+        solver().initializeSubEnvironments();
+        modelchecker().initializeSubEnvironments();
+    }
 }
\ No newline at end of file
@@ -27,6 +27,12 @@ namespace storm {
         ModelCheckerEnvironment& modelchecker();
         ModelCheckerEnvironment const& modelchecker() const;
         
+        /*!
+         * Creates all sub-environments, which are otherwise created (and initialized from the settings) on first
+         * access. Copies of this environment then no longer read the settings.
+         */
+        void initializeSubEnvironments();
+        
     private:
     
         SubEnvironment<InternalEnvironment> internalEnv;
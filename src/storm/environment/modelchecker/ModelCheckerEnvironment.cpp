@@ -2,6 +2,8 @@
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
+#include "storm/modelchecker/results/CheckResultCache.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/utility/macros.h"
 
@@ -26,6 +28,18 @@ namespace storm {
     MultiObjectiveModelCheckerEnvironment const& ModelCheckerEnvironment::multi() const {
         return multiObjectiveModelCheckerEnvironment.get();
     }
+
+    void ModelCheckerEnvironment::initializeSubEnvironments() {
+        multi();
+    }
+
+    std::shared_ptr<storm::modelchecker::CheckResultCache> const& ModelCheckerEnvironment::getResultCache() const {
+        return resultCache;
+    }
+
+    void ModelCheckerEnvironment::setResultCache(std::shared_ptr<storm::modelchecker::CheckResultCache> const& value) {
+        resultCache = value;
+    }
 }
     
 
@@ -10,6 +10,10 @@ namespace storm {
     
     // Forward declare subenvironments
     class MultiObjectiveModelCheckerEnvironment;
+
+    namespace modelchecker {
+        class CheckResultCache;
+    }
     
     class ModelCheckerEnvironment {
     public:
@@ -19,10 +23,23 @@ namespace storm {
         
         MultiObjectiveModelCheckerEnvironment& multi();
         MultiObjectiveModelCheckerEnvironment const& multi() const;
+        
+        /*!
+         * Creates all sub-environments, which are otherwise created on first access.
+         */
+        void initializeSubEnvironments();
 
+        /*!
+         * Retrieves the cache for the results of state subformulas (or null if results are not cached). The cache is
+         * shared among all copies of this environment. By default, no cache is used, as the cached results become
+         * invalid when a checked model is modified (e.g. instantiated in place).
+         */
+        std::shared_ptr<storm::modelchecker::CheckResultCache> const& getResultCache() const;
+        void setResultCache(std::shared_ptr<storm::modelchecker::CheckResultCache> const& value);
     
     private:
         SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
+        std::shared_ptr<storm::modelchecker::CheckResultCache> resultCache;
     };
 }
 
@@ -22,6 +22,7 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        andersonAccelerationDepth = minMaxSettings.isAndersonAccelerationSet() ? minMaxSettings.getAndersonAccelerationDepth() : 0;
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -81,4 +82,12 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    uint64_t const& MinMaxSolverEnvironment::getAndersonAccelerationDepth() const {
+        return andersonAccelerationDepth;
+    }
+    
+    void MinMaxSolverEnvironment::setAndersonAccelerationDepth(uint64_t value) {
+        andersonAccelerationDepth = value;
+    }
+    
 }
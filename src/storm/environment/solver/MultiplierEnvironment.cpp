@@ -11,6 +11,9 @@ namespace storm {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        prioritizedGaussSeidel = multiplierSettings.isPrioritizedGaussSeidelSet();
+        outOfCoreDirectory = multiplierSettings.getOutOfCoreDirectory();
+        outOfCoreBlockSize = multiplierSettings.getOutOfCoreBlockSize();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +33,28 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    bool MultiplierEnvironment::isPrioritizedGaussSeidelSet() const {
+        return prioritizedGaussSeidel;
+    }
+    
+    void MultiplierEnvironment::setPrioritizedGaussSeidel(bool value) {
+        prioritizedGaussSeidel = value;
+    }
+    
+    std::string const& MultiplierEnvironment::getOutOfCoreDirectory() const {
+        return outOfCoreDirectory;
+    }
+    
+    void MultiplierEnvironment::setOutOfCoreDirectory(std::string const& value) {
+        outOfCoreDirectory = value;
+    }
+    
+    uint64_t const& MultiplierEnvironment::getOutOfCoreBlockSize() const {
+        return outOfCoreBlockSize;
+    }
+    
+    void MultiplierEnvironment::setOutOfCoreBlockSize(uint64_t value) {
+        outOfCoreBlockSize = value;
+    }
+    
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
 
@@ -15,9 +17,20 @@ namespace storm {
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
         
+        bool isPrioritizedGaussSeidelSet() const;
+        void setPrioritizedGaussSeidel(bool value);
+        
+        std::string const& getOutOfCoreDirectory() const;
+        void setOutOfCoreDirectory(std::string const& value);
+        uint64_t const& getOutOfCoreBlockSize() const;
+        void setOutOfCoreBlockSize(uint64_t value);
+        
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        bool prioritizedGaussSeidel;
+        std::string outOfCoreDirectory;
+        uint64_t outOfCoreBlockSize;
     };
 }
 
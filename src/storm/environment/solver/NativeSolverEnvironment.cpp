@@ -23,6 +23,12 @@ namespace storm {
         powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
         sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
         symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        andersonAccelerationDepth = nativeSettings.isAndersonAccelerationSet() ? nativeSettings.getAndersonAccelerationDepth() : 0;
+        aggregationCoarsening = nativeSettings.getAggregationCoarsening();
+        aggregationThreshold = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getAggregationThreshold());
+        preconditioner = nativeSettings.getPreconditioner();
+        preconditionerBlockSize = nativeSettings.getPreconditionerBlockSize();
+        restartThreshold = nativeSettings.getRestartIterationCount();
 
     }
 
@@ -90,5 +96,53 @@ namespace storm {
     void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
         symmetricUpdates = value;
     }
+    
+    uint64_t const& NativeSolverEnvironment::getAndersonAccelerationDepth() const {
+        return andersonAccelerationDepth;
+    }
+    
+    void NativeSolverEnvironment::setAndersonAccelerationDepth(uint64_t value) {
+        andersonAccelerationDepth = value;
+    }
+    
+    storm::solver::AggregationCoarsening const& NativeSolverEnvironment::getAggregationCoarsening() const {
+        return aggregationCoarsening;
+    }
+    
+    void NativeSolverEnvironment::setAggregationCoarsening(storm::solver::AggregationCoarsening value) {
+        aggregationCoarsening = value;
+    }
+    
+    storm::RationalNumber const& NativeSolverEnvironment::getAggregationThreshold() const {
+        return aggregationThreshold;
+    }
+    
+    void NativeSolverEnvironment::setAggregationThreshold(storm::RationalNumber const& value) {
+        aggregationThreshold = value;
+    }
+    
+    storm::solver::NativeLinearEquationSolverPreconditioner const& NativeSolverEnvironment::getPreconditioner() const {
+        return preconditioner;
+    }
+    
+    void NativeSolverEnvironment::setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value) {
+        preconditioner = value;
+    }
+    
+    uint64_t const& NativeSolverEnvironment::getPreconditionerBlockSize() const {
+        return preconditionerBlockSize;
+    }
+    
+    void NativeSolverEnvironment::setPreconditionerBlockSize(uint64_t value) {
+        preconditionerBlockSize = value;
+    }
+    
+    uint64_t const& NativeSolverEnvironment::getRestartThreshold() const {
+        return restartThreshold;
+    }
+    
+    void NativeSolverEnvironment::setRestartThreshold(uint64_t value) {
+        restartThreshold = value;
+    }
   
 }
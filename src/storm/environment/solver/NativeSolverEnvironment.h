@@ -29,6 +29,18 @@ namespace storm {
         void setSorOmega(storm::RationalNumber const& value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        uint64_t const& getAndersonAccelerationDepth() const;
+        void setAndersonAccelerationDepth(uint64_t value);
+        storm::solver::AggregationCoarsening const& getAggregationCoarsening() const;
+        void setAggregationCoarsening(storm::solver::AggregationCoarsening value);
+        storm::RationalNumber const& getAggregationThreshold() const;
+        void setAggregationThreshold(storm::RationalNumber const& value);
+        storm::solver::NativeLinearEquationSolverPreconditioner const& getPreconditioner() const;
+        void setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value);
+        uint64_t const& getPreconditionerBlockSize() const;
+        void setPreconditionerBlockSize(uint64_t value);
+        uint64_t const& getRestartThreshold() const;
+        void setRestartThreshold(uint64_t value);
         
     private:
         storm::solver::NativeLinearEquationSolverMethod method;
@@ -39,6 +51,12 @@ namespace storm {
         storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
         storm::RationalNumber sorOmega;
         bool symmetricUpdates;
+        uint64_t andersonAccelerationDepth;
+        storm::solver::AggregationCoarsening aggregationCoarsening;
+        storm::RationalNumber aggregationThreshold;
+        storm::solver::NativeLinearEquationSolverPreconditioner preconditioner;
+        uint64_t preconditionerBlockSize;
+        uint64_t restartThreshold;
     };
 }
 
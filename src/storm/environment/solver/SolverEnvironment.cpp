@@ -11,6 +11,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -23,6 +24,18 @@ namespace storm {
         forceSoundness = storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet();
         linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
         linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+        
+        // Not all executables register the resource settings.
+        checkpointInterval = 600;
+        resumeFromCheckpoint = false;
+        if (storm::settings::hasModule<storm::settings::modules::ResourceSettings>()) {
+            auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+            if (resourceSettings.isCheckpointSet()) {
+                checkpointFilename = resourceSettings.getCheckpointFilename();
+            }
+            checkpointInterval = resourceSettings.getCheckpointIntervalInSeconds();
+            resumeFromCheckpoint = resourceSettings.isResumeFromCheckpointSet();
+        }
     }
     
     SolverEnvironment::~SolverEnvironment() {
@@ -84,6 +97,16 @@ namespace storm {
     TopologicalSolverEnvironment const& SolverEnvironment::topological() const {
         return topologicalSolverEnvironment.get();
     }
+    
+    void SolverEnvironment::initializeSubEnvironments() {
+        eigen();
+        gmmxx();
+        native();
+        minMax();
+        multiplier();
+        game();
+        topological();
+    }
 
     bool SolverEnvironment::isForceSoundness() const {
         return forceSoundness;
@@ -149,6 +172,30 @@ namespace storm {
             // gmm, eigen, elimination, and topological solvers do not have a precision
         }
     }
+    
+    boost::optional<std::string> const& SolverEnvironment::getCheckpointFilename() const {
+        return checkpointFilename;
+    }
+    
+    void SolverEnvironment::setCheckpointFilename(boost::optional<std::string> const& value) {
+        checkpointFilename = value;
+    }
+    
+    uint64_t const& SolverEnvironment::getCheckpointInterval() const {
+        return checkpointInterval;
+    }
+    
+    void SolverEnvironment::setCheckpointInterval(uint64_t value) {
+        checkpointInterval = value;
+    }
+    
+    bool SolverEnvironment::isResumeFromCheckpointSet() const {
+        return resumeFromCheckpoint;
+    }
+    
+    void SolverEnvironment::setResumeFromCheckpoint(bool value) {
+        resumeFromCheckpoint = value;
+    }
 }
     
 
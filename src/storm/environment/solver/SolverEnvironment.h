@@ -1,6 +1,7 @@
 #pragma once
 
 #include<memory>
+#include <string>
 #include <boost/optional.hpp>
 
 #include "storm/environment/Environment.h"
@@ -39,6 +40,11 @@ namespace storm {
         GameSolverEnvironment const& game() const;
         TopologicalSolverEnvironment& topological();
         TopologicalSolverEnvironment const& topological() const;
+        
+        /*!
+         * Creates all sub-environments, which are otherwise created on first access.
+         */
+        void initializeSubEnvironments();
 
         bool isForceSoundness() const;
         void setForceSoundness(bool value);
@@ -49,6 +55,16 @@ namespace storm {
 
         std::pair<boost::optional<storm::RationalNumber>, boost::optional<bool>> getPrecisionOfLinearEquationSolver(storm::solver::EquationSolverType const& solverType) const;
         void setLinearEquationSolverPrecision(boost::optional<storm::RationalNumber> const& newPrecision, boost::optional<bool> const& relativePrecision = boost::none);
+        
+        /*!
+         * The prefix of the files to which long-running computations write checkpoints (if any).
+         */
+        boost::optional<std::string> const& getCheckpointFilename() const;
+        void setCheckpointFilename(boost::optional<std::string> const& value);
+        uint64_t const& getCheckpointInterval() const;
+        void setCheckpointInterval(uint64_t value);
+        bool isResumeFromCheckpointSet() const;
+        void setResumeFromCheckpoint(bool value);
     
     private:
         SubEnvironment<EigenSolverEnvironment> eigenSolverEnvironment;
@@ -62,6 +78,9 @@ namespace storm {
         storm::solver::EquationSolverType linearEquationSolverType;
         bool linearEquationSolverTypeSetFromDefault;
         bool forceSoundness;
+        boost::optional<std::string> checkpointFilename;
+        uint64_t checkpointInterval;
+        bool resumeFromCheckpoint;
     };
 }
 
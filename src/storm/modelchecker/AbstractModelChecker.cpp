@@ -2,6 +2,7 @@
 
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/CheckResultCache.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -10,6 +11,7 @@
 #include "storm/exceptions/InternalTypeErrorException.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -24,6 +26,8 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 
+#include <sstream>
+
 #include <boost/core/typeinfo.hpp>
 
 namespace storm {
@@ -173,8 +177,48 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This model checker (" << getClassName() << ") does not support the formula: " << checkTask.getFormula() << ".");
         }
 
+        template<typename ValueType>
+        static std::string getResultCacheKey(std::string const& checkerName, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
+            // Besides the formula, the key comprises everything of the task that can influence the result.
+            std::stringstream stream;
+            stream << checkerName << "|" << checkTask.getFormula();
+            if (checkTask.isOptimizationDirectionSet()) {
+                stream << "|direction=" << checkTask.getOptimizationDirection();
+            }
+            if (checkTask.isRewardModelSet()) {
+                stream << "|rewards=" << checkTask.getRewardModel();
+            }
+            if (checkTask.isBoundSet()) {
+                stream << "|bound=" << checkTask.getBound();
+            }
+            stream << "|initial=" << checkTask.isOnlyInitialStatesRelevantSet() << "|qualitative=" << checkTask.isQualitativeSet() << "|schedulers=" << checkTask.isProduceSchedulersSet();
+            return stream.str();
+        }
+
         template<typename ModelType>
         std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::checkStateFormula(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
+            // Only the (potentially expensive) results of operator formulas are cached.
+            std::shared_ptr<CheckResultCache> const& cache = env.modelchecker().getResultCache();
+            void const* cacheIdentifier = this->getResultCacheIdentifier();
+            if (!cache || !cacheIdentifier || !checkTask.getFormula().isOperatorFormula()) {
+                return this->checkStateFormulaUncached(env, checkTask);
+            }
+
+            std::string key = getResultCacheKey(getClassName(), checkTask);
+            std::unique_ptr<CheckResult> result = cache->find(cacheIdentifier, key);
+            if (result) {
+                STORM_LOG_DEBUG("Reusing cached result of formula " << checkTask.getFormula() << ".");
+            } else {
+                result = this->checkStateFormulaUncached(env, checkTask);
+                if (result) {
+                    cache->insert(cacheIdentifier, key, *result);
+                }
+            }
+            return result;
+        }
+
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::checkStateFormulaUncached(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
             storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
             if (stateFormula.isBinaryBooleanStateFormula()) {
                 return this->checkBinaryBooleanStateFormula(env, checkTask.substituteFormula(stateFormula.asBinaryBooleanStateFormula()));
@@ -318,6 +362,11 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This model checker (" << getClassName() << ") does not support the formula: " << checkTask.getFormula() << ".");
         }
 
+        template<typename ModelType>
+        void const* AbstractModelChecker<ModelType>::getResultCacheIdentifier() const {
+            return nullptr;
+        }
+
         ///////////////////////////////////////////////
         // Explicitly instantiate the template class.
         ///////////////////////////////////////////////
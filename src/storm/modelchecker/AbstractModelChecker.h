@@ -95,6 +95,16 @@ namespace storm {
             // The methods to check quantile formulas.
             virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env, CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask);
             
+        protected:
+            /*!
+             * Retrieves an identifier of the checked model under which the results of this model checker are cached if
+             * the environment provides a result cache. If null is returned, no results are cached.
+             */
+            virtual void const* getResultCacheIdentifier() const;
+
+        private:
+            // Dispatches the given state formula to the corresponding check method.
+            std::unique_ptr<CheckResult> checkStateFormulaUncached(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask);
         };
     }
 }
@@ -106,6 +106,11 @@ namespace storm {
             return reuseQuantitativeResults;
         }
         
+        template<typename ModelType>
+        void AbstractAbstractionRefinementModelChecker<ModelType>::translateBounds(storm::models::Model<ValueType> const&, std::pair<std::unique_ptr<CheckResult>, std::unique_ptr<CheckResult>>&) {
+            // Intentionally left empty.
+        }
+        
         template<typename ModelType>
         std::unique_ptr<CheckResult> AbstractAbstractionRefinementModelChecker<ModelType>::performAbstractionRefinement(Environment const& env) {
             STORM_LOG_THROW(checkTask->isOnlyInitialStatesRelevantSet(), storm::exceptions::InvalidPropertyException, "The abstraction-refinement model checkers can only compute the result for the initial states.");
@@ -124,6 +129,11 @@ namespace storm {
                 std::shared_ptr<storm::models::Model<ValueType>> abstractModel = this->getAbstractModel();
                 auto abstractionEnd = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Model in iteration " << iterations << " has " << abstractModel->getNumberOfStates() << " states and " << abstractModel->getNumberOfTransitions() << " transitions (retrieved in " << std::chrono::duration_cast<std::chrono::milliseconds>(abstractionEnd - abstractionStart).count() << "ms).");
+                
+                // Make the bounds of the previous iteration refer to the states of the new abstract model.
+                if (this->getReuseQuantitativeResults() && (lastBounds.first || lastBounds.second)) {
+                    this->translateBounds(*abstractModel, lastBounds);
+                }
 
                 // Obtain lower and upper bounds from the abstract model.
                 std::pair<std::unique_ptr<CheckResult>, std::unique_ptr<CheckResult>> bounds = computeBounds(env, *abstractModel);
@@ -110,6 +110,11 @@ namespace storm {
             /// current ones.
             virtual void refineAbstractModel() = 0;
             
+            /// Translates the bounds that were obtained for the previous abstract model to the states of the given
+            /// (refined) abstract model so that the lower bounds can be reused as starting values. Bounds that cannot
+            /// be translated are to be reset. By default, the bounds are kept as they are.
+            virtual void translateBounds(storm::models::Model<ValueType> const& abstractModel, std::pair<std::unique_ptr<CheckResult>, std::unique_ptr<CheckResult>>& bounds);
+            
             /// -------- Methods used to implement the abstraction refinement procedure.
             
             /// Performs the actual abstraction refinement loop.
@@ -8,9 +8,11 @@
 #include "storm/abstraction/SymbolicStateSet.h"
 
 #include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/bisimulation/Partition.h"
 
 #include "storm/modelchecker/propositional/SymbolicPropositionalModelChecker.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -61,6 +63,10 @@ namespace storm {
         template<typename ModelType>
         std::shared_ptr<storm::models::Model<typename BisimulationAbstractionRefinementModelChecker<ModelType>::ValueType>> BisimulationAbstractionRefinementModelChecker<ModelType>::getAbstractModel() {
             lastAbstractModel = this->bisimulation->getQuotient();
+            
+            auto const& partition = this->bisimulation->getStatePartition();
+            previousPartition = lastPartition;
+            lastPartition = partition.storedAsBdd() ? partition.asBdd() : partition.asAdd().notZero();
             return lastAbstractModel;
         }
         
@@ -126,6 +132,41 @@ namespace storm {
             this->bisimulation->compute(10);
         }
         
+        template<typename ModelType>
+        void BisimulationAbstractionRefinementModelChecker<ModelType>::translateBounds(storm::models::Model<ValueType> const& abstractModel, std::pair<std::unique_ptr<CheckResult>, std::unique_ptr<CheckResult>>& bounds) {
+            if (!previousPartition) {
+                return;
+            }
+            
+            auto const& partition = this->bisimulation->getStatePartition();
+            std::set<storm::expressions::Variable> blockVariableSet = {partition.getBlockVariable()};
+            std::set<storm::expressions::Variable> blockPrimeVariableSet = {partition.getPrimedBlockVariable()};
+            
+            auto const& symbolicAbstractModel = *abstractModel.template as<storm::models::symbolic::Model<DdType, ValueType>>();
+            if (symbolicAbstractModel.getRowVariables() != blockVariableSet) {
+                // The states of the abstract model are not the blocks (e.g. because the full quotient was extracted
+                // over the original variables), so the bounds cannot be translated.
+                bounds.first = nullptr;
+                bounds.second = nullptr;
+                return;
+            }
+            
+            // Only the lower bounds are used (as start values of the minimizing solve), so the upper bounds are dropped.
+            // Since the symbolic solvers approach the solution from below, starting the maximizing solve from an upper
+            // bound could converge to a wrong fixed point.
+            bounds.second = nullptr;
+            if (!bounds.first) {
+                return;
+            }
+            
+            // Since the last partition refines the previous one, every (new) block is related to exactly one (old)
+            // block from which it was split and inherits its value. As the refined abstract model is at least as
+            // precise, the translated lower bounds remain valid.
+            storm::dd::Bdd<DdType> splitRelation = (lastPartition.get() && previousPartition.get().renameVariables(blockVariableSet, blockPrimeVariableSet)).existsAbstract(model.getColumnVariables());
+            storm::dd::Add<DdType, ValueType> values = bounds.first->template asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector().renameVariables(blockVariableSet, blockPrimeVariableSet);
+            bounds.first = std::make_unique<SymbolicQuantitativeCheckResult<DdType, ValueType>>(symbolicAbstractModel.getReachableStates(), splitRelation.ite(values, symbolicAbstractModel.getManager().template getAddZero<ValueType>()).maxAbstract(blockPrimeVariableSet));
+        }
+        
         template class BisimulationAbstractionRefinementModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>;
         template class BisimulationAbstractionRefinementModelChecker<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>>;
         template class BisimulationAbstractionRefinementModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>>;
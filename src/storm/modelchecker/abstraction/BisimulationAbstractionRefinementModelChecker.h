@@ -2,8 +2,12 @@
 
 #include <memory>
 
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/abstraction/AbstractAbstractionRefinementModelChecker.h"
 
+#include "storm/storage/dd/Bdd.h"
+
 namespace storm {
     namespace models {
         template<typename ValueType>
@@ -39,6 +43,7 @@ namespace storm {
             virtual uint64_t getAbstractionPlayer() const override;
             virtual bool requiresSchedulerSynthesis() const override;
             virtual void refineAbstractModel() override;
+            virtual void translateBounds(storm::models::Model<ValueType> const& abstractModel, std::pair<std::unique_ptr<CheckResult>, std::unique_ptr<CheckResult>>& bounds) override;
             
         private:
             template<typename QuotientModelType>
@@ -52,6 +57,12 @@ namespace storm {
             /// Maintains the last abstract model that was returned.
             std::shared_ptr<storm::models::Model<ValueType>> lastAbstractModel;
             
+            /// The partitions (over the column variables and the block variable) from which the last and the previous
+            /// abstract model were extracted. They are used to map the bounds of the previous abstract model to the
+            /// blocks of the last one.
+            boost::optional<storm::dd::Bdd<DdType>> lastPartition;
+            boost::optional<storm::dd::Bdd<DdType>> previousPartition;
+            
             /// The name of the method.
             const static std::string name;
         };
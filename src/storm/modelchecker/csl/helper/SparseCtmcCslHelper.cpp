@@ -8,8 +8,13 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
+#include "storm/solver/helper/AggregationDisaggregationHelper.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -413,6 +418,19 @@ namespace storm {
                                                          exitRateVector);
             }
             
+            template <typename ValueType, typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, int>::type = 0>
+            static bool computeSteadyStateDistributionAggregationDisaggregation(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transposedProbabilityMatrix, std::vector<uint_fast64_t> const& stateToBsccIndexMap, uint_fast64_t numberOfBsccs, std::vector<ValueType>& distribution) {
+                storm::solver::helper::SteadyStateAggregationDisaggregationHelper<ValueType> aggregationDisaggregationHelper(env, transposedProbabilityMatrix, stateToBsccIndexMap, numberOfBsccs);
+                aggregationDisaggregationHelper.computeSteadyStateDistribution(env, distribution);
+                return true;
+            }
+            
+            template <typename ValueType, typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, int>::type = 0>
+            static bool computeSteadyStateDistributionAggregationDisaggregation(Environment const&, storm::storage::SparseMatrix<ValueType> const&, std::vector<uint_fast64_t> const&, uint_fast64_t, std::vector<ValueType>&) {
+                // As the native solver, the aggregation-disaggregation method does not support parametric computations.
+                return false;
+            }
+            
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeLongRunAverages(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, std::function<ValueType (storm::storage::sparse::state_type const& state)> const& valueGetter, std::vector<ValueType> const* exitRateVector){
                 uint_fast64_t numberOfStates = probabilityMatrix.getRowCount();
@@ -486,76 +504,81 @@ namespace storm {
                         }
                     }
                     
-                    // Build a different system depending on the problem format of the equation solver.
-                    // Check solver requirements.
-                    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
-                    auto requirements = linearEquationSolverFactory.getRequirements(env);
-                    requirements.clearLowerBounds();
-                    requirements.clearUpperBounds();
-                    STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
-                    
-                    bool fixedPointSystem = false;
-                    if (linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem) {
-                        fixedPointSystem = true;
+                    // Create the initial guess for the LRAs. We take a uniform distribution over all states in a BSCC.
+                    std::vector<ValueType> bsccEquationSystemSolution(bsccEquationSystem.getColumnCount(), zero);
+                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
+                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
+                        
+                        for (auto const& state : bscc) {
+                            bsccEquationSystemSolution[indexInStatesInBsccs[state]] = one / bscc.size();
+                        }
                     }
+                    
+                    // The aggregation-disaggregation method of the native solver aggregates the chain itself instead of the
+                    // equation system, as the coarse systems of the latter are singular.
+                    bool useAggregationDisaggregation = env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native && env.solver().native().getMethod() == storm::solver::NativeLinearEquationSolverMethod::AggregationDisaggregation;
+                    if (!useAggregationDisaggregation || !computeSteadyStateDistributionAggregationDisaggregation(env, bsccEquationSystem, stateToBsccIndexMap, bsccDecomposition.size(), bsccEquationSystemSolution)) {
+                        // Build a different system depending on the problem format of the equation solver.
+                        // Check solver requirements.
+                        storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+                        auto requirements = linearEquationSolverFactory.getRequirements(env);
+                        requirements.clearLowerBounds();
+                        requirements.clearUpperBounds();
+                        STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
+                    
+                        bool fixedPointSystem = false;
+                        if (linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem) {
+                            fixedPointSystem = true;
+                        }
 
-                    // Now build the final equation system matrix, the initial guess and the right-hand side in one go.
-                    std::vector<ValueType> bsccEquationSystemRightSide(bsccEquationSystem.getColumnCount(), zero);
-                    storm::storage::SparseMatrixBuilder<ValueType> builder;
-                    for (uint_fast64_t row = 0; row < bsccEquationSystem.getRowCount(); ++row) {
+                        // Now build the final equation system matrix, the initial guess and the right-hand side in one go.
+                        std::vector<ValueType> bsccEquationSystemRightSide(bsccEquationSystem.getColumnCount(), zero);
+                        storm::storage::SparseMatrixBuilder<ValueType> builder;
+                        for (uint_fast64_t row = 0; row < bsccEquationSystem.getRowCount(); ++row) {
                     
-                        // If the current row is the first one belonging to a BSCC, we substitute it by the constraint that the
-                        // values for states of this BSCC must sum to one. However, in order to have a non-zero value on the
-                        // diagonal, we add the constraint of the BSCC that produces a 1 on the diagonal.
-                        if (firstStatesInBsccs.get(row)) {
-                            uint_fast64_t requiredBscc = stateToBsccIndexMap[row];
-                            storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[requiredBscc];
-
-                            if (fixedPointSystem) {
-                                for (auto const& state : bscc) {
-                                    if (row == indexInStatesInBsccs[state]) {
-                                        builder.addNextValue(row, indexInStatesInBsccs[state], zero);
-                                    } else {
-                                        builder.addNextValue(row, indexInStatesInBsccs[state], -one);
+                            // If the current row is the first one belonging to a BSCC, we substitute it by the constraint that the
+                            // values for states of this BSCC must sum to one. However, in order to have a non-zero value on the
+                            // diagonal, we add the constraint of the BSCC that produces a 1 on the diagonal.
+                            if (firstStatesInBsccs.get(row)) {
+                                uint_fast64_t requiredBscc = stateToBsccIndexMap[row];
+                                storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[requiredBscc];
+
+                                if (fixedPointSystem) {
+                                    for (auto const& state : bscc) {
+                                        if (row == indexInStatesInBsccs[state]) {
+                                            builder.addNextValue(row, indexInStatesInBsccs[state], zero);
+                                        } else {
+                                            builder.addNextValue(row, indexInStatesInBsccs[state], -one);
+                                        }
+                                    }
+                                } else {
+                                    for (auto const& state : bscc) {
+                                        builder.addNextValue(row, indexInStatesInBsccs[state], one);
                                     }
                                 }
-                            } else {
-                                for (auto const& state : bscc) {
-                                    builder.addNextValue(row, indexInStatesInBsccs[state], one);
-                                }
-                            }
                             
-                            bsccEquationSystemRightSide[row] = one;
-                        } else {
-                            // Otherwise, we copy the row, and subtract 1 from the diagonal (only for the equation solver format).
-                            for (auto& entry : bsccEquationSystem.getRow(row)) {
-                                if (fixedPointSystem || entry.getColumn() != row) {
-                                    builder.addNextValue(row, entry.getColumn(), entry.getValue());
-                                } else {
-                                    builder.addNextValue(row, entry.getColumn(), entry.getValue() - one);
+                                bsccEquationSystemRightSide[row] = one;
+                            } else {
+                                // Otherwise, we copy the row, and subtract 1 from the diagonal (only for the equation solver format).
+                                for (auto& entry : bsccEquationSystem.getRow(row)) {
+                                    if (fixedPointSystem || entry.getColumn() != row) {
+                                        builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                                    } else {
+                                        builder.addNextValue(row, entry.getColumn(), entry.getValue() - one);
+                                    }
                                 }
                             }
                         }
-                    }
                     
-                    // Create the initial guess for the LRAs. We take a uniform distribution over all states in a BSCC.
-                    std::vector<ValueType> bsccEquationSystemSolution(bsccEquationSystem.getColumnCount(), zero);
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
-                        
-                        for (auto const& state : bscc) {
-                            bsccEquationSystemSolution[indexInStatesInBsccs[state]] = one / bscc.size();
+                        bsccEquationSystem = builder.build();
+                        {
+                            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(bsccEquationSystem));
+                            solver->setLowerBound(storm::utility::zero<ValueType>());
+                            solver->setUpperBound(storm::utility::one<ValueType>());
+                            solver->solveEquations(env, bsccEquationSystemSolution, bsccEquationSystemRightSide);
                         }
                     }
                     
-                    bsccEquationSystem = builder.build();
-                    {
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(bsccEquationSystem));
-                        solver->setLowerBound(storm::utility::zero<ValueType>());
-                        solver->setUpperBound(storm::utility::one<ValueType>());
-                        solver->solveEquations(env, bsccEquationSystemSolution, bsccEquationSystemRightSide);
-                    }
-                    
                     // If exit rates were given, we need to 'fix' the results to also account for the timing behaviour.
                     if (exitRateVector != nullptr) {
                         std::vector<ValueType> bsccTotalValue(bsccDecomposition.size(), zero);
@@ -801,16 +824,41 @@ namespace storm {
                 }
                 
                 auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                
+                // If requested, resume from a checkpoint. The index of the next multiplication is stored as iteration.
+                storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, useMixedPoissonProbabilities ? "uniformization-cumulative" : "uniformization", [&] () {
+                    std::size_t fingerprint = uniformizedMatrix.hash();
+                    boost::hash_combine(fingerprint, boost::hash_range(values.begin(), values.end()));
+                    if (addVector) {
+                        boost::hash_combine(fingerprint, boost::hash_range(addVector->begin(), addVector->end()));
+                    }
+                    boost::hash_combine(fingerprint, timeBound);
+                    boost::hash_combine(fingerprint, uniformizationRate);
+                    return fingerprint;
+                });
+                uint_fast64_t firstIndex = 1;
+                if (auto restoredIndex = checkpoint.restore({&values, &result})) {
+                    firstIndex = restoredIndex.get();
+                }
+                
                 if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
                     // Perform the matrix-vector multiplications (without adding).
-                    multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+                    if (checkpoint.isEnabled()) {
+                        for (uint_fast64_t index = firstIndex; index < startingIteration; ++index) {
+                            multiplier->multiply(env, values, addVector, values);
+                            checkpoint.update(index + 1, {&values, &result});
+                        }
+                    } else {
+                        multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+                    }
                 } else if (useMixedPoissonProbabilities) {
                     std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
                     
                     // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-                    for (uint_fast64_t index = 1; index < startingIteration; ++index) {
+                    for (uint_fast64_t index = firstIndex; index < startingIteration; ++index) {
                         multiplier->multiply(env, values, nullptr, values);
                         storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                        checkpoint.update(index + 1, {&values, &result});
                     }
                 }
                 
@@ -818,11 +866,12 @@ namespace storm {
                 // multiplication, scale and add the result.
                 ValueType weight = 0;
                 std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
-                for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
+                for (uint_fast64_t index = std::max(startingIteration, firstIndex); index <= foxGlynnResult.right; ++index) {
                     multiplier->multiply(env, values, addVector, values);
                     
                     weight = foxGlynnResult.weights[index - foxGlynnResult.left];
                     storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                    checkpoint.update(index + 1, {&values, &result});
                 }
                 
                 return result;
@@ -902,59 +902,68 @@ namespace storm {
                 solver->setOptimizationDirection(invert(dir));
                 
                 // First, we need to create the variables for the problem.
-                std::map<uint64_t, storm::expressions::Variable> stateToVariableMap;
+                std::vector<storm::expressions::Variable> variables;
+                std::map<uint64_t, uint64_t> stateToVariableIndexMap;
+                uint64_t numberOfChoices = 0;
                 for (auto const& stateChoicesPair : mec) {
                     std::string variableName = "x" + std::to_string(stateChoicesPair.first);
-                    stateToVariableMap[stateChoicesPair.first] = solver->addUnboundedContinuousVariable(variableName);
+                    stateToVariableIndexMap[stateChoicesPair.first] = variables.size();
+                    variables.push_back(solver->addUnboundedContinuousVariable(variableName));
+                    numberOfChoices += stateChoicesPair.second.size();
                 }
+                uint64_t kIndex = variables.size();
                 storm::expressions::Variable k = solver->addUnboundedContinuousVariable("k", storm::utility::one<ValueType>());
+                variables.push_back(k);
                 solver->update();
                 
-                // Now we encode the problem as constraints.
+                // Now we encode the problem as constraints, one for each choice. The constraints are passed to the
+                // solver as a matrix, which avoids building an expression for every choice.
+                storm::storage::SparseMatrixBuilder<ValueType> constraintBuilder(numberOfChoices, variables.size());
+                std::vector<ValueType> rightHandSides;
+                rightHandSides.reserve(numberOfChoices);
+                std::map<uint64_t, ValueType> coefficients;
+                uint64_t constraintIndex = 0;
                 std::vector<uint64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
                 for (auto const& stateChoicesPair : mec) {
                     uint64_t state = stateChoicesPair.first;
                     
                     // Now, based on the type of the state, create a suitable constraint.
                     if (markovianStates.get(state)) {
+                        // For Markovian states, we want to add the constraint x_s - sum P(s, s') * x_s' + k / E(s) <= R(s).
                         STORM_LOG_ASSERT(stateChoicesPair.second.size() == 1, "Markovian state " << state << " is not deterministic: It has " << stateChoicesPair.second.size() << " choices.");
                         uint64_t choice = *stateChoicesPair.second.begin();
                         
-                        storm::expressions::Expression constraint = stateToVariableMap.at(state);
-                        
+                        coefficients.clear();
+                        coefficients[stateToVariableIndexMap.at(state)] = storm::utility::one<ValueType>();
                         for (auto element : transitionMatrix.getRow(nondeterministicChoiceIndices[state])) {
-                            constraint = constraint - stateToVariableMap.at(element.getColumn()) * solver->getManager().rational((element.getValue()));
+                            auto coefficientIt = coefficients.emplace(stateToVariableIndexMap.at(element.getColumn()), storm::utility::zero<ValueType>()).first;
+                            coefficientIt->second -= element.getValue();
                         }
-                        
-                        constraint = constraint + solver->getManager().rational(storm::utility::one<ValueType>() / exitRateVector[state]) * k;
-                        
-                        storm::expressions::Expression rightHandSide = solver->getManager().rational(rewardModel.getTotalStateActionReward(state, choice, transitionMatrix, (ValueType) (storm::utility::one<ValueType>() / exitRateVector[state])));
-                        if (dir == OptimizationDirection::Minimize) {
-                            constraint = constraint <= rightHandSide;
-                        } else {
-                            constraint = constraint >= rightHandSide;
+                        coefficients[kIndex] = storm::utility::one<ValueType>() / exitRateVector[state];
+                        for (auto const& coefficient : coefficients) {
+                            constraintBuilder.addNextValue(constraintIndex, coefficient.first, coefficient.second);
                         }
-                        solver->addConstraint("state" + std::to_string(state), constraint);
+                        rightHandSides.push_back(rewardModel.getTotalStateActionReward(state, choice, transitionMatrix, (ValueType) (storm::utility::one<ValueType>() / exitRateVector[state])));
+                        ++constraintIndex;
                     } else {
                         // For probabilistic states, we want to add the constraint x_s <= sum P(s, a, s') * x_s' where a is the current action
                         // and the sum ranges over all states s'.
                         for (auto choice : stateChoicesPair.second) {
-                            storm::expressions::Expression constraint = stateToVariableMap.at(state);
-                            
+                            coefficients.clear();
+                            coefficients[stateToVariableIndexMap.at(state)] = storm::utility::one<ValueType>();
                             for (auto element : transitionMatrix.getRow(choice)) {
-                                constraint = constraint - stateToVariableMap.at(element.getColumn()) * solver->getManager().rational(element.getValue());
+                                auto coefficientIt = coefficients.emplace(stateToVariableIndexMap.at(element.getColumn()), storm::utility::zero<ValueType>()).first;
+                                coefficientIt->second -= element.getValue();
                             }
-
-                            storm::expressions::Expression rightHandSide = solver->getManager().rational(rewardModel.getTotalStateActionReward(state, choice, transitionMatrix, storm::utility::zero<ValueType>()));
-                            if (dir == OptimizationDirection::Minimize) {
-                                constraint = constraint <= rightHandSide;
-                            } else {
-                                constraint = constraint >= rightHandSide;
+                            for (auto const& coefficient : coefficients) {
+                                constraintBuilder.addNextValue(constraintIndex, coefficient.first, coefficient.second);
                             }
-                            solver->addConstraint("state" + std::to_string(state), constraint);
+                            rightHandSides.push_back(rewardModel.getTotalStateActionReward(state, choice, transitionMatrix, storm::utility::zero<ValueType>()));
+                            ++constraintIndex;
                         }
                     }
                 }
+                solver->addConstraints(constraintBuilder.build(), variables, dir == OptimizationDirection::Minimize ? storm::expressions::OperatorType::LessOrEqual : storm::expressions::OperatorType::GreaterOrEqual, rightHandSides);
                 
                 solver->optimize();
                 return solver->getContinuousValue(k);
@@ -1532,36 +1532,46 @@ namespace storm {
                 solver->setOptimizationDirection(invert(dir));
                 
                 // First, we need to create the variables for the problem.
-                std::map<uint_fast64_t, storm::expressions::Variable> stateToVariableMap;
+                std::vector<storm::expressions::Variable> variables;
+                std::map<uint_fast64_t, uint64_t> stateToVariableIndexMap;
+                uint64_t numberOfChoices = 0;
                 for (auto const& stateChoicesPair : mec) {
                     std::string variableName = "h" + std::to_string(stateChoicesPair.first);
-                    stateToVariableMap[stateChoicesPair.first] = solver->addUnboundedContinuousVariable(variableName);
+                    stateToVariableIndexMap[stateChoicesPair.first] = variables.size();
+                    variables.push_back(solver->addUnboundedContinuousVariable(variableName));
+                    numberOfChoices += stateChoicesPair.second.size();
                 }
+                uint64_t lambdaIndex = variables.size();
                 storm::expressions::Variable lambda = solver->addUnboundedContinuousVariable("L", 1);
+                variables.push_back(lambda);
                 solver->update();
                 
-                // Now we encode the problem as constraints.
+                // Now we encode the problem as constraints h_s - sum_s' P(s,a,s') * h_s' + L <= r(s,a) (>= when
+                // maximizing) with one row for each choice.
+                storm::storage::SparseMatrixBuilder<ValueType> constraintBuilder(numberOfChoices, variables.size());
+                std::vector<ValueType> rightHandSides;
+                rightHandSides.reserve(numberOfChoices);
+                std::map<uint64_t, ValueType> coefficients;
+                uint64_t constraintIndex = 0;
                 for (auto const& stateChoicesPair : mec) {
                     uint_fast64_t state = stateChoicesPair.first;
                     
-                    // Now, based on the type of the state, create a suitable constraint.
                     for (auto choice : stateChoicesPair.second) {
-                        storm::expressions::Expression constraint = -lambda;
-                        
+                        coefficients.clear();
+                        coefficients[stateToVariableIndexMap.at(state)] = storm::utility::one<ValueType>();
+                        coefficients[lambdaIndex] = storm::utility::one<ValueType>();
                         for (auto element : transitionMatrix.getRow(choice)) {
-                            constraint = constraint + stateToVariableMap.at(element.getColumn()) * solver->getConstant(element.getValue());
+                            auto coefficientIt = coefficients.emplace(stateToVariableIndexMap.at(element.getColumn()), storm::utility::zero<ValueType>()).first;
+                            coefficientIt->second -= element.getValue();
                         }
-                        typename RewardModelType::ValueType r = rewardModel.getTotalStateActionReward(state, choice, transitionMatrix);
-                        constraint = solver->getConstant(r) + constraint;
-                        
-                        if (dir == OptimizationDirection::Minimize) {
-                            constraint = stateToVariableMap.at(state) <= constraint;
-                        } else {
-                            constraint = stateToVariableMap.at(state) >= constraint;
+                        for (auto const& coefficient : coefficients) {
+                            constraintBuilder.addNextValue(constraintIndex, coefficient.first, coefficient.second);
                         }
-                        solver->addConstraint("state" + std::to_string(state) + "," + std::to_string(choice), constraint);
+                        rightHandSides.push_back(rewardModel.getTotalStateActionReward(state, choice, transitionMatrix));
+                        ++constraintIndex;
                     }
                 }
+                solver->addConstraints(constraintBuilder.build(), variables, dir == OptimizationDirection::Minimize ? storm::expressions::OperatorType::LessOrEqual : storm::expressions::OperatorType::GreaterOrEqual, rightHandSides);
                 
                 solver->optimize();
                 return solver->getContinuousValue(lambda);
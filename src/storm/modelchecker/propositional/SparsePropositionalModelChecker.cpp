@@ -49,6 +49,11 @@ namespace storm {
         SparseModelType const& SparsePropositionalModelChecker<SparseModelType>::getModel() const {
             return model;
         }
+
+        template<typename SparseModelType>
+        void const* SparsePropositionalModelChecker<SparseModelType>::getResultCacheIdentifier() const {
+            return &model;
+        }
         
         // Explicitly instantiate the template class.
         template class SparsePropositionalModelChecker<storm::models::sparse::Model<double>>;
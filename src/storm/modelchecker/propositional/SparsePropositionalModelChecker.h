@@ -27,6 +27,8 @@ namespace storm {
              * @return The model associated with this model checker instance.
              */
             SparseModelType const& getModel() const;
+
+            virtual void const* getResultCacheIdentifier() const override;
             
         private:
             // The model that is to be analyzed by the model checker.
@@ -56,6 +56,11 @@ namespace storm {
         ModelType const& SymbolicPropositionalModelChecker<ModelType>::getModel() const {
             return model;
         }
+
+        template<typename ModelType>
+        void const* SymbolicPropositionalModelChecker<ModelType>::getResultCacheIdentifier() const {
+            return &model;
+        }
         
         // Explicitly instantiate the template class.
         template class SymbolicPropositionalModelChecker<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>>;
@@ -166,6 +166,10 @@ namespace storm {
         bool CheckResult::hasScheduler() const {
             return false;
         }
+
+        uint64_t CheckResult::getMemoryUsage() const {
+            return 0;
+        }
         
         // Explicitly instantiate the template functions.
         template QuantitativeCheckResult<double>& CheckResult::asQuantitativeCheckResult();
@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_CHECKRESULT_H_
 #define STORM_MODELCHECKER_CHECKRESULT_H_
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 
@@ -114,6 +115,12 @@ namespace storm {
 
             virtual bool hasScheduler() const;
 
+            /*!
+             * Retrieves an estimate of the number of bytes occupied by the values of this result. Results whose values
+             * are stored in decision diagrams share their nodes with other diagrams, so these values are not counted.
+             */
+            virtual uint64_t getMemoryUsage() const;
+
             virtual std::ostream& writeToStream(std::ostream& out) const = 0;
         };
         
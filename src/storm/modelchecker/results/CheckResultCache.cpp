@@ -0,0 +1,120 @@
+#include "storm/modelchecker/results/CheckResultCache.h"
+
+#include <sstream>
+
+#include "storm/modelchecker/results/CheckResult.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        static std::string getModelKey(void const* model, std::string const& key) {
+            std::stringstream stream;
+            stream << model << "|" << key;
+            return stream.str();
+        }
+
+        CheckResultCache::CheckResultCache(uint64_t memoryLimit) : memoryLimit(memoryLimit), restrictedModel(nullptr), memoryUsage(0), hits(0), misses(0), evictions(0) {
+            // Intentionally left empty.
+        }
+
+        std::unique_ptr<CheckResult> CheckResultCache::find(void const* model, std::string const& key) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!isCached(model)) {
+                return nullptr;
+            }
+            auto entryIt = keyToEntry.find(getModelKey(model, key));
+            if (entryIt == keyToEntry.end()) {
+                ++misses;
+                return nullptr;
+            }
+            ++hits;
+            // Mark the entry as the most recently used one.
+            entries.splice(entries.begin(), entries, entryIt->second);
+            return entryIt->second->result->clone();
+        }
+
+        void CheckResultCache::insert(void const* model, std::string const& key, CheckResult const& result) {
+            uint64_t resultMemoryUsage = result.getMemoryUsage() + key.size();
+            if (memoryLimit > 0 && resultMemoryUsage > memoryLimit) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!isCached(model)) {
+                return;
+            }
+            std::unique_ptr<CheckResult> copy = result.clone();
+            std::string modelKey = getModelKey(model, key);
+            auto entryIt = keyToEntry.find(modelKey);
+            if (entryIt != keyToEntry.end()) {
+                memoryUsage -= entryIt->second->memoryUsage;
+                entries.erase(entryIt->second);
+                keyToEntry.erase(entryIt);
+            }
+            entries.push_front(Entry{modelKey, std::move(copy), resultMemoryUsage});
+            keyToEntry.emplace(std::move(modelKey), entries.begin());
+            memoryUsage += resultMemoryUsage;
+            evict();
+        }
+
+        void CheckResultCache::clear() {
+            std::lock_guard<std::mutex> lock(mutex);
+            entries.clear();
+            keyToEntry.clear();
+            memoryUsage = 0;
+        }
+
+        void CheckResultCache::restrictToModel(void const* model) {
+            std::lock_guard<std::mutex> lock(mutex);
+            restrictedModel = model;
+        }
+
+        bool CheckResultCache::isCached(void const* model) const {
+            return restrictedModel == nullptr || restrictedModel == model;
+        }
+
+        void CheckResultCache::evict() {
+            while (memoryLimit > 0 && memoryUsage > memoryLimit && !entries.empty()) {
+                memoryUsage -= entries.back().memoryUsage;
+                keyToEntry.erase(entries.back().key);
+                entries.pop_back();
+                ++evictions;
+            }
+        }
+
+        uint64_t CheckResultCache::getNumberOfEntries() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return entries.size();
+        }
+
+        uint64_t CheckResultCache::getNumberOfHits() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return hits;
+        }
+
+        uint64_t CheckResultCache::getNumberOfMisses() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return misses;
+        }
+
+        uint64_t CheckResultCache::getNumberOfEvictions() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return evictions;
+        }
+
+        uint64_t CheckResultCache::getMemoryUsage() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return memoryUsage;
+        }
+
+        uint64_t CheckResultCache::getMemoryLimit() const {
+            return memoryLimit;
+        }
+
+        void CheckResultCache::printStatistics(std::ostream& out) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            out << "Subformula cache: " << hits << " hits, " << misses << " misses, " << entries.size() << " entries (" << memoryUsage << " bytes), " << evictions << " evictions." << std::endl;
+        }
+
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace storm {
+    namespace modelchecker {
+
+        class CheckResult;
+
+        /*!
+         * A cache for the results of state formulas that can be shared among the checks of several properties. Results
+         * are stored per model and are identified by a key that describes the formula (including its bounds and
+         * optimization directions) and the relevant parts of the check task.
+         *
+         * If the memory occupied by the cached results exceeds the limit, the least recently used results are
+         * evicted. Results of models that are modified after they were inserted must be removed by clearing the cache.
+         * As models are identified by their address, the cache can be restricted to a single model such that results
+         * of temporary models (whose addresses may be reused later) are not cached.
+         * All operations are thread-safe.
+         */
+        class CheckResultCache {
+        public:
+            /*!
+             * Creates an empty cache.
+             *
+             * @param memoryLimit The maximal number of bytes occupied by the cached results (zero means no limit).
+             */
+            CheckResultCache(uint64_t memoryLimit = 0);
+
+            /*!
+             * Retrieves a copy of the result that was cached for the given key and model (if any).
+             *
+             * @return The copy of the cached result or null if there is none.
+             */
+            std::unique_ptr<CheckResult> find(void const* model, std::string const& key);
+
+            /*!
+             * Stores a copy of the given result for the given key and model. Results exceeding the memory limit on
+             * their own are not stored.
+             */
+            void insert(void const* model, std::string const& key, CheckResult const& result);
+
+            /*!
+             * Removes all cached results, but keeps the statistics.
+             */
+            void clear();
+
+            /*!
+             * Restricts the cache to results of the given model, i.e., results of all other models are neither stored
+             * nor retrieved.
+             */
+            void restrictToModel(void const* model);
+
+            uint64_t getNumberOfEntries() const;
+            uint64_t getNumberOfHits() const;
+            uint64_t getNumberOfMisses() const;
+            uint64_t getNumberOfEvictions() const;
+            uint64_t getMemoryUsage() const;
+            uint64_t getMemoryLimit() const;
+
+            void printStatistics(std::ostream& out) const;
+
+        private:
+            struct Entry {
+                std::string key;
+                std::unique_ptr<CheckResult> result;
+                uint64_t memoryUsage;
+            };
+
+            void evict();
+            bool isCached(void const* model) const;
+
+            uint64_t memoryLimit;
+            void const* restrictedModel;
+            uint64_t memoryUsage;
+            uint64_t hits;
+            uint64_t misses;
+            uint64_t evictions;
+
+            // The entries ordered from the most to the least recently used one.
+            std::list<Entry> entries;
+            std::unordered_map<std::string, std::list<Entry>::iterator> keyToEntry;
+
+            mutable std::mutex mutex;
+        };
+
+    }
+}
@@ -163,6 +163,15 @@ namespace storm {
         bool ExplicitQualitativeCheckResult::isExplicitQualitativeCheckResult() const {
             return true;
         }
+
+        uint64_t ExplicitQualitativeCheckResult::getMemoryUsage() const {
+            if (this->isResultForAllStates()) {
+                return ((this->getTruthValuesVector().size() + 63) / 64) * sizeof(uint64_t);
+            } else {
+                // Account for the nodes of the map.
+                return this->getTruthValuesMap().size() * (sizeof(map_type::value_type) + 4 * sizeof(void*));
+            }
+        }
         
         std::ostream& ExplicitQualitativeCheckResult::writeToStream(std::ostream& out) const {
             if (this->isResultForAllStates()) {
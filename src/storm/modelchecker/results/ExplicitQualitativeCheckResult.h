@@ -43,6 +43,8 @@ namespace storm {
             virtual bool isResultForAllStates() const override;
             
             virtual bool isExplicitQualitativeCheckResult() const override;
+
+            virtual uint64_t getMemoryUsage() const override;
             
             virtual QualitativeCheckResult& operator&=(QualitativeCheckResult const& other) override;
             virtual QualitativeCheckResult& operator|=(QualitativeCheckResult const& other) override;
@@ -180,6 +180,16 @@ namespace storm {
             return static_cast<bool>(scheduler);
         }
         
+        template<typename ValueType>
+        uint64_t ExplicitQuantitativeCheckResult<ValueType>::getMemoryUsage() const {
+            if (this->isResultForAllStates()) {
+                return this->getValueVector().size() * sizeof(ValueType);
+            } else {
+                // Account for the nodes of the map.
+                return this->getValueMap().size() * (sizeof(typename map_type::value_type) + 4 * sizeof(void*));
+            }
+        }
+
         template<typename ValueType>
         void ExplicitQuantitativeCheckResult<ValueType>::setScheduler(std::unique_ptr<storm::storage::Scheduler<ValueType>>&& scheduler) {
             this->scheduler = std::move(scheduler);
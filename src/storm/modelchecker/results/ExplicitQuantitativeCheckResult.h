@@ -66,6 +66,7 @@ namespace storm {
             virtual ValueType sum() const override;
             
             virtual bool hasScheduler() const override;
+            virtual uint64_t getMemoryUsage() const override;
             void setScheduler(std::unique_ptr<storm::storage::Scheduler<ValueType>>&& scheduler);
             storm::storage::Scheduler<ValueType> const& getScheduler() const;
             storm::storage::Scheduler<ValueType>& getScheduler();
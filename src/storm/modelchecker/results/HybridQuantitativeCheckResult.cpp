@@ -94,6 +94,12 @@ namespace storm {
         std::vector<ValueType> const& HybridQuantitativeCheckResult<Type, ValueType>::getExplicitValueVector() const {
             return explicitValues;
         }
+
+        template<storm::dd::DdType Type, typename ValueType>
+        uint64_t HybridQuantitativeCheckResult<Type, ValueType>::getMemoryUsage() const {
+            // Only the explicit values are accounted for, as the decision diagrams share their nodes.
+            return explicitValues.size() * sizeof(ValueType);
+        }
         
         template<typename ValueType>
         void print(std::ostream& out, ValueType const& value) {
@@ -43,6 +43,8 @@ namespace storm {
             storm::dd::Odd const& getOdd() const;
             
             std::vector<ValueType> const& getExplicitValueVector() const;
+
+            virtual uint64_t getMemoryUsage() const override;
             
             virtual std::ostream& writeToStream(std::ostream& out) const override;
             
@@ -86,6 +86,13 @@ namespace storm {
              */
             virtual void printModelInformationToStream(std::ostream& out) const = 0;
             
+            /*!
+             * Prints how much memory is occupied by the components of the model to the specified stream.
+             *
+             * @param out The stream the information is to be printed to.
+             */
+            virtual void printMemoryUsageToStream(std::ostream& out) const = 0;
+            
             /*!
              * Checks whether the model is a sparse model.
              *
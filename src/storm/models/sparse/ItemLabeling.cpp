@@ -130,6 +130,18 @@ namespace storm {
                 return itemCount;
             }
 
+            uint64_t ItemLabeling::getMemoryUsage() const {
+                uint64_t result = sizeof(*this);
+                for (auto const& labeling : labelings) {
+                    result += labeling.getSizeInBytes();
+                }
+                // Account for the nodes of the map and the names of the labels.
+                for (auto const& nameIndexPair : nameToLabelingIndexMap) {
+                    result += sizeof(nameIndexPair) + 2 * sizeof(void*) + nameIndexPair.first.capacity();
+                }
+                return result;
+            }
+
             storm::storage::BitVector const& ItemLabeling::getItems(std::string const& label) const {
                 STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "The label " << label << " is invalid for the labeling of the model.");
                 return this->labelings[nameToLabelingIndexMap.at(label)];
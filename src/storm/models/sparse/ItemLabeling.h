@@ -113,6 +113,13 @@ namespace storm {
                  */
                 std::size_t getNumberOfItems() const;
 
+                /*!
+                 * Retrieves an estimate of the number of bytes occupied by this labeling.
+                 *
+                 * @return The number of bytes occupied by this labeling.
+                 */
+                uint64_t getMemoryUsage() const;
+
                 
 
                 /*!
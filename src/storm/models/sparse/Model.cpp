@@ -7,6 +7,7 @@
 #include "storm/utility/vector.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/MemoryUsage.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -299,6 +300,36 @@ namespace storm {
                 this->printModelInformationFooterToStream(out);
             }
             
+            template<typename ValueType, typename RewardModelType>
+            static storm::utility::memory::MemoryUsageBreakdown getMemoryUsageBreakdown(Model<ValueType, RewardModelType> const& model) {
+                storm::utility::memory::MemoryUsageBreakdown breakdown("Memory usage of the model");
+                breakdown.add("Transition matrix", model.getTransitionMatrix().getMemoryUsage());
+                breakdown.add("State labeling", model.getStateLabeling().getMemoryUsage());
+                if (model.hasChoiceLabeling()) {
+                    breakdown.add("Choice labeling", model.getChoiceLabeling().getMemoryUsage());
+                }
+                for (auto const& rewardModel : model.getRewardModels()) {
+                    breakdown.add(rewardModel.first.empty() ? "Reward model (unnamed)" : "Reward model '" + rewardModel.first + "'", rewardModel.second.getMemoryUsage());
+                }
+                if (model.hasStateValuations()) {
+                    breakdown.add("State valuations", model.getStateValuations().getMemoryUsage());
+                }
+                if (model.hasChoiceOrigins()) {
+                    breakdown.add("Choice origins", model.getChoiceOrigins()->getMemoryUsage());
+                }
+                return breakdown;
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            uint64_t Model<ValueType, RewardModelType>::getMemoryUsage() const {
+                return getMemoryUsageBreakdown(*this).getTotal();
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            void Model<ValueType, RewardModelType>::printMemoryUsageToStream(std::ostream& out) const {
+                getMemoryUsageBreakdown(*this).printToStream(out);
+            }
+            
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::printModelInformationHeaderToStream(std::ostream& out) const {
                 out << "-------------------------------------------------------------- " << std::endl;
@@ -319,6 +319,15 @@ namespace storm {
                  */
                 virtual void printModelInformationToStream(std::ostream& out) const override;
                 
+                /*!
+                 * Retrieves an estimate of the number of bytes occupied by this model.
+                 *
+                 * @return The number of bytes occupied by this model.
+                 */
+                uint64_t getMemoryUsage() const;
+                
+                virtual void printMemoryUsageToStream(std::ostream& out) const override;
+                
                 /*!
                  * Exports the model to the dot-format and prints the result to the given stream.
                  *
@@ -361,6 +361,21 @@ namespace storm {
 
 
 
+            template<typename ValueType>
+            uint64_t StandardRewardModel<ValueType>::getMemoryUsage() const {
+                uint64_t result = sizeof(*this);
+                if (hasStateRewards()) {
+                    result += getStateRewardVector().capacity() * sizeof(ValueType);
+                }
+                if (hasStateActionRewards()) {
+                    result += getStateActionRewardVector().capacity() * sizeof(ValueType);
+                }
+                if (hasTransitionRewards()) {
+                    result += getTransitionRewardMatrix().getMemoryUsage();
+                }
+                return result;
+            }
+
             template<typename ValueType>
             bool StandardRewardModel<ValueType>::isCompatible(uint_fast64_t nrStates, uint_fast64_t nrChoices) const {
                 if(hasStateRewards()) {
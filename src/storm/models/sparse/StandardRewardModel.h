@@ -312,6 +312,13 @@ namespace storm {
                  */
                 bool isCompatible(uint_fast64_t nrStates, uint_fast64_t nrChoices) const;
                 
+                /*!
+                 * Retrieves an estimate of the number of bytes occupied by this reward model.
+                 *
+                 * @return The number of bytes occupied by this reward model.
+                 */
+                uint64_t getMemoryUsage() const;
+                
                 template <typename ValueTypePrime>
                 friend std::ostream& operator<<(std::ostream& out, StandardRewardModel<ValueTypePrime> const& rewardModel);
                 
@@ -18,6 +18,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/dd.h"
+#include "storm/utility/MemoryUsage.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
@@ -294,6 +295,15 @@ namespace storm {
                 this->printModelInformationFooterToStream(out);
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            void Model<Type, ValueType>::printMemoryUsageToStream(std::ostream& out) const {
+                // The nodes of all diagrams are stored in the (shared) unique table of the DD package, so the memory can
+                // not be attributed to the individual components of the model.
+                storm::utility::memory::MemoryUsageBreakdown breakdown("Memory usage of the model");
+                breakdown.add("DD package", this->getManager().getMemoryUsage());
+                breakdown.printToStream(out);
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             std::vector<std::string> Model<Type, ValueType>::getLabels() const {
                 std::vector<std::string> labels;
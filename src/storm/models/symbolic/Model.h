@@ -319,6 +319,8 @@ namespace storm {
                 
                 virtual void printModelInformationToStream(std::ostream& out) const override;
                 
+                virtual void printMemoryUsageToStream(std::ostream& out) const override;
+                
                 virtual bool isSymbolicModel() const override;
 
                 virtual bool supportsParameters() const override;
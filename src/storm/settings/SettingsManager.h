@@ -16,6 +16,7 @@ namespace storm {
             class IOSettings;
             class ModuleSettings;
             class AbstractionSettings;
+            class BisimulationSettings;
         }
         class Option;
         
@@ -328,6 +329,14 @@ namespace storm {
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
         
+        /*!
+         * Retrieves the bisimulation settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the bisimulation settings.
+         */
+        storm::settings::modules::BisimulationSettings& mutableBisimulationSettings();
+        
     } // namespace settings
 } // namespace storm
 
@@ -22,6 +22,7 @@ namespace storm {
             const std::string BisimulationSettings::initialPartitionOptionName = "init";
             const std::string BisimulationSettings::refinementModeOptionName = "refine";
             const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+            const std::string BisimulationSettings::partialQuotientModeOptionName = "partialquot";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
@@ -54,6 +55,12 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
                                 .build());
+                
+                std::vector<std::string> partialQuotientModes = {"incremental", "full"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, partialQuotientModeOptionName, true, "Sets whether partial quotients are updated from the previous one or extracted from scratch.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(partialQuotientModes))
+                                             .setDefaultValueString("incremental").build())
+                                .build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -78,6 +85,10 @@ namespace storm {
                 return BisimulationSettings::QuotientFormat::Dd;
             }
             
+            void BisimulationSettings::setQuotientFormat(QuotientFormat const& format) {
+                this->getOption(quotientFormatOptionName).getArgumentByName("format").setFromStringValue(format == QuotientFormat::Sparse ? "sparse" : "dd");
+            }
+            
             bool BisimulationSettings::isUseRepresentativesSet() const {
                 return this->getOption(representativeOptionName).getHasOptionBeenSet();
             }
@@ -129,6 +140,14 @@ namespace storm {
                 }
                 return RefinementMode::Full;
             }
+            
+            bool BisimulationSettings::isIncrementalPartialQuotientSet() const {
+                return this->getOption(partialQuotientModeOptionName).getArgumentByName("mode").getValueAsString() == "incremental";
+            }
+            
+            void BisimulationSettings::setIncrementalPartialQuotient(bool value) {
+                this->getOption(partialQuotientModeOptionName).getArgumentByName("mode").setFromStringValue(value ? "incremental" : "full");
+            }
 
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
@@ -50,6 +50,13 @@ namespace storm {
                  */
                 QuotientFormat getQuotientFormat() const;
                 
+                /*!
+                 * Sets the format in which the quotient is to be extracted.
+                 *
+                 * @param format The new format.
+                 */
+                void setQuotientFormat(QuotientFormat const& format);
+                
                 /*!
                  * Retrieves whether representatives for blocks are to be used instead of the block numbers.
                  * NOTE: only applies to DD-based bisimulation.
@@ -89,6 +96,18 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves whether partial quotients are to be obtained by updating the previously extracted one.
+                 */
+                bool isIncrementalPartialQuotientSet() const;
+                
+                /*!
+                 * Sets whether partial quotients are to be obtained by updating the previously extracted one.
+                 *
+                 * @param value The new value.
+                 */
+                void setIncrementalPartialQuotient(bool value);
                                 
                 virtual bool check() const override;
                 
@@ -107,6 +126,7 @@ namespace storm {
                 static const std::string refinementModeOptionName;
                 static const std::string parallelismModeOptionName;
                 static const std::string exactArithmeticDdOptionName;
+                static const std::string partialQuotientModeOptionName;
             };
         } // namespace modules
     } // namespace settings
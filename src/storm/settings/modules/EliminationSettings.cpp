@@ -20,7 +20,7 @@ namespace storm {
             const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
             
             EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "nd"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the order in which states are chosen for elimination.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(orders)).setDefaultValueString("fwrev").build()).build());
                 
                 std::vector<std::string> methods = {"state", "hybrid"};
@@ -61,6 +61,8 @@ namespace storm {
                     return EliminationOrder::DynamicPenalty;
                 } else if (eliminationOrderAsString == "regex") {
                     return EliminationOrder::RegularExpression;
+                } else if (eliminationOrderAsString == "nd") {
+                    return EliminationOrder::NestedDissection;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
                 }
@@ -15,7 +15,7 @@ namespace storm {
                 /*!
                  * An enum that contains all available state elimination orders.
                  */
-                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression, NestedDissection };
 				
                 /*!
                  * An enum that contains all available elimination methods.
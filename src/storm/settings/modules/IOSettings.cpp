@@ -32,6 +32,7 @@ namespace storm {
             const std::string IOSettings::prismInputOptionName = "prism";
             const std::string IOSettings::janiInputOptionName = "jani";
             const std::string IOSettings::prismToJaniOptionName = "prism2jani";
+            const std::string IOSettings::prismRecursiveDescentParserOptionName = "prism-rdparser";
 
             const std::string IOSettings::transitionRewardsOptionName = "transrew";
             const std::string IOSettings::stateRewardsOptionName = "staterew";
@@ -48,6 +49,7 @@ namespace storm {
             const std::string IOSettings::qvbsInputOptionName = "qvbs";
             const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
             const std::string IOSettings::qvbsRootOptionName = "qvbsroot";
+            const std::string IOSettings::serverOptionName = "server";
             
             IOSettings::IOSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportDotOptionName, "", "If given, the loaded model will be written to the specified file in the dot format.").setIsAdvanced()
@@ -73,6 +75,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, janiInputOptionName, false, "Parses the model given in the JANI format.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file from which to read the JANI input.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, prismToJaniOptionName, false, "If set, the input PRISM model is transformed to JANI.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, prismRecursiveDescentParserOptionName, false, "If set, the input PRISM model is parsed by the (experimental) hand-written recursive-descent parser instead of the Spirit-based one.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, propertyOptionName, false, "Specifies the properties to be checked on the model.").setShortName(propertyOptionShortName)
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("property or filename", "The formula or the file containing the formulas.").build())
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filter", "The names of the properties to check.").setDefaultValueString("all").build())
@@ -102,6 +105,7 @@ namespace storm {
 #endif
                 this->addOption(storm::settings::OptionBuilder(moduleName, qvbsRootOptionName, false, "Specifies the root directory of the Quantitative Verification Benchmark Set. Default can be set in CMAKE.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The path.").setDefaultValueString(qvbsRootDefault).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, serverOptionName, false, "If set, the input model is kept in memory and queries (properties, constant definitions) are read line by line from the standard input instead of checking the given properties once.").setIsAdvanced().build());
             }
 
             bool IOSettings::isExportDotSet() const {
@@ -188,6 +192,10 @@ namespace storm {
                 return this->getOption(prismToJaniOptionName).getHasOptionBeenSet();
             }
 
+            bool IOSettings::isPrismRecursiveDescentParserSet() const {
+                return this->getOption(prismRecursiveDescentParserOptionName).getHasOptionBeenSet();
+            }
+
             std::string IOSettings::getPrismInputFilename() const {
                 return this->getOption(prismInputOptionName).getArgumentByName("filename").getValueAsString();
             }
@@ -285,6 +293,10 @@ namespace storm {
                 }
             }
             
+            bool IOSettings::isServerSet() const {
+                return this->getOption(serverOptionName).getHasOptionBeenSet();
+            }
+
             std::string IOSettings::getQvbsRoot() const {
                 auto const& path = this->getOption(qvbsRootOptionName).getArgumentByName("path");
 #ifndef STORM_HAVE_QVBS
@@ -317,6 +329,10 @@ namespace storm {
                 // Make sure PRISM-to-JANI conversion is only set if the actual input is in PRISM format.
                 STORM_LOG_THROW(!isPrismToJaniSet() || isPrismInputSet(), storm::exceptions::InvalidSettingsException, "For the transformation from PRISM to JANI, the input model must be given in the prism format.");
                 
+                // The server needs an input model that it can keep in memory.
+                STORM_LOG_THROW(!isServerSet() || numSymbolicInputs + numExplicitInputs == 1, storm::exceptions::InvalidSettingsException, "The server mode requires an input model.");
+                STORM_LOG_THROW(!isServerSet() || !isQvbsInputSet(), storm::exceptions::InvalidSettingsException, "The server mode does not support QVBS input.");
+                
                 return true;
             }
 
@@ -168,6 +168,13 @@ namespace storm {
                  */
                 bool isPrismToJaniSet() const;
                 
+                /*!
+                 * Retrieves whether the PRISM input is to be parsed by the recursive-descent parser.
+                 *
+                 * @return True if the option was set.
+                 */
+                bool isPrismRecursiveDescentParserSet() const;
+                
                 /*!
                  * Retrieves the name of the file that contains the PRISM model specification if the model was given
                  * using the PRISM input option.
@@ -310,6 +317,11 @@ namespace storm {
                  * Retrieves the specified root directory of qvbs
                  */
                 std::string getQvbsRoot() const;
+
+                /*!
+                 * Retrieves whether the model is to be served, i.e., queries are read from the standard input.
+                 */
+                bool isServerSet() const;
                 
                 bool check() const override;
                 void finalize() override;
@@ -334,6 +346,7 @@ namespace storm {
                 static const std::string prismInputOptionName;
                 static const std::string janiInputOptionName;
                 static const std::string prismToJaniOptionName;
+                static const std::string prismRecursiveDescentParserOptionName;
                 static const std::string transitionRewardsOptionName;
                 static const std::string stateRewardsOptionName;
                 static const std::string choiceLabelingOptionName;
@@ -347,6 +360,7 @@ namespace storm {
                 static const std::string qvbsInputOptionName;
                 static const std::string qvbsInputOptionShortName;
                 static const std::string qvbsRootOptionName;
+                static const std::string serverOptionName;
 
             };
 
@@ -21,6 +21,7 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::markovAutomatonBoundedReachabilityMethodOptionName = "mamethod";
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
             const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string MinMaxEquationSolverSettings::andersonAccelerationOptionName = "anderson";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "topological", "vi-to-pi"};
@@ -46,6 +47,9 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").setIsAdvanced().build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, andersonAccelerationOptionName, false, "If set, the iterations of value iteration are accelerated by Anderson extrapolation (safeguarded, only for non-exact computations).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The number of previous iterates used for the extrapolation.").setDefaultValueUnsignedInteger(3).setIsOptional(true).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -139,6 +143,14 @@ namespace storm {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
             
+            bool MinMaxEquationSolverSettings::isAndersonAccelerationSet() const {
+                return this->getOption(andersonAccelerationOptionName).getHasOptionBeenSet();
+            }
+            
+            uint_fast64_t MinMaxEquationSolverSettings::getAndersonAccelerationDepth() const {
+                return this->getOption(andersonAccelerationOptionName).getArgumentByName("depth").getValueAsUnsignedInteger();
+            }
+            
         }
     }
 }
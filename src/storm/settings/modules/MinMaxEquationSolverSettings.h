@@ -117,6 +117,20 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether Anderson acceleration of the iterations has been enabled.
+                 *
+                 * @return True iff Anderson acceleration has been enabled.
+                 */
+                bool isAndersonAccelerationSet() const;
+                
+                /*!
+                 * Retrieves the number of previous iterates considered by Anderson acceleration.
+                 *
+                 * @return The depth of Anderson acceleration.
+                 */
+                uint_fast64_t getAndersonAccelerationDepth() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -130,6 +144,7 @@ namespace storm {
                 static const std::string markovAutomatonBoundedReachabilityMethodOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string andersonAccelerationOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
@@ -14,14 +14,27 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::cacheSubformulasOptionName = "cache-subformulas";
+            const std::string ModelCheckerSettings::cacheMemoryOptionName = "cache-memory";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheSubformulasOptionName, false, "If set, the results of nested probability, reward, time and long-run average operators are cached and reused across all properties checked on the same model.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheMemoryOptionName, false, "Sets the maximal amount of memory occupied by cached subformula results.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in megabytes (0 means no limit).").setDefaultValueUnsignedInteger(1024).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
+
+            bool ModelCheckerSettings::isCacheSubformulasSet() const {
+                return this->getOption(cacheSubformulasOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t ModelCheckerSettings::getSubformulaCacheMemoryLimit() const {
+                return this->getOption(cacheMemoryOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+            }
             
         } // namespace modules
     } // namespace settings
@@ -22,12 +22,25 @@ namespace storm {
                 
                 bool isFilterRewZeroSet() const;
 
+                /*!
+                 * Retrieves whether the results of state subformulas are to be cached across properties.
+                 */
+                bool isCacheSubformulasSet() const;
+
+                /*!
+                 * Retrieves the maximal amount of memory (in megabytes) the cached results of state subformulas may
+                 * occupy.
+                 */
+                uint64_t getSubformulaCacheMemoryLimit() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string cacheSubformulasOptionName;
+                static const std::string cacheMemoryOptionName;
             };
 
         } // namespace modules
@@ -3,9 +3,12 @@
 #include "storm/settings/Option.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/exceptions/InvalidSettingsException.h"
 
 namespace storm {
     namespace settings {
@@ -13,12 +16,22 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::prioritizedGaussSeidelOptionName = "prioritized";
+            const std::string MultiplierSettings::outOfCoreDirectoryOptionName = "ooc-dir";
+            const std::string MultiplierSettings::outOfCoreBlockSizeOptionName = "ooc-blocksize";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+                std::vector<std::string> multiplierTypes = {"native", "gmmxx", "outofcore"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, prioritizedGaussSeidelOptionName, true, "If set, Gauss-Seidel style multiplications of the native multiplier update the states in the order of their residuals and skip states that did not change.").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, outOfCoreDirectoryOptionName, true, "Sets the directory in which the out-of-core multiplier stores the matrix.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The path of the directory. If empty, the temporary directory of the system is used.").setDefaultValueString("").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, outOfCoreBlockSizeOptionName, true, "Sets the number of rows that the out-of-core multiplier reads from disk at once.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of rows.").setDefaultValueUnsignedInteger(65536).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -27,6 +40,8 @@ namespace storm {
                     return storm::solver::MultiplierType::Native;
                 } else if (type == "gmmxx") {
                     return storm::solver::MultiplierType::Gmmxx;
+                } else if (type == "outofcore") {
+                    return storm::solver::MultiplierType::OutOfCore;
                 }
                 
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -35,6 +50,27 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            bool MultiplierSettings::isPrioritizedGaussSeidelSet() const {
+                return this->getOption(prioritizedGaussSeidelOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string MultiplierSettings::getOutOfCoreDirectory() const {
+                return this->getOption(outOfCoreDirectoryOptionName).getArgumentByName("path").getValueAsString();
+            }
+            
+            uint_fast64_t MultiplierSettings::getOutOfCoreBlockSize() const {
+                return this->getOption(outOfCoreBlockSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool MultiplierSettings::check() const {
+                // The out-of-core multiplier stores the values bytewise on disk, which is only possible for doubles.
+                if (getMultiplierType() == storm::solver::MultiplierType::OutOfCore) {
+                    auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
+                    STORM_LOG_THROW(!generalSettings.isExactSet() && !generalSettings.isParametricSet(), storm::exceptions::InvalidSettingsException, "The out-of-core multiplier only supports double values and can therefore not be combined with exact or parametric model checking.");
+                }
+                return true;
+            }
         }
     }
 }
@@ -22,11 +22,33 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether Gauss-Seidel style multiplications are to be performed in the order of the (estimated)
+                 * residuals of the states, skipping states that are known to be fixed.
+                 */
+                bool isPrioritizedGaussSeidelSet() const;
+                
+                /*!
+                 * Retrieves the directory in which the out-of-core multiplier stores the matrix. An empty string refers
+                 * to the temporary directory of the system.
+                 */
+                std::string getOutOfCoreDirectory() const;
+                
+                /*!
+                 * Retrieves the number of rows that the out-of-core multiplier reads at once.
+                 */
+                uint_fast64_t getOutOfCoreBlockSize() const;
+                
+                bool check() const override;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string prioritizedGaussSeidelOptionName;
+                static const std::string outOfCoreDirectoryOptionName;
+                static const std::string outOfCoreBlockSizeOptionName;
             };
             
         }
@@ -24,9 +24,15 @@ namespace storm {
             const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
             const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string NativeEquationSolverSettings::andersonAccelerationOptionName = "anderson";
+            const std::string NativeEquationSolverSettings::aggregationCoarseningOptionName = "iad-coarsening";
+            const std::string NativeEquationSolverSettings::aggregationThresholdOptionName = "iad-threshold";
+            const std::string NativeEquationSolverSettings::preconditionerOptionName = "precond";
+            const std::string NativeEquationSolverSettings::restartOptionName = "restart";
+            const std::string NativeEquationSolverSettings::preconditionerBlockSizeOptionName = "precond-blocksize";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "interval-iteration", "ii", "ratsearch" };
+                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "interval-iteration", "ii", "ratsearch", "iad", "gmres", "bicgstab" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The method to be used for solving linear equation systems with the native engine.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods)).setDefaultValueString("jacobi").build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false, "The maximal number of iterations to perform before iterative solving is aborted.").setIsAdvanced().setShortName(maximalIterationsOptionShortName).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal iteration count.").build()).build());
@@ -42,6 +48,26 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
                                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, andersonAccelerationOptionName, false, "If set, the iterations of the power method are accelerated by Anderson extrapolation (safeguarded, only for non-exact computations).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The number of previous iterates used for the extrapolation.").setDefaultValueUnsignedInteger(3).setIsOptional(true).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                std::vector<std::string> coarsenings = {"strong", "scc"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, aggregationCoarseningOptionName, false, "Sets how the aggregates of the aggregation-disaggregation method are determined.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the coarsening. 'strong' groups strongly coupled states, 'scc' uses the SCCs of the matrix.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(coarsenings)).setDefaultValueString("strong").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, aggregationThresholdOptionName, false, "Sets the relative weight above which a transition is considered a strong coupling by the aggregation-disaggregation method.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The threshold relative to the largest off-diagonal entry of a row.").setDefaultValueDouble(0.1).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                
+                std::vector<std::string> preconditioners = {"ilu", "blockjacobi", "diagonal", "none"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, preconditionerOptionName, true, "The preconditioning technique used by the Krylov methods (gmres and bicgstab).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the preconditioning method.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(preconditioners)).setDefaultValueString("ilu").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, preconditionerBlockSizeOptionName, true, "The number of consecutive rows that form one block of the block-Jacobi preconditioner.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The block size.").setDefaultValueUnsignedInteger(1024).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, restartOptionName, true, "The number of iterations after which gmres is restarted.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of iterations.").setDefaultValueUnsignedInteger(50).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -70,6 +96,12 @@ namespace storm {
                     return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
                 } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
                     return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+                } else if (linearEquationSystemTechniqueAsString == "iad") {
+                    return storm::solver::NativeLinearEquationSolverMethod::AggregationDisaggregation;
+                } else if (linearEquationSystemTechniqueAsString == "gmres") {
+                    return storm::solver::NativeLinearEquationSolverMethod::Gmres;
+                } else if (linearEquationSystemTechniqueAsString == "bicgstab") {
+                    return storm::solver::NativeLinearEquationSolverMethod::Bicgstab;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
             }
@@ -115,6 +147,50 @@ namespace storm {
             bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet() const {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
+            
+            bool NativeEquationSolverSettings::isAndersonAccelerationSet() const {
+                return this->getOption(andersonAccelerationOptionName).getHasOptionBeenSet();
+            }
+            
+            uint_fast64_t NativeEquationSolverSettings::getAndersonAccelerationDepth() const {
+                return this->getOption(andersonAccelerationOptionName).getArgumentByName("depth").getValueAsUnsignedInteger();
+            }
+            
+            storm::solver::AggregationCoarsening NativeEquationSolverSettings::getAggregationCoarsening() const {
+                std::string coarseningAsString = this->getOption(aggregationCoarseningOptionName).getArgumentByName("name").getValueAsString();
+                if (coarseningAsString == "strong") {
+                    return storm::solver::AggregationCoarsening::StrongCoupling;
+                } else if (coarseningAsString == "scc") {
+                    return storm::solver::AggregationCoarsening::Scc;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown coarsening '" << coarseningAsString << "'.");
+            }
+            
+            double NativeEquationSolverSettings::getAggregationThreshold() const {
+                return this->getOption(aggregationThresholdOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            storm::solver::NativeLinearEquationSolverPreconditioner NativeEquationSolverSettings::getPreconditioner() const {
+                std::string preconditionerAsString = this->getOption(preconditionerOptionName).getArgumentByName("name").getValueAsString();
+                if (preconditionerAsString == "ilu") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::Ilu;
+                } else if (preconditionerAsString == "blockjacobi") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::BlockJacobi;
+                } else if (preconditionerAsString == "diagonal") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal;
+                } else if (preconditionerAsString == "none") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::None;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown preconditioner '" << preconditionerAsString << "'.");
+            }
+            
+            uint_fast64_t NativeEquationSolverSettings::getPreconditionerBlockSize() const {
+                return this->getOption(preconditionerBlockSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint_fast64_t NativeEquationSolverSettings::getRestartIterationCount() const {
+                return this->getOption(restartOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
 
             bool NativeEquationSolverSettings::check() const {
                 return true;
@@ -98,6 +98,20 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether Anderson acceleration of the iterations has been enabled.
+                 *
+                 * @return True iff Anderson acceleration has been enabled.
+                 */
+                bool isAndersonAccelerationSet() const;
+                
+                /*!
+                 * Retrieves the number of previous iterates considered by Anderson acceleration.
+                 *
+                 * @return The depth of Anderson acceleration.
+                 */
+                uint_fast64_t getAndersonAccelerationDepth() const;
+                
                 /*!
                  * Retrieves the multiplication style to use in the power method.
                  *
@@ -105,6 +119,42 @@ namespace storm {
                  */
                 storm::solver::MultiplicationStyle getPowerMethodMultiplicationStyle() const;
                 
+                /*!
+                 * Retrieves the coarsening that determines the aggregates of the aggregation-disaggregation method.
+                 *
+                 * @return The coarsening.
+                 */
+                storm::solver::AggregationCoarsening getAggregationCoarsening() const;
+                
+                /*!
+                 * Retrieves the (relative) threshold above which a transition is considered a strong coupling when
+                 * aggregating strongly coupled states.
+                 *
+                 * @return The threshold.
+                 */
+                double getAggregationThreshold() const;
+                
+                /*!
+                 * Retrieves the preconditioner that is used by the Krylov methods.
+                 *
+                 * @return The preconditioner.
+                 */
+                storm::solver::NativeLinearEquationSolverPreconditioner getPreconditioner() const;
+                
+                /*!
+                 * Retrieves the number of consecutive rows that form one block of the block-Jacobi preconditioner.
+                 *
+                 * @return The block size.
+                 */
+                uint_fast64_t getPreconditionerBlockSize() const;
+                
+                /*!
+                 * Retrieves the number of iterations after which gmres is restarted.
+                 *
+                 * @return The restart threshold.
+                 */
+                uint_fast64_t getRestartIterationCount() const;
+                
                 /*!
                  * Retrieves whether the  force bounds option has been set.
                  */
@@ -126,6 +176,12 @@ namespace storm {
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
                 static const std::string powerMethodMultiplicationStyleOptionName;
                 static const std::string forceBoundsOptionName;
+                static const std::string aggregationCoarseningOptionName;
+                static const std::string aggregationThresholdOptionName;
+                static const std::string andersonAccelerationOptionName;
+                static const std::string preconditionerOptionName;
+                static const std::string restartOptionName;
+                static const std::string preconditionerBlockSizeOptionName;
 
             };
             
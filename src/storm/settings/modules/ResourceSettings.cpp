@@ -15,11 +15,27 @@ namespace storm {
             const std::string ResourceSettings::timeoutOptionShortName = "t";
             const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
             const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
+            const std::string ResourceSettings::memoryBreakdownOptionName = "memory-breakdown";
+            const std::string ResourceSettings::checkpointOptionName = "checkpoint";
+            const std::string ResourceSettings::checkpointIntervalOptionName = "checkpoint-interval";
+            const std::string ResourceSettings::resumeOptionName = "resume";
+            const std::string ResourceSettings::metricsOptionName = "metrics";
+            const std::string ResourceSettings::metricsIntervalOptionName = "metrics-interval";
 
             ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.").setShortName(timeoutOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "The number of seconds after which to timeout.").setDefaultValueUnsignedInteger(0).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.").setShortName(printTimeAndMemoryOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryBreakdownOptionName, false, "Prints the memory occupied by the components of the model after building it and by the result and solver caches after checking each property.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, checkpointOptionName, false, "If given, long-running numerical computations (value iteration, interval iteration, uniformization) periodically write their progress to files with the given prefix (and before a timeout or interrupt terminates storm).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The prefix of the checkpoint files.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, checkpointIntervalOptionName, false, "Sets the minimal time between two checkpoints.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "The number of seconds between two checkpoints.").setDefaultValueUnsignedInteger(600).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, resumeOptionName, false, "If given, computations resume from the checkpoint file if it stems from the same computation.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, metricsOptionName, false, "If given, metrics about the progress (explored states, iterations, residuals, memory, elapsed time per phase, ...) are exported in the Prometheus text format.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("target", "The file that is periodically rewritten or unix:<path> for a unix socket that answers every connection with the current metrics.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, metricsIntervalOptionName, false, "Sets the time between two exports of the metrics to a file.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "The number of seconds between two exports.").setDefaultValueUnsignedInteger(5).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             bool ResourceSettings::isTimeoutSet() const {
@@ -33,6 +49,38 @@ namespace storm {
             bool ResourceSettings::isPrintTimeAndMemorySet() const {
                 return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
             }
+            
+            bool ResourceSettings::isPrintMemoryBreakdownSet() const {
+                return this->getOption(memoryBreakdownOptionName).getHasOptionBeenSet();
+            }
+            
+            bool ResourceSettings::isCheckpointSet() const {
+                return this->getOption(checkpointOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string ResourceSettings::getCheckpointFilename() const {
+                return this->getOption(checkpointOptionName).getArgumentByName("filename").getValueAsString();
+            }
+            
+            uint_fast64_t ResourceSettings::getCheckpointIntervalInSeconds() const {
+                return this->getOption(checkpointIntervalOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
+            }
+            
+            bool ResourceSettings::isResumeFromCheckpointSet() const {
+                return this->getOption(resumeOptionName).getHasOptionBeenSet();
+            }
+            
+            bool ResourceSettings::isExportMetricsSet() const {
+                return this->getOption(metricsOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string ResourceSettings::getMetricsTarget() const {
+                return this->getOption(metricsOptionName).getArgumentByName("target").getValueAsString();
+            }
+            
+            uint_fast64_t ResourceSettings::getMetricsIntervalInSeconds() const {
+                return this->getOption(metricsIntervalOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
+            }
 
         }
     }
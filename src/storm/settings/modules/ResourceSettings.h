@@ -25,6 +25,13 @@ namespace storm {
                  */
                 bool isPrintTimeAndMemorySet() const;
                 
+                /*!
+                 * Retrieves whether a breakdown of the memory occupied by the model and the results shall be printed.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isPrintMemoryBreakdownSet() const;
+                
                 /*!
                  * Retrieves whether the timeout option was set.
                  *
@@ -38,6 +45,55 @@ namespace storm {
                  * @return The number of seconds after which to timeout.
                  */
                 uint_fast64_t getTimeoutInSeconds() const;
+                
+                /*!
+                 * Retrieves whether long-running numerical computations shall periodically write checkpoints.
+                 *
+                 * @return True iff the checkpoint option was set.
+                 */
+                bool isCheckpointSet() const;
+                
+                /*!
+                 * Retrieves the prefix of the files to which checkpoints are written.
+                 *
+                 * @return The prefix of the checkpoint files.
+                 */
+                std::string getCheckpointFilename() const;
+                
+                /*!
+                 * Retrieves the minimal number of seconds between two checkpoints.
+                 *
+                 * @return The checkpoint interval in seconds.
+                 */
+                uint_fast64_t getCheckpointIntervalInSeconds() const;
+                
+                /*!
+                 * Retrieves whether computations shall be resumed from a matching checkpoint (if there is one).
+                 *
+                 * @return True iff the resume option was set.
+                 */
+                bool isResumeFromCheckpointSet() const;
+                
+                /*!
+                 * Retrieves whether metrics shall be exported during the run.
+                 *
+                 * @return True iff the metrics option was set.
+                 */
+                bool isExportMetricsSet() const;
+                
+                /*!
+                 * Retrieves the target of the metrics export, i.e. a file name or unix:<path> for a unix socket.
+                 *
+                 * @return The target of the metrics export.
+                 */
+                std::string getMetricsTarget() const;
+                
+                /*!
+                 * Retrieves the number of seconds between two exports of the metrics to a file.
+                 *
+                 * @return The metrics interval in seconds.
+                 */
+                uint_fast64_t getMetricsIntervalInSeconds() const;
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -48,6 +104,12 @@ namespace storm {
                 static const std::string timeoutOptionShortName;
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
+                static const std::string memoryBreakdownOptionName;
+                static const std::string checkpointOptionName;
+                static const std::string checkpointIntervalOptionName;
+                static const std::string resumeOptionName;
+                static const std::string metricsOptionName;
+                static const std::string metricsIntervalOptionName;
             };
         }
     }
@@ -1,5 +1,7 @@
 #include "storm/solver/AbstractEquationSolver.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -8,6 +10,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/Metrics.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 
@@ -271,6 +274,58 @@ namespace storm {
                 }
                 this->progressMeasurement->updateProgress(iteration);
             }
+            if (storm::utility::metrics::isEnabled()) {
+                storm::utility::metrics::setGauge("storm_solver_iterations", "Number of iterations of the running equation solver.", static_cast<double>(iteration));
+            }
+        }
+        
+        static double residualToDouble(double const& residual) {
+            return residual;
+        }
+        
+        static double residualToDouble(float const& residual) {
+            return residual;
+        }
+        
+        template<typename ValueType>
+        static double residualToDouble(ValueType const& residual) {
+            return storm::utility::convertNumber<double>(residual);
+        }
+        
+        template<typename ValueType>
+        boost::optional<double> computeMaximalDifference(std::vector<ValueType> const& previous, std::vector<ValueType> const& current, bool relative) {
+            STORM_LOG_ASSERT(previous.size() == current.size(), "Lengths of vectors does not match.");
+            ValueType residual = storm::utility::zero<ValueType>();
+            for (uint64_t index = 0; index < previous.size(); ++index) {
+                // As in the convergence check, relative differences are taken w.r.t. the previous value.
+                ValueType difference = storm::utility::abs<ValueType>(current[index] - previous[index]);
+                if (relative && !storm::utility::isZero(previous[index])) {
+                    difference /= storm::utility::abs<ValueType>(previous[index]);
+                }
+                residual = std::max(residual, difference);
+            }
+            return residualToDouble(residual);
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        boost::optional<double> computeMaximalDifference(std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const&, bool) {
+            // Differences of rational functions can not be compared.
+            return boost::none;
+        }
+#endif
+        
+        template<typename ValueType>
+        void AbstractEquationSolver<ValueType>::reportResidual(std::vector<ValueType> const& previous, std::vector<ValueType> const& current, bool relative) const {
+            if (storm::utility::metrics::isEnabled()) {
+                auto now = std::chrono::steady_clock::now();
+                if (now - timeOfLastResidualReport >= std::chrono::seconds(1)) {
+                    if (boost::optional<double> residual = computeMaximalDifference(previous, current, relative)) {
+                        storm::utility::metrics::setGauge("storm_solver_residual", "Maximal (relative) difference of two successive iterates of the running equation solver.", residual.get());
+                    }
+                    timeOfLastResidualReport = now;
+                }
+            }
         }
         
         template class AbstractEquationSolver<double>;
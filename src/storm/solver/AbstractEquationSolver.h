@@ -177,6 +177,12 @@ namespace storm {
              * Shows progress if this solver is asked to do so.
              */
             void showProgressIterative(uint64_t iterations, boost::optional<uint64_t> const& bound = boost::none) const;
+            
+            /*!
+             * Publishes the maximal (relative) difference of the two given iterates as the residual of this solver if
+             * metrics are collected. To keep the overhead low, this happens at most once per second.
+             */
+            void reportResidual(std::vector<ValueType> const& previous, std::vector<ValueType> const& current, bool relative) const;
 
         protected:
             /*!
@@ -212,6 +218,9 @@ namespace storm {
         private:
             // Indicates the progress of this solver.
             mutable boost::optional<storm::utility::ProgressMeasurement> progressMeasurement;
+            
+            // The time at which the residual was last published.
+            mutable std::chrono::steady_clock::time_point timeOfLastResidualReport;
         };
         
     }
@@ -0,0 +1,131 @@
+#include "storm/solver/DistributedIterativeSolver.h"
+
+#ifdef STORM_HAVE_MPI
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        DistributedIterativeSolver<ValueType>::DistributedIterativeSolver(storm::storage::DistributedSparseMatrix<ValueType> const& matrix) : matrix(matrix), iterations(0) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        bool DistributedIterativeSolver<ValueType>::solveEquationsJacobi(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::storage::SparseMatrix<ValueType> const& localMatrix = matrix.getLocalMatrix();
+            uint64_t numberOfLocalStates = matrix.getNumberOfLocalStates();
+            STORM_LOG_THROW(localMatrix.getRowCount() == numberOfLocalStates, storm::exceptions::InvalidArgumentException, "The Jacobi method requires a matrix without nondeterminism.");
+            STORM_LOG_THROW(x.size() == numberOfLocalStates && b.size() == numberOfLocalStates, storm::exceptions::InvalidArgumentException, "Vectors have illegal size.");
+
+            // Split the local matrix into its diagonal and the remaining entries.
+            std::vector<ValueType> inverseDiagonal(numberOfLocalStates, storm::utility::zero<ValueType>());
+            storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfLocalStates, localMatrix.getColumnCount(), localMatrix.getEntryCount());
+            for (uint64_t row = 0; row < numberOfLocalStates; ++row) {
+                for (auto const& entry : localMatrix.getRow(row)) {
+                    if (entry.getColumn() == row) {
+                        inverseDiagonal[row] += entry.getValue();
+                    } else {
+                        builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                    }
+                }
+                STORM_LOG_THROW(!storm::utility::isZero(inverseDiagonal[row]), storm::exceptions::InvalidArgumentException, "The Jacobi method requires non-zero diagonal entries, but the entry of state " << (matrix.getFirstLocalState() + row) << " is zero.");
+                inverseDiagonal[row] = storm::utility::one<ValueType>() / inverseDiagonal[row];
+            }
+            storm::storage::SparseMatrix<ValueType> offDiagonal = builder.build(numberOfLocalStates, localMatrix.getColumnCount());
+
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t maximalNumberOfIterations = env.solver().native().getMaximalNumberOfIterations();
+
+            // The current values of the owned states followed by the ghost states.
+            std::vector<ValueType> currentX(x);
+            currentX.resize(numberOfLocalStates + matrix.getNumberOfGhostStates());
+            std::vector<ValueType> product(numberOfLocalStates);
+
+            bool converged = false;
+            for (iterations = 0; !converged && iterations < maximalNumberOfIterations; ++iterations) {
+                matrix.exchangeHalo(currentX);
+
+                // Compute x' = D^-1 * (b - (L+U)*x).
+                offDiagonal.multiplyWithVector(currentX, product);
+                for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+                    x[state] = inverseDiagonal[state] * (b[state] - product[state]);
+                }
+                converged = isConverged(currentX, x, precision, relative);
+                std::copy(x.begin(), x.end(), currentX.begin());
+            }
+
+            STORM_LOG_INFO_COND(!converged, "Distributed Jacobi method converged after " << iterations << " iterations.");
+            STORM_LOG_WARN_COND(converged, "Distributed Jacobi method did not converge within " << iterations << " iterations.");
+            return converged;
+        }
+
+        template<typename ValueType>
+        bool DistributedIterativeSolver<ValueType>::solveEquationsValueIteration(Environment const& env, boost::optional<OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::storage::SparseMatrix<ValueType> const& localMatrix = matrix.getLocalMatrix();
+            uint64_t numberOfLocalStates = matrix.getNumberOfLocalStates();
+            STORM_LOG_THROW(x.size() == numberOfLocalStates && b.size() == localMatrix.getRowCount(), storm::exceptions::InvalidArgumentException, "Vectors have illegal size.");
+            STORM_LOG_THROW(dir || localMatrix.getRowCount() == numberOfLocalStates, storm::exceptions::InvalidArgumentException, "An optimization direction is required for matrices with nondeterminism.");
+
+            ValueType precision = storm::utility::convertNumber<ValueType>(dir ? env.solver().minMax().getPrecision() : env.solver().native().getPrecision());
+            bool relative = dir ? env.solver().minMax().getRelativeTerminationCriterion() : env.solver().native().getRelativeTerminationCriterion();
+            uint64_t maximalNumberOfIterations = dir ? env.solver().minMax().getMaximalNumberOfIterations() : env.solver().native().getMaximalNumberOfIterations();
+
+            // The current values of the owned states followed by the ghost states.
+            std::vector<ValueType> currentX(x);
+            currentX.resize(numberOfLocalStates + matrix.getNumberOfGhostStates());
+
+            bool converged = false;
+            for (iterations = 0; !converged && iterations < maximalNumberOfIterations; ++iterations) {
+                matrix.exchangeHalo(currentX);
+                if (dir) {
+                    localMatrix.multiplyAndReduce(dir.get(), localMatrix.getRowGroupIndices(), currentX, &b, x, nullptr);
+                } else {
+                    localMatrix.multiplyWithVector(currentX, x, &b);
+                }
+                converged = isConverged(currentX, x, precision, relative);
+                std::copy(x.begin(), x.end(), currentX.begin());
+            }
+
+            STORM_LOG_INFO_COND(!converged, "Distributed value iteration converged after " << iterations << " iterations.");
+            STORM_LOG_WARN_COND(converged, "Distributed value iteration did not converge within " << iterations << " iterations.");
+            return converged;
+        }
+
+        template<typename ValueType>
+        uint64_t DistributedIterativeSolver<ValueType>::getNumberOfIterations() const {
+            return iterations;
+        }
+
+        template<typename ValueType>
+        bool DistributedIterativeSolver<ValueType>::isConverged(std::vector<ValueType> const& oldValues, std::vector<ValueType> const& newValues, ValueType const& precision, bool relative) const {
+            int localConverged = 1;
+            for (uint64_t state = 0; state < matrix.getNumberOfLocalStates(); ++state) {
+                ValueType difference = storm::utility::abs<ValueType>(newValues[state] - oldValues[state]);
+                if (relative && !storm::utility::isZero(oldValues[state])) {
+                    difference /= storm::utility::abs<ValueType>(oldValues[state]);
+                }
+                if (difference > precision) {
+                    localConverged = 0;
+                    break;
+                }
+            }
+            int globalConverged = 0;
+            MPI_Allreduce(&localConverged, &globalConverged, 1, MPI_INT, MPI_LAND, matrix.getCommunicator());
+            return globalConverged != 0;
+        }
+
+        template class DistributedIterativeSolver<double>;
+    }
+}
+
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MPI
+
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/DistributedSparseMatrix.h"
+
+namespace storm {
+    class Environment;
+
+    namespace solver {
+
+        /*!
+         * Iterative solvers that operate on a matrix that is distributed across the ranks of an MPI communicator. All
+         * methods are collective operations, i.e. they have to be called on all ranks. Vectors only hold the entries of
+         * the states (or rows) that are owned by the calling rank.
+         *
+         * Convergence is checked globally in every iteration, such that all ranks perform the same number of iterations.
+         */
+        template<typename ValueType>
+        class DistributedIterativeSolver {
+        public:
+            DistributedIterativeSolver(storm::storage::DistributedSparseMatrix<ValueType> const& matrix);
+
+            /*!
+             * Solves the equation system A*x = b with the Jacobi method. The precision, the termination criterion and
+             * the maximal number of iterations are taken from the native solver environment.
+             *
+             * @param x The initial guess for the owned states that is overwritten with the solution.
+             * @param b The right-hand side for the owned states.
+             * @return True iff the method converged.
+             */
+            bool solveEquationsJacobi(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+            /*!
+             * Iterates x' = A*x + b (or, if a direction is given, x' = min/max(A*x + b) over the rows of each row
+             * group) until a fixed point is approximated. The precision, the termination criterion and the maximal
+             * number of iterations are taken from the min-max solver environment if a direction is given and from the
+             * native solver environment otherwise.
+             *
+             * @param dir If given, the direction in which the values of the rows of each row group are optimized.
+             * @param x The initial values of the owned states that are overwritten with the result.
+             * @param b The values that are added to the owned rows.
+             * @return True iff the method converged.
+             */
+            bool solveEquationsValueIteration(Environment const& env, boost::optional<OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+            /*!
+             * Retrieves the number of iterations of the last invocation.
+             */
+            uint64_t getNumberOfIterations() const;
+
+        private:
+            /*!
+             * Checks whether the owned entries of the two vectors are equal (modulo the precision) on all ranks.
+             */
+            bool isConverged(std::vector<ValueType> const& oldValues, std::vector<ValueType> const& newValues, ValueType const& precision, bool relative) const;
+
+            storm::storage::DistributedSparseMatrix<ValueType> const& matrix;
+            mutable uint64_t iterations;
+        };
+
+    }
+}
+
+#endif
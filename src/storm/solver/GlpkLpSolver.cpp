@@ -10,6 +10,7 @@
 #include "storm/utility/constants.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/InvalidAccessException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -207,6 +208,50 @@ namespace storm {
             this->currentModelHasBeenOptimized = false;
         }
         
+        template<typename ValueType>
+        void GlpkLpSolver<ValueType>::addConstraints(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::expressions::Variable> const& variables, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) {
+            this->checkConstraintMatrix(matrix, variables, relation, rightHandSides);
+
+            // Resolve the indices of the variables once.
+            std::vector<int> variableIndices;
+            variableIndices.reserve(variables.size());
+            for (auto const& variable : variables) {
+                auto variableIndexPair = this->variableToIndexMap.find(variable);
+                STORM_LOG_THROW(variableIndexPair != this->variableToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Constraint refers to unknown variable '" << variable.getName() << "'.");
+                variableIndices.push_back(variableIndexPair->second);
+            }
+
+            if (matrix.getRowCount() == 0) {
+                return;
+            }
+            glp_add_rows(this->lp, matrix.getRowCount());
+            rowIndices.reserve(rowIndices.size() + matrix.getEntryCount());
+            columnIndices.reserve(columnIndices.size() + matrix.getEntryCount());
+            coefficientValues.reserve(coefficientValues.size() + matrix.getEntryCount());
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                double rightHandSide = storm::utility::convertNumber<double>(rightHandSides[row]);
+                switch (relation) {
+                    case storm::expressions::OperatorType::LessOrEqual:
+                        glp_set_row_bnds(this->lp, nextConstraintIndex, GLP_UP, 0, rightHandSide);
+                        break;
+                    case storm::expressions::OperatorType::GreaterOrEqual:
+                        glp_set_row_bnds(this->lp, nextConstraintIndex, GLP_LO, rightHandSide, 0);
+                        break;
+                    default:
+                        glp_set_row_bnds(this->lp, nextConstraintIndex, GLP_FX, rightHandSide, rightHandSide);
+                }
+
+                // Record the coefficients in the coefficient matrix.
+                for (auto const& entry : matrix.getRow(row)) {
+                    rowIndices.push_back(nextConstraintIndex);
+                    columnIndices.push_back(variableIndices[entry.getColumn()]);
+                    coefficientValues.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+                }
+                ++nextConstraintIndex;
+            }
+            this->currentModelHasBeenOptimized = false;
+        }
+
         template<typename ValueType>
         void GlpkLpSolver<ValueType>::optimize() const {
             // First, reset the flags.
@@ -77,6 +77,7 @@ namespace storm {
             
             // Methods to add constraints
             virtual void addConstraint(std::string const& name, storm::expressions::Expression const& constraint) override;
+            virtual void addConstraints(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::expressions::Variable> const& variables, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) override;
             
             // Methods to optimize and retrieve optimality status.
             virtual void optimize() const override;
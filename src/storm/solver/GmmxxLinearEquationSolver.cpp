@@ -126,9 +126,9 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxLinearEquationSolver<ValueType>::clearCache() const {
+            LinearEquationSolver<ValueType>::clearCache();
             iluPreconditioner.reset();
             diagonalPreconditioner.reset();
-            LinearEquationSolver<ValueType>::clearCache();
         }
         
         template<typename ValueType>
@@ -33,6 +33,11 @@ namespace storm {
             Multiplier<ValueType>::clearCache();
         }
         
+        template<typename ValueType>
+        uint64_t GmmxxMultiplier<ValueType>::getCacheMemoryUsage() const {
+            return Multiplier<ValueType>::getCacheMemoryUsage() + gmmMatrix.pr.capacity() * sizeof(ValueType) + (gmmMatrix.ir.capacity() + gmmMatrix.jc.capacity()) * sizeof(typename gmm::csr_matrix<ValueType>::IND_TYPE);
+        }
+        
         template<typename ValueType>
         bool GmmxxMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
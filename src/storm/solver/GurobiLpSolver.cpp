@@ -14,6 +14,7 @@
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidAccessException.h"
@@ -226,6 +227,47 @@ namespace storm {
             STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException, "Could not assert constraint (" << GRBgeterrormsg(env) << ", error code " << error << ").");
         }
         
+        template<typename ValueType>
+        void GurobiLpSolver<ValueType>::addConstraints(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::expressions::Variable> const& variables, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) {
+            this->checkConstraintMatrix(matrix, variables, relation, rightHandSides);
+            STORM_LOG_TRACE("Adding " << matrix.getRowCount() << " constraints with " << matrix.getEntryCount() << " coefficients to GurobiLpSolver.");
+
+            // Resolve the indices of the variables once.
+            std::vector<int> variableIndices;
+            variableIndices.reserve(variables.size());
+            for (auto const& variable : variables) {
+                auto variableIndexPair = this->variableToIndexMap.find(variable);
+                STORM_LOG_THROW(variableIndexPair != this->variableToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Constraint refers to unknown variable '" << variable.getName() << "'.");
+                variableIndices.push_back(variableIndexPair->second);
+            }
+
+            // Translate the matrix to the compressed row format of Gurobi.
+            std::vector<int> rowBegins;
+            std::vector<int> columns;
+            std::vector<double> coefficients;
+            rowBegins.reserve(matrix.getRowCount());
+            columns.reserve(matrix.getEntryCount());
+            coefficients.reserve(matrix.getEntryCount());
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                rowBegins.push_back(columns.size());
+                for (auto const& entry : matrix.getRow(row)) {
+                    columns.push_back(variableIndices[entry.getColumn()]);
+                    coefficients.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+                }
+            }
+            std::vector<double> rightHandSideValues;
+            rightHandSideValues.reserve(rightHandSides.size());
+            for (auto const& value : rightHandSides) {
+                rightHandSideValues.push_back(storm::utility::convertNumber<double>(value));
+            }
+            char sense = relation == storm::expressions::OperatorType::LessOrEqual ? GRB_LESS_EQUAL : (relation == storm::expressions::OperatorType::GreaterOrEqual ? GRB_GREATER_EQUAL : GRB_EQUAL);
+            std::vector<char> senses(matrix.getRowCount(), sense);
+
+            int error = GRBaddconstrs(model, matrix.getRowCount(), columns.size(), rowBegins.data(), columns.data(), coefficients.data(), senses.data(), rightHandSideValues.data(), nullptr);
+            STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException, "Could not assert constraints (" << GRBgeterrormsg(env) << ", error code " << error << ").");
+            nextConstraintIndex += matrix.getRowCount();
+        }
+
         template<typename ValueType>
         void GurobiLpSolver<ValueType>::optimize() const {
             // First incorporate all recent changes.
@@ -652,6 +694,11 @@ namespace storm {
         void GurobiLpSolver<ValueType>::addConstraint(std::string const&, storm::expressions::Expression const&) {
             throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that requires this support. Please choose a version of support with Gurobi support.";
         }
+
+        template<typename ValueType>
+        void GurobiLpSolver<ValueType>::addConstraints(storm::storage::SparseMatrix<ValueType> const&, std::vector<storm::expressions::Variable> const&, storm::expressions::OperatorType const&, std::vector<ValueType> const&) {
+            throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that requires this support. Please choose a version of support with Gurobi support.";
+        }
         
         template<typename ValueType>
         void GurobiLpSolver<ValueType>::optimize() const {
@@ -0,0 +1,113 @@
+#include "storm/solver/ImplicitProductMultiplier.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        ImplicitProductMultiplier<ValueType>::ImplicitProductMultiplier(storm::storage::ImplicitModelMemoryProduct<ValueType> const& product) : Multiplier<ValueType>(product.getStructure()), product(product) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType>& ImplicitProductMultiplier<ValueType>::getTarget(std::vector<ValueType> const& x, std::vector<ValueType>& result) const {
+            if (&x != &result) {
+                return result;
+            }
+            if (this->cachedVector) {
+                this->cachedVector->resize(x.size());
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            }
+            return *this->cachedVector;
+        }
+
+        template<typename ValueType>
+        void ImplicitProductMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<ValueType>& target = getTarget(x, result);
+            product.multiply(x, b, target);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void ImplicitProductMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            STORM_LOG_ASSERT(product.getNumberOfRows() == x.size(), "Gauss-Seidel multiplications require a square matrix.");
+            // The rows are processed backwards, as for the in-memory multipliers.
+            for (uint64_t productState = product.getNumberOfStates(); productState > 0; --productState) {
+                ValueType value = b ? (*b)[productState - 1] : storm::utility::zero<ValueType>();
+                product.multiplyRow(productState - 1, productState - 1, x, value);
+                x[productState - 1] = std::move(value);
+            }
+        }
+
+        template<typename ValueType>
+        void ImplicitProductMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            std::vector<ValueType>& target = getTarget(x, result);
+            multAddReduce(dir, rowGroupIndices, x, b, target, choices);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void ImplicitProductMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            multAddReduce(dir, rowGroupIndices, x, b, x, choices);
+        }
+
+        template<typename ValueType>
+        void ImplicitProductMultiplier<ValueType>::multAddReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            // The rows of a product state are only known as the rows of its model state.
+            STORM_LOG_THROW(rowGroupIndices == product.getRowGroupIndices(), storm::exceptions::InvalidArgumentException, "The multiplier for a model-memory product only supports the row groups of the product.");
+            result.resize(product.getNumberOfStates());
+            bool minimize = storm::solver::minimize(dir);
+
+            // As for the in-memory multipliers, the choice of a state is only changed if the new choice is strictly
+            // better and states without rows are left untouched.
+            for (uint64_t productState = product.getNumberOfStates(); productState > 0; --productState) {
+                uint64_t state = productState - 1;
+                uint64_t firstRow = rowGroupIndices[state];
+                uint64_t endRow = rowGroupIndices[state + 1];
+                if (firstRow == endRow) {
+                    continue;
+                }
+                ValueType currentValue = storm::utility::zero<ValueType>();
+                ValueType oldSelectedChoiceValue = storm::utility::zero<ValueType>();
+                uint64_t selectedChoice = 0;
+                for (uint64_t row = firstRow; row < endRow; ++row) {
+                    ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    product.multiplyRow(state, row, x, value);
+                    if (row == firstRow || (minimize ? value < currentValue : value > currentValue)) {
+                        currentValue = value;
+                        selectedChoice = row - firstRow;
+                    }
+                    if (choices && row - firstRow == (*choices)[state]) {
+                        oldSelectedChoiceValue = std::move(value);
+                    }
+                }
+                if (choices && (minimize ? currentValue < oldSelectedChoiceValue : currentValue > oldSelectedChoiceValue)) {
+                    (*choices)[state] = selectedChoice;
+                }
+                result[state] = std::move(currentValue);
+            }
+        }
+
+        template<typename ValueType>
+        void ImplicitProductMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            auto const& rowGroupIndices = product.getRowGroupIndices();
+            uint64_t productState = std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), rowIndex) - rowGroupIndices.begin() - 1;
+            product.multiplyRow(productState, rowIndex, x, value);
+        }
+
+        template class ImplicitProductMultiplier<double>;
+        template class ImplicitProductMultiplier<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/memorystructure/ImplicitModelMemoryProduct.h"
+
+namespace storm {
+    namespace solver {
+
+        /*!
+         * A multiplier for the transition matrix of a model-memory product that is not materialized. The entries of
+         * the product rows are derived from the model rows whenever they are needed. The product (and thereby the
+         * model and its transition matrix) has to outlive the multiplier.
+         */
+        template<typename ValueType>
+        class ImplicitProductMultiplier : public Multiplier<ValueType> {
+        public:
+            ImplicitProductMultiplier(storm::storage::ImplicitModelMemoryProduct<ValueType> const& product);
+
+            virtual ~ImplicitProductMultiplier() = default;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+
+        private:
+            /*!
+             * Retrieves the vector in which the result is to be stored, which is the cached vector if x and the result
+             * are the same.
+             */
+            std::vector<ValueType>& getTarget(std::vector<ValueType> const& x, std::vector<ValueType>& result) const;
+
+            /*!
+             * Computes A*x + b and reduces over the rows of each product state. The result of a product state is written
+             * right after its rows are processed, so result may be the same as x (which yields a Gauss-Seidel style
+             * multiplication).
+             */
+            void multAddReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            storm::storage::ImplicitModelMemoryProduct<ValueType> const& product;
+        };
+
+    }
+}
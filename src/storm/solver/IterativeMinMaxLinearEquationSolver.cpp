@@ -6,6 +6,10 @@
 #include "storm/utility/ConstantsComparator.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+
+#include "storm/solver/helper/AndersonAccelerationHelper.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
@@ -64,7 +68,9 @@ namespace storm {
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             bool result = false;
-            switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact)) {
+            auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
+            STORM_LOG_THROW(!this->onDiskA || (method == MinMaxMethod::ValueIteration && !this->hasInitialScheduler()), storm::exceptions::InvalidEnvironmentException, "The matrix of the solver was moved to disk for the out-of-core multiplier, which is only supported by value iteration without an initial scheduler.");
+            switch (method) {
                 case MinMaxMethod::ValueIteration:
                     result = solveEquationsValueIteration(env, dir, x, b);
                     break;
@@ -297,16 +303,40 @@ namespace storm {
             // Allow aliased multiplications.
             bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
             
+            // Optionally accelerate the iteration. The safeguard of the acceleration only preserves the guarantee of
+            // the iteration if the fixed point is unique.
+            std::unique_ptr<storm::solver::helper::AndersonAccelerationHelper<ValueType>> andersonHelper;
+            if (!storm::NumberTraits<ValueType>::IsExact && env.solver().minMax().getAndersonAccelerationDepth() > 0) {
+                if (this->hasUniqueSolution() || guarantee == SolverGuarantee::None) {
+                    andersonHelper = std::make_unique<storm::solver::helper::AndersonAccelerationHelper<ValueType>>(currentX->size(), env.solver().minMax().getAndersonAccelerationDepth());
+                } else {
+                    STORM_LOG_WARN("Anderson acceleration is disabled, because the solution of the equation system is not known to be unique.");
+                }
+            }
+            
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
             uint64_t iterations = currentIterations;
             
+            // If requested, resume from a checkpoint. As the iterates only depend on the current one, restoring it
+            // suffices to continue the iteration.
+            storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, "value-iteration", [&] () { return computeCheckpointFingerprint(dir, b, precision, {currentX}); });
+            if (auto restoredIterations = checkpoint.restore({currentX})) {
+                iterations = std::max(iterations, restoredIterations.get());
+            }
+            
             SolverStatus status = SolverStatus::InProgress;
+            // Whether the current vector is the unmodified result of the previous Gauss-Seidel multiplication.
+            bool continueGaussSeidel = false;
             while (status == SolverStatus::InProgress) {
                 // Compute x' = min/max(A*x + b).
                 if (useGaussSeidelMultiplication) {
                     // Copy over the current vector so we can modify it in-place.
                     *newX = *currentX;
+                    if (continueGaussSeidel) {
+                        multiplier.declareGaussSeidelContinuation();
+                    }
                     multiplier.multiplyAndReduceGaussSeidel(env, dir, *newX, &b);
+                    continueGaussSeidel = true;
                 } else {
                     multiplier.multiplyAndReduce(env, dir, *currentX, &b, *newX);
                 }
@@ -315,23 +345,55 @@ namespace storm {
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
                     status = SolverStatus::Converged;
                 }
+                this->reportResidual(*currentX, *newX, relative);
+                
+                // If we did not converge, try to replace the step by an extrapolated one.
+                if (andersonHelper && status == SolverStatus::InProgress) {
+                    andersonHelper->recordIterate(*currentX, *newX);
+                    if (andersonHelper->computeCandidate()) {
+                        std::vector<ValueType>& candidateImage = andersonHelper->getCandidateImage();
+                        if (useGaussSeidelMultiplication) {
+                            candidateImage = andersonHelper->getCandidate();
+                            multiplier.multiplyAndReduceGaussSeidel(env, dir, candidateImage, &b);
+                            continueGaussSeidel = false;
+                        } else {
+                            multiplier.multiplyAndReduce(env, dir, andersonHelper->getCandidate(), &b, candidateImage);
+                        }
+                        andersonHelper->applyCandidate(*currentX, *newX, guarantee);
+                    }
+                }
                 
                 // Update environment variables.
                 std::swap(currentX, newX);
                 ++iterations;
                 status = updateStatusIfNotConverged(status, *currentX, iterations, maximalNumberOfIterations, guarantee);
+                if (status == SolverStatus::InProgress) {
+                    checkpoint.update(iterations, {currentX});
+                }
 
                 // Potentially show progress.
                 this->showProgressIterative(iterations);
             }
             
+            if (andersonHelper) {
+                STORM_LOG_INFO("Anderson acceleration accepted " << andersonHelper->getNumberOfAcceptedCandidates() << " and rejected " << andersonHelper->getNumberOfRejectedCandidates() << " extrapolated iterates.");
+            }
+            
             return ValueIterationResult(iterations - currentIterations, status);
         }
         
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                // An initial scheduler requires the entries of the matrix, so the matrix can only be moved to disk without one.
+                if (!this->onDiskA && this->localA && !this->hasInitialScheduler() && env.solver().multiplier().getType() == MultiplierType::OutOfCore) {
+                    this->moveMatrixToDisk(env);
+                }
+                if (this->onDiskA) {
+                    this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, this->onDiskA);
+                } else {
+                    this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                }
             }
             
             if (!auxiliaryRowGroupVector) {
@@ -486,6 +548,13 @@ namespace storm {
             if (!relative) {
                 precision *= storm::utility::convertNumber<ValueType>(2.0);
             }
+            
+            // If requested, resume from a checkpoint that stores both bounds and the differences of the last steps.
+            storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, "interval-iteration", [&] () { return computeCheckpointFingerprint(dir, b, precision, {lowerX, upperX}); });
+            if (auto restoredIterations = checkpoint.restore({lowerX, upperX}, {&maxLowerDiff, &maxUpperDiff})) {
+                iterations = restoredIterations.get();
+            }
+            
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < env.solver().minMax().getMaximalNumberOfIterations()) {
                 // Remember in which directions we took steps in this iteration.
@@ -574,6 +643,8 @@ namespace storm {
                     } else {
                         status = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, precision, relative) ? SolverStatus::Converged : status;
                     }
+                    // For interval iteration, the residual is the gap between the bounds.
+                    this->reportResidual(*lowerX, *upperX, relative);
                 }
                 
                 // Update environment variables.
@@ -585,6 +656,9 @@ namespace storm {
                 if (upperStep) {
                     status = updateStatusIfNotConverged(status, *upperX, iterations, env.solver().minMax().getMaximalNumberOfIterations(), SolverGuarantee::GreaterOrEqual);
                 }
+                if (status == SolverStatus::InProgress) {
+                    checkpoint.update(iterations, {lowerX, upperX}, {maxLowerDiff, maxUpperDiff});
+                }
 
                 // Potentially show progress.
                 this->showProgressIterative(iterations);
@@ -1012,6 +1086,18 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        std::size_t IterativeMinMaxLinearEquationSolver<ValueType>::computeCheckpointFingerprint(OptimizationDirection dir, std::vector<ValueType> const& b, ValueType const& precision, std::vector<std::vector<ValueType> const*> const& initialVectors) const {
+            std::size_t fingerprint = this->onDiskA ? this->onDiskAHash : this->A->hash();
+            boost::hash_combine(fingerprint, static_cast<int>(dir));
+            boost::hash_combine(fingerprint, boost::hash_range(b.begin(), b.end()));
+            boost::hash_combine(fingerprint, precision);
+            for (auto const& vector : initialVectors) {
+                boost::hash_combine(fingerprint, boost::hash_range(vector->begin(), vector->end()));
+            }
+            return fingerprint;
+        }
+        
         template<typename ValueType>
         SolverStatus IterativeMinMaxLinearEquationSolver<ValueType>::updateStatusIfNotConverged(SolverStatus status, std::vector<ValueType> const& x, uint64_t iterations, uint64_t maximalNumberOfIterations, SolverGuarantee const& guarantee) const {
             if (status != SolverStatus::Converged) {
@@ -1037,11 +1123,26 @@ namespace storm {
         
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+            StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
             multiplierA.reset();
             auxiliaryRowGroupVector.reset();
             auxiliaryRowGroupVector2.reset();
             soundValueIterationHelper.reset();
-            StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        uint64_t IterativeMinMaxLinearEquationSolver<ValueType>::getCacheMemoryUsage() const {
+            uint64_t result = StandardMinMaxLinearEquationSolver<ValueType>::getCacheMemoryUsage();
+            if (multiplierA) {
+                result += multiplierA->getCacheMemoryUsage();
+            }
+            if (auxiliaryRowGroupVector) {
+                result += auxiliaryRowGroupVector->capacity() * sizeof(ValueType);
+            }
+            if (auxiliaryRowGroupVector2) {
+                result += auxiliaryRowGroupVector2->capacity() * sizeof(ValueType);
+            }
+            return result;
         }
         
         template class IterativeMinMaxLinearEquationSolver<double>;
@@ -27,6 +27,7 @@ namespace storm {
             virtual bool internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
 
             virtual void clearCache() const override;
+            virtual uint64_t getCacheMemoryUsage() const override;
             
             virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none, bool const& hasInitialScheduler = false) const override;
             
@@ -86,6 +87,11 @@ namespace storm {
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             
             SolverStatus updateStatusIfNotConverged(SolverStatus status, std::vector<ValueType> const& x, uint64_t iterations, uint64_t maximalNumberOfIterations, SolverGuarantee const& guarantee) const;
+            
+            /*!
+             * Computes the fingerprint that identifies checkpoints of an iteration on the current equation system.
+             */
+            std::size_t computeCheckpointFingerprint(OptimizationDirection dir, std::vector<ValueType> const& b, ValueType const& precision, std::vector<std::vector<ValueType> const*> const& initialVectors) const;
             static void reportStatus(SolverStatus status, uint64_t iterations);
         };
         
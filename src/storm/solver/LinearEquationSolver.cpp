@@ -10,6 +10,7 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/MemoryUsage.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
@@ -51,9 +52,15 @@ namespace storm {
         
         template<typename ValueType>
         void LinearEquationSolver<ValueType>::clearCache() const {
+            storm::utility::memory::recordSolverCacheUsage(this->getCacheMemoryUsage());
             cachedRowVector.reset();
         }
         
+        template<typename ValueType>
+        uint64_t LinearEquationSolver<ValueType>::getCacheMemoryUsage() const {
+            return cachedRowVector ? cachedRowVector->capacity() * sizeof(ValueType) : 0;
+        }
+        
         template<typename ValueType>
         std::unique_ptr<LinearEquationSolver<ValueType>> LinearEquationSolverFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) const {
             std::unique_ptr<LinearEquationSolver<ValueType>> solver = this->create(env);
@@ -72,10 +72,18 @@ namespace storm {
             bool isCachingEnabled() const;
             
             /*
-             * Clears the currently cached data that has been stored during previous calls of the solver.
+             * Clears the currently cached data that has been stored during previous calls of the solver. The memory
+             * occupied by the cache is recorded before, so overriding methods have to call this one before freeing
+             * their own data.
              */
             virtual void clearCache() const;
             
+            /*!
+             * Retrieves an estimate of the number of bytes occupied by the data that has been cached during previous
+             * calls of the solver, i.e., the memory that would be freed by clearCache.
+             */
+            virtual uint64_t getCacheMemoryUsage() const;
+            
         protected:
             virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
                         
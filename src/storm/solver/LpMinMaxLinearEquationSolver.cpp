@@ -53,21 +53,29 @@ namespace storm {
             }
             solver->update();
             
-            // Add a constraint for each row
+            // Add a constraint x_s - sum_j A(r,j) * x_j <= b_r (>= when maximizing) for each row r of each row group s.
+            // The constraints are passed to the solver as a matrix, which avoids building an expression for every row.
+            storm::storage::SparseMatrixBuilder<ValueType> constraintBuilder(this->A->getRowCount(), this->A->getRowGroupCount(), this->A->getEntryCount() + this->A->getRowCount());
             for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
                 for (uint64_t row = this->A->getRowGroupIndices()[rowGroup]; row < this->A->getRowGroupIndices()[rowGroup + 1]; ++row) {
-                    storm::expressions::Expression rowConstraint = solver->getConstant(b[row]);
+                    bool diagonalEntryAdded = false;
                     for (auto const& entry : this->A->getRow(row)) {
-                        rowConstraint = rowConstraint + (solver->getConstant(entry.getValue()) * variables[entry.getColumn()].getExpression());
+                        if (!diagonalEntryAdded && entry.getColumn() >= rowGroup) {
+                            diagonalEntryAdded = true;
+                            if (entry.getColumn() == rowGroup) {
+                                constraintBuilder.addNextValue(row, rowGroup, storm::utility::one<ValueType>() - entry.getValue());
+                                continue;
+                            }
+                            constraintBuilder.addNextValue(row, rowGroup, storm::utility::one<ValueType>());
+                        }
+                        constraintBuilder.addNextValue(row, entry.getColumn(), -entry.getValue());
                     }
-                    if (minimize(dir)) {
-                        rowConstraint = variables[rowGroup].getExpression() <= rowConstraint;
-                    } else {
-                        rowConstraint = variables[rowGroup].getExpression() >= rowConstraint;
+                    if (!diagonalEntryAdded) {
+                        constraintBuilder.addNextValue(row, rowGroup, storm::utility::one<ValueType>());
                     }
-                    solver->addConstraint("", rowConstraint);
                 }
             }
+            solver->addConstraints(constraintBuilder.build(), variables, minimize(dir) ? storm::expressions::OperatorType::LessOrEqual : storm::expressions::OperatorType::GreaterOrEqual, b);
             
             // Invoke optimization
             solver->optimize();
@@ -3,6 +3,11 @@
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 
 
 
@@ -58,6 +63,34 @@ namespace storm {
             return manager->rational(value);
         }
         
+        template<typename ValueType>
+        void LpSolver<ValueType>::addConstraints(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::expressions::Variable> const& variables, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) {
+            checkConstraintMatrix(matrix, variables, relation, rightHandSides);
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                storm::expressions::Expression leftHandSide = getConstant(storm::utility::zero<ValueType>());
+                for (auto const& entry : matrix.getRow(row)) {
+                    leftHandSide = leftHandSide + getConstant(entry.getValue()) * variables[entry.getColumn()].getExpression();
+                }
+                switch (relation) {
+                    case storm::expressions::OperatorType::LessOrEqual:
+                        addConstraint("", leftHandSide <= getConstant(rightHandSides[row]));
+                        break;
+                    case storm::expressions::OperatorType::GreaterOrEqual:
+                        addConstraint("", leftHandSide >= getConstant(rightHandSides[row]));
+                        break;
+                    default:
+                        addConstraint("", leftHandSide == getConstant(rightHandSides[row]));
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void LpSolver<ValueType>::checkConstraintMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::expressions::Variable> const& variables, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) const {
+            STORM_LOG_THROW(matrix.getColumnCount() <= variables.size(), storm::exceptions::InvalidArgumentException, "The constraint matrix has more columns than there are variables.");
+            STORM_LOG_THROW(matrix.getRowCount() == rightHandSides.size(), storm::exceptions::InvalidArgumentException, "The number of right-hand sides does not match the number of constraints.");
+            STORM_LOG_THROW(relation == storm::expressions::OperatorType::LessOrEqual || relation == storm::expressions::OperatorType::GreaterOrEqual || relation == storm::expressions::OperatorType::Equal, storm::exceptions::InvalidArgumentException, "Illegal relation for LP constraints.");
+        }
+
         template class LpSolver<double>;
         template class LpSolver<storm::RationalNumber>;
         
@@ -7,6 +7,7 @@
 #include <memory>
 #include <boost/optional.hpp>
 #include "OptimizationDirection.h"
+#include "storm/storage/expressions/OperatorType.h"
 
 namespace storm {
     namespace expressions {
@@ -14,6 +15,11 @@ namespace storm {
         class Variable;
         class Expression;
     }
+
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
     
     namespace solver {
         /*!
@@ -179,6 +185,19 @@ namespace storm {
              * (in)equality over the registered variables.
              */
             virtual void addConstraint(std::string const& name, storm::expressions::Expression const& constraint) = 0;
+
+            /*!
+             * Adds one (unnamed) constraint for each row of the given matrix to the LP problem. The constraint for row i
+             * is sum_j matrix(i,j) * variables[j] ~ rightHandSides[i], where ~ is the given relation.
+             * By default, the constraints are added as expressions via addConstraint. Solvers that support it load the
+             * coefficients directly, which avoids building and translating an expression for every row.
+             *
+             * @param matrix The coefficients of the constraints. The columns refer to the given variables.
+             * @param variables The registered variables, one for each column of the matrix.
+             * @param relation The relation of the constraints. Must be LessOrEqual, GreaterOrEqual or Equal.
+             * @param rightHandSides The right-hand sides of the constraints, one for each row of the matrix.
+             */
+            virtual void addConstraints(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::expressions::Variable> const& variables, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides);
             
             /*!
              * Optimizes the LP problem previously constructed. Afterwards, the methods isInfeasible, isUnbounded and
@@ -296,6 +315,11 @@ namespace storm {
 			virtual void pop() = 0;
         
         protected:
+            /*!
+             * Checks that the arguments of addConstraints are consistent and throws an exception otherwise.
+             */
+            void checkConstraintMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::expressions::Variable> const& variables, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) const;
+
             // The manager responsible for the variables.
             std::shared_ptr<storm::expressions::ExpressionManager> manager;
             
@@ -11,6 +11,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/MemoryUsage.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -122,7 +123,12 @@ namespace storm {
         
         template<typename ValueType>
         void MinMaxLinearEquationSolver<ValueType>::clearCache() const {
-            // Intentionally left empty.
+            storm::utility::memory::recordSolverCacheUsage(this->getCacheMemoryUsage());
+        }
+        
+        template<typename ValueType>
+        uint64_t MinMaxLinearEquationSolver<ValueType>::getCacheMemoryUsage() const {
+            return 0;
         }
                 
         template<typename ValueType>
@@ -11,8 +11,11 @@
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/GmmxxMultiplier.h"
+#include "storm/solver/OutOfCoreMultiplier.h"
+#include "storm/solver/ImplicitProductMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace solver {
@@ -27,6 +30,16 @@ namespace storm {
             cachedVector.reset();
         }
         
+        template<typename ValueType>
+        uint64_t Multiplier<ValueType>::getCacheMemoryUsage() const {
+            return cachedVector ? cachedVector->capacity() * sizeof(ValueType) : 0;
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::declareGaussSeidelContinuation() const {
+            // Intentionally left empty.
+        }
+        
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
@@ -57,6 +70,16 @@ namespace storm {
             multiplyRow(rowIndex, x2, val2);
         }
         
+        template<typename ValueType>
+        static std::unique_ptr<Multiplier<ValueType>> createOutOfCoreMultiplier(std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> const& matrix) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The out-of-core multiplier only supports double values.");
+        }
+        
+        template<>
+        std::unique_ptr<Multiplier<double>> createOutOfCoreMultiplier(std::shared_ptr<storm::storage::OnDiskSparseMatrix<double>> const& matrix) {
+            return std::make_unique<OutOfCoreMultiplier<double>>(matrix);
+        }
+        
         template<typename ValueType>
         std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
             auto type = env.solver().multiplier().getType();
@@ -73,16 +96,48 @@ namespace storm {
                 }
                 STORM_LOG_INFO_COND(!changed, "Selecting '" + toString(type) + "' as the multiplier type to match the selected equation solver. If you want to override this, please explicitly specify a different multiplier type.");
             }
-            
+
+            // Prioritized Gauss-Seidel multiplications are only supported by the native multiplier.
+            if (env.solver().multiplier().isPrioritizedGaussSeidelSet() && type != MultiplierType::Native) {
+                if (env.solver().multiplier().isTypeSetFromDefault()) {
+                    STORM_LOG_INFO("Selecting '" + toString(MultiplierType::Native) + "' as the multiplier type, because prioritized Gauss-Seidel multiplications were requested.");
+                    type = MultiplierType::Native;
+                } else {
+                    STORM_LOG_WARN("Prioritized Gauss-Seidel multiplications are not supported by the selected multiplier type '" + toString(type) + "'.");
+                }
+            }
+
             switch (type) {
                 case MultiplierType::Gmmxx:
                     return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
                 case MultiplierType::Native:
                     return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+                case MultiplierType::OutOfCore:
+                    STORM_LOG_WARN("The out-of-core multiplier requires a matrix on disk but the given matrix is in memory. Selecting '" + toString(MultiplierType::Native) + "' as the multiplier type.");
+                    return std::make_unique<NativeMultiplier<ValueType>>(matrix);
             }
             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
         }
         
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> const& matrix) {
+            STORM_LOG_WARN_COND(env.solver().multiplier().isTypeSetFromDefault() || env.solver().multiplier().getType() == MultiplierType::OutOfCore, "The selected multiplier type '" + toString(env.solver().multiplier().getType()) + "' is ignored for the matrix on disk.");
+            return createOutOfCoreMultiplier(matrix);
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::ImplicitModelMemoryProduct<ValueType> const& product) {
+            STORM_LOG_WARN_COND(env.solver().multiplier().isTypeSetFromDefault(), "The selected multiplier type '" + toString(env.solver().multiplier().getType()) + "' is ignored for the implicit model-memory product.");
+            return std::make_unique<ImplicitProductMultiplier<ValueType>>(product);
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        std::unique_ptr<Multiplier<storm::RationalFunction>> MultiplierFactory<storm::RationalFunction>::create(Environment const& env, storm::storage::ImplicitModelMemoryProduct<storm::RationalFunction> const& product) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Implicit model-memory products are not supported for parametric models.");
+        }
+#endif
+        
         template class Multiplier<double>;
         template class MultiplierFactory<double>;
         
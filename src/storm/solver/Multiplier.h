@@ -13,6 +13,10 @@ namespace storm {
     namespace storage {
         template<typename ValueType>
         class SparseMatrix;
+        template<typename ValueType>
+        class ImplicitModelMemoryProduct;
+        template<typename ValueType>
+        class OnDiskSparseMatrix;
     }
     
     namespace solver {
@@ -30,6 +34,12 @@ namespace storm {
              */
             virtual void clearCache() const;
             
+            /*!
+             * Retrieves an estimate of the number of bytes occupied by the currently cached data of this multiplier,
+             * i.e., the memory that would be freed by clearCache. The underlying matrix is not taken into account.
+             */
+            virtual uint64_t getCacheMemoryUsage() const;
+            
             /*!
              * Performs a matrix-vector multiplication x' = A*x + b.
              *
@@ -86,6 +96,14 @@ namespace storm {
             void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const = 0;
             
+            /*!
+             * Declares that the vector passed to the next Gauss-Seidel style multiplication is the unmodified result of
+             * the previous one (with the same offsets and direction). Multipliers that keep information across these
+             * multiplications only reuse it after such a declaration. Otherwise, the vector is considered to be
+             * modified. The declaration only applies to the next Gauss-Seidel style multiplication.
+             */
+            virtual void declareGaussSeidelContinuation() const;
+            
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -143,7 +161,23 @@ namespace storm {
             MultiplierFactory() = default;
             ~MultiplierFactory() = default;
 
+            /*!
+             * Creates a multiplier for the given in-memory matrix. As the out-of-core multiplier requires the matrix to
+             * be on disk, the native multiplier is used if the out-of-core multiplier is selected.
+             */
             std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix);
+
+            /*!
+             * Creates an out-of-core multiplier for the given on-disk matrix. Only matrices with double values are
+             * supported.
+             */
+            std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> const& matrix);
+
+            /*!
+             * Creates a multiplier for the transition matrix of the given model-memory product without materializing it.
+             * The product has to outlive the multiplier.
+             */
+            std::unique_ptr<Multiplier<ValueType>> create(Environment const& env, storm::storage::ImplicitModelMemoryProduct<ValueType> const& product);
         };
         
     }
@@ -1,8 +1,12 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
-#include <limits>
-
+#include "storm/environment/Environment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/storage/OnDiskSparseMatrix.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
@@ -10,6 +14,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/AndersonAccelerationHelper.h"
+#include "storm/solver/helper/AggregationDisaggregationHelper.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -38,6 +44,7 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
             localA.reset();
+            onDiskA.reset();
             this->A = &A;
             clearCache();
         }
@@ -45,9 +52,34 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
             localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+            onDiskA.reset();
             this->A = localA.get();
             clearCache();
         }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::createMultiplier(Environment const& env) const {
+            if (!onDiskA && localA && env.solver().multiplier().getType() == MultiplierType::OutOfCore) {
+                moveMatrixToDisk(env);
+            }
+            if (onDiskA) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, onDiskA);
+            } else {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::moveMatrixToDisk(Environment const& env) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The out-of-core multiplier only supports double values.");
+        }
+        
+        template<>
+        void NativeLinearEquationSolver<double>::moveMatrixToDisk(Environment const& env) const {
+            onDiskA = storm::storage::OnDiskSparseMatrix<double>::moveToTemporaryFile(std::move(*localA), env.solver().multiplier().getOutOfCoreDirectory(), env.solver().multiplier().getOutOfCoreBlockSize());
+            localA.reset();
+            A = &onDiskA->getStructure();
+        }
 
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const {
@@ -72,6 +104,7 @@ namespace storm {
                 
                 // Now check if the process already converged within our precision.
                 converged = storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative);
+                this->reportResidual(*this->cachedRowVector, x, relative);
                 terminate = this->terminateNow(x, SolverGuarantee::None);
                 
                 // If we did not yet converge, we need to backup the contents of x.
@@ -137,6 +170,7 @@ namespace storm {
                 
                 // Now check if the process already converged within our precision.
                 converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, precision, relative);
+                this->reportResidual(*currentX, *nextX, relative);
                 terminate = this->terminateNow(*currentX, SolverGuarantee::None);
                 
                 // Swap the two pointers as a preparation for the next iteration.
@@ -308,19 +342,49 @@ namespace storm {
 
             bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
             
+            // Optionally accelerate the iteration. Linear equation systems are assumed to have a unique solution, so
+            // the safeguard of the acceleration preserves the guarantee of the iteration.
+            std::unique_ptr<storm::solver::helper::AndersonAccelerationHelper<ValueType>> andersonHelper;
+            if (!storm::NumberTraits<ValueType>::IsExact && env.solver().native().getAndersonAccelerationDepth() > 0) {
+                andersonHelper = std::make_unique<storm::solver::helper::AndersonAccelerationHelper<ValueType>>(currentX->size(), env.solver().native().getAndersonAccelerationDepth());
+            }
+            
             bool converged = false;
             bool terminate = this->terminateNow(*currentX, guarantee);
             uint64_t iterations = currentIterations;
+            // Whether the current vector is the unmodified result of the previous Gauss-Seidel multiplication.
+            bool continueGaussSeidel = false;
             while (!converged && !terminate && iterations < maxIterations) {
                 if (useGaussSeidelMultiplication) {
                     *newX = *currentX;
+                    if (continueGaussSeidel) {
+                        this->multiplier->declareGaussSeidelContinuation();
+                    }
                     this->multiplier->multiplyGaussSeidel(env, *newX, &b);
+                    continueGaussSeidel = true;
                 } else {
                     this->multiplier->multiply(env, *currentX, &b, *newX);
                 }
                 
                 // Check for convergence.
                 converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative);
+                this->reportResidual(*currentX, *newX, relative);
+                
+                // If we did not converge, try to replace the step by an extrapolated one.
+                if (andersonHelper && !converged) {
+                    andersonHelper->recordIterate(*currentX, *newX);
+                    if (andersonHelper->computeCandidate()) {
+                        std::vector<ValueType>& candidateImage = andersonHelper->getCandidateImage();
+                        if (useGaussSeidelMultiplication) {
+                            candidateImage = andersonHelper->getCandidate();
+                            this->multiplier->multiplyGaussSeidel(env, candidateImage, &b);
+                            continueGaussSeidel = false;
+                        } else {
+                            this->multiplier->multiply(env, andersonHelper->getCandidate(), &b, candidateImage);
+                        }
+                        andersonHelper->applyCandidate(*currentX, *newX, guarantee);
+                    }
+                }
 
                 // Check for termination.
                 std::swap(currentX, newX);
@@ -331,6 +395,10 @@ namespace storm {
                 this->showProgressIterative(iterations);
             }
             
+            if (andersonHelper) {
+                STORM_LOG_INFO("Anderson acceleration accepted " << andersonHelper->getNumberOfAcceptedCandidates() << " and rejected " << andersonHelper->getNumberOfRejectedCandidates() << " extrapolated iterates.");
+            }
+            
             return PowerIterationResult(iterations - currentIterations, converged ? SolverStatus::Converged : (terminate ? SolverStatus::TerminatedEarly : SolverStatus::MaximalIterationsExceeded));
         }
         
@@ -343,7 +411,7 @@ namespace storm {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
             }
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                createMultiplier(env);
             }
             std::vector<ValueType>* currentX = &x;
             SolverGuarantee guarantee = SolverGuarantee::None;
@@ -377,6 +445,390 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        NativeLinearEquationSolver<ValueType>::AggregationData::AggregationData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A) : coarseEnvironment(std::make_unique<Environment>(env)) {
+            if (env.solver().native().getAggregationCoarsening() == AggregationCoarsening::Scc) {
+                numberOfAggregates = helper::computeSccAggregates(A, aggregateOfRow);
+            } else {
+                numberOfAggregates = helper::computeStrongCouplingAggregates(A, storm::utility::convertNumber<ValueType>(env.solver().native().getAggregationThreshold()), aggregateOfRow);
+            }
+            computeCoarseMatrix(A);
+        }
+        
+        template<typename ValueType>
+        NativeLinearEquationSolver<ValueType>::AggregationData::~AggregationData() = default;
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::AggregationData::computeCoarseMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
+            // Group the rows by their aggregate.
+            std::vector<uint64_t> aggregateSizes(numberOfAggregates, 0);
+            for (auto const& aggregate : aggregateOfRow) {
+                ++aggregateSizes[aggregate];
+            }
+            std::vector<uint64_t> aggregateStart(numberOfAggregates + 1, 0);
+            for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+                aggregateStart[aggregate + 1] = aggregateStart[aggregate] + aggregateSizes[aggregate];
+            }
+            std::vector<uint64_t> rowsByAggregate(aggregateOfRow.size());
+            std::vector<uint64_t> nextPosition(aggregateStart.begin(), aggregateStart.end() - 1);
+            for (uint64_t row = 0; row < aggregateOfRow.size(); ++row) {
+                rowsByAggregate[nextPosition[aggregateOfRow[row]]++] = row;
+            }
+            
+            // Each row contributes to its aggregate with the same weight.
+            rowWeights = std::vector<ValueType>(aggregateOfRow.size());
+            for (uint64_t row = 0; row < aggregateOfRow.size(); ++row) {
+                rowWeights[row] = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(static_cast<uint_fast64_t>(aggregateSizes[aggregateOfRow[row]]));
+            }
+            
+            // The coarse matrix is the weighted sum of the rows of each aggregate, where the columns are summed up per aggregate.
+            storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfAggregates, numberOfAggregates);
+            std::vector<ValueType> coarseRow(numberOfAggregates, storm::utility::zero<ValueType>());
+            storm::storage::BitVector touchedColumns(numberOfAggregates);
+            for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+                for (uint64_t position = aggregateStart[aggregate]; position < aggregateStart[aggregate + 1]; ++position) {
+                    uint64_t row = rowsByAggregate[position];
+                    for (auto const& entry : A.getRow(row)) {
+                        uint64_t column = aggregateOfRow[entry.getColumn()];
+                        coarseRow[column] += rowWeights[row] * entry.getValue();
+                        touchedColumns.set(column);
+                    }
+                }
+                for (auto column : touchedColumns) {
+                    if (!storm::utility::isZero(coarseRow[column])) {
+                        builder.addNextValue(aggregate, column, coarseRow[column]);
+                    }
+                    coarseRow[column] = storm::utility::zero<ValueType>();
+                }
+                touchedColumns.clear();
+            }
+            storm::storage::SparseMatrix<ValueType> coarseMatrix = builder.build(numberOfAggregates, numberOfAggregates);
+            
+            // The coarse system is aggregated further if this still reduces its size considerably. Otherwise, it is
+            // solved with Gauss-Seidel. The maximal number of iterations is kept, as the coarse system of a singular
+            // (e.g. steady-state) system need not have a solution.
+            coarseEnvironment->solver().native().setRelativeTerminationCriterion(false);
+            coarseEnvironment->solver().native().setPrecision(coarseEnvironment->solver().native().getPrecision() * storm::utility::convertNumber<storm::RationalNumber>(0.1));
+            if (numberOfAggregates <= 1000 || 4 * numberOfAggregates > 3 * aggregateOfRow.size()) {
+                coarseEnvironment->solver().native().setMethod(NativeLinearEquationSolverMethod::GaussSeidel);
+            }
+            coarseSolver = std::make_unique<NativeLinearEquationSolver<ValueType>>();
+            if (coarseSolver->getEquationProblemFormat(*coarseEnvironment) == LinearEquationSolverProblemFormat::EquationSystem) {
+                coarseMatrix.convertToEquationSystem();
+            }
+            coarseSolver->setMatrix(std::move(coarseMatrix));
+            coarseSolver->setCachingEnabled(true);
+            coarseX.resize(numberOfAggregates);
+            coarseB.resize(numberOfAggregates);
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsAggregationDisaggregation(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (AggregationDisaggregation)");
+            
+            if (!this->cachedRowVector) {
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+            }
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            if (!aggregationData) {
+                aggregationData = std::make_unique<AggregationData>(env, *A);
+                STORM_LOG_INFO("Aggregated " << A->getRowCount() << " rows into " << aggregationData->numberOfAggregates << " aggregates.");
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            std::vector<ValueType>& tmp = *this->cachedRowVector;
+            
+            uint64_t iterations = 0;
+            bool converged = false;
+            bool terminate = false;
+            
+            this->startMeasureProgress();
+            while (!converged && !terminate && iterations < maxIter) {
+                // Compute the residual r = Ax + b - x and restrict it to the aggregates.
+                this->multiplier->multiply(env, x, &b, tmp);
+                storm::utility::vector::subtractVectors(tmp, x, tmp);
+                std::fill(aggregationData->coarseB.begin(), aggregationData->coarseB.end(), storm::utility::zero<ValueType>());
+                for (uint64_t row = 0; row < tmp.size(); ++row) {
+                    aggregationData->coarseB[aggregationData->aggregateOfRow[row]] += aggregationData->rowWeights[row] * tmp[row];
+                }
+                
+                // Solve the coarse correction equation e = A_c e + r_c and disaggregate the correction.
+                std::fill(aggregationData->coarseX.begin(), aggregationData->coarseX.end(), storm::utility::zero<ValueType>());
+                if (!aggregationData->coarseSolver->solveEquations(*aggregationData->coarseEnvironment, aggregationData->coarseX, aggregationData->coarseB)) {
+                    STORM_LOG_WARN("Could not solve the coarse correction equation in iteration " << iterations << ".");
+                    break;
+                }
+                for (uint64_t row = 0; row < x.size(); ++row) {
+                    x[row] += aggregationData->coarseX[aggregationData->aggregateOfRow[row]];
+                }
+                
+                // Smooth the error within the aggregates by a Gauss-Seidel sweep.
+                tmp = x;
+                this->multiplier->multiplyGaussSeidel(env, x, &b);
+                
+                // Now check if the process already converged within our precision.
+                converged = storm::utility::vector::equalModuloPrecision<ValueType>(tmp, x, precision, relative);
+                terminate = this->terminateNow(x, SolverGuarantee::None);
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+                
+                // Increase iteration count so we can abort if convergence is too slow.
+                ++iterations;
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, terminate, iterations);
+            
+            return converged;
+        }
+        
+        template<typename ValueType>
+        NativeLinearEquationSolver<ValueType>::KrylovData::KrylovData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A) : multiplier(A), preconditioner(A, env.solver().native().getPreconditioner(), env.solver().native().getPreconditionerBlockSize(), storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            STORM_LOG_DEBUG("Levels of the preconditioner: " << preconditioner.getNumberOfLevels().first << " (forward), " << preconditioner.getNumberOfLevels().second << " (backward).");
+        }
+        
+        template<typename ValueType>
+        ValueType NativeLinearEquationSolver<ValueType>::KrylovData::computeTolerance(Environment const& env, std::vector<ValueType> const& b) const {
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            if (env.solver().native().getRelativeTerminationCriterion()) {
+                return precision * storm::utility::sqrt(storm::utility::vector::dotProduct(b, b));
+            }
+            return precision;
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::KrylovData::computeResidual(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& residual) const {
+            multiplier.multiply(env, x, nullptr, residual);
+            storm::utility::vector::subtractVectors(b, residual, residual);
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsGmres(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Gmres)");
+            
+            if (!krylovData) {
+                krylovData = std::make_unique<KrylovData>(env, *A);
+            }
+            
+            uint64_t restart = std::max<uint64_t>(env.solver().native().getRestartThreshold(), 1);
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            ValueType tolerance = krylovData->computeTolerance(env, b);
+            
+            // The Krylov basis (with right preconditioning) and two further auxiliary vectors.
+            std::vector<std::vector<ValueType>>& basis = krylovData->vectors;
+            basis.resize(restart + 3);
+            for (auto& vector : basis) {
+                vector.resize(x.size());
+            }
+            std::vector<ValueType>& preconditioned = basis[restart + 1];
+            std::vector<ValueType>& update = basis[restart + 2];
+            
+            // The Hessenberg matrix (column-major), the Givens rotations and the right-hand side of the least-squares problem.
+            std::vector<ValueType> hessenberg((restart + 1) * restart);
+            std::vector<ValueType> cosines(restart);
+            std::vector<ValueType> sines(restart);
+            std::vector<ValueType> g(restart + 1);
+            std::vector<ValueType> y(restart);
+            auto h = [&hessenberg, restart] (uint64_t row, uint64_t column) -> ValueType& { return hessenberg[column * (restart + 1) + row]; };
+            
+            krylovData->computeResidual(env, x, b, basis[0]);
+            ValueType residualNorm = storm::utility::sqrt(storm::utility::vector::dotProduct(basis[0], basis[0]));
+            bool converged = residualNorm <= tolerance;
+            bool terminate = this->terminateNow(x, SolverGuarantee::None);
+            uint64_t iterations = 0;
+            while (!converged && !terminate && iterations < maxIter) {
+                storm::utility::vector::scaleVectorInPlace(basis[0], storm::utility::one<ValueType>() / residualNorm);
+                std::fill(g.begin(), g.end(), storm::utility::zero<ValueType>());
+                g[0] = residualNorm;
+                
+                uint64_t k = 0;
+                while (k < restart && iterations < maxIter) {
+                    // Extend the basis by A*M^-1*v_k, orthogonalized by the modified Gram-Schmidt process.
+                    krylovData->preconditioner.apply(basis[k], preconditioned);
+                    krylovData->multiplier.multiply(env, preconditioned, nullptr, basis[k + 1]);
+                    for (uint64_t i = 0; i <= k; ++i) {
+                        h(i, k) = storm::utility::vector::dotProduct(basis[k + 1], basis[i]);
+                        storm::utility::vector::addScaledVector(basis[k + 1], basis[i], -h(i, k));
+                    }
+                    h(k + 1, k) = storm::utility::sqrt(storm::utility::vector::dotProduct(basis[k + 1], basis[k + 1]));
+                    bool breakdown = storm::utility::isZero(h(k + 1, k));
+                    if (!breakdown) {
+                        storm::utility::vector::scaleVectorInPlace(basis[k + 1], storm::utility::one<ValueType>() / h(k + 1, k));
+                    }
+                    
+                    // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+                    for (uint64_t i = 0; i < k; ++i) {
+                        ValueType temp = cosines[i] * h(i, k) + sines[i] * h(i + 1, k);
+                        h(i + 1, k) = cosines[i] * h(i + 1, k) - sines[i] * h(i, k);
+                        h(i, k) = temp;
+                    }
+                    ValueType norm = storm::utility::sqrt(h(k, k) * h(k, k) + h(k + 1, k) * h(k + 1, k));
+                    if (storm::utility::isZero(norm)) {
+                        cosines[k] = storm::utility::one<ValueType>();
+                        sines[k] = storm::utility::zero<ValueType>();
+                    } else {
+                        cosines[k] = h(k, k) / norm;
+                        sines[k] = h(k + 1, k) / norm;
+                    }
+                    h(k, k) = norm;
+                    h(k + 1, k) = storm::utility::zero<ValueType>();
+                    g[k + 1] = -sines[k] * g[k];
+                    g[k] = cosines[k] * g[k];
+                    
+                    ++k;
+                    ++iterations;
+                    this->showProgressIterative(iterations);
+                    if (storm::utility::abs<ValueType>(g[k]) <= tolerance || breakdown) {
+                        break;
+                    }
+                }
+                
+                // Solve the (triangular) least-squares problem and update the solution by M^-1 * (V*y).
+                for (uint64_t i = k; i > 0; --i) {
+                    uint64_t row = i - 1;
+                    ValueType value = g[row];
+                    for (uint64_t column = row + 1; column < k; ++column) {
+                        value -= h(row, column) * y[column];
+                    }
+                    y[row] = storm::utility::isZero(h(row, row)) ? storm::utility::zero<ValueType>() : value / h(row, row);
+                }
+                std::fill(update.begin(), update.end(), storm::utility::zero<ValueType>());
+                for (uint64_t i = 0; i < k; ++i) {
+                    storm::utility::vector::addScaledVector(update, basis[i], y[i]);
+                }
+                krylovData->preconditioner.apply(update, preconditioned);
+                storm::utility::vector::addVectors(x, preconditioned, x);
+                
+                // Restart with the true residual.
+                krylovData->computeResidual(env, x, b, basis[0]);
+                residualNorm = storm::utility::sqrt(storm::utility::vector::dotProduct(basis[0], basis[0]));
+                converged = residualNorm <= tolerance;
+                terminate = this->terminateNow(x, SolverGuarantee::None);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, terminate, iterations);
+            
+            return converged;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsBicgstab(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Bicgstab)");
+            
+            if (!krylovData) {
+                krylovData = std::make_unique<KrylovData>(env, *A);
+            }
+            
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            ValueType tolerance = krylovData->computeTolerance(env, b);
+            
+            std::vector<std::vector<ValueType>>& vectors = krylovData->vectors;
+            vectors.resize(7);
+            for (auto& vector : vectors) {
+                vector.resize(x.size());
+            }
+            std::vector<ValueType>& r = vectors[0];
+            std::vector<ValueType>& shadowResidual = vectors[1];
+            std::vector<ValueType>& p = vectors[2];
+            std::vector<ValueType>& v = vectors[3];
+            std::vector<ValueType>& preconditionedP = vectors[4];
+            std::vector<ValueType>& preconditionedS = vectors[5];
+            std::vector<ValueType>& t = vectors[6];
+            
+            krylovData->computeResidual(env, x, b, r);
+            bool converged = storm::utility::sqrt(storm::utility::vector::dotProduct(r, r)) <= tolerance;
+            bool terminate = this->terminateNow(x, SolverGuarantee::None);
+            bool restart = true;
+            bool restarted = false;
+            ValueType rho = storm::utility::one<ValueType>();
+            ValueType alpha = storm::utility::one<ValueType>();
+            ValueType omega = storm::utility::one<ValueType>();
+            uint64_t iterations = 0;
+            while (!converged && !terminate && iterations < maxIter) {
+                if (restart) {
+                    // A breakdown directly after a restart can not be resolved.
+                    if (restarted) {
+                        STORM_LOG_WARN("Unrecoverable breakdown of BiCGSTAB.");
+                        break;
+                    }
+                    
+                    // (Re-)start with the current residual as shadow residual.
+                    shadowResidual = r;
+                    std::fill(p.begin(), p.end(), storm::utility::zero<ValueType>());
+                    std::fill(v.begin(), v.end(), storm::utility::zero<ValueType>());
+                    rho = alpha = omega = storm::utility::one<ValueType>();
+                    restart = false;
+                    restarted = true;
+                }
+                
+                ValueType newRho = storm::utility::vector::dotProduct(shadowResidual, r);
+                if (storm::utility::isZero(newRho)) {
+                    STORM_LOG_TRACE("Breakdown of BiCGSTAB, restarting.");
+                    restart = true;
+                    continue;
+                }
+                
+                // p = r + beta * (p - omega * v)
+                ValueType beta = (newRho / rho) * (alpha / omega);
+                storm::utility::vector::addScaledVector(p, v, -omega);
+                storm::utility::vector::scaleVectorInPlace(p, beta);
+                storm::utility::vector::addVectors(p, r, p);
+                
+                krylovData->preconditioner.apply(p, preconditionedP);
+                krylovData->multiplier.multiply(env, preconditionedP, nullptr, v);
+                ValueType denominator = storm::utility::vector::dotProduct(shadowResidual, v);
+                if (storm::utility::isZero(denominator)) {
+                    STORM_LOG_TRACE("Breakdown of BiCGSTAB, restarting.");
+                    restart = true;
+                    continue;
+                }
+                alpha = newRho / denominator;
+                rho = newRho;
+                
+                // s = r - alpha * v (stored in r)
+                storm::utility::vector::addScaledVector(r, v, -alpha);
+                storm::utility::vector::addScaledVector(x, preconditionedP, alpha);
+                restarted = false;
+                ++iterations;
+                if (storm::utility::sqrt(storm::utility::vector::dotProduct(r, r)) <= tolerance) {
+                    converged = true;
+                    break;
+                }
+                
+                krylovData->preconditioner.apply(r, preconditionedS);
+                krylovData->multiplier.multiply(env, preconditionedS, nullptr, t);
+                ValueType tt = storm::utility::vector::dotProduct(t, t);
+                omega = storm::utility::isZero(tt) ? storm::utility::zero<ValueType>() : storm::utility::vector::dotProduct(t, r) / tt;
+                storm::utility::vector::addScaledVector(x, preconditionedS, omega);
+                storm::utility::vector::addScaledVector(r, t, -omega);
+                restart = storm::utility::isZero(omega);
+                
+                converged = storm::utility::sqrt(storm::utility::vector::dotProduct(r, r)) <= tolerance;
+                terminate = this->terminateNow(x, SolverGuarantee::None);
+                this->showProgressIterative(iterations);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, terminate, iterations);
+            
+            return converged;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -922,7 +1374,9 @@ namespace storm {
         
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-            switch(getMethod(env, storm::NumberTraits<ValueType>::IsExact)) {
+            auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
+            STORM_LOG_THROW(!onDiskA || method == NativeLinearEquationSolverMethod::Power, storm::exceptions::InvalidEnvironmentException, "The matrix of the solver was moved to disk for the out-of-core multiplier, which is only supported by the power method.");
+            switch(method) {
                 case NativeLinearEquationSolverMethod::SOR:
                     return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
                 case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -939,6 +1393,12 @@ namespace storm {
                     return this->solveEquationsIntervalIteration(env, x, b);
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return this->solveEquationsRationalSearch(env, x, b);
+                case NativeLinearEquationSolverMethod::AggregationDisaggregation:
+                    return this->solveEquationsAggregationDisaggregation(env, x, b);
+                case NativeLinearEquationSolverMethod::Gmres:
+                    return this->solveEquationsGmres(env, x, b);
+                case NativeLinearEquationSolverMethod::Bicgstab:
+                    return this->solveEquationsBicgstab(env, x, b);
             }
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
             return false;
@@ -947,7 +1407,7 @@ namespace storm {
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
-            if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::IntervalIteration) {
+            if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::IntervalIteration || method == NativeLinearEquationSolverMethod::AggregationDisaggregation) {
                 return LinearEquationSolverProblemFormat::FixedPointSystem;
             } else {
                 return LinearEquationSolverProblemFormat::EquationSystem;
@@ -970,12 +1430,47 @@ namespace storm {
         
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::clearCache() const {
+            LinearEquationSolver<ValueType>::clearCache();
             jacobiDecomposition.reset();
             cachedRowVector2.reset();
             walkerChaeData.reset();
+            aggregationData.reset();
+            krylovData.reset();
             multiplier.reset();
             soundValueIterationHelper.reset();
-            LinearEquationSolver<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        uint64_t NativeLinearEquationSolver<ValueType>::getCacheMemoryUsage() const {
+            uint64_t result = LinearEquationSolver<ValueType>::getCacheMemoryUsage();
+            if (multiplier) {
+                result += multiplier->getCacheMemoryUsage();
+            }
+            if (cachedRowVector2) {
+                result += cachedRowVector2->capacity() * sizeof(ValueType);
+            }
+            if (jacobiDecomposition) {
+                result += jacobiDecomposition->LUMatrix.getMemoryUsage() + jacobiDecomposition->DVector.capacity() * sizeof(ValueType);
+                if (jacobiDecomposition->multiplier) {
+                    result += jacobiDecomposition->multiplier->getCacheMemoryUsage();
+                }
+            }
+            if (walkerChaeData) {
+                result += walkerChaeData->matrix.getMemoryUsage() + (walkerChaeData->b.capacity() + walkerChaeData->columnSums.capacity() + walkerChaeData->newX.capacity()) * sizeof(ValueType);
+            }
+            if (aggregationData) {
+                result += aggregationData->aggregateOfRow.capacity() * sizeof(uint64_t) + (aggregationData->rowWeights.capacity() + aggregationData->coarseX.capacity() + aggregationData->coarseB.capacity()) * sizeof(ValueType);
+                if (aggregationData->coarseSolver) {
+                    result += aggregationData->coarseSolver->getCacheMemoryUsage();
+                }
+            }
+            if (krylovData) {
+                result += krylovData->multiplier.getCacheMemoryUsage();
+                for (auto const& vector : krylovData->vectors) {
+                    result += vector.capacity() * sizeof(ValueType);
+                }
+            }
+            return result;
         }
         
         template<typename ValueType>
@@ -9,13 +9,18 @@
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/SparsePreconditioner.h"
 
 #include "storm/utility/NumberTraits.h"
 
 namespace storm {
-    
     class Environment;
     
+    namespace storage {
+        template<typename ValueType>
+        class OnDiskSparseMatrix;
+    }
+    
     namespace solver {
         
         /*!
@@ -35,6 +40,7 @@ namespace storm {
             virtual LinearEquationSolverRequirements getRequirements(Environment const& env) const override;
 
             virtual void clearCache() const override;
+            virtual uint64_t getCacheMemoryUsage() const override;
 
         protected:
             virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
@@ -61,6 +67,18 @@ namespace storm {
 
             NativeLinearEquationSolverMethod getMethod(Environment const& env, bool isExactMode) const;
 
+            /*!
+             * Creates the multiplier for A. If the out-of-core multiplier is selected and the solver owns A, A is
+             * moved to disk first.
+             */
+            void createMultiplier(Environment const& env) const;
+
+            /*!
+             * Moves the owned matrix to a temporary file and releases it, such that A refers to the (entry-free)
+             * structure of the on-disk matrix afterwards. Only matrices with double values can be moved to disk.
+             */
+            void moveMatrixToDisk(Environment const& env) const;
+
             virtual bool solveEquationsSOR(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const;
             virtual bool solveEquationsJacobi(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsWalkerChae(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -68,6 +86,9 @@ namespace storm {
             virtual bool solveEquationsSoundValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsAggregationDisaggregation(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsGmres(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsBicgstab(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -83,11 +104,15 @@ namespace storm {
             
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
-            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
             
             // A pointer to the original sparse matrix given to this solver. If the solver takes posession of the matrix
-            // the pointer refers to localA.
-            storm::storage::SparseMatrix<ValueType> const* A;
+            // the pointer refers to localA. If the matrix was moved to disk, the pointer refers to its structure.
+            mutable storm::storage::SparseMatrix<ValueType> const* A;
+            
+            // The matrix of the solver if it was moved to disk for the out-of-core multiplier. In contrast to the
+            // multiplier, it is kept when the cache is cleared.
+            mutable std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> onDiskA;
             
             // An object to dispatch all multiplication operations.
             mutable std::unique_ptr<Multiplier<ValueType>> multiplier;
@@ -122,6 +147,40 @@ namespace storm {
                 std::vector<ValueType> newX;
             };
             mutable std::unique_ptr<WalkerChaeData> walkerChaeData;
+            
+            struct AggregationData {
+                AggregationData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
+                ~AggregationData();
+                
+                void computeCoarseMatrix(storm::storage::SparseMatrix<ValueType> const& A);
+                
+                // The aggregate of each row and the weight of each row within its aggregate.
+                std::vector<uint64_t> aggregateOfRow;
+                std::vector<ValueType> rowWeights;
+                uint64_t numberOfAggregates;
+                
+                // The solver for the aggregated (coarse) system and its environment.
+                std::unique_ptr<Environment> coarseEnvironment;
+                std::unique_ptr<NativeLinearEquationSolver<ValueType>> coarseSolver;
+                std::vector<ValueType> coarseX;
+                std::vector<ValueType> coarseB;
+            };
+            mutable std::unique_ptr<AggregationData> aggregationData;
+            
+            struct KrylovData {
+                KrylovData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
+                
+                ValueType computeTolerance(Environment const& env, std::vector<ValueType> const& b) const;
+                void computeResidual(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& residual) const;
+                
+                // The multiplications are performed natively to avoid converting the matrix to a different format.
+                NativeMultiplier<ValueType> multiplier;
+                helper::SparsePreconditioner<ValueType> preconditioner;
+                
+                // Auxiliary vectors of the size of the equation system.
+                std::vector<std::vector<ValueType>> vectors;
+            };
+            mutable std::unique_ptr<KrylovData> krylovData;
         };
         
         template<typename ValueType>
@@ -3,6 +3,9 @@
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/Environment.h"
+#include "storm/solver/helper/PrioritizedGaussSeidelHelper.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
@@ -13,6 +16,7 @@
 #include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace solver {
@@ -22,6 +26,17 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<typename ValueType>
+        NativeMultiplier<ValueType>::~NativeMultiplier() {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            prioritizedGaussSeidelHelper.reset();
+            Multiplier<ValueType>::clearCache();
+        }
+        
         template<typename ValueType>
         bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
@@ -31,6 +46,24 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::prioritizeGaussSeidel(Environment const& env) const {
+            return env.solver().multiplier().isPrioritizedGaussSeidelSet();
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyGaussSeidelPrioritized(boost::optional<OptimizationDirection> const& dir, std::vector<uint64_t> const* rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            if (!prioritizedGaussSeidelHelper || !prioritizedGaussSeidelHelper->isCompatible(rowGroupIndices)) {
+                prioritizedGaussSeidelHelper = std::make_unique<helper::PrioritizedGaussSeidelHelper<ValueType>>(this->matrix, rowGroupIndices);
+            }
+            prioritizedGaussSeidelHelper->performSweep(dir, x, b, gaussSeidelContinuation);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::declareGaussSeidelContinuation() const {
+            gaussSeidelContinuation = true;
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             std::vector<ValueType>* target = &result;
@@ -54,7 +87,12 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
-            this->matrix.multiplyWithVectorBackward(x, x, b);
+            if (prioritizeGaussSeidel(env)) {
+                multiplyGaussSeidelPrioritized(boost::none, nullptr, x, b);
+            } else {
+                this->matrix.multiplyWithVectorBackward(x, x, b);
+            }
+            gaussSeidelContinuation = false;
         }
         
         template<typename ValueType>
@@ -80,7 +118,13 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
-            this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            // As the prioritized multiplication skips states, it can not provide the choices of all states.
+            if (choices == nullptr && prioritizeGaussSeidel(env)) {
+                multiplyGaussSeidelPrioritized(dir, &rowGroupIndices, x, b);
+            } else {
+                this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            }
+            gaussSeidelContinuation = false;
         }
         
         template<typename ValueType>
@@ -128,6 +172,19 @@ namespace storm {
 #endif
         }
 
+#ifdef STORM_HAVE_CARL
+        template<>
+        bool NativeMultiplier<storm::RationalFunction>::prioritizeGaussSeidel(Environment const& env) const {
+            STORM_LOG_WARN_COND(!env.solver().multiplier().isPrioritizedGaussSeidelSet(), "Prioritized Gauss-Seidel multiplications are not supported for rational functions.");
+            return false;
+        }
+        
+        template<>
+        void NativeMultiplier<storm::RationalFunction>::multiplyGaussSeidelPrioritized(boost::optional<OptimizationDirection> const&, std::vector<uint64_t> const*, std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Prioritized Gauss-Seidel multiplications are not supported for rational functions.");
+        }
+#endif
+
         template class NativeMultiplier<double>;
 #ifdef STORM_HAVE_CARL
         template class NativeMultiplier<storm::RationalNumber>;
@@ -2,6 +2,8 @@
 
 #include "storm/solver/Multiplier.h"
 
+#include <boost/optional.hpp>
+
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
@@ -11,22 +13,32 @@ namespace storm {
     }
     
     namespace solver {
+        namespace helper {
+            template<typename ValueType>
+            class PrioritizedGaussSeidelHelper;
+        }
         
         template<typename ValueType>
         class NativeMultiplier : public Multiplier<ValueType> {
         public:
             NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
-            virtual ~NativeMultiplier() = default;
+            virtual ~NativeMultiplier();
+            
+            virtual void clearCache() const override;
             
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void declareGaussSeidelContinuation() const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
 
         private:
             bool parallelize(Environment const& env) const;
+            bool prioritizeGaussSeidel(Environment const& env) const;
+            
+            void multiplyGaussSeidelPrioritized(boost::optional<OptimizationDirection> const& dir, std::vector<uint64_t> const* rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b) const;
             
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             
@@ -35,6 +47,11 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            // The helper for prioritized Gauss-Seidel multiplications (if they are used).
+            mutable std::unique_ptr<helper::PrioritizedGaussSeidelHelper<ValueType>> prioritizedGaussSeidelHelper;
+            
+            // Whether the next prioritized Gauss-Seidel multiplication continues the previous one.
+            mutable bool gaussSeidelContinuation = false;
         };
         
     }
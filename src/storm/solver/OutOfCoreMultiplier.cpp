@@ -0,0 +1,139 @@
+#include "storm/solver/OutOfCoreMultiplier.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        OutOfCoreMultiplier<ValueType>::OutOfCoreMultiplier(std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> const& onDiskMatrix) : Multiplier<ValueType>(onDiskMatrix->getStructure()), onDiskMatrix(onDiskMatrix) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        void OutOfCoreMultiplier<ValueType>::clearCache() const {
+            rowBuffer.clear();
+            rowBuffer.shrink_to_fit();
+            Multiplier<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        uint64_t OutOfCoreMultiplier<ValueType>::getCacheMemoryUsage() const {
+            return Multiplier<ValueType>::getCacheMemoryUsage() + rowBuffer.capacity() * sizeof(typename storm::storage::OnDiskSparseMatrix<ValueType>::Entry);
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType>& OutOfCoreMultiplier<ValueType>::getTarget(std::vector<ValueType> const& x, std::vector<ValueType>& result) const {
+            if (&x != &result) {
+                return result;
+            }
+            if (this->cachedVector) {
+                this->cachedVector->resize(x.size());
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            }
+            return *this->cachedVector;
+        }
+
+        template<typename ValueType>
+        template<typename Function>
+        void OutOfCoreMultiplier<ValueType>::forEachRowValue(std::vector<ValueType> const& x, std::vector<ValueType> const* b, Function const& function) const {
+            auto const& rowIndications = onDiskMatrix->getRowIndications();
+            onDiskMatrix->forEachBlock([&] (typename storm::storage::OnDiskSparseMatrix<ValueType>::Block const& block) {
+                auto entryIt = block.entries.begin();
+                for (uint64_t row = block.firstRow; row < block.endRow; ++row) {
+                    ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto entryIte = block.entries.begin() + (rowIndications[row + 1] - block.firstEntry); entryIt != entryIte; ++entryIt) {
+                        value += entryIt->value * x[entryIt->column];
+                    }
+                    function(row, value);
+                }
+            });
+        }
+
+        template<typename ValueType>
+        void OutOfCoreMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<ValueType>& target = getTarget(x, result);
+            target.resize(onDiskMatrix->getRowCount());
+            forEachRowValue(x, b, [&target] (uint64_t row, ValueType const& value) { target[row] = value; });
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void OutOfCoreMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            STORM_LOG_ASSERT(onDiskMatrix->getRowCount() == x.size(), "Gauss-Seidel multiplications require a square matrix.");
+            forEachRowValue(x, b, [&x] (uint64_t row, ValueType const& value) { x[row] = value; });
+        }
+
+        template<typename ValueType>
+        void OutOfCoreMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            std::vector<ValueType>& target = getTarget(x, result);
+            multAddReduce(dir, rowGroupIndices, x, b, target, choices);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void OutOfCoreMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            multAddReduce(dir, rowGroupIndices, x, b, x, choices);
+        }
+
+        template<typename ValueType>
+        void OutOfCoreMultiplier<ValueType>::multAddReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(rowGroupIndices.back() == onDiskMatrix->getRowCount(), storm::exceptions::InvalidArgumentException, "The row grouping does not match the number of rows of the matrix.");
+            uint64_t numberOfGroups = rowGroupIndices.size() - 1;
+            result.resize(numberOfGroups);
+            bool minimize = storm::solver::minimize(dir);
+
+            // Groups without rows are skipped and their result is left untouched.
+            uint64_t group = 0;
+            auto skipEmptyGroups = [&] () {
+                while (group < numberOfGroups && rowGroupIndices[group] == rowGroupIndices[group + 1]) {
+                    ++group;
+                }
+            };
+            skipEmptyGroups();
+
+            // As the rows are processed in ascending order, the current group is tracked across blocks. As for the
+            // in-memory multipliers, the choice of a group is only changed if the new choice is strictly better.
+            ValueType currentValue = storm::utility::zero<ValueType>();
+            ValueType oldSelectedChoiceValue = storm::utility::zero<ValueType>();
+            uint64_t selectedChoice = 0;
+            forEachRowValue(x, b, [&] (uint64_t row, ValueType const& value) {
+                uint64_t choice = row - rowGroupIndices[group];
+                if (choice == 0 || (minimize ? value < currentValue : value > currentValue)) {
+                    currentValue = value;
+                    selectedChoice = choice;
+                }
+                if (choices && choice == (*choices)[group]) {
+                    oldSelectedChoiceValue = value;
+                }
+                if (row + 1 == rowGroupIndices[group + 1]) {
+                    result[group] = currentValue;
+                    if (choices && (minimize ? currentValue < oldSelectedChoiceValue : currentValue > oldSelectedChoiceValue)) {
+                        (*choices)[group] = selectedChoice;
+                    }
+                    ++group;
+                    skipEmptyGroups();
+                }
+            });
+        }
+
+        template<typename ValueType>
+        void OutOfCoreMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            onDiskMatrix->readRow(rowIndex, rowBuffer);
+            for (auto const& entry : rowBuffer) {
+                value += entry.value * x[entry.column];
+            }
+        }
+
+        template class OutOfCoreMultiplier<double>;
+    }
+}
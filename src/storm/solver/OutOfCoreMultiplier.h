@@ -0,0 +1,63 @@
+#pragma once
+
+#include "storm/solver/Multiplier.h"
+
+#include <memory>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/OnDiskSparseMatrix.h"
+
+namespace storm {
+    namespace solver {
+
+        /*!
+         * A multiplier whose matrix resides on disk. Each multiplication streams the matrix block by block, where the
+         * next block is read while the current block is processed. Only the row structure of the matrix and the
+         * vectors are kept in memory.
+         *
+         * Gauss-Seidel multiplications are performed in forward order, because the matrix can only be streamed in
+         * ascending row order.
+         */
+        template<typename ValueType>
+        class OutOfCoreMultiplier : public Multiplier<ValueType> {
+        public:
+            /*!
+             * Creates a multiplier for the given on-disk matrix.
+             */
+            OutOfCoreMultiplier(std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> const& onDiskMatrix);
+
+            virtual ~OutOfCoreMultiplier() = default;
+
+            virtual void clearCache() const override;
+            virtual uint64_t getCacheMemoryUsage() const override;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+
+        private:
+            /*!
+             * Retrieves the vector in which the result is to be stored, which is the cached vector if x and the result
+             * are the same.
+             */
+            std::vector<ValueType>& getTarget(std::vector<ValueType> const& x, std::vector<ValueType>& result) const;
+
+            /*!
+             * Streams the matrix and calls the given function with (row, A[row]*x + b[row]) for all rows in ascending
+             * order. As the function is called right after computing the value of a row, x can be modified in between.
+             */
+            template<typename Function>
+            void forEachRowValue(std::vector<ValueType> const& x, std::vector<ValueType> const* b, Function const& function) const;
+
+            void multAddReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+
+            std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> onDiskMatrix;
+
+            // A buffer for the entries of single rows.
+            mutable std::vector<typename storm::storage::OnDiskSparseMatrix<ValueType>::Entry> rowBuffer;
+        };
+
+    }
+}
@@ -32,6 +32,8 @@ namespace storm {
                     return "Native";
                 case MultiplierType::Gmmxx:
                     return "Gmmxx";
+                case MultiplierType::OutOfCore:
+                    return "OutOfCore";
             }
             return "invalid";
         }
@@ -112,6 +114,36 @@ namespace storm {
                     return "IntervalIteration";
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return "RationalSearch";
+                case NativeLinearEquationSolverMethod::AggregationDisaggregation:
+                    return "AggregationDisaggregation";
+                case NativeLinearEquationSolverMethod::Gmres:
+                    return "Gmres";
+                case NativeLinearEquationSolverMethod::Bicgstab:
+                    return "Bicgstab";
+            }
+            return "invalid";
+        }
+        
+        std::string toString(AggregationCoarsening t) {
+            switch(t) {
+                case AggregationCoarsening::StrongCoupling:
+                    return "strong";
+                case AggregationCoarsening::Scc:
+                    return "scc";
+            }
+            return "invalid";
+        }
+        
+        std::string toString(NativeLinearEquationSolverPreconditioner t) {
+            switch (t) {
+                case NativeLinearEquationSolverPreconditioner::Ilu:
+                    return "ilu";
+                case NativeLinearEquationSolverPreconditioner::BlockJacobi:
+                    return "blockjacobi";
+                case NativeLinearEquationSolverPreconditioner::Diagonal:
+                    return "diagonal";
+                case NativeLinearEquationSolverPreconditioner::None:
+                    return "none";
             }
             return "invalid";
         }
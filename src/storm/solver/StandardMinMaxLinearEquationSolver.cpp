@@ -8,12 +8,16 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+
+#include "storm/storage/OnDiskSparseMatrix.h"
 
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 namespace storm {
     namespace solver {
         
@@ -35,6 +39,7 @@ namespace storm {
         template<typename ValueType>
         void StandardMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
             this->localA = nullptr;
+            this->onDiskA = nullptr;
             this->A = &matrix;
             this->clearCache();
         }
@@ -42,10 +47,24 @@ namespace storm {
         template<typename ValueType>
         void StandardMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) {
             this->localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(matrix));
+            this->onDiskA = nullptr;
             this->A = this->localA.get();
             this->clearCache();
         }
         
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolver<ValueType>::moveMatrixToDisk(Environment const& env) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The out-of-core multiplier only supports double values.");
+        }
+        
+        template<>
+        void StandardMinMaxLinearEquationSolver<double>::moveMatrixToDisk(Environment const& env) const {
+            onDiskAHash = localA->hash();
+            onDiskA = storm::storage::OnDiskSparseMatrix<double>::moveToTemporaryFile(std::move(*localA), env.solver().multiplier().getOutOfCoreDirectory(), env.solver().multiplier().getOutOfCoreBlockSize());
+            localA.reset();
+            A = &onDiskA->getStructure();
+        }
+        
         template class StandardMinMaxLinearEquationSolver<double>;
         
 #ifdef STORM_HAVE_CARL
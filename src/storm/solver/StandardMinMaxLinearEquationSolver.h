@@ -7,6 +7,11 @@ namespace storm {
     
     class Environment;
     
+    namespace storage {
+        template<typename ValueType>
+        class OnDiskSparseMatrix;
+    }
+    
     namespace solver {
         
         template<typename ValueType>
@@ -22,14 +27,24 @@ namespace storm {
             virtual ~StandardMinMaxLinearEquationSolver() = default;
             
         protected:
+            /*!
+             * Moves the owned matrix to a temporary file and releases it, such that A refers to the (entry-free)
+             * structure of the on-disk matrix afterwards. Only matrices with double values can be moved to disk.
+             */
+            void moveMatrixToDisk(Environment const& env) const;
             
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
-            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
             
             // A reference to the original sparse matrix given to this solver. If the solver takes posession of the matrix
-            // the reference refers to localA.
-            storm::storage::SparseMatrix<ValueType> const* A;
+            // the reference refers to localA. If the matrix was moved to disk, the reference refers to its structure.
+            mutable storm::storage::SparseMatrix<ValueType> const* A;
+            
+            // The matrix of the solver if it was moved to disk for the out-of-core multiplier and the hash of the
+            // matrix (as the structure does not identify the matrix).
+            mutable std::shared_ptr<storm::storage::OnDiskSparseMatrix<ValueType>> onDiskA;
+            mutable std::size_t onDiskAHash;
         };
      
     }
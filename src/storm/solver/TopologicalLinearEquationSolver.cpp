@@ -223,10 +223,19 @@ namespace storm {
         
         template<typename ValueType>
         void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
+            LinearEquationSolver<ValueType>::clearCache();
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
-            LinearEquationSolver<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        uint64_t TopologicalLinearEquationSolver<ValueType>::getCacheMemoryUsage() const {
+            uint64_t result = LinearEquationSolver<ValueType>::getCacheMemoryUsage();
+            if (sccSolver) {
+                result += sccSolver->getCacheMemoryUsage();
+            }
+            return result;
         }
         
         template<typename ValueType>
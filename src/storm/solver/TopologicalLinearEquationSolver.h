@@ -26,6 +26,7 @@ namespace storm {
             virtual LinearEquationSolverRequirements getRequirements(Environment const& env) const override;
 
             virtual void clearCache() const override;
+            virtual uint64_t getCacheMemoryUsage() const override;
 
         protected:
             virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
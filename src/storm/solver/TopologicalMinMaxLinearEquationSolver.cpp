@@ -303,11 +303,23 @@ namespace storm {
         
         template<typename ValueType>
         void TopologicalMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+            StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
             auxiliaryRowGroupVector.reset();
-            StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        uint64_t TopologicalMinMaxLinearEquationSolver<ValueType>::getCacheMemoryUsage() const {
+            uint64_t result = StandardMinMaxLinearEquationSolver<ValueType>::getCacheMemoryUsage();
+            if (sccSolver) {
+                result += sccSolver->getCacheMemoryUsage();
+            }
+            if (auxiliaryRowGroupVector) {
+                result += auxiliaryRowGroupVector->capacity() * sizeof(ValueType);
+            }
+            return result;
         }
         
         // Explicitly instantiate the min max linear equation solver.
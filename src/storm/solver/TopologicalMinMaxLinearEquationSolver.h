@@ -22,6 +22,7 @@ namespace storm {
             }
 
             virtual void clearCache() const override;
+            virtual uint64_t getCacheMemoryUsage() const override;
 
             virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none, bool const& hasInitialScheduler = false) const override ;
 
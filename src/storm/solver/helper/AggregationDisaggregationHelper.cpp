@@ -0,0 +1,314 @@
+#include "storm/solver/helper/AggregationDisaggregationHelper.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/EigenSolverEnvironment.h"
+
+#include "storm/solver/EigenLinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            uint64_t computeStrongCouplingAggregates(storm::storage::SparseMatrix<ValueType> const& matrix, ValueType const& threshold, std::vector<uint64_t>& aggregateOfRow) {
+                uint64_t const noAggregate = std::numeric_limits<uint64_t>::max();
+                aggregateOfRow = std::vector<uint64_t>(matrix.getRowCount(), noAggregate);
+                uint64_t numberOfAggregates = 0;
+
+                // Determine the largest off-diagonal entry of each row, relative to which couplings are considered strong.
+                std::vector<ValueType> strongCouplingBounds(matrix.getRowCount(), storm::utility::zero<ValueType>());
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (entry.getColumn() != row) {
+                            strongCouplingBounds[row] = storm::utility::max<ValueType>(strongCouplingBounds[row], storm::utility::abs<ValueType>(entry.getValue()));
+                        }
+                    }
+                    strongCouplingBounds[row] *= threshold;
+                }
+                auto isStrongCoupling = [&strongCouplingBounds] (uint64_t row, uint64_t column, ValueType const& value) {
+                    return column != row && !storm::utility::isZero(value) && storm::utility::abs<ValueType>(value) >= strongCouplingBounds[row];
+                };
+
+                // First, form an aggregate out of every row whose strongly coupled neighbors are all still unaggregated.
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    if (aggregateOfRow[row] != noAggregate) {
+                        continue;
+                    }
+                    bool neighborsFree = true;
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (isStrongCoupling(row, entry.getColumn(), entry.getValue()) && aggregateOfRow[entry.getColumn()] != noAggregate) {
+                            neighborsFree = false;
+                            break;
+                        }
+                    }
+                    if (neighborsFree) {
+                        aggregateOfRow[row] = numberOfAggregates;
+                        for (auto const& entry : matrix.getRow(row)) {
+                            if (isStrongCoupling(row, entry.getColumn(), entry.getValue())) {
+                                aggregateOfRow[entry.getColumn()] = numberOfAggregates;
+                            }
+                        }
+                        ++numberOfAggregates;
+                    }
+                }
+
+                // Then, add each remaining row to the aggregate it is most strongly coupled to (or make it a singleton).
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    if (aggregateOfRow[row] != noAggregate) {
+                        continue;
+                    }
+                    uint64_t bestAggregate = noAggregate;
+                    ValueType bestValue = storm::utility::zero<ValueType>();
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (isStrongCoupling(row, entry.getColumn(), entry.getValue()) && aggregateOfRow[entry.getColumn()] != noAggregate && (bestAggregate == noAggregate || storm::utility::abs<ValueType>(entry.getValue()) > bestValue)) {
+                            bestAggregate = aggregateOfRow[entry.getColumn()];
+                            bestValue = storm::utility::abs<ValueType>(entry.getValue());
+                        }
+                    }
+                    if (bestAggregate == noAggregate) {
+                        bestAggregate = numberOfAggregates;
+                        ++numberOfAggregates;
+                    }
+                    aggregateOfRow[row] = bestAggregate;
+                }
+                return numberOfAggregates;
+            }
+
+            template<typename ValueType>
+            uint64_t computeSccAggregates(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t>& aggregateOfRow) {
+                storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(matrix);
+                aggregateOfRow = std::vector<uint64_t>(matrix.getRowCount());
+                for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                    for (auto const& row : sccDecomposition.getBlock(sccIndex)) {
+                        aggregateOfRow[row] = sccIndex;
+                    }
+                }
+                return sccDecomposition.size();
+            }
+
+            template<typename ValueType>
+            SteadyStateAggregationDisaggregationHelper<ValueType>::SteadyStateAggregationDisaggregationHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transposedMatrix, std::vector<uint64_t> const& componentOfState, uint64_t numberOfComponents) : transposedMatrix(transposedMatrix), componentOfState(componentOfState), numberOfComponents(numberOfComponents), coarseEnvironment(std::make_unique<Environment>(env)) {
+                STORM_LOG_ASSERT(transposedMatrix.getRowCount() == transposedMatrix.getColumnCount(), "Steady-state distributions require a square matrix.");
+                STORM_LOG_ASSERT(componentOfState.size() == transposedMatrix.getRowCount(), "The number of states does not match the number of components.");
+
+                // As there are no entries between different bottom SCCs, each aggregate is contained in one of them.
+                if (env.solver().native().getAggregationCoarsening() == AggregationCoarsening::Scc) {
+                    numberOfAggregates = computeSccAggregates(transposedMatrix, aggregateOfState);
+                } else {
+                    numberOfAggregates = computeStrongCouplingAggregates(transposedMatrix, storm::utility::convertNumber<ValueType>(env.solver().native().getAggregationThreshold()), aggregateOfState);
+                }
+                STORM_LOG_INFO("Aggregated " << transposedMatrix.getRowCount() << " states into " << numberOfAggregates << " aggregates.");
+
+                // Group the states by their aggregate.
+                aggregateStart = std::vector<uint64_t>(numberOfAggregates + 1, 0);
+                for (auto const& aggregate : aggregateOfState) {
+                    ++aggregateStart[aggregate + 1];
+                }
+                for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+                    aggregateStart[aggregate + 1] += aggregateStart[aggregate];
+                }
+                statesByAggregate = std::vector<uint64_t>(aggregateOfState.size());
+                std::vector<uint64_t> nextPosition(aggregateStart.begin(), aggregateStart.end() - 1);
+                componentOfAggregate = std::vector<uint64_t>(numberOfAggregates);
+                for (uint64_t state = 0; state < aggregateOfState.size(); ++state) {
+                    statesByAggregate[nextPosition[aggregateOfState[state]]++] = state;
+                    componentOfAggregate[aggregateOfState[state]] = componentOfState[state];
+                }
+
+                // As for linear equation systems, the coarse chain is aggregated further if this still reduces its size
+                // considerably. Otherwise, it is solved with LU factorization.
+                recursive = numberOfAggregates > 1000 && 4 * numberOfAggregates <= 3 * aggregateOfState.size();
+                coarseEnvironment->solver().native().setRelativeTerminationCriterion(false);
+                coarseEnvironment->solver().native().setPrecision(coarseEnvironment->solver().native().getPrecision() * storm::utility::convertNumber<storm::RationalNumber>(0.1));
+                if (!recursive) {
+                    coarseEnvironment->solver().eigen().setMethod(EigenLinearEquationSolverMethod::SparseLU);
+                }
+            }
+
+            template<typename ValueType>
+            SteadyStateAggregationDisaggregationHelper<ValueType>::~SteadyStateAggregationDisaggregationHelper() = default;
+
+            template<typename ValueType>
+            uint64_t SteadyStateAggregationDisaggregationHelper<ValueType>::getNumberOfAggregates() const {
+                return numberOfAggregates;
+            }
+
+            template<typename ValueType>
+            bool SteadyStateAggregationDisaggregationHelper<ValueType>::isCoarseChainAggregated() const {
+                return recursive;
+            }
+
+            template<typename ValueType>
+            bool SteadyStateAggregationDisaggregationHelper<ValueType>::computeSteadyStateDistribution(Environment const& env, std::vector<ValueType>& x) {
+                STORM_LOG_ASSERT(x.size() == transposedMatrix.getRowCount(), "The size of the initial guess does not match the number of states.");
+                ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+                uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+                bool relative = env.solver().native().getRelativeTerminationCriterion();
+
+                normalize(x, componentOfState);
+                std::vector<ValueType> previousX(x.size());
+                std::vector<ValueType> weights(x.size());
+                std::vector<ValueType> coarseX(numberOfAggregates);
+
+                uint64_t iterations = 0;
+                bool converged = false;
+                while (!converged && iterations < maxIter) {
+                    previousX = x;
+
+                    // Aggregate the distribution and determine the weight of each state within its aggregate.
+                    std::fill(coarseX.begin(), coarseX.end(), storm::utility::zero<ValueType>());
+                    for (uint64_t state = 0; state < x.size(); ++state) {
+                        coarseX[aggregateOfState[state]] += x[state];
+                    }
+                    for (uint64_t state = 0; state < x.size(); ++state) {
+                        uint64_t aggregate = aggregateOfState[state];
+                        if (storm::utility::isZero(coarseX[aggregate])) {
+                            weights[state] = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(static_cast<uint_fast64_t>(aggregateStart[aggregate + 1] - aggregateStart[aggregate]));
+                        } else {
+                            weights[state] = x[state] / coarseX[aggregate];
+                        }
+                    }
+
+                    // Solve the coarse chain and disaggregate its distribution.
+                    if (!solveCoarseChain(weights, coarseX)) {
+                        STORM_LOG_WARN("Could not solve the coarse chain in iteration " << iterations << ".");
+                        break;
+                    }
+                    for (uint64_t state = 0; state < x.size(); ++state) {
+                        x[state] = coarseX[aggregateOfState[state]] * weights[state];
+                    }
+
+                    // Smooth the distribution within the aggregates.
+                    performGaussSeidelSweep(x);
+                    normalize(x, componentOfState);
+
+                    converged = storm::utility::vector::equalModuloPrecision<ValueType>(previousX, x, precision, relative);
+                    ++iterations;
+                }
+
+                if (converged) {
+                    STORM_LOG_INFO("Iterative aggregation-disaggregation converged in " << iterations << " iterations.");
+                } else {
+                    STORM_LOG_WARN("Iterative aggregation-disaggregation did not converge in " << iterations << " iterations.");
+                }
+                return converged;
+            }
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> SteadyStateAggregationDisaggregationHelper<ValueType>::computeCoarseMatrix(std::vector<ValueType> const& weights, bool equationSystem) const {
+                // The first aggregate of each bottom SCC carries the normalization constraint of the equation system.
+                std::vector<std::vector<uint64_t>> aggregatesOfComponent(equationSystem ? numberOfComponents : 0);
+                if (equationSystem) {
+                    for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+                        aggregatesOfComponent[componentOfAggregate[aggregate]].push_back(aggregate);
+                    }
+                }
+
+                // Row J of the coarse matrix sums up the rows of the states in J, where the column of each state i is
+                // weighted with w_i and summed up per aggregate.
+                storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfAggregates, numberOfAggregates);
+                std::vector<ValueType> coarseRow(numberOfAggregates, storm::utility::zero<ValueType>());
+                storm::storage::BitVector touchedColumns(numberOfAggregates);
+                for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+                    if (equationSystem && aggregatesOfComponent[componentOfAggregate[aggregate]].front() == aggregate) {
+                        for (auto const& column : aggregatesOfComponent[componentOfAggregate[aggregate]]) {
+                            builder.addNextValue(aggregate, column, storm::utility::one<ValueType>());
+                        }
+                        continue;
+                    }
+                    for (uint64_t position = aggregateStart[aggregate]; position < aggregateStart[aggregate + 1]; ++position) {
+                        for (auto const& entry : transposedMatrix.getRow(statesByAggregate[position])) {
+                            uint64_t column = aggregateOfState[entry.getColumn()];
+                            coarseRow[column] += entry.getValue() * weights[entry.getColumn()];
+                            touchedColumns.set(column);
+                        }
+                    }
+                    if (equationSystem) {
+                        coarseRow[aggregate] -= storm::utility::one<ValueType>();
+                        touchedColumns.set(aggregate);
+                    }
+                    for (auto column : touchedColumns) {
+                        if (!storm::utility::isZero(coarseRow[column])) {
+                            builder.addNextValue(aggregate, column, coarseRow[column]);
+                        }
+                        coarseRow[column] = storm::utility::zero<ValueType>();
+                    }
+                    touchedColumns.clear();
+                }
+                return builder.build(numberOfAggregates, numberOfAggregates);
+            }
+
+            template<typename ValueType>
+            bool SteadyStateAggregationDisaggregationHelper<ValueType>::solveCoarseChain(std::vector<ValueType> const& weights, std::vector<ValueType>& coarseX) {
+                if (recursive) {
+                    storm::storage::SparseMatrix<ValueType> coarseMatrix = computeCoarseMatrix(weights, false);
+                    SteadyStateAggregationDisaggregationHelper<ValueType> coarseHelper(*coarseEnvironment, coarseMatrix, componentOfAggregate, numberOfComponents);
+                    return coarseHelper.computeSteadyStateDistribution(*coarseEnvironment, coarseX);
+                }
+
+                // The aggregates of a bottom SCC appear in ascending order, so the first one is the normalization row.
+                std::vector<ValueType> coarseB(numberOfAggregates, storm::utility::zero<ValueType>());
+                storm::storage::BitVector normalizedComponents(numberOfComponents);
+                for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+                    if (!normalizedComponents.get(componentOfAggregate[aggregate])) {
+                        normalizedComponents.set(componentOfAggregate[aggregate]);
+                        coarseB[aggregate] = storm::utility::one<ValueType>();
+                    }
+                }
+                EigenLinearEquationSolver<ValueType> coarseSolver(computeCoarseMatrix(weights, true));
+                return coarseSolver.solveEquations(*coarseEnvironment, coarseX, coarseB);
+            }
+
+            template<typename ValueType>
+            void SteadyStateAggregationDisaggregationHelper<ValueType>::performGaussSeidelSweep(std::vector<ValueType>& x) const {
+                // Solve each row for its diagonal entry. A state whose only successor is itself keeps its value.
+                for (uint64_t row = 0; row < transposedMatrix.getRowCount(); ++row) {
+                    ValueType diagonal = storm::utility::zero<ValueType>();
+                    ValueType sum = storm::utility::zero<ValueType>();
+                    for (auto const& entry : transposedMatrix.getRow(row)) {
+                        if (entry.getColumn() == row) {
+                            diagonal += entry.getValue();
+                        } else {
+                            sum += entry.getValue() * x[entry.getColumn()];
+                        }
+                    }
+                    if (!storm::utility::isOne(diagonal)) {
+                        x[row] = sum / (storm::utility::one<ValueType>() - diagonal);
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            void SteadyStateAggregationDisaggregationHelper<ValueType>::normalize(std::vector<ValueType>& x, std::vector<uint64_t> const& componentOfElement) const {
+                std::vector<ValueType> componentSums(numberOfComponents, storm::utility::zero<ValueType>());
+                for (uint64_t element = 0; element < x.size(); ++element) {
+                    componentSums[componentOfElement[element]] += x[element];
+                }
+                for (uint64_t element = 0; element < x.size(); ++element) {
+                    x[element] /= componentSums[componentOfElement[element]];
+                }
+            }
+
+            template uint64_t computeStrongCouplingAggregates(storm::storage::SparseMatrix<double> const& matrix, double const& threshold, std::vector<uint64_t>& aggregateOfRow);
+            template uint64_t computeSccAggregates(storm::storage::SparseMatrix<double> const& matrix, std::vector<uint64_t>& aggregateOfRow);
+            template class SteadyStateAggregationDisaggregationHelper<double>;
+
+            template uint64_t computeStrongCouplingAggregates(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix, storm::RationalNumber const& threshold, std::vector<uint64_t>& aggregateOfRow);
+            template uint64_t computeSccAggregates(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix, std::vector<uint64_t>& aggregateOfRow);
+            template class SteadyStateAggregationDisaggregationHelper<storm::RationalNumber>;
+        }
+    }
+}
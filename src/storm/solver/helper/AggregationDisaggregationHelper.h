@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <memory>
+
+namespace storm {
+    class Environment;
+
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Groups the rows of the given square matrix into aggregates of strongly coupled rows. An entry couples its
+             * row strongly to its column if its absolute value is at least the given threshold times the largest
+             * absolute off-diagonal value of the row.
+             *
+             * @param aggregateOfRow Is set to the aggregate of each row.
+             * @return The number of aggregates.
+             */
+            template<typename ValueType>
+            uint64_t computeStrongCouplingAggregates(storm::storage::SparseMatrix<ValueType> const& matrix, ValueType const& threshold, std::vector<uint64_t>& aggregateOfRow);
+
+            /*!
+             * Groups the rows of the given square matrix into aggregates according to the SCCs of the matrix.
+             *
+             * @param aggregateOfRow Is set to the aggregate of each row.
+             * @return The number of aggregates.
+             */
+            template<typename ValueType>
+            uint64_t computeSccAggregates(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t>& aggregateOfRow);
+
+            /*!
+             * Computes steady-state distributions with iterative aggregation-disaggregation (Koury, McAllister and
+             * Stewart). In every iteration, the current distribution is aggregated to a coarse chain whose transitions
+             * are weighted with the distribution within each aggregate. The steady-state distribution of the coarse chain
+             * is then disaggregated according to the same weights and smoothed by a Gauss-Seidel sweep. Nearly
+             * completely decomposable chains, i.e., chains whose aggregates are only weakly connected, are the typical
+             * application as plain iterative methods converge very slowly on them.
+             *
+             * The coarse chain is solved directly unless aggregating it further still reduces its size considerably.
+             * The aggregates are computed once (according to the aggregation settings of the native environment), only
+             * the weights change between iterations.
+             */
+            template<typename ValueType>
+            class SteadyStateAggregationDisaggregationHelper {
+            public:
+                /*!
+                 * Creates a helper for the given chain.
+                 *
+                 * @param transposedMatrix The transposed transition probability matrix P^T of the chain, i.e., a
+                 * steady-state distribution x satisfies x = P^T x. Every state has to be contained in a bottom SCC.
+                 * @param componentOfState The bottom SCC of each state. The distribution is normalized within each of them.
+                 * @param numberOfComponents The number of bottom SCCs.
+                 */
+                SteadyStateAggregationDisaggregationHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transposedMatrix, std::vector<uint64_t> const& componentOfState, uint64_t numberOfComponents);
+
+                ~SteadyStateAggregationDisaggregationHelper();
+
+                /*!
+                 * Computes the steady-state distribution of each bottom SCC.
+                 *
+                 * @param x The initial guess, which has to be positive. It is replaced by the steady-state distribution.
+                 * @return True iff the iteration converged with respect to the precision of the native environment.
+                 */
+                bool computeSteadyStateDistribution(Environment const& env, std::vector<ValueType>& x);
+
+                /*!
+                 * Retrieves the number of aggregates of the chain.
+                 */
+                uint64_t getNumberOfAggregates() const;
+
+                /*!
+                 * Retrieves whether the coarse chain is aggregated further instead of being solved directly.
+                 */
+                bool isCoarseChainAggregated() const;
+
+            private:
+                /*!
+                 * Computes the transposed coarse matrix whose entry (J, I) is the probability to move from aggregate I
+                 * to aggregate J when the states within I are distributed according to the weights.
+                 *
+                 * @param equationSystem If set, the first row of each bottom SCC is replaced by the normalization
+                 * constraint and one is subtracted from the remaining diagonal entries. The steady-state distribution then
+                 * solves the system for the first unit vector of each bottom SCC.
+                 */
+                storm::storage::SparseMatrix<ValueType> computeCoarseMatrix(std::vector<ValueType> const& weights, bool equationSystem) const;
+
+                /*!
+                 * Solves the coarse chain, starting from the given (aggregated) distribution.
+                 */
+                bool solveCoarseChain(std::vector<ValueType> const& weights, std::vector<ValueType>& coarseX);
+
+                /*!
+                 * Performs a Gauss-Seidel sweep on x = P^T x.
+                 */
+                void performGaussSeidelSweep(std::vector<ValueType>& x) const;
+
+                /*!
+                 * Normalizes the given distribution within each bottom SCC.
+                 */
+                void normalize(std::vector<ValueType>& x, std::vector<uint64_t> const& componentOfElement) const;
+
+                storm::storage::SparseMatrix<ValueType> const& transposedMatrix;
+                std::vector<uint64_t> const& componentOfState;
+                uint64_t numberOfComponents;
+
+                // The aggregate of each state and the states grouped by their aggregate.
+                std::vector<uint64_t> aggregateOfState;
+                uint64_t numberOfAggregates;
+                std::vector<uint64_t> aggregateStart;
+                std::vector<uint64_t> statesByAggregate;
+                std::vector<uint64_t> componentOfAggregate;
+
+                // Whether the coarse chain is aggregated further and the environment of the coarse chain.
+                bool recursive;
+                std::unique_ptr<Environment> coarseEnvironment;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,202 @@
+#include "storm/solver/helper/AndersonAccelerationHelper.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            AndersonAccelerationHelper<ValueType>::AndersonAccelerationHelper(uint64_t dimension, uint64_t depth) : depth(std::max<uint64_t>(depth, 1)), newest(0), candidate(dimension), candidateImage(dimension), acceptedCandidates(0), rejectedCandidates(0) {
+                iterates.reserve(this->depth + 1);
+                images.reserve(this->depth + 1);
+            }
+
+            template<typename ValueType>
+            void AndersonAccelerationHelper<ValueType>::recordIterate(std::vector<ValueType> const& x, std::vector<ValueType> const& image) {
+                if (iterates.size() <= depth) {
+                    iterates.push_back(x);
+                    images.push_back(image);
+                    newest = iterates.size() - 1;
+                } else {
+                    newest = (newest + 1) % iterates.size();
+                    iterates[newest] = x;
+                    images[newest] = image;
+                }
+            }
+
+            template<typename ValueType>
+            bool AndersonAccelerationHelper<ValueType>::computeCandidate() {
+                if (iterates.size() < 2) {
+                    return false;
+                }
+
+                std::vector<uint64_t> others;
+                for (uint64_t index = 0; index < iterates.size(); ++index) {
+                    if (index != newest) {
+                        others.push_back(index);
+                    }
+                }
+                uint64_t const m = others.size();
+                std::vector<ValueType> const& lastX = iterates[newest];
+                std::vector<ValueType> const& lastImage = images[newest];
+
+                // Set up the normal equations of min_gamma ||f - sum_i gamma_i * d_i||, where f is the newest residual
+                // and d_i is the difference between the newest and the i-th residual.
+                std::vector<ValueType> gram(m * m, storm::utility::zero<ValueType>());
+                std::vector<ValueType> rhs(m, storm::utility::zero<ValueType>());
+                std::vector<ValueType> differences(m);
+                for (uint64_t position = 0; position < lastX.size(); ++position) {
+                    ValueType lastResidual = lastImage[position] - lastX[position];
+                    for (uint64_t i = 0; i < m; ++i) {
+                        differences[i] = lastResidual - (images[others[i]][position] - iterates[others[i]][position]);
+                        rhs[i] += differences[i] * lastResidual;
+                        for (uint64_t j = 0; j <= i; ++j) {
+                            gram[i * m + j] += differences[i] * differences[j];
+                        }
+                    }
+                }
+                ValueType largestDiagonal = storm::utility::zero<ValueType>();
+                for (uint64_t i = 0; i < m; ++i) {
+                    for (uint64_t j = 0; j < i; ++j) {
+                        gram[j * m + i] = gram[i * m + j];
+                    }
+                    largestDiagonal = std::max(largestDiagonal, gram[i * m + i]);
+                }
+                if (storm::utility::isZero(largestDiagonal)) {
+                    return false;
+                }
+
+                // Solve the (slightly regularized) normal equations by Gaussian elimination with partial pivoting.
+                ValueType const regularization = largestDiagonal * storm::utility::convertNumber<ValueType>(1e-12);
+                for (uint64_t i = 0; i < m; ++i) {
+                    gram[i * m + i] += regularization;
+                }
+                for (uint64_t column = 0; column < m; ++column) {
+                    uint64_t pivot = column;
+                    for (uint64_t row = column + 1; row < m; ++row) {
+                        if (storm::utility::abs<ValueType>(gram[row * m + column]) > storm::utility::abs<ValueType>(gram[pivot * m + column])) {
+                            pivot = row;
+                        }
+                    }
+                    if (storm::utility::abs<ValueType>(gram[pivot * m + column]) <= regularization) {
+                        return false;
+                    }
+                    if (pivot != column) {
+                        for (uint64_t k = 0; k < m; ++k) {
+                            std::swap(gram[pivot * m + k], gram[column * m + k]);
+                        }
+                        std::swap(rhs[pivot], rhs[column]);
+                    }
+                    for (uint64_t row = column + 1; row < m; ++row) {
+                        ValueType factor = gram[row * m + column] / gram[column * m + column];
+                        for (uint64_t k = column; k < m; ++k) {
+                            gram[row * m + k] -= factor * gram[column * m + k];
+                        }
+                        rhs[row] -= factor * rhs[column];
+                    }
+                }
+                std::vector<ValueType> gamma(m);
+                for (uint64_t i = m; i > 0; --i) {
+                    uint64_t row = i - 1;
+                    ValueType value = rhs[row];
+                    for (uint64_t k = row + 1; k < m; ++k) {
+                        value -= gram[row * m + k] * gamma[k];
+                    }
+                    gamma[row] = value / gram[row * m + row];
+                }
+
+                // The candidate is the correspondingly combined image.
+                for (uint64_t position = 0; position < lastX.size(); ++position) {
+                    ValueType value = lastImage[position];
+                    for (uint64_t i = 0; i < m; ++i) {
+                        value -= gamma[i] * (lastImage[position] - images[others[i]][position]);
+                    }
+                    candidate[position] = value;
+                }
+                return true;
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> const& AndersonAccelerationHelper<ValueType>::getCandidate() const {
+                return candidate;
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType>& AndersonAccelerationHelper<ValueType>::getCandidateImage() {
+                return candidateImage;
+            }
+
+            template<typename ValueType>
+            bool AndersonAccelerationHelper<ValueType>::applyCandidate(std::vector<ValueType> const& x, std::vector<ValueType>& image, SolverGuarantee const& guarantee) {
+                bool accept = true;
+                if (guarantee == SolverGuarantee::LessOrEqual) {
+                    for (uint64_t position = 0; position < candidate.size(); ++position) {
+                        if (candidate[position] > candidateImage[position]) {
+                            accept = false;
+                            break;
+                        }
+                    }
+                    if (accept) {
+                        for (uint64_t position = 0; position < candidate.size(); ++position) {
+                            image[position] = std::max(image[position], candidateImage[position]);
+                        }
+                    }
+                } else if (guarantee == SolverGuarantee::GreaterOrEqual) {
+                    for (uint64_t position = 0; position < candidate.size(); ++position) {
+                        if (candidate[position] < candidateImage[position]) {
+                            accept = false;
+                            break;
+                        }
+                    }
+                    if (accept) {
+                        for (uint64_t position = 0; position < candidate.size(); ++position) {
+                            image[position] = std::min(image[position], candidateImage[position]);
+                        }
+                    }
+                } else {
+                    ValueType candidateResidual = storm::utility::zero<ValueType>();
+                    ValueType currentResidual = storm::utility::zero<ValueType>();
+                    for (uint64_t position = 0; position < candidate.size(); ++position) {
+                        candidateResidual = std::max(candidateResidual, storm::utility::abs<ValueType>(candidateImage[position] - candidate[position]));
+                        currentResidual = std::max(currentResidual, storm::utility::abs<ValueType>(image[position] - x[position]));
+                    }
+                    accept = candidateResidual < currentResidual;
+                    if (accept) {
+                        image = candidateImage;
+                    }
+                }
+
+                if (accept) {
+                    ++acceptedCandidates;
+                } else {
+                    ++rejectedCandidates;
+                    reset();
+                }
+                return accept;
+            }
+
+            template<typename ValueType>
+            void AndersonAccelerationHelper<ValueType>::reset() {
+                iterates.clear();
+                images.clear();
+                newest = 0;
+            }
+
+            template<typename ValueType>
+            uint64_t AndersonAccelerationHelper<ValueType>::getNumberOfAcceptedCandidates() const {
+                return acceptedCandidates;
+            }
+
+            template<typename ValueType>
+            uint64_t AndersonAccelerationHelper<ValueType>::getNumberOfRejectedCandidates() const {
+                return rejectedCandidates;
+            }
+
+            template class AndersonAccelerationHelper<double>;
+            template class AndersonAccelerationHelper<storm::RationalNumber>;
+        }
+    }
+}
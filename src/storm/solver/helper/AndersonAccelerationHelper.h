@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "storm/solver/SolverGuarantee.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Implements Anderson acceleration (type II) for fixed point iterations x_{k+1} = F(x_k) with a monotone
+             * operator F, e.g., value iteration or the power method. From the last few iterates and their images, an
+             * extrapolated candidate is computed whose residual is (approximately) minimal in the span of the recorded
+             * residuals. The candidate is only accepted if it passes a safeguard that keeps the guarantee of the
+             * iteration (if any) intact.
+             */
+            template<typename ValueType>
+            class AndersonAccelerationHelper {
+            public:
+                /*!
+                 * Creates a helper for vectors of the given dimension.
+                 *
+                 * @param dimension The size of the iterated vectors.
+                 * @param depth The number of differences of previous iterates that are used for the extrapolation.
+                 */
+                AndersonAccelerationHelper(uint64_t dimension, uint64_t depth);
+
+                /*!
+                 * Records an iterate together with its image under the fixed point operator.
+                 */
+                void recordIterate(std::vector<ValueType> const& x, std::vector<ValueType> const& image);
+
+                /*!
+                 * Computes the extrapolated candidate from the recorded iterates. If this succeeds, the candidate can be
+                 * retrieved via getCandidate.
+                 *
+                 * @return True iff a candidate was computed.
+                 */
+                bool computeCandidate();
+
+                /*!
+                 * Retrieves the most recently computed candidate.
+                 */
+                std::vector<ValueType> const& getCandidate() const;
+
+                /*!
+                 * Retrieves a vector that can be used to store the image of the candidate under the fixed point operator.
+                 */
+                std::vector<ValueType>& getCandidateImage();
+
+                /*!
+                 * Checks whether the candidate can replace the regular iteration step. If so, the given image (the regular
+                 * next iterate) is overwritten with the safeguarded next iterate. Otherwise, the recorded history is
+                 * discarded so the extrapolation restarts from scratch.
+                 *
+                 * For guarantee LessOrEqual (GreaterOrEqual), the candidate is accepted only if it is a sub-solution
+                 * (super-solution), i.e., if it is less (greater) or equal than its image. The next iterate then is the
+                 * pointwise maximum (minimum) of both images, which is again a sub-solution (super-solution) that is at
+                 * least as close to the fixed point as the regular step. Note that this reasoning requires the fixed
+                 * point to be unique. Without guarantee, the candidate is accepted if its residual is smaller than the
+                 * residual of the current iterate.
+                 *
+                 * @param x The current iterate.
+                 * @param image The image of the current iterate, i.e. the regular next iterate.
+                 * @param guarantee The guarantee that the iteration has to maintain.
+                 * @return True iff the candidate was accepted.
+                 */
+                bool applyCandidate(std::vector<ValueType> const& x, std::vector<ValueType>& image, SolverGuarantee const& guarantee);
+
+                /*!
+                 * Discards all recorded iterates.
+                 */
+                void reset();
+
+                /*!
+                 * Retrieves the number of candidates that were accepted so far.
+                 */
+                uint64_t getNumberOfAcceptedCandidates() const;
+
+                /*!
+                 * Retrieves the number of candidates that were rejected so far.
+                 */
+                uint64_t getNumberOfRejectedCandidates() const;
+
+            private:
+                uint64_t depth;
+
+                // The recorded iterates and their images. The vectors are used as a ring buffer.
+                std::vector<std::vector<ValueType>> iterates;
+                std::vector<std::vector<ValueType>> images;
+                uint64_t newest;
+
+                std::vector<ValueType> candidate;
+                std::vector<ValueType> candidateImage;
+
+                uint64_t acceptedCandidates;
+                uint64_t rejectedCandidates;
+            };
+
+        }
+    }
+}
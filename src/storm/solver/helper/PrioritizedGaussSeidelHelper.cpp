@@ -0,0 +1,208 @@
+#include "storm/solver/helper/PrioritizedGaussSeidelHelper.h"
+
+#include <cmath>
+#include <limits>
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            static const uint64_t NUMBER_OF_BUCKETS = 64;
+            static const uint64_t NO_BUCKET = std::numeric_limits<uint64_t>::max();
+            static const uint64_t DEFERRED = NO_BUCKET - 1;
+
+            template<typename ValueType>
+            PrioritizedGaussSeidelHelper<ValueType>::PrioritizedGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const* rowGroupIndices) : matrix(matrix), rowGroupIndices(rowGroupIndices), numberOfStates(rowGroupIndices ? rowGroupIndices->size() - 1 : matrix.getRowCount()), buckets(NUMBER_OF_BUCKETS), currentSweep(0), initialized(false), lastOffsets(nullptr), numberOfUpdates(0) {
+                STORM_LOG_ASSERT(matrix.getColumnCount() == numberOfStates, "Gauss-Seidel style multiplications require as many columns as there are states.");
+
+                // Build the (deduplicated) predecessor relation in two passes. As the states are traversed in ascending
+                // order, a duplicate entry of a predecessor is always the last one that was added for the successor.
+                std::vector<uint64_t> lastPredecessor(numberOfStates, NO_BUCKET);
+                predecessorIndications.assign(numberOfStates + 1, 0);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    uint64_t firstRow = rowGroupIndices ? (*rowGroupIndices)[state] : state;
+                    uint64_t endRow = rowGroupIndices ? (*rowGroupIndices)[state + 1] : state + 1;
+                    for (uint64_t row = firstRow; row < endRow; ++row) {
+                        for (auto const& entry : matrix.getRow(row)) {
+                            if (!storm::utility::isZero(entry.getValue()) && lastPredecessor[entry.getColumn()] != state) {
+                                lastPredecessor[entry.getColumn()] = state;
+                                ++predecessorIndications[entry.getColumn() + 1];
+                            }
+                        }
+                    }
+                }
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    predecessorIndications[state + 1] += predecessorIndications[state];
+                }
+
+                predecessors.resize(predecessorIndications.back());
+                std::vector<uint64_t> nextPosition(predecessorIndications.begin(), predecessorIndications.end() - 1);
+                std::fill(lastPredecessor.begin(), lastPredecessor.end(), NO_BUCKET);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    uint64_t firstRow = rowGroupIndices ? (*rowGroupIndices)[state] : state;
+                    uint64_t endRow = rowGroupIndices ? (*rowGroupIndices)[state + 1] : state + 1;
+                    for (uint64_t row = firstRow; row < endRow; ++row) {
+                        for (auto const& entry : matrix.getRow(row)) {
+                            if (storm::utility::isZero(entry.getValue())) {
+                                continue;
+                            }
+                            ValueType coefficient = storm::utility::abs<ValueType>(entry.getValue());
+                            if (lastPredecessor[entry.getColumn()] != state) {
+                                lastPredecessor[entry.getColumn()] = state;
+                                predecessors[nextPosition[entry.getColumn()]++] = std::make_pair(state, coefficient);
+                            } else {
+                                auto& predecessor = predecessors[nextPosition[entry.getColumn()] - 1];
+                                predecessor.second = std::max(predecessor.second, coefficient);
+                            }
+                        }
+                    }
+                }
+
+                residualBounds.assign(numberOfStates, storm::utility::zero<ValueType>());
+                bucketOfState.assign(numberOfStates, NO_BUCKET);
+                lastSweepOfState.assign(numberOfStates, 0);
+            }
+
+            template<typename ValueType>
+            bool PrioritizedGaussSeidelHelper<ValueType>::isCompatible(std::vector<uint64_t> const* rowGroupIndices) const {
+                return this->rowGroupIndices == rowGroupIndices;
+            }
+
+            template<typename ValueType>
+            void PrioritizedGaussSeidelHelper<ValueType>::performSweep(boost::optional<OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool continuePreviousSweep) {
+                STORM_LOG_ASSERT(x.size() == numberOfStates, "Vector has unexpected size.");
+                if (!continuePreviousSweep || !initialized || dir != lastDirection || b != lastOffsets) {
+                    STORM_LOG_TRACE("The sweep does not continue the previous one, all states are considered.");
+                    lastDirection = dir;
+                    lastOffsets = b;
+                    initializeQueue();
+                    initialized = true;
+                }
+
+                ++currentSweep;
+                uint64_t bucket = 0;
+                while (bucket < NUMBER_OF_BUCKETS) {
+                    if (buckets[bucket].empty()) {
+                        ++bucket;
+                        continue;
+                    }
+                    uint64_t state = buckets[bucket].back();
+                    buckets[bucket].pop_back();
+                    if (bucketOfState[state] != bucket) {
+                        // The state was moved to a bucket with a larger residual in the meantime.
+                        continue;
+                    }
+                    bucketOfState[state] = NO_BUCKET;
+                    lastSweepOfState[state] = currentSweep;
+                    residualBounds[state] = storm::utility::zero<ValueType>();
+
+                    ValueType newValue = computeValue(state, dir, x, b);
+                    ++numberOfUpdates;
+                    if (newValue == x[state]) {
+                        continue;
+                    }
+                    ValueType change = storm::utility::abs<ValueType>(newValue - x[state]);
+                    x[state] = newValue;
+
+                    // Propagate the change to the predecessors.
+                    for (uint64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+                        uint64_t predecessor = predecessors[index].first;
+                        residualBounds[predecessor] += predecessors[index].second * change;
+                        schedule(predecessor);
+                        bucket = std::min(bucket, bucketOfState[predecessor]);
+                    }
+                }
+
+                // States that became dirty after they were updated in this sweep are considered in the next sweep.
+                ++currentSweep;
+                for (auto const& state : deferredStates) {
+                    bucketOfState[state] = NO_BUCKET;
+                    schedule(state);
+                }
+                deferredStates.clear();
+            }
+
+            template<typename ValueType>
+            uint64_t PrioritizedGaussSeidelHelper<ValueType>::getNumberOfUpdates() const {
+                return numberOfUpdates;
+            }
+
+            template<typename ValueType>
+            void PrioritizedGaussSeidelHelper<ValueType>::initializeQueue() {
+                for (auto& bucket : buckets) {
+                    bucket.clear();
+                }
+                deferredStates.clear();
+                std::fill(residualBounds.begin(), residualBounds.end(), storm::utility::zero<ValueType>());
+
+                // Put all states in the first bucket such that they are processed in descending order (as in a regular
+                // backward Gauss-Seidel sweep).
+                buckets.front().resize(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    buckets.front()[state] = state;
+                }
+                std::fill(bucketOfState.begin(), bucketOfState.end(), 0);
+            }
+
+            template<typename ValueType>
+            uint64_t PrioritizedGaussSeidelHelper<ValueType>::getBucket(ValueType const& residualBound) const {
+                double value = storm::utility::convertNumber<double>(residualBound);
+                if (value >= 1.0) {
+                    return 0;
+                }
+                int exponent;
+                std::frexp(value, &exponent);
+                return std::min<uint64_t>(static_cast<uint64_t>(-exponent), NUMBER_OF_BUCKETS - 1);
+            }
+
+            template<typename ValueType>
+            void PrioritizedGaussSeidelHelper<ValueType>::schedule(uint64_t state) {
+                if (lastSweepOfState[state] == currentSweep) {
+                    if (bucketOfState[state] != DEFERRED) {
+                        bucketOfState[state] = DEFERRED;
+                        deferredStates.push_back(state);
+                    }
+                    return;
+                }
+                if (storm::utility::isZero(residualBounds[state])) {
+                    return;
+                }
+                uint64_t bucket = getBucket(residualBounds[state]);
+                if (bucket < bucketOfState[state]) {
+                    buckets[bucket].push_back(state);
+                    bucketOfState[state] = bucket;
+                }
+            }
+
+            template<typename ValueType>
+            ValueType PrioritizedGaussSeidelHelper<ValueType>::computeValue(uint64_t state, boost::optional<OptimizationDirection> const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b) const {
+                uint64_t firstRow = rowGroupIndices ? (*rowGroupIndices)[state] : state;
+                uint64_t endRow = rowGroupIndices ? (*rowGroupIndices)[state + 1] : state + 1;
+                if (firstRow == endRow) {
+                    return x[state];
+                }
+
+                ValueType result;
+                for (uint64_t row = firstRow; row < endRow; ++row) {
+                    ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto const& entry : matrix.getRow(row)) {
+                        value += entry.getValue() * x[entry.getColumn()];
+                    }
+                    if (row == firstRow || (minimize(dir.get()) ? value < result : value > result)) {
+                        result = std::move(value);
+                    }
+                }
+                return result;
+            }
+
+            template class PrioritizedGaussSeidelHelper<double>;
+            template class PrioritizedGaussSeidelHelper<storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Performs Gauss-Seidel style multiplications in which states are updated in the order of their (estimated)
+             * Bellman residual. For every state, an upper bound on its residual is maintained. Whenever the value of a
+             * state changes, the bounds of its predecessors are raised accordingly. A sweep then only updates the states
+             * whose bound is non-zero, processing them bucket by bucket from large to small residuals, such that large
+             * changes are propagated within the same sweep. States whose residual bound is zero are guaranteed to be
+             * fixed and are skipped.
+             *
+             * The residual bounds are only valid as long as the vectors are exclusively modified by this helper. Hence,
+             * the caller has to declare whether a sweep continues the previous one. Otherwise, all states are considered
+             * to be dirty.
+             */
+            template<typename ValueType>
+            class PrioritizedGaussSeidelHelper {
+            public:
+                /*!
+                 * Creates a helper for the given matrix.
+                 *
+                 * @param matrix The matrix A of the multiplications.
+                 * @param rowGroupIndices If given, the rows are grouped accordingly and the sweeps reduce over the groups.
+                 * Otherwise, every row is treated as a separate state.
+                 */
+                PrioritizedGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const* rowGroupIndices);
+
+                /*!
+                 * Checks whether this helper was created for the given grouping.
+                 */
+                bool isCompatible(std::vector<uint64_t> const* rowGroupIndices) const;
+
+                /*!
+                 * Performs one prioritized sweep x = A*x + b (followed by a reduction if the rows are grouped).
+                 *
+                 * @param dir If the rows are grouped, the direction of the reduction.
+                 * @param x The input/output vector.
+                 * @param b If non-null, this vector is added after the multiplication.
+                 * @param continuePreviousSweep If set, x has to be the unmodified result of the previous sweep and b has
+                 * to be unmodified. The residual bounds of the previous sweep are then reused, unless the direction or the
+                 * offset vector changed.
+                 */
+                void performSweep(boost::optional<OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool continuePreviousSweep);
+
+                /*!
+                 * Retrieves the number of state updates performed so far.
+                 */
+                uint64_t getNumberOfUpdates() const;
+
+            private:
+                void initializeQueue();
+                uint64_t getBucket(ValueType const& residualBound) const;
+                void schedule(uint64_t state);
+                ValueType computeValue(uint64_t state, boost::optional<OptimizationDirection> const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b) const;
+
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+                std::vector<uint64_t> const* rowGroupIndices;
+                uint64_t numberOfStates;
+
+                // The predecessors of each state together with the largest absolute coefficient of the state in a row of the predecessor.
+                std::vector<uint64_t> predecessorIndications;
+                std::vector<std::pair<uint64_t, ValueType>> predecessors;
+
+                // The residual bounds and the buckets of states (with lazy deletion), where lower buckets correspond to larger residuals.
+                std::vector<ValueType> residualBounds;
+                std::vector<std::vector<uint64_t>> buckets;
+                std::vector<uint64_t> bucketOfState;
+                std::vector<uint64_t> lastSweepOfState;
+                std::vector<uint64_t> deferredStates;
+                uint64_t currentSweep;
+
+                // The direction and the offsets of the previous sweep.
+                bool initialized;
+                boost::optional<OptimizationDirection> lastDirection;
+                std::vector<ValueType> const* lastOffsets;
+
+                uint64_t numberOfUpdates;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,208 @@
+#include "storm/solver/helper/SolverCheckpoint.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <type_traits>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/resources.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            // The identifier at the beginning of the file ("STORMCKP") and the version of the format.
+            static const uint64_t MAGIC_NUMBER = 0x504b434d524f5453ull;
+            static const uint64_t FORMAT_VERSION = 1;
+
+            template<typename ValueType>
+            static void writeValues(std::ofstream& stream, ValueType const* values, uint64_t count) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checkpoints are not supported for this value type.");
+            }
+
+            template<>
+            void writeValues(std::ofstream& stream, double const* values, uint64_t count) {
+                stream.write(reinterpret_cast<char const*>(values), count * sizeof(double));
+            }
+
+            template<typename ValueType>
+            static void readValues(std::ifstream& stream, ValueType* values, uint64_t count) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checkpoints are not supported for this value type.");
+            }
+
+            template<>
+            void readValues(std::ifstream& stream, double* values, uint64_t count) {
+                stream.read(reinterpret_cast<char*>(values), count * sizeof(double));
+            }
+
+            static void writeNumber(std::ofstream& stream, uint64_t value) {
+                stream.write(reinterpret_cast<char const*>(&value), sizeof(uint64_t));
+            }
+
+            static uint64_t readNumber(std::ifstream& stream) {
+                uint64_t value = 0;
+                stream.read(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+                return value;
+            }
+
+            template<typename ValueType>
+            SolverCheckpoint<ValueType>::SolverCheckpoint(Environment const& env, std::string const& identifier, std::function<std::size_t ()> const& computeFingerprint) : enabled(false), resume(env.solver().isResumeFromCheckpointSet()), identifier(identifier), fingerprint(0), interval(env.solver().getCheckpointInterval()), lastCheckpoint(std::chrono::steady_clock::now()) {
+                if (env.solver().getCheckpointFilename()) {
+                    if (std::is_floating_point<ValueType>::value) {
+                        enabled = true;
+                        fingerprint = computeFingerprint();
+                        std::stringstream stream;
+                        stream << env.solver().getCheckpointFilename().get() << "." << identifier << "-" << std::hex << std::setw(16) << std::setfill('0') << static_cast<uint64_t>(fingerprint);
+                        filename = stream.str();
+                        storm::utility::resources::deferTermination();
+                    } else {
+                        STORM_LOG_WARN("Checkpoints are not supported for the value type of the computation '" << identifier << "'.");
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            SolverCheckpoint<ValueType>::~SolverCheckpoint() {
+                if (enabled) {
+                    storm::utility::resources::allowTermination();
+                    if (int signal = storm::utility::resources::getDeferredTerminationSignal()) {
+                        storm::utility::resources::terminateAfterSignal(signal);
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            bool SolverCheckpoint<ValueType>::isEnabled() const {
+                return enabled;
+            }
+
+            template<typename ValueType>
+            std::string const& SolverCheckpoint<ValueType>::getFilename() const {
+                return filename;
+            }
+
+            template<typename ValueType>
+            boost::optional<uint64_t> SolverCheckpoint<ValueType>::restore(std::vector<std::vector<ValueType>*> const& vectors, std::vector<ValueType*> const& scalars) const {
+                if (!enabled || !resume) {
+                    return boost::none;
+                }
+                std::ifstream stream(filename, std::ios::binary);
+                if (!stream) {
+                    STORM_LOG_INFO("No checkpoint file " << filename << " found. Starting the computation '" << identifier << "' from scratch.");
+                    return boost::none;
+                }
+
+                // Only restore checkpoints of the same computation.
+                if (readNumber(stream) != MAGIC_NUMBER || readNumber(stream) != FORMAT_VERSION) {
+                    STORM_LOG_WARN("The file " << filename << " does not contain a checkpoint. Starting the computation '" << identifier << "' from scratch.");
+                    return boost::none;
+                }
+                uint64_t storedFingerprint = readNumber(stream);
+                std::string storedIdentifier(readNumber(stream), ' ');
+                stream.read(&storedIdentifier[0], storedIdentifier.size());
+                if (!stream || storedFingerprint != fingerprint || storedIdentifier != identifier) {
+                    STORM_LOG_INFO("The checkpoint in " << filename << " stems from a different computation. Starting the computation '" << identifier << "' from scratch.");
+                    return boost::none;
+                }
+
+                // Read everything before overwriting the given values.
+                uint64_t iteration = readNumber(stream);
+                std::vector<std::vector<ValueType>> storedVectors;
+                bool matches = readNumber(stream) == vectors.size();
+                for (uint64_t index = 0; matches && index < vectors.size(); ++index) {
+                    uint64_t size = readNumber(stream);
+                    matches = stream && size == vectors[index]->size();
+                    if (matches) {
+                        storedVectors.emplace_back(size);
+                        readValues(stream, storedVectors.back().data(), size);
+                    }
+                }
+                std::vector<ValueType> storedScalars;
+                if (matches && readNumber(stream) == scalars.size()) {
+                    storedScalars.resize(scalars.size());
+                    readValues(stream, storedScalars.data(), scalars.size());
+                } else {
+                    matches = false;
+                }
+                if (!matches || !stream) {
+                    STORM_LOG_WARN("The checkpoint in " << filename << " is corrupted or does not match the dimensions of the computation. Starting the computation '" << identifier << "' from scratch.");
+                    return boost::none;
+                }
+
+                for (uint64_t index = 0; index < vectors.size(); ++index) {
+                    *vectors[index] = std::move(storedVectors[index]);
+                }
+                for (uint64_t index = 0; index < scalars.size(); ++index) {
+                    *scalars[index] = std::move(storedScalars[index]);
+                }
+                STORM_LOG_INFO("Resuming the computation '" << identifier << "' from the checkpoint of iteration " << iteration << ".");
+                return iteration;
+            }
+
+            template<typename ValueType>
+            bool SolverCheckpoint<ValueType>::update(uint64_t iteration, std::vector<std::vector<ValueType> const*> const& vectors, std::vector<ValueType> const& scalars) {
+                if (!enabled) {
+                    return false;
+                }
+                if (int signal = storm::utility::resources::getDeferredTerminationSignal()) {
+                    write(iteration, vectors, scalars);
+                    STORM_PRINT_AND_LOG("Saved the computation '" << identifier << "' to " << filename << " before terminating. Use --resume to continue it." << std::endl);
+                    enabled = false;
+                    storm::utility::resources::allowTermination();
+                    storm::utility::resources::terminateAfterSignal(signal);
+                }
+                if (std::chrono::steady_clock::now() - lastCheckpoint < interval) {
+                    return false;
+                }
+                write(iteration, vectors, scalars);
+                return true;
+            }
+
+            template<typename ValueType>
+            void SolverCheckpoint<ValueType>::write(uint64_t iteration, std::vector<std::vector<ValueType> const*> const& vectors, std::vector<ValueType> const& scalars) {
+                if (!enabled) {
+                    return;
+                }
+
+                // Write to a temporary file first, such that the previous checkpoint survives an interruption.
+                std::string temporaryFilename = filename + ".tmp";
+                {
+                    std::ofstream stream(temporaryFilename, std::ios::binary | std::ios::trunc);
+                    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open checkpoint file " << temporaryFilename << ".");
+                    writeNumber(stream, MAGIC_NUMBER);
+                    writeNumber(stream, FORMAT_VERSION);
+                    writeNumber(stream, fingerprint);
+                    writeNumber(stream, identifier.size());
+                    stream.write(identifier.data(), identifier.size());
+                    writeNumber(stream, iteration);
+                    writeNumber(stream, vectors.size());
+                    for (auto const& vector : vectors) {
+                        writeNumber(stream, vector->size());
+                        writeValues(stream, vector->data(), vector->size());
+                    }
+                    writeNumber(stream, scalars.size());
+                    writeValues(stream, scalars.data(), scalars.size());
+                    stream.flush();
+                    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write checkpoint file " << temporaryFilename << ".");
+                }
+                STORM_LOG_THROW(std::rename(temporaryFilename.c_str(), filename.c_str()) == 0, storm::exceptions::FileIoException, "Could not move checkpoint to " << filename << ".");
+
+                lastCheckpoint = std::chrono::steady_clock::now();
+                STORM_LOG_INFO("Wrote checkpoint of iteration " << iteration << " of the computation '" << identifier << "' to " << filename << ".");
+            }
+
+            template class SolverCheckpoint<double>;
+            template class SolverCheckpoint<storm::RationalNumber>;
+
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+    class Environment;
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Periodically writes the state of a long-running iterative computation (the iteration counter, a number
+             * of vectors and scalars) to a checkpoint file, such that the computation can be resumed after it was
+             * interrupted.
+             *
+             * Each checkpoint is tagged with an identifier of the computation and a fingerprint of its input (e.g. a
+             * hash over the matrix and the vectors). A checkpoint is only restored if both match. The name of the file
+             * consists of the checkpoint prefix given in the environment, the identifier and the fingerprint, so the
+             * checkpoints of subsequent computations (e.g. the solvers of the SCCs of a model) do not overwrite each
+             * other. The file is written atomically, i.e. an interruption while writing a checkpoint does not destroy
+             * the previous one.
+             *
+             * While checkpoints are written, the termination of the process upon a timeout, SIGTERM or SIGINT is
+             * deferred to the next update, which writes a final checkpoint before terminating.
+             *
+             * Checkpoints are only supported for floating point values. For other value types, the helper is disabled.
+             */
+            template<typename ValueType>
+            class SolverCheckpoint {
+            public:
+                /*!
+                 * Creates the helper.
+                 *
+                 * @param env The environment that specifies the checkpoint file and interval.
+                 * @param identifier The identifier of the computation.
+                 * @param computeFingerprint A function that computes a fingerprint of the input of the computation. It
+                 * is only invoked if checkpointing is enabled.
+                 */
+                SolverCheckpoint(Environment const& env, std::string const& identifier, std::function<std::size_t ()> const& computeFingerprint);
+
+                SolverCheckpoint(SolverCheckpoint const& other) = delete;
+                SolverCheckpoint& operator=(SolverCheckpoint const& other) = delete;
+
+                /*!
+                 * Terminates the process if this was requested after the last update.
+                 */
+                ~SolverCheckpoint();
+
+                /*!
+                 * Retrieves whether checkpoints are written.
+                 */
+                bool isEnabled() const;
+
+                /*!
+                 * Retrieves the name of the file to which the checkpoints of this computation are written.
+                 */
+                std::string const& getFilename() const;
+
+                /*!
+                 * If resuming is enabled and the checkpoint file contains a checkpoint of this computation, the given
+                 * vectors and scalars are overwritten with the ones of the checkpoint.
+                 *
+                 * @param vectors The vectors to restore. Their sizes have to match the stored ones.
+                 * @param scalars The scalars to restore.
+                 * @return The iteration of the checkpoint, if one was restored.
+                 */
+                boost::optional<uint64_t> restore(std::vector<std::vector<ValueType>*> const& vectors, std::vector<ValueType*> const& scalars = {}) const;
+
+                /*!
+                 * Writes a checkpoint if the checkpoint interval has passed since the last one (or since the creation of
+                 * this helper). This only involves a check of the clock otherwise, so it can be called in every iteration.
+                 * If the process was asked to terminate in the meantime, the checkpoint is written and the process is
+                 * terminated.
+                 *
+                 * @return True iff a checkpoint was written.
+                 */
+                bool update(uint64_t iteration, std::vector<std::vector<ValueType> const*> const& vectors, std::vector<ValueType> const& scalars = {});
+
+                /*!
+                 * Writes a checkpoint regardless of the time of the last one.
+                 */
+                void write(uint64_t iteration, std::vector<std::vector<ValueType> const*> const& vectors, std::vector<ValueType> const& scalars = {});
+
+            private:
+                bool enabled;
+                bool resume;
+                std::string filename;
+                std::string identifier;
+                std::size_t fingerprint;
+                std::chrono::seconds interval;
+                std::chrono::steady_clock::time_point lastCheckpoint;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,210 @@
+#include "storm/solver/helper/SparsePreconditioner.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+#ifdef STORM_HAVE_INTELTBB
+            // Levels with fewer rows are processed sequentially, because the overhead of parallelization would dominate.
+            static const uint64_t MINIMAL_PARALLEL_LEVEL_SIZE = 1024;
+#endif
+
+            template<typename ValueType>
+            SparsePreconditioner<ValueType>::SparsePreconditioner(storm::storage::SparseMatrix<ValueType> const& A, NativeLinearEquationSolverPreconditioner const& type, uint64_t blockSize, bool parallel) : identity(type == NativeLinearEquationSolverPreconditioner::None), parallel(parallel) {
+                STORM_LOG_THROW(A.getRowCount() == A.getColumnCount(), storm::exceptions::InvalidArgumentException, "Unable to precondition non-square matrix.");
+                if (identity) {
+                    return;
+                }
+
+                computePattern(A, type, blockSize);
+                computeLevels();
+
+                // Factorize the rows level by level. Within a level, rows only depend on rows of previous levels.
+                for (uint64_t level = 0; level + 1 < lowerLevelIndications.size(); ++level) {
+                    forEachRowOfLevel(lowerLevelIndications, lowerLevelRows, level, [this] (uint64_t row) { this->factorizeRow(row); });
+                }
+                for (uint64_t row = 0; row < diagonalPositions.size(); ++row) {
+                    STORM_LOG_THROW(!storm::utility::isZero(values[diagonalPositions[row]]), storm::exceptions::InvalidArgumentException, "Zero pivot in row " << row << " of the incomplete LU factorization. Please select a different preconditioner.");
+                }
+
+                STORM_LOG_DEBUG("Computed preconditioner with " << values.size() << " entries, " << (lowerLevelIndications.size() - 1) << " forward and " << (upperLevelIndications.size() - 1) << " backward substitution levels.");
+            }
+
+            template<typename ValueType>
+            void SparsePreconditioner<ValueType>::apply(std::vector<ValueType> const& vector, std::vector<ValueType>& target) const {
+                STORM_LOG_ASSERT(&vector != &target, "Preconditioning must not be performed in-place.");
+                if (identity) {
+                    target = vector;
+                    return;
+                }
+                target.resize(vector.size());
+
+                // Solve L*y = vector.
+                for (uint64_t level = 0; level + 1 < lowerLevelIndications.size(); ++level) {
+                    forEachRowOfLevel(lowerLevelIndications, lowerLevelRows, level, [&] (uint64_t row) {
+                        ValueType value = vector[row];
+                        for (uint64_t position = rowIndications[row]; position < diagonalPositions[row]; ++position) {
+                            value -= values[position] * target[columns[position]];
+                        }
+                        target[row] = std::move(value);
+                    });
+                }
+
+                // Solve U*target = y.
+                for (uint64_t level = 0; level + 1 < upperLevelIndications.size(); ++level) {
+                    forEachRowOfLevel(upperLevelIndications, upperLevelRows, level, [&] (uint64_t row) {
+                        ValueType value = target[row];
+                        for (uint64_t position = diagonalPositions[row] + 1; position < rowIndications[row + 1]; ++position) {
+                            value -= values[position] * target[columns[position]];
+                        }
+                        target[row] = value / values[diagonalPositions[row]];
+                    });
+                }
+            }
+
+            template<typename ValueType>
+            std::pair<uint64_t, uint64_t> SparsePreconditioner<ValueType>::getNumberOfLevels() const {
+                if (identity) {
+                    return std::make_pair(0, 0);
+                }
+                return std::make_pair(lowerLevelIndications.size() - 1, upperLevelIndications.size() - 1);
+            }
+
+            template<typename ValueType>
+            void SparsePreconditioner<ValueType>::computePattern(storm::storage::SparseMatrix<ValueType> const& A, NativeLinearEquationSolverPreconditioner const& type, uint64_t blockSize) {
+                uint64_t numberOfRows = A.getRowCount();
+                STORM_LOG_ASSERT(type != NativeLinearEquationSolverPreconditioner::BlockJacobi || blockSize > 0, "Illegal block size.");
+
+                rowIndications.reserve(numberOfRows + 1);
+                diagonalPositions.reserve(numberOfRows);
+                rowIndications.push_back(0);
+                for (uint64_t row = 0; row < numberOfRows; ++row) {
+                    bool foundDiagonal = false;
+                    for (auto const& entry : A.getRow(row)) {
+                        uint64_t column = entry.getColumn();
+                        bool keep;
+                        switch (type) {
+                            case NativeLinearEquationSolverPreconditioner::Ilu:
+                                keep = true;
+                                break;
+                            case NativeLinearEquationSolverPreconditioner::BlockJacobi:
+                                keep = row / blockSize == column / blockSize;
+                                break;
+                            default:
+                                keep = row == column;
+                                break;
+                        }
+                        if (column == row) {
+                            diagonalPositions.push_back(columns.size());
+                            foundDiagonal = true;
+                        } else if (!keep || storm::utility::isZero(entry.getValue())) {
+                            continue;
+                        }
+                        columns.push_back(column);
+                        values.push_back(entry.getValue());
+                    }
+                    STORM_LOG_THROW(foundDiagonal, storm::exceptions::InvalidArgumentException, "Unable to precondition matrix without diagonal entry in row " << row << ".");
+                    rowIndications.push_back(columns.size());
+                }
+            }
+
+            template<typename ValueType>
+            void SparsePreconditioner<ValueType>::computeLevels() {
+                uint64_t numberOfRows = diagonalPositions.size();
+
+                // Sorts the rows by their level (counting sort).
+                auto groupByLevel = [numberOfRows] (std::vector<uint64_t> const& levelOfRow, std::vector<uint64_t>& levelIndications, std::vector<uint64_t>& rowsOfLevels) {
+                    uint64_t numberOfLevels = 0;
+                    for (auto const& level : levelOfRow) {
+                        numberOfLevels = std::max(numberOfLevels, level + 1);
+                    }
+                    levelIndications.assign(numberOfLevels + 1, 0);
+                    for (auto const& level : levelOfRow) {
+                        ++levelIndications[level + 1];
+                    }
+                    for (uint64_t level = 0; level < numberOfLevels; ++level) {
+                        levelIndications[level + 1] += levelIndications[level];
+                    }
+                    rowsOfLevels.resize(numberOfRows);
+                    std::vector<uint64_t> nextPosition(levelIndications.begin(), levelIndications.end() - 1);
+                    for (uint64_t row = 0; row < numberOfRows; ++row) {
+                        rowsOfLevels[nextPosition[levelOfRow[row]]++] = row;
+                    }
+                };
+
+                std::vector<uint64_t> levelOfRow(numberOfRows, 0);
+                for (uint64_t row = 0; row < numberOfRows; ++row) {
+                    for (uint64_t position = rowIndications[row]; position < diagonalPositions[row]; ++position) {
+                        levelOfRow[row] = std::max(levelOfRow[row], levelOfRow[columns[position]] + 1);
+                    }
+                }
+                groupByLevel(levelOfRow, lowerLevelIndications, lowerLevelRows);
+
+                std::fill(levelOfRow.begin(), levelOfRow.end(), 0);
+                for (uint64_t row = numberOfRows; row > 0; --row) {
+                    uint64_t currentRow = row - 1;
+                    for (uint64_t position = diagonalPositions[currentRow] + 1; position < rowIndications[row]; ++position) {
+                        levelOfRow[currentRow] = std::max(levelOfRow[currentRow], levelOfRow[columns[position]] + 1);
+                    }
+                }
+                groupByLevel(levelOfRow, upperLevelIndications, upperLevelRows);
+            }
+
+            template<typename ValueType>
+            void SparsePreconditioner<ValueType>::factorizeRow(uint64_t row) {
+                // The IKJ variant of the incomplete LU factorization, where updates outside the pattern are dropped.
+                for (uint64_t position = rowIndications[row]; position < diagonalPositions[row]; ++position) {
+                    uint64_t pivotRow = columns[position];
+                    values[position] /= values[diagonalPositions[pivotRow]];
+                    ValueType const& factor = values[position];
+
+                    // Merge the remainder of the row with the upper part of the pivot row.
+                    uint64_t rowPosition = position + 1;
+                    uint64_t pivotPosition = diagonalPositions[pivotRow] + 1;
+                    while (rowPosition < rowIndications[row + 1] && pivotPosition < rowIndications[pivotRow + 1]) {
+                        if (columns[rowPosition] < columns[pivotPosition]) {
+                            ++rowPosition;
+                        } else if (columns[rowPosition] > columns[pivotPosition]) {
+                            ++pivotPosition;
+                        } else {
+                            values[rowPosition] -= factor * values[pivotPosition];
+                            ++rowPosition;
+                            ++pivotPosition;
+                        }
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            void SparsePreconditioner<ValueType>::forEachRowOfLevel(std::vector<uint64_t> const& levelIndications, std::vector<uint64_t> const& rowsOfLevels, uint64_t level, std::function<void (uint64_t)> const& function) const {
+                uint64_t first = levelIndications[level];
+                uint64_t end = levelIndications[level + 1];
+#ifdef STORM_HAVE_INTELTBB
+                if (parallel && end - first >= MINIMAL_PARALLEL_LEVEL_SIZE) {
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(first, end, 256), [&] (tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                            function(rowsOfLevels[index]);
+                        }
+                    });
+                    return;
+                }
+#endif
+                for (uint64_t index = first; index < end; ++index) {
+                    function(rowsOfLevels[index]);
+                }
+            }
+
+            template class SparsePreconditioner<double>;
+            template class SparsePreconditioner<storm::RationalNumber>;
+        }
+    }
+}
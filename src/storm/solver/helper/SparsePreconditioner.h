@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * A preconditioner M for a square sparse matrix A that is directly computed on storm's matrix format.
+             *
+             * All supported preconditioners are incomplete LU factorizations without fill-in (ILU(0)) that only differ
+             * in the part of the sparsity pattern of A that is retained: the full pattern (ILU), the entries within
+             * blocks of consecutive rows and columns (block-Jacobi with ILU(0) factorized blocks) or only the diagonal.
+             * Both the factorization and the triangular solves are organized by level scheduling, i.e. rows that do not
+             * depend on each other are grouped into levels that can be processed in parallel.
+             */
+            template<typename ValueType>
+            class SparsePreconditioner {
+            public:
+                /*!
+                 * Computes the preconditioner for the given matrix.
+                 *
+                 * @param A The (square) matrix to precondition. Its diagonal entries need to be non-zero.
+                 * @param type The type of the preconditioner.
+                 * @param blockSize For block-Jacobi preconditioning, the number of rows per block.
+                 * @param parallel If set, levels are processed in parallel (if storm was built with support for Intel TBB).
+                 */
+                SparsePreconditioner(storm::storage::SparseMatrix<ValueType> const& A, NativeLinearEquationSolverPreconditioner const& type, uint64_t blockSize, bool parallel);
+
+                /*!
+                 * Computes target = M^-1 * vector.
+                 */
+                void apply(std::vector<ValueType> const& vector, std::vector<ValueType>& target) const;
+
+                /*!
+                 * Retrieves the number of levels of the forward and backward substitution, respectively.
+                 */
+                std::pair<uint64_t, uint64_t> getNumberOfLevels() const;
+
+            private:
+                void computePattern(storm::storage::SparseMatrix<ValueType> const& A, NativeLinearEquationSolverPreconditioner const& type, uint64_t blockSize);
+                void computeLevels();
+                void factorizeRow(uint64_t row);
+                void forEachRowOfLevel(std::vector<uint64_t> const& levelIndications, std::vector<uint64_t> const& rowsOfLevels, uint64_t level, std::function<void (uint64_t)> const& function) const;
+
+                bool identity;
+                bool parallel;
+
+                // The factors L and U (where L has an implicit unit diagonal) stored in one row-major structure.
+                std::vector<uint64_t> rowIndications;
+                std::vector<uint64_t> columns;
+                std::vector<ValueType> values;
+                std::vector<uint64_t> diagonalPositions;
+
+                // The rows of the forward (lower) and backward (upper) substitution grouped by their level.
+                std::vector<uint64_t> lowerLevelIndications;
+                std::vector<uint64_t> lowerLevelRows;
+                std::vector<uint64_t> upperLevelIndications;
+                std::vector<uint64_t> upperLevelRows;
+            };
+
+        }
+    }
+}
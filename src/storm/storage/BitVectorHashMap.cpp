@@ -71,6 +71,11 @@ namespace storm {
             return 1ull << currentSize;
         }
         
+        template<class ValueType, class Hash>
+        uint64_t BitVectorHashMap<ValueType, Hash>::getMemoryUsage() const {
+            return sizeof(*this) - sizeof(buckets) - sizeof(occupied) + buckets.getSizeInBytes() + occupied.getSizeInBytes() + values.capacity() * sizeof(ValueType);
+        }
+        
         template<class ValueType, class Hash>
         void BitVectorHashMap<ValueType, Hash>::increaseSize() {
             ++currentSize;
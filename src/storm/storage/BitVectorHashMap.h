@@ -145,6 +145,13 @@ namespace storm {
              */
             uint64_t capacity() const;
             
+            /*!
+             * Retrieves an estimate of the number of bytes occupied by this map.
+             *
+             * @return The number of bytes occupied by this map.
+             */
+            uint64_t getMemoryUsage() const;
+            
             /*!
              * Performs a remapping of all values stored by applying the given remapping.
              *
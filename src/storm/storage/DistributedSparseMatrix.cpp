@@ -0,0 +1,282 @@
+#include "storm/storage/DistributedSparseMatrix.h"
+
+#ifdef STORM_HAVE_MPI
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/mpi.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace storage {
+
+        // The tag of the messages of the halo exchange.
+        static const int HALO_EXCHANGE_TAG = 4711;
+
+        template<typename ValueType>
+        static MPI_Datatype getMpiDatatype();
+
+        template<>
+        MPI_Datatype getMpiDatatype<double>() {
+            return MPI_DOUBLE;
+        }
+
+        template<typename ValueType>
+        DistributedSparseMatrix<ValueType>::DistributedSparseMatrix(MPI_Comm communicator, SparseMatrix<ValueType> const& localRows, std::vector<uint64_t> const& stateOffsets) : communicator(communicator), stateOffsets(stateOffsets) {
+            storm::utility::mpi::initialize();
+            int numberOfRanks = 0;
+            MPI_Comm_rank(communicator, &rank);
+            MPI_Comm_size(communicator, &numberOfRanks);
+            STORM_LOG_THROW(stateOffsets.size() == static_cast<uint64_t>(numberOfRanks) + 1, storm::exceptions::InvalidArgumentException, "Expected " << (numberOfRanks + 1) << " state offsets, but got " << stateOffsets.size() << ".");
+            uint64_t firstState = getFirstLocalState();
+            uint64_t endState = firstState + getNumberOfLocalStates();
+            STORM_LOG_THROW(localRows.getRowGroupCount() == endState - firstState, storm::exceptions::InvalidArgumentException, "The local rows have " << localRows.getRowGroupCount() << " row groups, but rank " << rank << " owns " << (endState - firstState) << " states.");
+
+            // Determine the global index of the first owned row.
+            uint64_t localRowCount = localRows.getRowCount();
+            firstLocalRow = 0;
+            MPI_Exscan(&localRowCount, &firstLocalRow, 1, MPI_UINT64_T, MPI_SUM, communicator);
+            if (rank == 0) {
+                // The result of the exclusive scan is undefined on the first rank.
+                firstLocalRow = 0;
+            }
+
+            // Collect the ghost states, i.e. the columns that are owned by other ranks.
+            for (auto const& entry : localRows) {
+                uint64_t column = entry.getColumn();
+                STORM_LOG_THROW(column < getNumberOfStates(), storm::exceptions::InvalidArgumentException, "Column " << column << " exceeds the number of states.");
+                if (column < firstState || column >= endState) {
+                    ghostStates.push_back(column);
+                }
+            }
+            std::sort(ghostStates.begin(), ghostStates.end());
+            ghostStates.erase(std::unique(ghostStates.begin(), ghostStates.end()), ghostStates.end());
+
+            // Build the local matrix with renumbered columns.
+            uint64_t numberOfLocalStates = endState - firstState;
+            SparseMatrixBuilder<ValueType> builder(localRowCount, numberOfLocalStates + ghostStates.size(), localRows.getEntryCount(), true, true, numberOfLocalStates);
+            for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+                builder.newRowGroup(localRows.getRowGroupIndices()[state]);
+                for (uint64_t row = localRows.getRowGroupIndices()[state]; row < localRows.getRowGroupIndices()[state + 1]; ++row) {
+                    // The entries of a row remain sorted, because ghost states are sorted and placed behind the owned ones.
+                    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+                    for (auto const& entry : localRows.getRow(row)) {
+                        uint64_t column = entry.getColumn();
+                        if (column >= firstState && column < endState) {
+                            rowEntries.emplace_back(column - firstState, entry.getValue());
+                        } else {
+                            rowEntries.emplace_back(numberOfLocalStates + (std::lower_bound(ghostStates.begin(), ghostStates.end(), column) - ghostStates.begin()), entry.getValue());
+                        }
+                    }
+                    std::sort(rowEntries.begin(), rowEntries.end(), [] (std::pair<uint64_t, ValueType> const& a, std::pair<uint64_t, ValueType> const& b) { return a.first < b.first; });
+                    for (auto const& entry : rowEntries) {
+                        builder.addNextValue(row, entry.first, entry.second);
+                    }
+                }
+            }
+            localMatrix = builder.build();
+
+            // As the ghost states are sorted, the ghost states of each owner form a contiguous range.
+            std::vector<int> requestCounts(numberOfRanks, 0);
+            for (auto ghostIt = ghostStates.begin(); ghostIt != ghostStates.end();) {
+                int owner = static_cast<int>(std::upper_bound(stateOffsets.begin(), stateOffsets.end(), *ghostIt) - stateOffsets.begin()) - 1;
+                auto rangeEnd = std::lower_bound(ghostIt, ghostStates.end(), stateOffsets[owner + 1]);
+                STORM_LOG_THROW(static_cast<uint64_t>(rangeEnd - ghostIt) <= static_cast<uint64_t>(std::numeric_limits<int>::max()), storm::exceptions::UnexpectedException, "Too many ghost states for a single halo exchange.");
+                requestCounts[owner] = static_cast<int>(rangeEnd - ghostIt);
+                receiveRanks.push_back(owner);
+                receiveOffsets.push_back(ghostIt - ghostStates.begin());
+                ghostIt = rangeEnd;
+            }
+            receiveOffsets.push_back(ghostStates.size());
+
+            // Tell every owner which of its states are needed.
+            std::vector<int> requestedCounts(numberOfRanks, 0);
+            MPI_Alltoall(requestCounts.data(), 1, MPI_INT, requestedCounts.data(), 1, MPI_INT, communicator);
+            std::vector<int> requestDisplacements(numberOfRanks, 0);
+            std::vector<int> requestedDisplacements(numberOfRanks, 0);
+            for (int otherRank = 1; otherRank < numberOfRanks; ++otherRank) {
+                requestDisplacements[otherRank] = requestDisplacements[otherRank - 1] + requestCounts[otherRank - 1];
+                requestedDisplacements[otherRank] = requestedDisplacements[otherRank - 1] + requestedCounts[otherRank - 1];
+            }
+            sendStates.resize(requestedDisplacements.back() + requestedCounts.back());
+            MPI_Alltoallv(ghostStates.data(), requestCounts.data(), requestDisplacements.data(), MPI_UINT64_T, sendStates.data(), requestedCounts.data(), requestedDisplacements.data(), MPI_UINT64_T, communicator);
+            for (int otherRank = 0; otherRank < numberOfRanks; ++otherRank) {
+                if (requestedCounts[otherRank] > 0) {
+                    sendRanks.push_back(otherRank);
+                    sendOffsets.push_back(requestedDisplacements[otherRank]);
+                }
+            }
+            sendOffsets.push_back(sendStates.size());
+            for (auto& state : sendStates) {
+                STORM_LOG_ASSERT(state >= firstState && state < endState, "Requested state " << state << " is not owned by rank " << rank << ".");
+                state -= firstState;
+            }
+            sendBuffer.resize(sendStates.size());
+
+            STORM_LOG_DEBUG("Rank " << rank << " owns " << numberOfLocalStates << " states with " << localMatrix.getEntryCount() << " entries, receives " << ghostStates.size() << " ghost values from " << receiveRanks.size() << " ranks and sends " << sendStates.size() << " values to " << sendRanks.size() << " ranks.");
+        }
+
+        template<typename ValueType>
+        DistributedSparseMatrix<ValueType> DistributedSparseMatrix<ValueType>::distribute(MPI_Comm communicator, SparseMatrix<ValueType> const& matrix) {
+            storm::utility::mpi::initialize();
+            int rank = 0;
+            int numberOfRanks = 0;
+            MPI_Comm_rank(communicator, &rank);
+            MPI_Comm_size(communicator, &numberOfRanks);
+            STORM_LOG_THROW(matrix.getRowGroupCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException, "Only matrices with one row group per column can be distributed.");
+
+            std::vector<uint64_t> stateOffsets = computeBalancedPartition(matrix, numberOfRanks);
+            uint64_t firstRow = matrix.getRowGroupIndices()[stateOffsets[rank]];
+            uint64_t endRow = matrix.getRowGroupIndices()[stateOffsets[rank + 1]];
+            uint64_t numberOfEntries = 0;
+            for (uint64_t row = firstRow; row < endRow; ++row) {
+                numberOfEntries += matrix.getRow(row).getNumberOfEntries();
+            }
+
+            SparseMatrixBuilder<ValueType> builder(endRow - firstRow, matrix.getColumnCount(), numberOfEntries, true, true, stateOffsets[rank + 1] - stateOffsets[rank]);
+            for (uint64_t state = stateOffsets[rank]; state < stateOffsets[rank + 1]; ++state) {
+                builder.newRowGroup(matrix.getRowGroupIndices()[state] - firstRow);
+                for (uint64_t row = matrix.getRowGroupIndices()[state]; row < matrix.getRowGroupIndices()[state + 1]; ++row) {
+                    for (auto const& entry : matrix.getRow(row)) {
+                        builder.addNextValue(row - firstRow, entry.getColumn(), entry.getValue());
+                    }
+                }
+            }
+            return DistributedSparseMatrix<ValueType>(communicator, builder.build(), stateOffsets);
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> DistributedSparseMatrix<ValueType>::computeBalancedPartition(SparseMatrix<ValueType> const& matrix, uint64_t numberOfParts) {
+            STORM_LOG_ASSERT(numberOfParts > 0, "Illegal number of parts.");
+            std::vector<uint64_t> offsets;
+            offsets.reserve(numberOfParts + 1);
+            offsets.push_back(0);
+
+            // Assign each part its share of the entries, but at least one row group per part (if possible).
+            uint64_t numberOfGroups = matrix.getRowGroupCount();
+            uint64_t assignedEntries = 0;
+            uint64_t group = 0;
+            for (uint64_t part = 1; part < numberOfParts; ++part) {
+                uint64_t targetEntries = (matrix.getEntryCount() * part) / numberOfParts;
+                while (group < numberOfGroups && (assignedEntries < targetEntries || group == offsets.back())) {
+                    for (uint64_t row = matrix.getRowGroupIndices()[group]; row < matrix.getRowGroupIndices()[group + 1]; ++row) {
+                        assignedEntries += matrix.getRow(row).getNumberOfEntries();
+                    }
+                    ++group;
+                }
+                // Keep enough row groups for the remaining parts.
+                group = std::min(group, numberOfGroups - std::min(numberOfGroups, numberOfParts - part));
+                group = std::max(group, offsets.back());
+                offsets.push_back(group);
+            }
+            offsets.push_back(numberOfGroups);
+            return offsets;
+        }
+
+        template<typename ValueType>
+        MPI_Comm DistributedSparseMatrix<ValueType>::getCommunicator() const {
+            return communicator;
+        }
+
+        template<typename ValueType>
+        uint64_t DistributedSparseMatrix<ValueType>::getNumberOfStates() const {
+            return stateOffsets.back();
+        }
+
+        template<typename ValueType>
+        uint64_t DistributedSparseMatrix<ValueType>::getFirstLocalState() const {
+            return stateOffsets[rank];
+        }
+
+        template<typename ValueType>
+        uint64_t DistributedSparseMatrix<ValueType>::getNumberOfLocalStates() const {
+            return stateOffsets[rank + 1] - stateOffsets[rank];
+        }
+
+        template<typename ValueType>
+        uint64_t DistributedSparseMatrix<ValueType>::getNumberOfGhostStates() const {
+            return ghostStates.size();
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& DistributedSparseMatrix<ValueType>::getStateOffsets() const {
+            return stateOffsets;
+        }
+
+        template<typename ValueType>
+        uint64_t DistributedSparseMatrix<ValueType>::getFirstLocalRow() const {
+            return firstLocalRow;
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> const& DistributedSparseMatrix<ValueType>::getLocalMatrix() const {
+            return localMatrix;
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& DistributedSparseMatrix<ValueType>::getGhostStates() const {
+            return ghostStates;
+        }
+
+        template<typename ValueType>
+        uint64_t DistributedSparseMatrix<ValueType>::getNumberOfNeighbors() const {
+            return receiveRanks.size();
+        }
+
+        template<typename ValueType>
+        void DistributedSparseMatrix<ValueType>::exchangeHalo(std::vector<ValueType>& x) const {
+            uint64_t numberOfLocalStates = getNumberOfLocalStates();
+            STORM_LOG_ASSERT(x.size() == numberOfLocalStates + ghostStates.size(), "Vector has illegal size.");
+            MPI_Datatype datatype = getMpiDatatype<ValueType>();
+
+            std::vector<MPI_Request> requests;
+            requests.reserve(receiveRanks.size() + sendRanks.size());
+            for (uint64_t index = 0; index < receiveRanks.size(); ++index) {
+                requests.emplace_back();
+                MPI_Irecv(x.data() + numberOfLocalStates + receiveOffsets[index], static_cast<int>(receiveOffsets[index + 1] - receiveOffsets[index]), datatype, receiveRanks[index], HALO_EXCHANGE_TAG, communicator, &requests.back());
+            }
+            for (uint64_t index = 0; index < sendStates.size(); ++index) {
+                sendBuffer[index] = x[sendStates[index]];
+            }
+            for (uint64_t index = 0; index < sendRanks.size(); ++index) {
+                requests.emplace_back();
+                MPI_Isend(sendBuffer.data() + sendOffsets[index], static_cast<int>(sendOffsets[index + 1] - sendOffsets[index]), datatype, sendRanks[index], HALO_EXCHANGE_TAG, communicator, &requests.back());
+            }
+            MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> DistributedSparseMatrix<ValueType>::getLocalStateValues(std::vector<ValueType> const& globalValues) const {
+            STORM_LOG_ASSERT(globalValues.size() == getNumberOfStates(), "Vector has illegal size.");
+            return std::vector<ValueType>(globalValues.begin() + getFirstLocalState(), globalValues.begin() + getFirstLocalState() + getNumberOfLocalStates());
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> DistributedSparseMatrix<ValueType>::getLocalRowValues(std::vector<ValueType> const& globalValues) const {
+            STORM_LOG_ASSERT(globalValues.size() >= firstLocalRow + localMatrix.getRowCount(), "Vector has illegal size.");
+            return std::vector<ValueType>(globalValues.begin() + firstLocalRow, globalValues.begin() + firstLocalRow + localMatrix.getRowCount());
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> DistributedSparseMatrix<ValueType>::gatherStateValues(std::vector<ValueType> const& localValues) const {
+            STORM_LOG_ASSERT(localValues.size() >= getNumberOfLocalStates(), "Vector has illegal size.");
+            STORM_LOG_THROW(getNumberOfStates() <= static_cast<uint64_t>(std::numeric_limits<int>::max()), storm::exceptions::UnexpectedException, "Too many states to gather the values on a single rank.");
+            std::vector<int> counts(stateOffsets.size() - 1);
+            std::vector<int> displacements(stateOffsets.size() - 1);
+            for (uint64_t otherRank = 0; otherRank + 1 < stateOffsets.size(); ++otherRank) {
+                counts[otherRank] = static_cast<int>(stateOffsets[otherRank + 1] - stateOffsets[otherRank]);
+                displacements[otherRank] = static_cast<int>(stateOffsets[otherRank]);
+            }
+            std::vector<ValueType> result(getNumberOfStates());
+            MPI_Allgatherv(localValues.data(), counts[rank], getMpiDatatype<ValueType>(), result.data(), counts.data(), displacements.data(), getMpiDatatype<ValueType>(), communicator);
+            return result;
+        }
+
+        template class DistributedSparseMatrix<double>;
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MPI
+
+#include <cstdint>
+#include <vector>
+
+#include <mpi.h>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A square (but possibly row grouped) matrix whose row groups are partitioned across the ranks of an MPI
+         * communicator. Each rank owns a contiguous range of states, i.e. of row groups and the corresponding columns.
+         *
+         * Locally, the owned rows are stored in a sparse matrix whose columns are renumbered: the owned states come
+         * first, followed by the ghost states, i.e. the states of other ranks that occur as columns of owned rows. Before
+         * each multiplication, the values of the ghost states are obtained by a halo exchange which only communicates
+         * with ranks that own ghost states (or need ghost states owned by this rank). The communication pattern is
+         * computed once upon construction.
+         */
+        template<typename ValueType>
+        class DistributedSparseMatrix {
+        public:
+            /*!
+             * Creates the distributed matrix from the rows owned by this rank. This is a collective operation.
+             *
+             * @param communicator The communicator of the ranks among which the matrix is distributed.
+             * @param localRows The owned rows with the row grouping of the owned states. The columns refer to the
+             * global state indices.
+             * @param stateOffsets For each rank, the index of its first state, followed by the total number of states.
+             * It has to be the same on all ranks.
+             */
+            DistributedSparseMatrix(MPI_Comm communicator, SparseMatrix<ValueType> const& localRows, std::vector<uint64_t> const& stateOffsets);
+
+            /*!
+             * Distributes a matrix that is known to all ranks. The states are partitioned such that each rank owns
+             * roughly the same number of entries. This is a collective operation.
+             */
+            static DistributedSparseMatrix<ValueType> distribute(MPI_Comm communicator, SparseMatrix<ValueType> const& matrix);
+
+            /*!
+             * Partitions the row groups of the given matrix into the given number of contiguous ranges such that all
+             * ranges have roughly the same number of entries.
+             *
+             * @return The index of the first row group of each range, followed by the number of row groups.
+             */
+            static std::vector<uint64_t> computeBalancedPartition(SparseMatrix<ValueType> const& matrix, uint64_t numberOfParts);
+
+            MPI_Comm getCommunicator() const;
+
+            uint64_t getNumberOfStates() const;
+            uint64_t getFirstLocalState() const;
+            uint64_t getNumberOfLocalStates() const;
+            uint64_t getNumberOfGhostStates() const;
+            std::vector<uint64_t> const& getStateOffsets() const;
+
+            /*!
+             * Retrieves the global index of the first owned row.
+             */
+            uint64_t getFirstLocalRow() const;
+
+            /*!
+             * Retrieves the owned rows, where columns [0, n) refer to the n owned states and the subsequent columns
+             * refer to the ghost states.
+             */
+            SparseMatrix<ValueType> const& getLocalMatrix() const;
+
+            /*!
+             * Retrieves the (global) indices of the ghost states in the order of their local columns.
+             */
+            std::vector<uint64_t> const& getGhostStates() const;
+
+            /*!
+             * Retrieves the number of ranks this rank receives values from in a halo exchange.
+             */
+            uint64_t getNumberOfNeighbors() const;
+
+            /*!
+             * Obtains the values of the ghost states from their owners. This is a collective operation.
+             *
+             * @param x A vector with an entry for each owned and each ghost state. The entries of the owned states are
+             * sent to the ranks that need them and the entries of the ghost states are overwritten.
+             */
+            void exchangeHalo(std::vector<ValueType>& x) const;
+
+            /*!
+             * Retrieves the values of the owned states from a vector with an entry for each (global) state.
+             */
+            std::vector<ValueType> getLocalStateValues(std::vector<ValueType> const& globalValues) const;
+
+            /*!
+             * Retrieves the values of the owned rows from a vector with an entry for each (global) row.
+             */
+            std::vector<ValueType> getLocalRowValues(std::vector<ValueType> const& globalValues) const;
+
+            /*!
+             * Collects the values of all states on all ranks. This is a collective operation.
+             *
+             * @param localValues The values of the owned states.
+             * @return The values of all states.
+             */
+            std::vector<ValueType> gatherStateValues(std::vector<ValueType> const& localValues) const;
+
+        private:
+            MPI_Comm communicator;
+            int rank;
+            std::vector<uint64_t> stateOffsets;
+            uint64_t firstLocalRow;
+
+            SparseMatrix<ValueType> localMatrix;
+            std::vector<uint64_t> ghostStates;
+
+            // The ranks from which ghost values are received and the ranges of the ghost states they own.
+            std::vector<int> receiveRanks;
+            std::vector<uint64_t> receiveOffsets;
+
+            // The ranks to which values of owned states are sent and the (local) states that are sent to them.
+            std::vector<int> sendRanks;
+            std::vector<uint64_t> sendOffsets;
+            std::vector<uint64_t> sendStates;
+            mutable std::vector<ValueType> sendBuffer;
+        };
+
+    }
+}
+
+#endif
@@ -0,0 +1,205 @@
+#include "storm/storage/OnDiskSparseMatrix.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <type_traits>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace storage {
+
+        // The identifier at the beginning of the file ("STORMMAT") and the version of the format.
+        static const uint64_t MAGIC_NUMBER = 0x54414d4d524f5453ull;
+        static const uint64_t FORMAT_VERSION = 1;
+
+        template<typename T>
+        static void writeRaw(std::ofstream& stream, T const* data, uint64_t count) {
+            stream.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+        }
+
+        template<typename T>
+        static void readRaw(std::ifstream& stream, T* data, uint64_t count) {
+            stream.read(reinterpret_cast<char*>(data), count * sizeof(T));
+        }
+
+        template<typename ValueType>
+        void OnDiskSparseMatrix<ValueType>::write(SparseMatrix<ValueType> const& matrix, std::string const& filename) {
+            static_assert(std::is_trivially_copyable<ValueType>::value, "Only values that can be copied bytewise can be written to disk.");
+            std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+
+            uint64_t header[8] = {MAGIC_NUMBER, FORMAT_VERSION, sizeof(ValueType), matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount(), matrix.hasTrivialRowGrouping() ? 0ull : 1ull, matrix.getRowGroupCount()};
+            writeRaw(stream, header, 8);
+
+            std::vector<uint64_t> rowIndications;
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            rowIndications.push_back(0);
+            for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+                rowIndications.push_back(rowIndications.back() + matrix.getRow(row).getNumberOfEntries());
+            }
+            writeRaw(stream, rowIndications.data(), rowIndications.size());
+            if (!matrix.hasTrivialRowGrouping()) {
+                std::vector<uint64_t> rowGroupIndices(matrix.getRowGroupIndices().begin(), matrix.getRowGroupIndices().end());
+                writeRaw(stream, rowGroupIndices.data(), rowGroupIndices.size());
+            }
+
+            // Write the entries in chunks to avoid one write call per entry.
+            std::vector<Entry> buffer;
+            buffer.reserve(1 << 16);
+            for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    buffer.push_back(Entry{entry.getColumn(), entry.getValue()});
+                    if (buffer.size() == buffer.capacity()) {
+                        writeRaw(stream, buffer.data(), buffer.size());
+                        buffer.clear();
+                    }
+                }
+            }
+            writeRaw(stream, buffer.data(), buffer.size());
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write matrix to file " << filename << ".");
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<OnDiskSparseMatrix<ValueType>> OnDiskSparseMatrix<ValueType>::moveToTemporaryFile(SparseMatrix<ValueType>&& matrix, std::string const& directory, index_type rowsPerBlock) {
+            boost::filesystem::path path = directory.empty() ? boost::filesystem::temp_directory_path() : boost::filesystem::path(directory);
+            path /= boost::filesystem::unique_path("storm-matrix-%%%%-%%%%-%%%%-%%%%.bin");
+            STORM_LOG_INFO("Moving matrix with " << matrix.getEntryCount() << " entries to " << path.string() << ".");
+            write(matrix, path.string());
+            matrix = SparseMatrix<ValueType>();
+            return std::make_shared<OnDiskSparseMatrix<ValueType>>(path.string(), rowsPerBlock, true);
+        }
+
+        template<typename ValueType>
+        OnDiskSparseMatrix<ValueType>::OnDiskSparseMatrix(std::string const& filename, index_type rowsPerBlock, bool deleteFileOnDestruction) : filename(filename), deleteFileOnDestruction(deleteFileOnDestruction), rowsPerBlock(std::max<index_type>(rowsPerBlock, 1)) {
+            stream.open(filename, std::ios::binary);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+
+            uint64_t header[8];
+            readRaw(stream, header, 8);
+            STORM_LOG_THROW(stream && header[0] == MAGIC_NUMBER, storm::exceptions::WrongFormatException, "File " << filename << " does not contain a binary matrix.");
+            STORM_LOG_THROW(header[1] == FORMAT_VERSION, storm::exceptions::WrongFormatException, "Unsupported version " << header[1] << " of binary matrix file " << filename << ".");
+            STORM_LOG_THROW(header[2] == sizeof(ValueType), storm::exceptions::WrongFormatException, "The binary matrix file " << filename << " was written with a different value type.");
+            index_type rowCount = header[3];
+            columnCount = header[4];
+            bool hasRowGrouping = header[6] != 0;
+
+            std::vector<uint64_t> buffer(rowCount + 1);
+            readRaw(stream, buffer.data(), buffer.size());
+            rowIndications.assign(buffer.begin(), buffer.end());
+            STORM_LOG_THROW(stream && rowIndications.back() == header[5], storm::exceptions::WrongFormatException, "The binary matrix file " << filename << " is corrupted.");
+            boost::optional<std::vector<index_type>> structureRowGroupIndices;
+            if (hasRowGrouping) {
+                buffer.resize(header[7] + 1);
+                readRaw(stream, buffer.data(), buffer.size());
+                STORM_LOG_THROW(stream, storm::exceptions::WrongFormatException, "The binary matrix file " << filename << " is corrupted.");
+                rowGroupIndices.assign(buffer.begin(), buffer.end());
+                structureRowGroupIndices = rowGroupIndices;
+            } else {
+                rowGroupIndices.resize(rowCount + 1);
+                for (index_type row = 0; row <= rowCount; ++row) {
+                    rowGroupIndices[row] = row;
+                }
+            }
+            entryOffset = stream.tellg();
+
+            structure = SparseMatrix<ValueType>(columnCount, std::vector<index_type>(rowCount + 1, 0), std::vector<MatrixEntry<index_type, ValueType>>(), std::move(structureRowGroupIndices));
+        }
+
+        template<typename ValueType>
+        OnDiskSparseMatrix<ValueType>::~OnDiskSparseMatrix() {
+            stream.close();
+            if (deleteFileOnDestruction) {
+                std::remove(filename.c_str());
+            }
+        }
+
+        template<typename ValueType>
+        typename OnDiskSparseMatrix<ValueType>::index_type OnDiskSparseMatrix<ValueType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ValueType>
+        typename OnDiskSparseMatrix<ValueType>::index_type OnDiskSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename OnDiskSparseMatrix<ValueType>::index_type OnDiskSparseMatrix<ValueType>::getEntryCount() const {
+            return rowIndications.back();
+        }
+
+        template<typename ValueType>
+        std::vector<typename OnDiskSparseMatrix<ValueType>::index_type> const& OnDiskSparseMatrix<ValueType>::getRowIndications() const {
+            return rowIndications;
+        }
+
+        template<typename ValueType>
+        std::vector<typename OnDiskSparseMatrix<ValueType>::index_type> const& OnDiskSparseMatrix<ValueType>::getRowGroupIndices() const {
+            return rowGroupIndices;
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> const& OnDiskSparseMatrix<ValueType>::getStructure() const {
+            return structure;
+        }
+
+        template<typename ValueType>
+        void OnDiskSparseMatrix<ValueType>::forEachBlock(std::function<void (Block const&)> const& function) const {
+            index_type numberOfBlocks = (getRowCount() + rowsPerBlock - 1) / rowsPerBlock;
+            if (numberOfBlocks == 0) {
+                return;
+            }
+
+            // Double buffering: while one block is processed, the next one is read in the background. The background
+            // reads use a separate stream such that they do not interfere with readRow calls of the function.
+            std::ifstream blockStream(filename, std::ios::binary);
+            STORM_LOG_THROW(blockStream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            Block blocks[2];
+            readBlock(blockStream, 0, blocks[0]);
+            for (index_type blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+                Block& currentBlock = blocks[blockIndex % 2];
+                std::future<void> nextBlockRead;
+                if (blockIndex + 1 < numberOfBlocks) {
+                    Block& nextBlock = blocks[(blockIndex + 1) % 2];
+                    nextBlockRead = std::async(std::launch::async, [this, blockIndex, &blockStream, &nextBlock] () { this->readBlock(blockStream, blockIndex + 1, nextBlock); });
+                }
+                function(currentBlock);
+                if (nextBlockRead.valid()) {
+                    // Also propagates exceptions thrown while reading.
+                    nextBlockRead.get();
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void OnDiskSparseMatrix<ValueType>::readRow(index_type row, std::vector<Entry>& entries) const {
+            std::lock_guard<std::mutex> lock(streamMutex);
+            readEntries(stream, rowIndications[row], rowIndications[row + 1], entries);
+        }
+
+        template<typename ValueType>
+        void OnDiskSparseMatrix<ValueType>::readEntries(std::ifstream& entryStream, index_type firstEntry, index_type endEntry, std::vector<Entry>& entries) const {
+            entries.resize(endEntry - firstEntry);
+            entryStream.clear();
+            entryStream.seekg(entryOffset + firstEntry * sizeof(Entry));
+            readRaw(entryStream, entries.data(), entries.size());
+            STORM_LOG_THROW(entryStream, storm::exceptions::FileIoException, "Could not read from binary matrix file " << filename << ".");
+        }
+
+        template<typename ValueType>
+        void OnDiskSparseMatrix<ValueType>::readBlock(std::ifstream& blockStream, index_type blockIndex, Block& block) const {
+            block.firstRow = blockIndex * rowsPerBlock;
+            block.endRow = std::min(block.firstRow + rowsPerBlock, getRowCount());
+            block.firstEntry = rowIndications[block.firstRow];
+            readEntries(blockStream, block.firstEntry, rowIndications[block.endRow], block.entries);
+        }
+
+        template class OnDiskSparseMatrix<double>;
+    }
+}
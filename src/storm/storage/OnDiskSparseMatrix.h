@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A sparse matrix whose entries reside in a binary file on disk. Only the row structure (the row indications
+         * and the row grouping) is kept in memory, i.e. the memory consumption is linear in the number of rows. The
+         * entries are streamed from the file in blocks of consecutive rows, where the next block is read in the
+         * background while the current block is processed.
+         */
+        template<typename ValueType>
+        class OnDiskSparseMatrix {
+        public:
+            typedef SparseMatrixIndexType index_type;
+
+            /*!
+             * An entry as it is stored on disk.
+             */
+            struct Entry {
+                index_type column;
+                ValueType value;
+            };
+
+            /*!
+             * A block of consecutive rows [firstRow, endRow) together with their entries.
+             */
+            struct Block {
+                index_type firstRow;
+                index_type endRow;
+
+                // The global index of the first entry of the block.
+                index_type firstEntry;
+                std::vector<Entry> entries;
+            };
+
+            /*!
+             * Writes the given matrix to the given file in the binary format that can be read by this class.
+             *
+             * @param matrix The matrix to write.
+             * @param filename The name of the file.
+             */
+            static void write(SparseMatrix<ValueType> const& matrix, std::string const& filename);
+
+            /*!
+             * Moves the given matrix to a temporary file and releases its entries afterwards, so that the matrix only
+             * occupies memory while it is written. The file is deleted once the returned matrix is destroyed.
+             *
+             * @param matrix The matrix to move.
+             * @param directory The directory of the temporary file. If empty, the temporary directory of the system is used.
+             * @param rowsPerBlock The number of rows that are read at once.
+             */
+            static std::shared_ptr<OnDiskSparseMatrix<ValueType>> moveToTemporaryFile(SparseMatrix<ValueType>&& matrix, std::string const& directory, index_type rowsPerBlock);
+
+            /*!
+             * Opens the given binary matrix file.
+             *
+             * @param filename The name of the file.
+             * @param rowsPerBlock The number of rows that are read at once.
+             * @param deleteFileOnDestruction If set, the file is deleted when this object is destroyed.
+             */
+            OnDiskSparseMatrix(std::string const& filename, index_type rowsPerBlock, bool deleteFileOnDestruction = false);
+
+            OnDiskSparseMatrix(OnDiskSparseMatrix const& other) = delete;
+            OnDiskSparseMatrix& operator=(OnDiskSparseMatrix const& other) = delete;
+
+            ~OnDiskSparseMatrix();
+
+            index_type getRowCount() const;
+            index_type getColumnCount() const;
+            index_type getEntryCount() const;
+
+            /*!
+             * Retrieves the global index of the first entry of each row (and the total number of entries at the end).
+             */
+            std::vector<index_type> const& getRowIndications() const;
+
+            /*!
+             * Retrieves the row grouping of the matrix (which is the trivial grouping if the matrix has none).
+             */
+            std::vector<index_type> const& getRowGroupIndices() const;
+
+            /*!
+             * Retrieves an in-memory matrix with the dimensions and the row grouping of this matrix but without any
+             * entries. It can serve as a placeholder where only the structure of the matrix is required.
+             */
+            SparseMatrix<ValueType> const& getStructure() const;
+
+            /*!
+             * Streams all blocks of the matrix in ascending order to the given function. While the function processes
+             * a block, the next block is read in the background. The blocks are read through a stream of their own, so
+             * the function may call readRow.
+             */
+            void forEachBlock(std::function<void (Block const&)> const& function) const;
+
+            /*!
+             * Reads the entries of a single row (by random access).
+             */
+            void readRow(index_type row, std::vector<Entry>& entries) const;
+
+        private:
+            void readEntries(std::ifstream& entryStream, index_type firstEntry, index_type endEntry, std::vector<Entry>& entries) const;
+            void readBlock(std::ifstream& blockStream, index_type blockIndex, Block& block) const;
+
+            std::string filename;
+            bool deleteFileOnDestruction;
+            index_type rowsPerBlock;
+            index_type columnCount;
+            std::vector<index_type> rowIndications;
+            std::vector<index_type> rowGroupIndices;
+            SparseMatrix<ValueType> structure;
+
+            // The offset of the first entry in the file.
+            uint64_t entryOffset;
+
+            // The stream used for random access to single rows and the mutex guarding it.
+            mutable std::ifstream stream;
+            mutable std::mutex streamMutex;
+        };
+
+    }
+}
@@ -531,6 +531,15 @@ namespace storm {
             return nonzeroEntryCount;
         }
         
+        template<typename ValueType>
+        uint64_t SparseMatrix<ValueType>::getMemoryUsage() const {
+            uint64_t result = sizeof(*this) + columnsAndValues.capacity() * sizeof(MatrixEntry<index_type, value_type>) + rowIndications.capacity() * sizeof(index_type);
+            if (rowGroupIndices) {
+                result += rowGroupIndices->capacity() * sizeof(index_type);
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         void SparseMatrix<ValueType>::updateNonzeroEntryCount() const {
             this->nonzeroEntryCount = 0;
@@ -1161,8 +1170,14 @@ namespace storm {
             if (keepZeros) {
                 entryCount = this->getEntryCount();
             } else {
-                this->updateNonzeroEntryCount();
-                entryCount = this->getNonzeroEntryCount();
+                // Count the nonzero entries locally instead of updating the cached count, such that the matrix is not
+                // modified and may be transposed by several threads at once.
+                entryCount = 0;
+                for (auto const& element : *this) {
+                    if (element.getValue() != storm::utility::zero<ValueType>()) {
+                        ++entryCount;
+                    }
+                }
             }
             
             std::vector<index_type> rowIndications(rowCount + 1);
@@ -536,6 +536,14 @@ namespace storm {
             */
             index_type getNonzeroEntryCount() const;
 
+            /*!
+             * Retrieves an estimate of the number of bytes occupied by this matrix. Memory that is allocated by the
+             * values themselves (e.g. by rational functions) is not taken into account.
+             *
+             * @return The number of bytes occupied by this matrix.
+             */
+            uint64_t getMemoryUsage() const;
+
             /*!
             * Recompute the nonzero entry count
             */
@@ -574,7 +582,8 @@ namespace storm {
             index_type getSizeOfLargestRowGroup() const;
             
             /*!
-             * Returns the grouping of rows of this matrix.
+             * Returns the grouping of rows of this matrix. Note that a trivial row grouping is created on the first
+             * call, so the first call must not happen concurrently with other accesses to the matrix.
              *
              * @return The grouping of rows of this matrix.
              */
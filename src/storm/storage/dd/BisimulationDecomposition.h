@@ -66,6 +66,11 @@ namespace storm {
              */
             std::shared_ptr<storm::models::Model<ExportValueType>> getQuotient() const;
             
+            /*!
+             * Retrieves the current state partition.
+             */
+            bisimulation::Partition<DdType, ValueType> const& getStatePartition() const;
+            
         private:
             void initialize();
             void refineWrtRewardModels();
@@ -485,6 +485,11 @@ namespace storm {
             internalDdManager.debugCheck();
         }
         
+        template<DdType LibraryType>
+        uint64_t DdManager<LibraryType>::getMemoryUsage() const {
+            return internalDdManager.getMemoryUsage();
+        }
+        
         template class DdManager<DdType::CUDD>;
         
         template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
@@ -321,6 +321,11 @@ namespace storm {
              * Performs a debug check if available.
              */
             void debugCheck() const;
+            
+            /*!
+             * Retrieves the number of bytes currently occupied by the DD package (nodes and caches).
+             */
+            uint64_t getMemoryUsage() const;
 
         private:
             /*!
@@ -19,6 +19,7 @@ namespace storm {
             PartialQuotientExtractor<DdType, ValueType, ExportValueType>::PartialQuotientExtractor(storm::models::symbolic::Model<DdType, ValueType> const& model) : model(model) {
                 auto const& settings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
                 this->quotientFormat = settings.getQuotientFormat();
+                this->incremental = settings.isIncrementalPartialQuotientSet();
                 
                 STORM_LOG_THROW(this->quotientFormat == storm::settings::modules::BisimulationSettings::QuotientFormat::Dd, storm::exceptions::NotSupportedException, "Only DD-based partial quotient extraction is currently supported.");
             }
@@ -83,9 +84,30 @@ namespace storm {
                     std::set<storm::expressions::Variable> blockPrimeAndColumnVariables;
                     std::set_union(blockPrimeVariableSet.begin(), blockPrimeVariableSet.end(), model.getColumnVariables().begin(), model.getColumnVariables().end(), std::inserter(blockPrimeAndColumnVariables, blockPrimeAndColumnVariables.end()));
                     storm::dd::Add<DdType, ValueType> partitionAsAdd = partitionAsBdd.template toAdd<ValueType>();
-                    storm::dd::Add<DdType, ValueType> quotientTransitionMatrix = model.getTransitionMatrix().multiplyMatrix(partitionAsAdd.renameVariables(blockAndRowVariables, blockPrimeAndColumnVariables), model.getColumnVariables());
-                    
-                    quotientTransitionMatrix = quotientTransitionMatrix * partitionAsAdd;
+                    storm::dd::Add<DdType, ValueType> quotientTransitionMatrix;
+                    if (incremental && lastPartitionBdd && lastQuotientTransitionMatrix) {
+                        // Since the original states are the rows of the partial quotient, only the rows of states that changed
+                        // their block or that have a successor that changed its block need to be recomputed.
+                        storm::dd::Bdd<DdType> changedStates = partitionAsBdd.exclusiveOr(lastPartitionBdd.get()).existsAbstract(blockVariableSet);
+                        std::set<storm::expressions::Variable> columnAndNondeterminismVariables;
+                        std::set_union(model.getColumnVariables().begin(), model.getColumnVariables().end(), model.getNondeterminismVariables().begin(), model.getNondeterminismVariables().end(), std::inserter(columnAndNondeterminismVariables, columnAndNondeterminismVariables.begin()));
+                        storm::dd::Bdd<DdType> affectedStates = changedStates || (model.getQualitativeTransitionMatrix() && changedStates.swapVariables(model.getRowColumnMetaVariablePairs())).existsAbstract(columnAndNondeterminismVariables);
+                        
+                        if (affectedStates.isZero()) {
+                            quotientTransitionMatrix = lastQuotientTransitionMatrix.get();
+                        } else {
+                            storm::dd::Add<DdType, ValueType> affectedRows = (model.getTransitionMatrix() * affectedStates.template toAdd<ValueType>()).multiplyMatrix(partitionAsAdd.renameVariables(blockAndRowVariables, blockPrimeAndColumnVariables), model.getColumnVariables());
+                            quotientTransitionMatrix = affectedStates.ite(affectedRows * partitionAsAdd, lastQuotientTransitionMatrix.get());
+                        }
+                        STORM_LOG_TRACE("Recomputed quotient rows of " << affectedStates.getNonZeroCount() << " of " << model.getNumberOfStates() << " states.");
+                    } else {
+                        quotientTransitionMatrix = model.getTransitionMatrix().multiplyMatrix(partitionAsAdd.renameVariables(blockAndRowVariables, blockPrimeAndColumnVariables), model.getColumnVariables());
+                        quotientTransitionMatrix = quotientTransitionMatrix * partitionAsAdd;
+                    }
+                    if (incremental) {
+                        lastPartitionBdd = partitionAsBdd;
+                        lastQuotientTransitionMatrix = quotientTransitionMatrix;
+                    }
                     end = std::chrono::high_resolution_clock::now();
                     
                     // Check quotient matrix for sanity.
@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/dd/DdType.h"
 
 #include "storm/models/symbolic/Model.h"
@@ -30,6 +32,14 @@ namespace storm {
                 storm::models::symbolic::Model<DdType, ValueType> const& model;
                 
                 storm::settings::modules::BisimulationSettings::QuotientFormat quotientFormat;
+                
+                // A flag indicating whether the quotient transition matrix is updated from the last extraction.
+                bool incremental;
+                
+                // The partition (in terms of the row variables) and the quotient transition matrix of the last extraction.
+                // As long as blocks keep their numbers, only the rows of states affected by a split need to be recomputed.
+                boost::optional<storm::dd::Bdd<DdType>> lastPartitionBdd;
+                boost::optional<storm::dd::Add<DdType, ValueType>> lastQuotientTransitionMatrix;
             };
             
         }
@@ -1,5 +1,6 @@
 #include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 
+#include <array>
 #include <numeric>
 
 #include "storm/storage/dd/DdManager.h"
@@ -621,8 +622,200 @@ namespace storm {
                 spp::sparse_hash_map<DdNode const*, uint64_t> blockToOffset;
             };
 
+            // A position in the recursive extraction of the sparse quotient transition matrix from a Sylvan DD.
+            struct SylvanQuotientExtractionPosition {
+                MTBDD transitionMatrixNode;
+                storm::dd::Odd const* sourceOdd;
+                uint64_t sourceOffset;
+                BDD targetPartitionNode;
+                BDD representativesNode;
+                BDD variables;
+                BDD nondeterminismVariables;
+                storm::dd::Odd const* stateOdd;
+                uint64_t stateOffset;
+            };
+            
+            // Subtrees of the extraction covering at most this many rows are processed by a single task.
+            static const uint64_t SYLVAN_QUOTIENT_SEQUENTIAL_ROWS = 256;
+            
+            /*!
+             * The non-template part of the Sylvan-based sparse quotient extractor that is used by the Lace tasks below.
+             */
+            class InternalSylvanSparseQuotientExtractorBase {
+            public:
+                virtual ~InternalSylvanSparseQuotientExtractorBase() = default;
+                
+                // Extracts the entries below the given position in the calling thread.
+                virtual void extractTransitionMatrixRec(SylvanQuotientExtractionPosition const& position) = 0;
+                
+                // Sorts the given rows of the extracted entries by column and adds up duplicate entries.
+                virtual void sortRows(uint64_t firstRow, uint64_t numberOfRows) = 0;
+                
+                // Moves the given (permuted) rows of the extracted entries to their final place in the quotient matrix.
+                virtual void copyRows(uint64_t firstRow, uint64_t numberOfRows) = 0;
+                
+                static bool isEmpty(SylvanQuotientExtractionPosition const& position) {
+                    // Note that the partition nodes cannot be zero as all states of the model have to be contained.
+                    return mtbdd_iszero(position.transitionMatrixNode) || position.representativesNode == sylvan_false;
+                }
+                
+                /*!
+                 * Computes the positions that are reached by moving through the next source variable. The first half of
+                 * the successors belongs to the else-successor of the source ODD and the second half to its then-successor.
+                 * As the two halves fill disjoint sets of rows, they can be processed in parallel.
+                 *
+                 * @return The number of successors.
+                 */
+                static uint64_t getSuccessors(SylvanQuotientExtractionPosition const& position, std::array<SylvanQuotientExtractionPosition, 4>& successors) {
+                    storm::dd::Odd const& sourceOdd = *position.sourceOdd;
+                    storm::dd::Odd const* stateOdd = position.stateOdd;
+                    BDD variables = position.variables;
+                    MTBDD transitionMatrixNode = position.transitionMatrixNode;
+                    
+                    // Determine whether the next variable is a nondeterminism variable.
+                    bool nextVariableIsNondeterminismVariable = !sylvan_isconst(position.nondeterminismVariables) && sylvan_var(position.nondeterminismVariables) == sylvan_var(variables);
+                    
+                    if (nextVariableIsNondeterminismVariable) {
+                        MTBDD t;
+                        MTBDD e;
+                        
+                        // Determine whether the variable was skipped in the matrix.
+                        if (sylvan_mtbdd_matches_variable_index(transitionMatrixNode, sylvan_var(variables))) {
+                            t = sylvan_high(transitionMatrixNode);
+                            e = sylvan_low(transitionMatrixNode);
+                        } else {
+                            t = e = transitionMatrixNode;
+                        }
+                        
+                        STORM_LOG_ASSERT(stateOdd, "Expected separate state ODD.");
+                        successors[0] = {e, &sourceOdd.getElseSuccessor(), position.sourceOffset, position.targetPartitionNode, position.representativesNode, sylvan_high(variables), sylvan_high(position.nondeterminismVariables), stateOdd, position.stateOffset};
+                        successors[1] = {t, &sourceOdd.getThenSuccessor(), position.sourceOffset + sourceOdd.getElseOffset(), position.targetPartitionNode, position.representativesNode, sylvan_high(variables), sylvan_high(position.nondeterminismVariables), stateOdd, position.stateOffset};
+                        return 2;
+                    }
+                    
+                    MTBDD t;
+                    MTBDD tt;
+                    MTBDD te;
+                    MTBDD e;
+                    MTBDD et;
+                    MTBDD ee;
+                    if (sylvan_mtbdd_matches_variable_index(transitionMatrixNode, sylvan_var(variables))) {
+                        // Source node was not skipped in transition matrix.
+                        t = sylvan_high(transitionMatrixNode);
+                        e = sylvan_low(transitionMatrixNode);
+                    } else {
+                        t = e = transitionMatrixNode;
+                    }
+                    
+                    if (sylvan_mtbdd_matches_variable_index(t, sylvan_var(variables) + 1)) {
+                        // Target node was not skipped in transition matrix.
+                        tt = sylvan_high(t);
+                        te = sylvan_low(t);
+                    } else {
+                        // Target node was skipped in transition matrix.
+                        tt = te = t;
+                    }
+                    if (t != e) {
+                        if (sylvan_mtbdd_matches_variable_index(e, sylvan_var(variables) + 1)) {
+                            // Target node was not skipped in transition matrix.
+                            et = sylvan_high(e);
+                            ee = sylvan_low(e);
+                        } else {
+                            // Target node was skipped in transition matrix.
+                            et = ee = e;
+                        }
+                    } else {
+                        et = tt;
+                        ee = te;
+                    }
+                    
+                    BDD targetT;
+                    BDD targetE;
+                    if (sylvan_bdd_matches_variable_index(position.targetPartitionNode, sylvan_var(variables))) {
+                        // Node was not skipped in target partition.
+                        targetT = sylvan_high(position.targetPartitionNode);
+                        targetE = sylvan_low(position.targetPartitionNode);
+                    } else {
+                        // Node was skipped in target partition.
+                        targetT = targetE = position.targetPartitionNode;
+                    }
+                    
+                    BDD representativesT;
+                    BDD representativesE;
+                    if (sylvan_bdd_matches_variable_index(position.representativesNode, sylvan_var(variables))) {
+                        // Node was not skipped in representatives.
+                        representativesT = sylvan_high(position.representativesNode);
+                        representativesE = sylvan_low(position.representativesNode);
+                    } else {
+                        // Node was skipped in representatives.
+                        representativesT = representativesE = position.representativesNode;
+                    }
+                    
+                    storm::dd::Odd const* stateOddE = stateOdd ? &stateOdd->getElseSuccessor() : stateOdd;
+                    storm::dd::Odd const* stateOddT = stateOdd ? &stateOdd->getThenSuccessor() : stateOdd;
+                    uint64_t stateOffsetT = position.stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0);
+                    successors[0] = {ee, &sourceOdd.getElseSuccessor(), position.sourceOffset, targetE, representativesE, sylvan_high(variables), position.nondeterminismVariables, stateOddE, position.stateOffset};
+                    successors[1] = {et, &sourceOdd.getElseSuccessor(), position.sourceOffset, targetT, representativesE, sylvan_high(variables), position.nondeterminismVariables, stateOddE, position.stateOffset};
+                    successors[2] = {te, &sourceOdd.getThenSuccessor(), position.sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, sylvan_high(variables), position.nondeterminismVariables, stateOddT, stateOffsetT};
+                    successors[3] = {tt, &sourceOdd.getThenSuccessor(), position.sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, sylvan_high(variables), position.nondeterminismVariables, stateOddT, stateOffsetT};
+                    return 4;
+                }
+            };
+            
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+            
+            /*!
+             * Extracts the entries below the given positions. The positions are processed one after another as they may
+             * fill the same rows, but the rows below the else- and then-successor of each position are filled in parallel.
+             */
+            VOID_TASK_3(sylvan_extract_quotient_transitions, SylvanQuotientExtractionPosition const*, positions, uint64_t, count, InternalSylvanSparseQuotientExtractorBase*, extractor)
+            {
+                for (uint64_t index = 0; index < count; ++index) {
+                    SylvanQuotientExtractionPosition const& position = positions[index];
+                    if (InternalSylvanSparseQuotientExtractorBase::isEmpty(position)) {
+                        continue;
+                    }
+                    if (sylvan_isconst(position.variables) || position.sourceOdd->getTotalOffset() <= SYLVAN_QUOTIENT_SEQUENTIAL_ROWS) {
+                        extractor->extractTransitionMatrixRec(position);
+                        continue;
+                    }
+                    
+                    std::array<SylvanQuotientExtractionPosition, 4> successors;
+                    uint64_t numberOfSuccessors = InternalSylvanSparseQuotientExtractorBase::getSuccessors(position, successors);
+                    uint64_t numberOfElseSuccessors = numberOfSuccessors / 2;
+                    SPAWN(sylvan_extract_quotient_transitions, successors.data() + numberOfElseSuccessors, numberOfSuccessors - numberOfElseSuccessors, extractor);
+                    CALL(sylvan_extract_quotient_transitions, successors.data(), numberOfElseSuccessors, extractor);
+                    SYNC(sylvan_extract_quotient_transitions);
+                }
+            }
+            
+            /*!
+             * Sorts (if sort is set) or copies the given rows, split into chunks that are processed in parallel.
+             */
+            VOID_TASK_4(sylvan_process_quotient_rows, uint64_t, first, uint64_t, count, bool, sort, InternalSylvanSparseQuotientExtractorBase*, extractor)
+            {
+                if (count > SYLVAN_QUOTIENT_SEQUENTIAL_ROWS) {
+                    SPAWN(sylvan_process_quotient_rows, first, count/2, sort, extractor);
+                    CALL(sylvan_process_quotient_rows, first+count/2, count-count/2, sort, extractor);
+                    SYNC(sylvan_process_quotient_rows);
+                    return;
+                }
+                
+                if (sort) {
+                    extractor->sortRows(first, count);
+                } else {
+                    extractor->copyRows(first, count);
+                }
+            }
+            
+#pragma GCC diagnostic pop
+#pragma clang diagnostic pop
+
             template<typename ValueType, typename ExportValueType>
-            class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, ExportValueType> : public InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType> {
+            class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, ExportValueType> : public InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>, public InternalSylvanSparseQuotientExtractorBase {
             public:
                 InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, ValueType> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& partitionBdd, storm::expressions::Variable const& blockVariable, uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives) : InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives) {
                     this->createBlockToOffsetMapping();
@@ -631,8 +824,90 @@ namespace storm {
             private:
                 virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
                     this->createMatrixEntryStorage();
-                    extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0);
-                    return this->createMatrixFromEntries();
+                    
+                    LACE_ME;
+                    SylvanQuotientExtractionPosition initialPosition = {matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? &this->nondeterminismOdd : &this->odd, 0, this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr, 0};
+                    CALL(sylvan_extract_quotient_transitions, &initialPosition, 1, this);
+                    return createMatrixFromEntriesParallel();
+                }
+                
+                /*!
+                 * Builds the quotient matrix from the extracted entries. The rows are sorted in parallel. Then, every task
+                 * moves a contiguous range of rows to its part of the final entry vector, so the parts written by the
+                 * tasks just need to be concatenated, which is free as their offsets are known in advance.
+                 */
+                storm::storage::SparseMatrix<ExportValueType> createMatrixFromEntriesParallel() {
+                    LACE_ME;
+                    uint64_t numberOfRows = this->matrixEntries.size();
+                    CALL(sylvan_process_quotient_rows, 0, numberOfRows, true, this);
+                    
+                    // For nondeterministic models, order the rows by their states. As the states are given by their offsets, a (stable) counting sort suffices.
+                    this->rowPermutation = std::vector<uint64_t>(numberOfRows);
+                    boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
+                    if (this->isNondeterministic) {
+                        rowGroupIndices = std::vector<uint_fast64_t>(this->numberOfBlocks + 1, 0);
+                        for (auto const& state : this->rowToState) {
+                            ++rowGroupIndices.get()[state + 1];
+                        }
+                        for (uint64_t state = 0; state < this->numberOfBlocks; ++state) {
+                            rowGroupIndices.get()[state + 1] += rowGroupIndices.get()[state];
+                        }
+                        std::vector<uint64_t> nextRowOfState(rowGroupIndices.get().begin(), rowGroupIndices.get().end() - 1);
+                        for (uint64_t row = 0; row < numberOfRows; ++row) {
+                            this->rowPermutation[nextRowOfState[this->rowToState[row]]++] = row;
+                        }
+                    } else {
+                        std::iota(this->rowPermutation.begin(), this->rowPermutation.end(), 0ull);
+                    }
+                    
+                    rowIndications = std::vector<uint_fast64_t>(numberOfRows + 1, 0);
+                    for (uint64_t row = 0; row < numberOfRows; ++row) {
+                        rowIndications[row + 1] = rowIndications[row] + this->matrixEntries[this->rowPermutation[row]].size();
+                    }
+                    columnsAndValues = std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>>(rowIndications.back());
+                    CALL(sylvan_process_quotient_rows, 0, numberOfRows, false, this);
+                    
+                    this->rowToState.clear();
+                    this->rowToState.shrink_to_fit();
+                    this->matrixEntries.clear();
+                    this->matrixEntries.shrink_to_fit();
+                    
+                    return storm::storage::SparseMatrix<ExportValueType>(this->numberOfBlocks, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+                }
+                
+                virtual void sortRows(uint64_t firstRow, uint64_t numberOfRows) override {
+                    for (uint64_t rowIndex = firstRow; rowIndex < firstRow + numberOfRows; ++rowIndex) {
+                        auto& row = this->matrixEntries[rowIndex];
+                        if (row.empty()) {
+                            continue;
+                        }
+                        std::sort(row.begin(), row.end(),
+                                  [] (storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& a, storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& b) {
+                                      return a.getColumn() < b.getColumn();
+                                  });
+                        
+                        // Add up the values of entries with the same column.
+                        auto last = row.begin();
+                        for (auto it = row.begin() + 1; it != row.end(); ++it) {
+                            if (it->getColumn() == last->getColumn()) {
+                                last->setValue(last->getValue() + it->getValue());
+                            } else if (++last != it) {
+                                *last = std::move(*it);
+                            }
+                        }
+                        row.erase(last + 1, row.end());
+                    }
+                }
+                
+                virtual void copyRows(uint64_t firstRow, uint64_t numberOfRows) override {
+                    for (uint64_t rowIndex = firstRow; rowIndex < firstRow + numberOfRows; ++rowIndex) {
+                        auto& row = this->matrixEntries[this->rowPermutation[rowIndex]];
+                        std::move(row.begin(), row.end(), columnsAndValues.begin() + rowIndications[rowIndex]);
+                        
+                        // Free storage for row.
+                        row.clear();
+                        row.shrink_to_fit();
+                    }
                 }
                 
                 virtual std::vector<ExportValueType> extractVectorInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& vector, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& variablesCube, storm::dd::Odd const& odd) override {
@@ -712,109 +987,34 @@ namespace storm {
                     }
                 }
                 
-                void extractTransitionMatrixRec(MTBDD transitionMatrixNode, storm::dd::Odd const& sourceOdd, uint64_t sourceOffset, BDD targetPartitionNode, BDD representativesNode, BDD variables, BDD nondeterminismVariables, storm::dd::Odd const* stateOdd, uint64_t stateOffset) {
-
-                    // For the empty DD, we do not need to add any entries. Note that the partition nodes cannot be zero
-                    // as all states of the model have to be contained.
-                    if (mtbdd_iszero(transitionMatrixNode) || representativesNode == sylvan_false) {
+                virtual void extractTransitionMatrixRec(SylvanQuotientExtractionPosition const& position) override {
+                    // For the empty DD, we do not need to add any entries.
+                    if (isEmpty(position)) {
                         return;
                     }
                     
                     // If we have moved through all source variables, we must have arrived at a target block encoding.
-                    if (sylvan_isconst(variables)) {
-                        STORM_LOG_ASSERT(mtbdd_isleaf(transitionMatrixNode), "Expected constant node.");
-                        this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode), storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(transitionMatrixNode)));
-                        if (stateOdd) {
-                            this->assignRowToState(sourceOffset, stateOffset);
+                    if (sylvan_isconst(position.variables)) {
+                        STORM_LOG_ASSERT(mtbdd_isleaf(position.transitionMatrixNode), "Expected constant node.");
+                        this->addMatrixEntry(position.sourceOffset, blockToOffset.at(position.targetPartitionNode), storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(position.transitionMatrixNode)));
+                        if (position.stateOdd) {
+                            this->assignRowToState(position.sourceOffset, position.stateOffset);
                         }
                     } else {
-                        // Determine whether the next variable is a nondeterminism variable.
-                        bool nextVariableIsNondeterminismVariable = !sylvan_isconst(nondeterminismVariables) && sylvan_var(nondeterminismVariables) == sylvan_var(variables);
-                        
-                        if (nextVariableIsNondeterminismVariable) {
-                            MTBDD t;
-                            MTBDD e;
-                            
-                            // Determine whether the variable was skipped in the matrix.
-                            if (sylvan_mtbdd_matches_variable_index(transitionMatrixNode, sylvan_var(variables))) {
-                                t = sylvan_high(transitionMatrixNode);
-                                e = sylvan_low(transitionMatrixNode);
-                            } else {
-                                t = e = transitionMatrixNode;
-                            }
-                            
-                            STORM_LOG_ASSERT(stateOdd, "Expected separate state ODD.");
-                            extractTransitionMatrixRec(e, sourceOdd.getElseSuccessor(), sourceOffset, targetPartitionNode, representativesNode, sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
-                            extractTransitionMatrixRec(t, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetPartitionNode, representativesNode, sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
-                        } else {
-                            MTBDD t;
-                            MTBDD tt;
-                            MTBDD te;
-                            MTBDD e;
-                            MTBDD et;
-                            MTBDD ee;
-                            if (sylvan_mtbdd_matches_variable_index(transitionMatrixNode, sylvan_var(variables))) {
-                                // Source node was not skipped in transition matrix.
-                                t = sylvan_high(transitionMatrixNode);
-                                e = sylvan_low(transitionMatrixNode);
-                            } else {
-                                t = e = transitionMatrixNode;
-                            }
-                            
-                            if (sylvan_mtbdd_matches_variable_index(t, sylvan_var(variables) + 1)) {
-                                // Target node was not skipped in transition matrix.
-                                tt = sylvan_high(t);
-                                te = sylvan_low(t);
-                            } else {
-                                // Target node was skipped in transition matrix.
-                                tt = te = t;
-                            }
-                            if (t != e) {
-                                if (sylvan_mtbdd_matches_variable_index(e, sylvan_var(variables) + 1)) {
-                                    // Target node was not skipped in transition matrix.
-                                    et = sylvan_high(e);
-                                    ee = sylvan_low(e);
-                                } else {
-                                    // Target node was skipped in transition matrix.
-                                    et = ee = e;
-                                }
-                            } else {
-                                et = tt;
-                                ee = te;
-                            }
-                            
-                            BDD targetT;
-                            BDD targetE;
-                            if (sylvan_bdd_matches_variable_index(targetPartitionNode, sylvan_var(variables))) {
-                                // Node was not skipped in target partition.
-                                targetT = sylvan_high(targetPartitionNode);
-                                targetE = sylvan_low(targetPartitionNode);
-                            } else {
-                                // Node was skipped in target partition.
-                                targetT = targetE = targetPartitionNode;
-                            }
-                            
-                            BDD representativesT;
-                            BDD representativesE;
-                            if (sylvan_bdd_matches_variable_index(representativesNode, sylvan_var(variables))) {
-                                // Node was not skipped in representatives.
-                                representativesT = sylvan_high(representativesNode);
-                                representativesE = sylvan_low(representativesNode);
-                            } else {
-                                // Node was skipped in representatives.
-                                representativesT = representativesE = representativesNode;
-                            }
-                            
-                            extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
-                            extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
-                            extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT, sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd, stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                        std::array<SylvanQuotientExtractionPosition, 4> successors;
+                        uint64_t numberOfSuccessors = getSuccessors(position, successors);
+                        for (uint64_t index = 0; index < numberOfSuccessors; ++index) {
+                            extractTransitionMatrixRec(successors[index]);
                         }
                     }
                 }
                 
                 // A mapping from blocks (stored in terms of a DD node) to the offset of the corresponding block.
                 spp::sparse_hash_map<BDD, uint64_t> blockToOffset;
+                
+                // The row indications and entries of the quotient matrix while it is assembled.
+                std::vector<uint_fast64_t> rowIndications;
+                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>> columnsAndValues;
             };
 
             template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
@@ -2,12 +2,23 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CuddSettings.h"
+#include "storm/utility/Metrics.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace dd {
         
+        // Publishes the state of the manager after every garbage collection.
+        static int publishCuddMetrics(DdManager* manager, const char*, void*) {
+            if (storm::utility::metrics::isEnabled()) {
+                storm::utility::metrics::incrementCounter("storm_dd_garbage_collections_total", "Number of garbage collections of the DD package.", 1.0, "library=\"cudd\"");
+                storm::utility::metrics::setGauge("storm_dd_nodes", "Number of live nodes of the DD package after the last garbage collection.", static_cast<double>(Cudd_ReadKeys(manager) - Cudd_ReadDead(manager)), "library=\"cudd\"");
+                storm::utility::metrics::setGauge("storm_dd_memory_bytes", "Memory used by the DD package.", static_cast<double>(Cudd_ReadMemoryInUse(manager)), "library=\"cudd\"");
+            }
+            return 1;
+        }
+        
         InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
             this->cuddManager.SetMaxMemory(static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
             
@@ -38,6 +49,8 @@ namespace storm {
             }
             
             this->allowDynamicReordering(settings.isReorderingEnabled());
+            
+            Cudd_AddHook(this->cuddManager.getManager(), &publishCuddMetrics, CUDD_POST_GC_HOOK);
         }
         
         InternalDdManager<DdType::CUDD>::~InternalDdManager() {
@@ -157,6 +170,10 @@ namespace storm {
             this->getCuddManager().DebugCheck();
         }
         
+        uint64_t InternalDdManager<DdType::CUDD>::getMemoryUsage() const {
+            return static_cast<uint64_t>(Cudd_ReadMemoryInUse(cuddManager.getManager()));
+        }
+        
         cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
             return cuddManager;
         }
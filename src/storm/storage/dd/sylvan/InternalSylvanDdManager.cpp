@@ -12,6 +12,7 @@
 #include "storm/exceptions/InvalidSettingsException.h"
 
 #include "storm/utility/sylvan.h"
+#include "storm/utility/Metrics.h"
 
 #include "storm-config.h"
 
@@ -37,6 +38,27 @@ namespace storm {
 #pragma clang diagnostic pop
 #endif
         
+#endif
+        
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+        
+        VOID_TASK_0(gc_publish_metrics) {
+            if (storm::utility::metrics::isEnabled()) {
+                storm::utility::metrics::incrementCounter("storm_dd_garbage_collections_total", "Number of garbage collections of the DD package.", 1.0, "library=\"sylvan\"");
+                // Right after the garbage collection, the filled slots of the node table are exactly the live nodes.
+                size_t filled = 0;
+                size_t total = 0;
+                sylvan_table_usage(&filled, &total);
+                storm::utility::metrics::setGauge("storm_dd_nodes", "Number of live nodes of the DD package after the last garbage collection.", static_cast<double>(filled), "library=\"sylvan\"");
+            }
+        }
+        
+#if defined(__clang__)
+#pragma clang diagnostic pop
 #endif
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -45,6 +67,11 @@ namespace storm {
         // some operations.
         uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
         
+        // The number of bytes per slot of the node table (a 16 byte node plus an 8 byte hash bucket) and per slot of
+        // the operation cache (a 32 byte entry plus a 4 byte status word), as used by sylvan.
+        static const uint64_t SYLVAN_BYTES_PER_TABLE_SLOT = 24;
+        static const uint64_t SYLVAN_BYTES_PER_CACHE_SLOT = 36;
+        
         uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
             for (uint_fast64_t index = 0; index < 64; ++index) {
                 if ((number & (1ull << (63 - index))) != 0) {
@@ -78,7 +105,7 @@ namespace storm {
                     max_c <<= -table_ratio;
                 }
                 
-                uint64_t cur = max_t * 24 + max_c * 36;
+                uint64_t cur = max_t * SYLVAN_BYTES_PER_TABLE_SLOT + max_c * SYLVAN_BYTES_PER_CACHE_SLOT;
                 STORM_LOG_THROW(cur <= memorycap, storm::exceptions::InvalidSettingsException, "Memory cap incompatible with default table ratio.");
                 
                 while (2*cur < memorycap && max_t < 0x0000040000000000) {
@@ -106,6 +133,7 @@ namespace storm {
                 sylvan_gc_hook_pregc(TASK(gc_start));
                 sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
+                sylvan_gc_hook_postgc(TASK(gc_publish_metrics));
 
             }
             ++numberOfInstances;
@@ -258,6 +286,16 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
         }
         
+        uint64_t InternalDdManager<DdType::Sylvan>::getMemoryUsage() const {
+            LACE_ME;
+            size_t filled = 0;
+            size_t total = 0;
+            sylvan_table_usage(&filled, &total);
+            // Sylvan does not report the memory it occupies, so we estimate it from the current size of the node table.
+            // The operation cache is created with as many slots as the table and grows along with it.
+            return static_cast<uint64_t>(total) * (SYLVAN_BYTES_PER_TABLE_SLOT + SYLVAN_BYTES_PER_CACHE_SLOT);
+        }
+        
         uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
             return nextFreeVariableIndex;
         }
@@ -132,6 +132,11 @@ namespace storm {
              */
             void debugCheck() const;
             
+            /*!
+             * Retrieves the number of bytes currently occupied by the DD package (nodes and caches).
+             */
+            uint64_t getMemoryUsage() const;
+            
             /*!
              * Retrieves the number of DD variables managed by this manager.
              *
@@ -91,6 +91,10 @@ namespace storm {
             rationalValues[rationalVariable.getOffset()] = value;
         }
         
+        uint64_t SimpleValuation::getMemoryUsage() const {
+            return sizeof(*this) + (booleanValues.capacity() + 7) / 8 + integerValues.capacity() * sizeof(int_fast64_t) + rationalValues.capacity() * sizeof(double);
+        }
+        
         std::string SimpleValuation::toPrettyString(std::set<storm::expressions::Variable> const& selectedVariables) const {
             std::vector<std::string> assignments;
             for (auto const& variable : selectedVariables) {
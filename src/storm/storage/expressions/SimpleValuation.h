@@ -54,6 +54,13 @@ namespace storm {
             virtual double getRationalValue(Variable const& rationalVariable) const override;
             virtual void setRationalValue(Variable const& rationalVariable, double value) override;
             
+            /*!
+             * Retrieves an estimate of the number of bytes occupied by this valuation (excluding the manager).
+             *
+             * @return The number of bytes occupied by this valuation.
+             */
+            uint64_t getMemoryUsage() const;
+            
             /*!
              * Returns a string representation of the valuation of the selected variables.
              *
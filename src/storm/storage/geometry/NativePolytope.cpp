@@ -5,7 +5,6 @@
 #include "storm/solver/Z3LpSolver.h"
 #include "storm/solver/SmtSolver.h"
 #include "storm/storage/geometry/nativepolytopeconversion/QuickHull.h"
-#include "storm/storage/geometry/nativepolytopeconversion/HyperplaneEnumeration.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -67,12 +66,12 @@ namespace storm {
             }
             
             template <typename ValueType>
-            NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other) : emptyStatus(other.emptyStatus), A(other.A), b(other.b) {
+            NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other) : emptyStatus(other.emptyStatus), A(other.A), b(other.b), doubleDescription(other.doubleDescription) {
                 // Intentionally left empty
             }
             
             template <typename ValueType>
-            NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType>&& other) : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)) {
+            NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType>&& other) : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)), doubleDescription(std::move(other.doubleDescription)) {
                 // Intentionally left empty
             }
             
@@ -86,6 +85,11 @@ namespace storm {
                 // Intentionally left empty
             }
             
+            template <typename ValueType>
+            NativePolytope<ValueType>::NativePolytope(EigenMatrix&& halfspaceMatrix, EigenVector&& halfspaceVector, std::shared_ptr<DoubleDescription<ValueType> const>&& doubleDescription) : emptyStatus(doubleDescription->isEmpty() ? EmptyStatus::Empty : EmptyStatus::Nonempty), A(std::move(halfspaceMatrix)), b(std::move(halfspaceVector)), doubleDescription(std::move(doubleDescription)) {
+                // Intentionally left empty
+            }
+            
             template <typename ValueType>
             NativePolytope<ValueType>::~NativePolytope() {
                 // Intentionally left empty
@@ -115,6 +119,9 @@ namespace storm {
 
             template <typename ValueType>
             bool NativePolytope<ValueType>::isEmpty() const {
+                if (emptyStatus == EmptyStatus::Unknown && doubleDescription) {
+                    emptyStatus = doubleDescription->isEmpty() ? EmptyStatus::Empty : EmptyStatus::Nonempty;
+                }
                 if (emptyStatus == EmptyStatus::Unknown) {
                     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
                     std::unique_ptr<storm::solver::SmtSolver> solver = storm::utility::solver::SmtSolverFactory().create(*manager);
@@ -191,29 +198,37 @@ namespace storm {
             std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::intersection(std::shared_ptr<Polytope<ValueType>> const& rhs) const{
                 STORM_LOG_THROW(rhs->isNativePolytope(), storm::exceptions::InvalidArgumentException, "Invoked operation between a NativePolytope and a different polytope implementation. This is not supported");
                 NativePolytope<ValueType> const& nativeRhs = dynamic_cast<NativePolytope<ValueType> const&>(*rhs);
-                EigenMatrix resultA(A.rows() + nativeRhs.A.rows(), A.cols());
-                resultA << A,
-                           nativeRhs.A;
-                EigenVector resultb(resultA.rows());
-                resultb << b,
-                           nativeRhs.b;
-                return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, std::move(resultA), std::move(resultb));
+                return intersection(nativeRhs.A, nativeRhs.b);
             }
             
             template <typename ValueType>
             std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::intersection(Halfspace<ValueType> const& halfspace) const{
-                if (A.rows() == 0) {
+                EigenMatrix halfspaceMatrix = storm::adapters::EigenAdapter::toEigenVector(halfspace.normalVector()).transpose();
+                EigenVector halfspaceVector(1);
+                halfspaceVector(0) = halfspace.offset();
+                return intersection(halfspaceMatrix, halfspaceVector);
+            }
+            
+            template <typename ValueType>
+            std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::intersection(EigenMatrix const& halfspaceMatrix, EigenVector const& halfspaceVector) const{
+                if (halfspaceMatrix.rows() == 0) {
+                    return std::make_shared<NativePolytope<ValueType>>(*this);
+                } else if (A.rows() == 0) {
                     // No constraints yet
-                    EigenMatrix resultA = storm::adapters::EigenAdapter::toEigenVector(halfspace.normalVector()).transpose();
-                    EigenVector resultb(1);
-                    resultb(0) = halfspace.offset();
-                    return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, std::move(resultA), std::move(resultb));
+                    return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, halfspaceMatrix, halfspaceVector);
                 }
-                EigenMatrix resultA(A.rows() + 1, A.cols());
-                resultA << A, storm::adapters::EigenAdapter::toEigenVector(halfspace.normalVector()).transpose();
+                EigenMatrix resultA(A.rows() + halfspaceMatrix.rows(), A.cols());
+                resultA << A,
+                           halfspaceMatrix;
                 EigenVector resultb(resultA.rows());
                 resultb << b,
-                           halfspace.offset();
+                           halfspaceVector;
+                if (doubleDescription) {
+                    // Only the new halfspaces need to be inserted into the vertex representation
+                    auto resultDoubleDescription = std::make_shared<DoubleDescription<ValueType>>(*doubleDescription);
+                    resultDoubleDescription->addHalfspaces(halfspaceMatrix, halfspaceVector);
+                    return std::make_shared<NativePolytope<ValueType>>(std::move(resultA), std::move(resultb), std::shared_ptr<DoubleDescription<ValueType> const>(std::move(resultDoubleDescription)));
+                }
                 return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, std::move(resultA), std::move(resultb));
             }
             
@@ -370,9 +385,21 @@ namespace storm {
             }
             template <typename ValueType>
             std::vector<typename NativePolytope<ValueType>::EigenVector> NativePolytope<ValueType>::getEigenVertices() const {
-                storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
-                he.generateVerticesFromConstraints(A, b, false);
-                return he.getResultVertices();
+                if (A.cols() == 0) {
+                    // No halfspaces means no vertices
+                    return std::vector<EigenVector>();
+                }
+                return getDoubleDescription().getVertices();
+            }
+
+            template <typename ValueType>
+            DoubleDescription<ValueType> const& NativePolytope<ValueType>::getDoubleDescription() const {
+                if (!doubleDescription) {
+                    auto newDoubleDescription = std::make_shared<DoubleDescription<ValueType>>(A.cols());
+                    newDoubleDescription->addHalfspaces(A, b);
+                    doubleDescription = std::move(newDoubleDescription);
+                }
+                return *doubleDescription;
             }
 
             template <typename ValueType>
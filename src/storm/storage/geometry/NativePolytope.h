@@ -4,6 +4,7 @@
 #include <memory>
 #include "storm/storage/geometry/Polytope.h"
 #include "storm/adapters/EigenAdapter.h"
+#include "storm/storage/geometry/nativepolytopeconversion/DoubleDescription.h"
 #include "storm/storage/expressions/Expression.h"
 
 namespace storm {
@@ -57,6 +58,7 @@ namespace storm {
                 */
                 NativePolytope(EmptyStatus const& emptyStatus, EigenMatrix const& halfspaceMatrix, EigenVector const& halfspaceVector);
                 NativePolytope(EmptyStatus&& emptyStatus, EigenMatrix&& halfspaceMatrix, EigenVector&& halfspaceVector);
+                NativePolytope(EigenMatrix&& halfspaceMatrix, EigenVector&& halfspaceVector, std::shared_ptr<DoubleDescription<ValueType> const>&& doubleDescription);
                 
 
                 virtual ~NativePolytope();
@@ -147,6 +149,13 @@ namespace storm {
                 // returns the vertices of this polytope as EigenVectors
                 std::vector<EigenVector> getEigenVertices() const;
 
+                // returns the double description of this polytope (which is computed if it is not yet known)
+                DoubleDescription<ValueType> const& getDoubleDescription() const;
+
+                // Returns the intersection of this polytope with the given halfspaces.
+                // If the vertices of this are known, the vertices of the result are derived incrementally.
+                std::shared_ptr<Polytope<ValueType>> intersection(EigenMatrix const& halfspaceMatrix, EigenVector const& halfspaceVector) const;
+
                 // As optimize(..) but with EigenVectors
                 std::pair<EigenVector, bool> optimize(EigenVector const& direction) const;
 
@@ -159,7 +168,8 @@ namespace storm {
                 EigenMatrix A;
                 EigenVector b;
 
-
+                // Caches the vertices of the polytope. The double description is shared with the polytopes that are copied from this one and never modified after construction.
+                mutable std::shared_ptr<DoubleDescription<ValueType> const> doubleDescription;
 
             };
             
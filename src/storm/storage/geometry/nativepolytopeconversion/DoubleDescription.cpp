@@ -0,0 +1,238 @@
+#include "storm/storage/geometry/nativepolytopeconversion/DoubleDescription.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/utility/macros.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace storage {
+        namespace geometry {
+
+            // Computes constraint * ray and returns its sign.
+            template <typename ValueType>
+            static int evaluateConstraint(StormEigen::Matrix<ValueType, StormEigen::Dynamic, 1> const& constraint, StormEigen::Matrix<ValueType, StormEigen::Dynamic, 1> const& ray, ValueType& value) {
+                value = storm::utility::zero<ValueType>();
+                for (StormEigen::Index i = 0; i < constraint.rows(); ++i) {
+                    value += constraint(i) * ray(i);
+                }
+                if (storm::utility::isZero(value)) {
+                    return 0;
+                }
+                return value > storm::utility::zero<ValueType>() ? 1 : -1;
+            }
+
+            // For floating point numbers, values that are small compared to the magnitude of the summands are considered as zero.
+            static int evaluateConstraint(StormEigen::Matrix<double, StormEigen::Dynamic, 1> const& constraint, StormEigen::Matrix<double, StormEigen::Dynamic, 1> const& ray, double& value) {
+                value = 0.0;
+                double magnitude = 1.0;
+                for (StormEigen::Index i = 0; i < constraint.rows(); ++i) {
+                    double summand = constraint(i) * ray(i);
+                    value += summand;
+                    magnitude += std::abs(summand);
+                }
+                if (storm::utility::isAlmostZero(value / magnitude)) {
+                    value = 0.0;
+                    return 0;
+                }
+                return value > 0.0 ? 1 : -1;
+            }
+
+            template <typename ValueType>
+            static bool isZeroEntry(ValueType const& value) {
+                return storm::utility::isZero(value);
+            }
+
+            static bool isZeroEntry(double const& value) {
+                return storm::utility::isAlmostZero(value);
+            }
+
+            template <typename ValueType>
+            DoubleDescription<ValueType>::DoubleDescription(uint_fast64_t dimension) : dimension(dimension), numberOfConstraints(0) {
+                // Initially, the cone is the whole space, i.e., its lineality space is spanned by the unit vectors.
+                lineality.reserve(dimension + 1);
+                for (uint_fast64_t i = 0; i <= dimension; ++i) {
+                    lineality.push_back(EigenVector::Zero(dimension + 1));
+                    lineality.back()(i) = storm::utility::one<ValueType>();
+                }
+                // Add the constraint -t <= 0
+                EigenVector nonNegativity = EigenVector::Zero(dimension + 1);
+                nonNegativity(dimension) = -storm::utility::one<ValueType>();
+                addHomogeneousConstraint(nonNegativity);
+            }
+
+            template <typename ValueType>
+            void DoubleDescription<ValueType>::addHalfspace(EigenVector const& normalVector, ValueType const& offset) {
+                STORM_LOG_ASSERT((uint_fast64_t) normalVector.rows() == dimension, "Dimension of halfspace does not match.");
+                EigenVector constraint(dimension + 1);
+                constraint.head(dimension) = normalVector;
+                constraint(dimension) = -offset;
+                addHomogeneousConstraint(constraint);
+            }
+
+            template <typename ValueType>
+            void DoubleDescription<ValueType>::addHalfspaces(EigenMatrix const& constraintMatrix, EigenVector const& constraintVector) {
+                for (StormEigen::Index row = 0; row < constraintMatrix.rows(); ++row) {
+                    addHalfspace(constraintMatrix.row(row).transpose(), constraintVector(row));
+                }
+            }
+
+            template <typename ValueType>
+            void DoubleDescription<ValueType>::addHomogeneousConstraint(EigenVector const& constraint) {
+                uint_fast64_t constraintIndex = numberOfConstraints++;
+                for (auto& incidence : incidences) {
+                    incidence.resize(numberOfConstraints);
+                }
+
+                // If the constraint is not tight on the whole lineality space, the lineality space shrinks.
+                uint_fast64_t pivotIndex = lineality.size();
+                ValueType pivotValue = storm::utility::zero<ValueType>();
+                ValueType value;
+                for (uint_fast64_t i = 0; i < lineality.size(); ++i) {
+                    if (evaluateConstraint(constraint, lineality[i], value) != 0 && (pivotIndex == lineality.size() || storm::utility::abs(value) > storm::utility::abs(pivotValue))) {
+                        pivotIndex = i;
+                        pivotValue = value;
+                    }
+                }
+                if (pivotIndex < lineality.size()) {
+                    EigenVector newRay = std::move(lineality[pivotIndex]);
+                    lineality.erase(lineality.begin() + pivotIndex);
+                    if (pivotValue > storm::utility::zero<ValueType>()) {
+                        newRay = -newRay;
+                        pivotValue = -pivotValue;
+                    }
+                    // Project the remaining generators onto the hyperplane. They stay in the cone as newRay is (was) part of the lineality space.
+                    for (auto& line : lineality) {
+                        if (evaluateConstraint(constraint, line, value) != 0) {
+                            line -= (value / pivotValue) * newRay;
+                        }
+                    }
+                    for (uint_fast64_t i = 0; i < rays.size(); ++i) {
+                        if (evaluateConstraint(constraint, rays[i], value) != 0) {
+                            rays[i] -= (value / pivotValue) * newRay;
+                            normalize(rays[i]);
+                        }
+                        incidences[i].set(constraintIndex, true);
+                    }
+                    // The new ray is tight at all previous constraints.
+                    normalize(newRay);
+                    rays.push_back(std::move(newRay));
+                    incidences.emplace_back(numberOfConstraints, true);
+                    incidences.back().set(constraintIndex, false);
+                    return;
+                }
+
+                // The constraint is tight on the lineality space, so only the rays need to be considered.
+                std::vector<ValueType> values(rays.size());
+                std::vector<uint_fast64_t> positive, negative;
+                storm::storage::BitVector keptRays(rays.size(), true);
+                for (uint_fast64_t i = 0; i < rays.size(); ++i) {
+                    int sign = evaluateConstraint(constraint, rays[i], values[i]);
+                    if (sign > 0) {
+                        positive.push_back(i);
+                        keptRays.set(i, false);
+                    } else if (sign < 0) {
+                        negative.push_back(i);
+                    } else {
+                        incidences[i].set(constraintIndex, true);
+                    }
+                }
+                if (positive.empty()) {
+                    // The halfspace is redundant
+                    return;
+                }
+
+                // Every adjacent pair of rays on different sides of the hyperplane yields a new ray on the hyperplane.
+                // At two adjacent rays, (at least) as many constraints are tight as the dimension of the pointed part of the cone minus two.
+                uint_fast64_t minimalCommonIncidence = dimension + 1 - lineality.size();
+                std::vector<EigenVector> newRays;
+                std::vector<storm::storage::BitVector> newIncidences;
+                for (auto const& positiveRay : positive) {
+                    for (auto const& negativeRay : negative) {
+                        storm::storage::BitVector commonIncidence = incidences[positiveRay] & incidences[negativeRay];
+                        if (commonIncidence.getNumberOfSetBits() + 2 >= minimalCommonIncidence && isAdjacent(positiveRay, negativeRay, commonIncidence)) {
+                            EigenVector newRay = values[positiveRay] * rays[negativeRay] - values[negativeRay] * rays[positiveRay];
+                            normalize(newRay);
+                            newRays.push_back(std::move(newRay));
+                            commonIncidence.set(constraintIndex, true);
+                            newIncidences.push_back(std::move(commonIncidence));
+                        }
+                    }
+                }
+
+                std::vector<EigenVector> resultRays;
+                std::vector<storm::storage::BitVector> resultIncidences;
+                resultRays.reserve(keptRays.getNumberOfSetBits() + newRays.size());
+                resultIncidences.reserve(resultRays.capacity());
+                for (auto const& i : keptRays) {
+                    resultRays.push_back(std::move(rays[i]));
+                    resultIncidences.push_back(std::move(incidences[i]));
+                }
+                std::move(newRays.begin(), newRays.end(), std::back_inserter(resultRays));
+                std::move(newIncidences.begin(), newIncidences.end(), std::back_inserter(resultIncidences));
+                rays = std::move(resultRays);
+                incidences = std::move(resultIncidences);
+            }
+
+            template <typename ValueType>
+            bool DoubleDescription<ValueType>::isAdjacent(uint_fast64_t firstRay, uint_fast64_t secondRay, storm::storage::BitVector const& commonIncidence) const {
+                for (uint_fast64_t i = 0; i < rays.size(); ++i) {
+                    if (i != firstRay && i != secondRay && commonIncidence.isSubsetOf(incidences[i])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template <typename ValueType>
+            void DoubleDescription<ValueType>::normalize(EigenVector& ray) const {
+                if (isZeroEntry(ray(dimension))) {
+                    ray(dimension) = storm::utility::zero<ValueType>();
+                    ValueType maxEntry = storm::utility::zero<ValueType>();
+                    for (StormEigen::Index i = 0; i < ray.rows(); ++i) {
+                        maxEntry = std::max(maxEntry, storm::utility::abs<ValueType>(ray(i)));
+                    }
+                    if (!storm::utility::isZero(maxEntry)) {
+                        ray /= maxEntry;
+                    }
+                } else {
+                    ray /= ray(dimension);
+                }
+            }
+
+            template <typename ValueType>
+            std::vector<typename DoubleDescription<ValueType>::EigenVector> DoubleDescription<ValueType>::getVertices() const {
+                std::vector<EigenVector> result;
+                if (!lineality.empty()) {
+                    return result;
+                }
+                for (auto const& ray : rays) {
+                    if (ray(dimension) > storm::utility::zero<ValueType>()) {
+                        result.push_back(ray.head(dimension));
+                    }
+                }
+                return result;
+            }
+
+            template <typename ValueType>
+            bool DoubleDescription<ValueType>::isEmpty() const {
+                for (auto const& ray : rays) {
+                    if (ray(dimension) > storm::utility::zero<ValueType>()) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template <typename ValueType>
+            uint_fast64_t DoubleDescription<ValueType>::getDimension() const {
+                return dimension;
+            }
+
+            template class DoubleDescription<double>;
+            template class DoubleDescription<storm::RationalNumber>;
+
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef STORM_STORAGE_GEOMETRY_NATIVEPOLYTOPECONVERSION_DOUBLEDESCRIPTION_H_
+#define STORM_STORAGE_GEOMETRY_NATIVEPOLYTOPECONVERSION_DOUBLEDESCRIPTION_H_
+
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/adapters/EigenAdapter.h"
+
+namespace storm {
+    namespace storage {
+        namespace geometry {
+
+            /*
+             * Maintains the vertices of a polyhedron { x | Ax<=b } under the insertion of halfspaces using the double description method.
+             * The polyhedron is represented by the cone { (x,t) | Ax - bt <= 0, t >= 0 } which is given by its extreme rays and a basis of its lineality space.
+             * Extreme rays with t > 0 correspond to the vertices of the polyhedron.
+             * For every extreme ray, the set of constraints that are tight at the ray is stored. Two rays are adjacent iff no other ray is tight at all their common constraints.
+             * Hence, inserting a single halfspace only requires to combine the adjacent pairs of rays that lie on different sides of the new hyperplane.
+             */
+            template <typename ValueType>
+            class DoubleDescription {
+            public:
+
+                typedef StormEigen::Matrix<ValueType, StormEigen::Dynamic, StormEigen::Dynamic> EigenMatrix;
+                typedef StormEigen::Matrix<ValueType, StormEigen::Dynamic, 1> EigenVector;
+
+                /*
+                 * Creates the double description of the whole space with the given dimension.
+                 */
+                DoubleDescription(uint_fast64_t dimension);
+                ~DoubleDescription() = default;
+
+                /*
+                 * Intersects the represented polyhedron with the halfspace { x | normalVector * x <= offset }.
+                 */
+                void addHalfspace(EigenVector const& normalVector, ValueType const& offset);
+
+                /*
+                 * Intersects the represented polyhedron with the halfspaces given by the rows of the matrix and the vector.
+                 */
+                void addHalfspaces(EigenMatrix const& constraintMatrix, EigenVector const& constraintVector);
+
+                /*
+                 * Returns the vertices of the represented polyhedron.
+                 * If the polyhedron contains a line (i.e., it is not pointed), there are no vertices.
+                 */
+                std::vector<EigenVector> getVertices() const;
+
+                /*
+                 * Returns true iff the represented polyhedron is empty.
+                 */
+                bool isEmpty() const;
+
+                uint_fast64_t getDimension() const;
+
+            private:
+
+                // Intersects the cone with { y | constraint * y <= 0 }
+                void addHomogeneousConstraint(EigenVector const& constraint);
+
+                // Returns true iff the rays with the given indices are adjacent, where commonIncidence is the set of constraints that are tight at both rays.
+                bool isAdjacent(uint_fast64_t firstRay, uint_fast64_t secondRay, storm::storage::BitVector const& commonIncidence) const;
+
+                // Scales the given ray such that t=1 (if t>0) or such that its largest entry is one (if t=0).
+                void normalize(EigenVector& ray) const;
+
+                uint_fast64_t dimension;
+                uint_fast64_t numberOfConstraints;
+
+                // The extreme rays of the cone (modulo the lineality space) and the constraints that are tight at each of them.
+                std::vector<EigenVector> rays;
+                std::vector<storm::storage::BitVector> incidences;
+
+                // A basis of the lineality space of the cone.
+                std::vector<EigenVector> lineality;
+            };
+        }
+    }
+}
+
+#endif /* STORM_STORAGE_GEOMETRY_NATIVEPOLYTOPECONVERSION_DOUBLEDESCRIPTION_H_ */
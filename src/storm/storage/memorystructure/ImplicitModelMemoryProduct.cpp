@@ -0,0 +1,284 @@
+#include "storm/storage/memorystructure/ImplicitModelMemoryProduct.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        ImplicitModelMemoryProduct<ValueType>::ImplicitModelMemoryProduct(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::MemoryStructure const& memory) : transitionMatrix(transitionMatrix), memoryStateCount(memory.getNumberOfStates()) {
+            STORM_LOG_THROW(initialStates.getNumberOfSetBits() == memory.getInitialMemoryStates().size(), storm::exceptions::InvalidArgumentException, "The memory structure considers a different number of initial states.");
+            STORM_LOG_THROW(memoryStateCount <= std::numeric_limits<uint32_t>::max(), storm::exceptions::InvalidArgumentException, "The memory structure has too many states.");
+
+            // Tabulate the memory successors such that an access does not need to check every memory state.
+            memorySuccessors.resize(transitionMatrix.getEntryCount() * memoryStateCount, std::numeric_limits<uint32_t>::max());
+            for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
+                for (uint64_t successorMemoryState = 0; successorMemoryState < memoryStateCount; ++successorMemoryState) {
+                    boost::optional<storm::storage::BitVector> const& matrixEntry = memory.getTransitionMatrix()[memoryState][successorMemoryState];
+                    if (matrixEntry) {
+                        for (auto const& modelTransitionIndex : matrixEntry.get()) {
+                            memorySuccessors[modelTransitionIndex * memoryStateCount + memoryState] = successorMemoryState;
+                        }
+                    }
+                }
+            }
+
+            // Explore the reachable pairs of model and memory states. The set of reached pairs only requires one bit
+            // per pair and is discarded afterwards.
+            storm::storage::BitVector reachedPairs(transitionMatrix.getRowGroupCount() * memoryStateCount, false);
+            std::vector<uint64_t> stack;
+            std::vector<uint64_t> initialPairs;
+            auto memoryInitIt = memory.getInitialMemoryStates().begin();
+            for (auto const& modelInit : initialStates) {
+                uint64_t pair = modelInit * memoryStateCount + *memoryInitIt;
+                initialPairs.push_back(pair);
+                if (!reachedPairs.get(pair)) {
+                    reachedPairs.set(pair);
+                    stack.push_back(pair);
+                }
+                ++memoryInitIt;
+            }
+            while (!stack.empty()) {
+                uint64_t pair = stack.back();
+                stack.pop_back();
+                uint64_t memoryState = pair % memoryStateCount;
+                auto const& rowGroup = transitionMatrix.getRowGroup(pair / memoryStateCount);
+                for (auto entryIt = rowGroup.begin(), entryIte = rowGroup.end(); entryIt != entryIte; ++entryIt) {
+                    if (!storm::utility::isZero(entryIt->getValue())) {
+                        uint64_t successorPair = entryIt->getColumn() * memoryStateCount + getSuccessorMemoryState(memoryState, entryIt - transitionMatrix.begin());
+                        if (!reachedPairs.get(successorPair)) {
+                            reachedPairs.set(successorPair);
+                            stack.push_back(successorPair);
+                        }
+                    }
+                }
+            }
+
+            productStates.reserve(reachedPairs.getNumberOfSetBits());
+            productStateIndices.reserve(transitionMatrix.getRowGroupCount() + 1);
+            rowGroupIndices.reserve(reachedPairs.getNumberOfSetBits() + 1);
+            rowGroupIndices.push_back(0);
+            for (auto const& pair : reachedPairs) {
+                uint64_t modelState = pair / memoryStateCount;
+                while (productStateIndices.size() <= modelState) {
+                    productStateIndices.push_back(productStates.size());
+                }
+                productStates.push_back(pair);
+                rowGroupIndices.push_back(rowGroupIndices.back() + transitionMatrix.getRowGroupSize(modelState));
+            }
+            while (productStateIndices.size() <= transitionMatrix.getRowGroupCount()) {
+                productStateIndices.push_back(productStates.size());
+            }
+
+            this->initialStates = storm::storage::BitVector(productStates.size(), false);
+            for (auto const& pair : initialPairs) {
+                this->initialStates.set(getProductState(pair / memoryStateCount, pair % memoryStateCount));
+            }
+
+            boost::optional<std::vector<uint64_t>> structureRowGroupIndices;
+            if (!transitionMatrix.hasTrivialRowGrouping()) {
+                structureRowGroupIndices = rowGroupIndices;
+            }
+            structure = storm::storage::SparseMatrix<ValueType>(getNumberOfStates(), std::vector<uint64_t>(getNumberOfRows() + 1, 0), std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>>(), std::move(structureRowGroupIndices));
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getNumberOfStates() const {
+            return productStates.size();
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getNumberOfRows() const {
+            return rowGroupIndices.back();
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& ImplicitModelMemoryProduct<ValueType>::getModelTransitionMatrix() const {
+            return transitionMatrix;
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& ImplicitModelMemoryProduct<ValueType>::getStructure() const {
+            return structure;
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& ImplicitModelMemoryProduct<ValueType>::getRowGroupIndices() const {
+            return rowGroupIndices;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector const& ImplicitModelMemoryProduct<ValueType>::getInitialStates() const {
+            return initialStates;
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getModelState(uint64_t productState) const {
+            return productStates[productState] / memoryStateCount;
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getMemoryState(uint64_t productState) const {
+            return productStates[productState] % memoryStateCount;
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getFirstProductState(uint64_t modelState) const {
+            return productStateIndices[modelState];
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getSuccessorMemoryState(uint64_t memoryState, uint64_t modelTransitionIndex) const {
+            uint32_t successorMemoryState = memorySuccessors[modelTransitionIndex * memoryStateCount + memoryState];
+            STORM_LOG_ASSERT(successorMemoryState != std::numeric_limits<uint32_t>::max(), "The successor memory state for the given transition could not be found.");
+            return successorMemoryState;
+        }
+
+        template<typename ValueType>
+        bool ImplicitModelMemoryProduct<ValueType>::isReachable(uint64_t modelState, uint64_t memoryState) const {
+            return std::binary_search(productStates.begin() + productStateIndices[modelState], productStates.begin() + productStateIndices[modelState + 1], modelState * memoryStateCount + memoryState);
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getProductState(uint64_t modelState, uint64_t memoryState) const {
+            // Only the product states of the given model state are searched
+            auto stateIte = productStates.begin() + productStateIndices[modelState + 1];
+            auto stateIt = std::lower_bound(productStates.begin() + productStateIndices[modelState], stateIte, modelState * memoryStateCount + memoryState);
+            STORM_LOG_ASSERT(stateIt != stateIte && *stateIt == modelState * memoryStateCount + memoryState, "Tried to get unreachable product state (" << modelState << "," << memoryState << ").");
+            return stateIt - productStates.begin();
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getModelRow(uint64_t productRow) const {
+            uint64_t productState = std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), productRow) - rowGroupIndices.begin() - 1;
+            return getModelRowOfState(productState, productRow);
+        }
+
+        template<typename ValueType>
+        uint64_t ImplicitModelMemoryProduct<ValueType>::getModelRowOfState(uint64_t productState, uint64_t productRow) const {
+            STORM_LOG_ASSERT(rowGroupIndices[productState] <= productRow && productRow < rowGroupIndices[productState + 1], "Row " << productRow << " does not belong to product state " << productState << ".");
+            return transitionMatrix.getRowGroupIndices()[getModelState(productState)] + (productRow - rowGroupIndices[productState]);
+        }
+
+        template<typename ValueType>
+        template<typename Callback>
+        void ImplicitModelMemoryProduct<ValueType>::forEachEntry(uint64_t memoryState, uint64_t modelRow, Callback const& callback) const {
+            for (auto entryIt = transitionMatrix.begin(modelRow), entryIte = transitionMatrix.end(modelRow); entryIt != entryIte; ++entryIt) {
+                if (!storm::utility::isZero(entryIt->getValue())) {
+                    uint64_t successorMemoryState = getSuccessorMemoryState(memoryState, entryIt - transitionMatrix.begin());
+                    callback(getProductState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+                }
+            }
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> ImplicitModelMemoryProduct<ValueType>::liftStateValues(std::vector<ValueType> const& modelStateValues) const {
+            std::vector<ValueType> result;
+            result.reserve(getNumberOfStates());
+            for (uint64_t productState = 0; productState < getNumberOfStates(); ++productState) {
+                result.push_back(modelStateValues[getModelState(productState)]);
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> ImplicitModelMemoryProduct<ValueType>::liftRowValues(std::vector<ValueType> const& modelRowValues) const {
+            std::vector<ValueType> result;
+            result.reserve(getNumberOfRows());
+            for (uint64_t productState = 0; productState < getNumberOfStates(); ++productState) {
+                for (uint64_t productRow = rowGroupIndices[productState]; productRow < rowGroupIndices[productState + 1]; ++productRow) {
+                    result.push_back(modelRowValues[getModelRowOfState(productState, productRow)]);
+                }
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector ImplicitModelMemoryProduct<ValueType>::liftStates(storm::storage::BitVector const& modelStates) const {
+            storm::storage::BitVector result(getNumberOfStates(), false);
+            for (uint64_t productState = 0; productState < getNumberOfStates(); ++productState) {
+                if (modelStates.get(getModelState(productState))) {
+                    result.set(productState);
+                }
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        void ImplicitModelMemoryProduct<ValueType>::multiplyRow(uint64_t productState, uint64_t productRow, std::vector<ValueType> const& x, ValueType& value) const {
+            forEachEntry(getMemoryState(productState), getModelRowOfState(productState, productRow), [&value, &x] (uint64_t column, ValueType const& entryValue) { value += entryValue * x[column]; });
+        }
+
+        template<typename ValueType>
+        void ImplicitModelMemoryProduct<ValueType>::multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            STORM_LOG_ASSERT(&x != &result, "The input and output vectors must be different.");
+            result.resize(getNumberOfRows());
+            for (uint64_t productState = 0; productState < getNumberOfStates(); ++productState) {
+                uint64_t memoryState = getMemoryState(productState);
+                uint64_t modelRow = transitionMatrix.getRowGroupIndices()[getModelState(productState)];
+                for (uint64_t productRow = rowGroupIndices[productState]; productRow < rowGroupIndices[productState + 1]; ++productRow, ++modelRow) {
+                    ValueType value = b ? (*b)[productRow] : storm::utility::zero<ValueType>();
+                    forEachEntry(memoryState, modelRow, [&value, &x] (uint64_t column, ValueType const& entryValue) { value += entryValue * x[column]; });
+                    result[productRow] = std::move(value);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void ImplicitModelMemoryProduct<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            STORM_LOG_ASSERT(&x != &result, "The input and output vectors must be different.");
+            result.resize(getNumberOfStates());
+            if (choices) {
+                choices->resize(getNumberOfStates());
+            }
+            for (uint64_t productState = 0; productState < getNumberOfStates(); ++productState) {
+                uint64_t memoryState = getMemoryState(productState);
+                uint64_t modelRow = transitionMatrix.getRowGroupIndices()[getModelState(productState)];
+                for (uint64_t productRow = rowGroupIndices[productState]; productRow < rowGroupIndices[productState + 1]; ++productRow, ++modelRow) {
+                    ValueType value = b ? (*b)[productRow] : storm::utility::zero<ValueType>();
+                    forEachEntry(memoryState, modelRow, [&value, &x] (uint64_t column, ValueType const& entryValue) { value += entryValue * x[column]; });
+                    bool isFirstRow = productRow == rowGroupIndices[productState];
+                    if (isFirstRow || (storm::solver::minimize(dir) ? value < result[productState] : value > result[productState])) {
+                        result[productState] = std::move(value);
+                        if (choices) {
+                            (*choices)[productState] = productRow - rowGroupIndices[productState];
+                        }
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> ImplicitModelMemoryProduct<ValueType>::buildTransitionMatrix() const {
+            bool hasTrivialRowGrouping = transitionMatrix.hasTrivialRowGrouping();
+            storm::storage::SparseMatrixBuilder<ValueType> builder(getNumberOfRows(), getNumberOfStates(), 0, true, !hasTrivialRowGrouping, hasTrivialRowGrouping ? 0 : getNumberOfStates());
+            for (uint64_t productState = 0; productState < getNumberOfStates(); ++productState) {
+                if (!hasTrivialRowGrouping) {
+                    builder.newRowGroup(rowGroupIndices[productState]);
+                }
+                uint64_t memoryState = getMemoryState(productState);
+                uint64_t modelRow = transitionMatrix.getRowGroupIndices()[getModelState(productState)];
+                for (uint64_t productRow = rowGroupIndices[productState]; productRow < rowGroupIndices[productState + 1]; ++productRow, ++modelRow) {
+                    // The entries of a row have to be added in ascending column order.
+                    std::vector<std::pair<uint64_t, ValueType>> entries;
+                    forEachEntry(memoryState, modelRow, [&entries] (uint64_t column, ValueType const& value) { entries.emplace_back(column, value); });
+                    std::sort(entries.begin(), entries.end(), [] (std::pair<uint64_t, ValueType> const& lhs, std::pair<uint64_t, ValueType> const& rhs) { return lhs.first < rhs.first; });
+                    for (auto const& entry : entries) {
+                        builder.addNextValue(productRow, entry.first, entry.second);
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        template class ImplicitModelMemoryProduct<double>;
+        template class ImplicitModelMemoryProduct<storm::RationalNumber>;
+    }
+}
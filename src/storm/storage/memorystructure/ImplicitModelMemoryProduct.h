@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/memorystructure/MemoryStructure.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * The product of a sparse model and a memory structure that is not materialized. Only the reachable product
+         * states are numbered (in the same order as in SparseModelMemoryProduct) whereas the rows of the product are
+         * computed on the fly from the rows of the model and the transition function of the memory structure.
+         *
+         * Compared to SparseModelMemoryProduct, this saves the product matrix as well as the table that maps every
+         * (model state, memory state) pair. The successor memory states are tabulated for every (model transition,
+         * memory state) pair with 32 bits per pair. Accessing an entry of the product then involves a lookup of the
+         * index of the successor product state among the (at most memory.getNumberOfStates()) product states of the
+         * successor model state.
+         *
+         * Multipliers for the product are obtained from storm::solver::MultiplierFactory and the qualitative analyses
+         * for reachability properties from storm::utility::graph.
+         */
+        template<typename ValueType>
+        class ImplicitModelMemoryProduct {
+        public:
+            /*!
+             * Explores the product states that are reachable from the initial states.
+             *
+             * @param transitionMatrix The transition matrix of the model.
+             * @param initialStates The initial states of the model.
+             * @param memory The memory structure. Its initial memory states refer to the initial model states (in
+             * ascending order). It is only accessed during the construction.
+             */
+            ImplicitModelMemoryProduct(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::MemoryStructure const& memory);
+
+            uint64_t getNumberOfStates() const;
+            uint64_t getNumberOfRows() const;
+
+            /*!
+             * Retrieves the transition matrix of the model.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getModelTransitionMatrix() const;
+
+            /*!
+             * Retrieves a matrix without entries that has the dimensions and the row groups of the product matrix.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getStructure() const;
+
+            /*!
+             * Retrieves the row groups of the product. The rows of a product state are the rows of its model state.
+             */
+            std::vector<uint64_t> const& getRowGroupIndices() const;
+
+            storm::storage::BitVector const& getInitialStates() const;
+
+            uint64_t getModelState(uint64_t productState) const;
+            uint64_t getMemoryState(uint64_t productState) const;
+
+            /*!
+             * Retrieves the first product state with the given model state. The product states with the same model
+             * state are numbered consecutively, i.e., they range up to getFirstProductState(modelState + 1), which is
+             * the number of product states for the last model state.
+             */
+            uint64_t getFirstProductState(uint64_t modelState) const;
+
+            /*!
+             * Retrieves the memory state that is reached when the given model transition is taken in the given memory
+             * state.
+             *
+             * @param modelTransitionIndex The index of the transition (i.e. the entry) in the model transition matrix.
+             */
+            uint64_t getSuccessorMemoryState(uint64_t memoryState, uint64_t modelTransitionIndex) const;
+
+            /*!
+             * Retrieves whether the product state with the given model and memory state is reachable.
+             */
+            bool isReachable(uint64_t modelState, uint64_t memoryState) const;
+
+            /*!
+             * Retrieves the product state with the given model and memory state, which has to be reachable.
+             */
+            uint64_t getProductState(uint64_t modelState, uint64_t memoryState) const;
+
+            /*!
+             * Retrieves the row of the model that corresponds to the given row of the product.
+             */
+            uint64_t getModelRow(uint64_t productRow) const;
+
+            /*!
+             * Lifts the given values of the model states to the product states.
+             */
+            std::vector<ValueType> liftStateValues(std::vector<ValueType> const& modelStateValues) const;
+
+            /*!
+             * Lifts the given values of the model rows to the product rows.
+             */
+            std::vector<ValueType> liftRowValues(std::vector<ValueType> const& modelRowValues) const;
+
+            /*!
+             * Lifts the given set of model states to the product states.
+             */
+            storm::storage::BitVector liftStates(storm::storage::BitVector const& modelStates) const;
+
+            /*!
+             * Multiplies the given row of the product with x and adds the result to the given value.
+             *
+             * @param productState The product state to which the row belongs.
+             */
+            void multiplyRow(uint64_t productState, uint64_t productRow, std::vector<ValueType> const& x, ValueType& value) const;
+
+            /*!
+             * Performs the multiplication result = A*x + b, where A is the product matrix.
+             *
+             * @param b If non-null, this vector (given for the product rows) is added after the multiplication.
+             * @param result The vector with one entry per product row. Must not be the same as x.
+             */
+            void multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+            /*!
+             * Performs the multiplication A*x + b and optimizes over the rows of each product state.
+             *
+             * @param result The vector with one entry per product state. Must not be the same as x.
+             * @param choices If given, the optimal (local) choices are written to this vector.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+            /*!
+             * Materializes the transition matrix of the (reachable part of the) product.
+             */
+            storm::storage::SparseMatrix<ValueType> buildTransitionMatrix() const;
+
+        private:
+            uint64_t getModelRowOfState(uint64_t productState, uint64_t productRow) const;
+
+            /*!
+             * Invokes the given callback with the column (i.e. the product state) and the value of every nonzero
+             * entry of the product row that is derived from the given model row and memory state.
+             */
+            template<typename Callback>
+            void forEachEntry(uint64_t memoryState, uint64_t modelRow, Callback const& callback) const;
+
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+            uint64_t memoryStateCount;
+
+            // For every model transition and memory state, the successor memory state at index (modelTransitionIndex * memoryStateCount) + memoryState.
+            std::vector<uint32_t> memorySuccessors;
+
+            // For every product state, the index (modelState * memoryStateCount) + memoryState in ascending order.
+            std::vector<uint64_t> productStates;
+            // For every model state, the first product state with this model state (plus the total number of product states).
+            std::vector<uint64_t> productStateIndices;
+            std::vector<uint64_t> rowGroupIndices;
+            storm::storage::BitVector initialStates;
+            storm::storage::SparseMatrix<ValueType> structure;
+        };
+
+    }
+}
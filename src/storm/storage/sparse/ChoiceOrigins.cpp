@@ -51,6 +51,14 @@ namespace storm {
                 return indexToIdentifier.size();
             }
             
+            uint64_t ChoiceOrigins::getMemoryUsage() const {
+                uint64_t result = sizeof(*this) + indexToIdentifier.capacity() * sizeof(uint_fast64_t) + identifierToInfo.capacity() * sizeof(std::string);
+                for (auto const& info : identifierToInfo) {
+                    result += info.capacity();
+                }
+                return result;
+            }
+            
 			uint_fast64_t ChoiceOrigins::getIdentifierForChoicesWithNoOrigin() {
 				return 0;
 			}
@@ -47,6 +47,11 @@ namespace storm {
                  */
                 uint_fast64_t getNumberOfChoices() const;
                 
+                /*
+                 * Returns an estimate of the number of bytes occupied by this object (excluding the input model description).
+                 */
+                virtual uint64_t getMemoryUsage() const;
+                
                 /*
                  * Returns the identifier that is used for choices without an origin in the input specification
                  * E.g., Selfloops introduced on deadlock states
@@ -0,0 +1,34 @@
+#include "storm/storage/sparse/DistributedModelComponents.h"
+
+#include <fstream>
+
+#include "storm/storage/OnDiskSparseMatrix.h"
+
+#include "storm/utility/file.h"
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+
+            template<typename ValueType, typename RewardModelType>
+            void writePartitionedModel(DistributedModelComponents<ValueType, RewardModelType> const& components, std::string const& filename) {
+                storm::storage::OnDiskSparseMatrix<ValueType>::write(components.transitionMatrix, filename + "." + std::to_string(components.rank));
+
+                if (components.rank == 0) {
+                    std::ofstream stream;
+                    storm::utility::openFile(filename, stream);
+                    stream << "parts " << (components.stateOffsets.size() - 1) << std::endl;
+                    stream << "offsets";
+                    for (auto const& offset : components.stateOffsets) {
+                        stream << " " << offset;
+                    }
+                    stream << std::endl;
+                    storm::utility::closeFile(stream);
+                }
+            }
+
+            template void writePartitionedModel(DistributedModelComponents<double> const& components, std::string const& filename);
+
+        }
+    }
+}
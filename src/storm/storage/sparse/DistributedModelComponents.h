@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "storm/models/ModelType.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+
+            /*!
+             * The components of a model whose states are partitioned across several processes (ranks). Each rank owns
+             * a contiguous range of the (global) state indices and only holds the components of its owned states.
+             */
+            template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+            struct DistributedModelComponents {
+
+                DistributedModelComponents(storm::models::ModelType modelType,
+                                           storm::storage::SparseMatrix<ValueType>&& transitionMatrix,
+                                           std::vector<uint64_t>&& stateOffsets,
+                                           uint64_t rank,
+                                           storm::models::sparse::StateLabeling&& stateLabeling = storm::models::sparse::StateLabeling(),
+                                           std::unordered_map<std::string, RewardModelType>&& rewardModels = std::unordered_map<std::string, RewardModelType>(),
+                                           bool rateTransitions = false)
+                        : modelType(modelType), transitionMatrix(std::move(transitionMatrix)), stateOffsets(std::move(stateOffsets)), rank(rank), stateLabeling(std::move(stateLabeling)), rewardModels(std::move(rewardModels)), rateTransitions(rateTransitions) {
+                    // Intentionally left empty
+                }
+
+                uint64_t getNumberOfStates() const {
+                    return stateOffsets.back();
+                }
+
+                uint64_t getFirstLocalState() const {
+                    return stateOffsets[rank];
+                }
+
+                uint64_t getNumberOfLocalStates() const {
+                    return stateOffsets[rank + 1] - stateOffsets[rank];
+                }
+
+                // The type of the model.
+                storm::models::ModelType modelType;
+                // The rows of the owned states. The row groups refer to the owned states (in the order of their global
+                // indices) whereas the columns refer to the global state indices.
+                storm::storage::SparseMatrix<ValueType> transitionMatrix;
+                // For each rank, the global index of its first state, followed by the total number of states.
+                std::vector<uint64_t> stateOffsets;
+                // The rank that owns the components.
+                uint64_t rank;
+                // The labeling of the owned states.
+                storm::models::sparse::StateLabeling stateLabeling;
+                // The reward models restricted to the owned states and rows.
+                std::unordered_map<std::string, RewardModelType> rewardModels;
+                // True iff the transition values are interpreted as rates.
+                bool rateTransitions;
+            };
+
+            /*!
+             * Writes the owned rows of the given components to the file <filename>.<rank> in the binary format of
+             * storm::storage::OnDiskSparseMatrix. In addition, the first rank writes the partition, i.e. the number of
+             * parts and the state offsets, to the file <filename>. As every rank only writes its own part, this does not
+             * require any communication.
+             */
+            template<typename ValueType, typename RewardModelType>
+            void writePartitionedModel(DistributedModelComponents<ValueType, RewardModelType> const& components, std::string const& filename);
+
+        }
+    }
+}
@@ -21,6 +21,14 @@ namespace storm {
                 return identifierToEdgeIndexSet.size();
             }
             
+            uint64_t JaniChoiceOrigins::getMemoryUsage() const {
+                uint64_t result = ChoiceOrigins::getMemoryUsage() + (sizeof(*this) - sizeof(ChoiceOrigins)) + identifierToEdgeIndexSet.capacity() * sizeof(EdgeIndexSet);
+                for (auto const& set : identifierToEdgeIndexSet) {
+                    result += set.capacity() * sizeof(uint_fast64_t);
+                }
+                return result;
+            }
+            
             storm::jani::Model const& JaniChoiceOrigins::getModel() const {
                 return *model;
             }
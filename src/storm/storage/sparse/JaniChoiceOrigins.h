@@ -37,6 +37,8 @@ namespace storm {
                  */
                 virtual uint_fast64_t getNumberOfIdentifiers() const override;
                 
+                virtual uint64_t getMemoryUsage() const override;
+                
                 /*!
                  * Retrieves the associated JANI model.
                  */
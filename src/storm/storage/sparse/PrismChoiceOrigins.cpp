@@ -26,6 +26,14 @@ namespace storm {
                 return identifierToCommandSet.size();
             }
             
+            uint64_t PrismChoiceOrigins::getMemoryUsage() const {
+                uint64_t result = ChoiceOrigins::getMemoryUsage() + (sizeof(*this) - sizeof(ChoiceOrigins)) + identifierToCommandSet.capacity() * sizeof(CommandSet);
+                for (auto const& set : identifierToCommandSet) {
+                    result += set.capacity() * sizeof(uint_fast64_t);
+                }
+                return result;
+            }
+            
             storm::prism::Program const& PrismChoiceOrigins::getProgram() const {
             	return *program;
             }
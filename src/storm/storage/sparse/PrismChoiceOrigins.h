@@ -40,6 +40,8 @@ namespace storm {
                  */
                 virtual uint_fast64_t getNumberOfIdentifiers() const override;
                 
+                virtual uint64_t getMemoryUsage() const override;
+                
                 /*
                  * Returns the prism program associated with this
                  */
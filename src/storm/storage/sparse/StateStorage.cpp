@@ -14,6 +14,11 @@ namespace storm {
                 return stateToId.size();
             }
             
+            template <typename StateType>
+            uint64_t StateStorage<StateType>::getMemoryUsage() const {
+                return sizeof(*this) - sizeof(stateToId) + stateToId.getMemoryUsage() + (initialStateIndices.capacity() + deadlockStateIndices.capacity()) * sizeof(StateType);
+            }
+            
             template struct StateStorage<uint32_t>;
             template struct StateStorage<uint_fast64_t>;
         }
@@ -29,6 +29,9 @@ namespace storm {
                 
                 // Get the number of states that were found in the exploration so far.
                 uint_fast64_t getNumberOfStates() const;
+                
+                // Get an estimate of the number of bytes occupied by the states found so far.
+                uint64_t getMemoryUsage() const;
             };
             
         }
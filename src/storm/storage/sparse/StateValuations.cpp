@@ -26,6 +26,14 @@ namespace storm {
                 return valuations.size();
             }
             
+            uint64_t StateValuations::getMemoryUsage() const {
+                uint64_t result = sizeof(*this) + (valuations.capacity() - valuations.size()) * sizeof(storm::expressions::SimpleValuation);
+                for (auto const& valuation : valuations) {
+                    result += valuation.getMemoryUsage();
+                }
+                return result;
+            }
+            
             StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
                 return StateValuations(storm::utility::vector::filterVector(valuations, selectedStates));
             }
@@ -32,6 +32,9 @@ namespace storm {
                 // Returns the number of states that this object describes.
                 uint_fast64_t getNumberOfStates() const;
                 
+                // Returns an estimate of the number of bytes occupied by the valuations.
+                uint64_t getMemoryUsage() const;
+                
                 /*
                  * Derive new state valuations from this by selecting the given states.
                  */
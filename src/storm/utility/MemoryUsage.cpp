@@ -0,0 +1,106 @@
+#include "storm/utility/MemoryUsage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+#include "storm/utility/Metrics.h"
+
+namespace storm {
+    namespace utility {
+        namespace memory {
+
+            static std::atomic<uint64_t> peakSolverCacheUsage(0);
+            static std::atomic<uint64_t> stateStorageUsage(0);
+
+            std::string formatBytes(uint64_t bytes) {
+                static const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+                double value = static_cast<double>(bytes);
+                uint64_t unit = 0;
+                while (value >= 1024.0 && unit < 4) {
+                    value /= 1024.0;
+                    ++unit;
+                }
+                std::stringstream stream;
+                if (unit == 0) {
+                    stream << bytes << " " << units[unit];
+                } else {
+                    stream << std::fixed << std::setprecision(1) << value << " " << units[unit];
+                }
+                return stream.str();
+            }
+
+            void recordSolverCacheUsage(uint64_t bytes) {
+                uint64_t previous = peakSolverCacheUsage.load(std::memory_order_relaxed);
+                while (previous < bytes && !peakSolverCacheUsage.compare_exchange_weak(previous, bytes, std::memory_order_relaxed)) {
+                    // Intentionally left empty.
+                }
+                if (bytes > previous && storm::utility::metrics::isEnabled()) {
+                    storm::utility::metrics::setGauge("storm_solver_cache_peak_bytes", "Largest amount of memory occupied by the cached data of a solver.", static_cast<double>(bytes));
+                }
+            }
+
+            uint64_t getPeakSolverCacheUsage() {
+                return peakSolverCacheUsage.load(std::memory_order_relaxed);
+            }
+
+            void resetPeakSolverCacheUsage() {
+                peakSolverCacheUsage.store(0, std::memory_order_relaxed);
+            }
+
+            void recordStateStorageUsage(uint64_t bytes) {
+                stateStorageUsage.store(bytes, std::memory_order_relaxed);
+                if (storm::utility::metrics::isEnabled()) {
+                    storm::utility::metrics::setGauge("storm_state_storage_bytes", "Memory occupied by the state storage of the explicit model builder.", static_cast<double>(bytes));
+                }
+            }
+
+            uint64_t getStateStorageUsage() {
+                return stateStorageUsage.load(std::memory_order_relaxed);
+            }
+
+            MemoryUsageBreakdown::MemoryUsageBreakdown(std::string const& title) : title(title) {
+                // Intentionally left empty.
+            }
+
+            void MemoryUsageBreakdown::add(std::string const& name, uint64_t bytes) {
+                components.emplace_back(name, bytes);
+            }
+
+            uint64_t MemoryUsageBreakdown::getTotal() const {
+                uint64_t total = 0;
+                for (auto const& component : components) {
+                    total += component.second;
+                }
+                return total;
+            }
+
+            void MemoryUsageBreakdown::printToStream(std::ostream& out) const {
+                uint64_t total = getTotal();
+                std::size_t width = 5;
+                for (auto const& component : components) {
+                    width = std::max(width, component.first.size());
+                }
+
+                std::ios_base::fmtflags flags = out.flags();
+                std::streamsize precision = out.precision();
+                out << title << ":" << std::endl;
+                for (auto const& component : components) {
+                    double share = total == 0 ? 0.0 : 100.0 * static_cast<double>(component.second) / static_cast<double>(total);
+                    out << "  " << std::left << std::setw(width) << component.first << "  " << std::right << std::setw(10) << formatBytes(component.second) << "  (" << std::fixed << std::setprecision(1) << std::setw(5) << share << "%)" << std::endl;
+                }
+                out << "  " << std::left << std::setw(width) << "Total" << "  " << std::right << std::setw(10) << formatBytes(total) << std::endl;
+                out << "  Resident set size: " << formatBytes(storm::utility::metrics::getResidentSetSize()) << " (peak: " << formatBytes(storm::utility::metrics::getPeakResidentSetSize()) << ")" << std::endl;
+                out.flags(flags);
+                out.precision(precision);
+            }
+
+            std::ostream& operator<<(std::ostream& out, MemoryUsageBreakdown const& breakdown) {
+                breakdown.printToStream(out);
+                return out;
+            }
+
+        }
+    }
+}
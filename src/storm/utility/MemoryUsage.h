@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+        namespace memory {
+
+            /*!
+             * Formats the given number of bytes in a human-readable way, e.g. 1.5 MiB.
+             */
+            std::string formatBytes(uint64_t bytes);
+
+            /*!
+             * Records the memory occupied by the cached data of a solver. This is to be called right before the cache
+             * is freed, such that the peak over all solvers can be reported afterwards.
+             */
+            void recordSolverCacheUsage(uint64_t bytes);
+
+            /*!
+             * Retrieves the largest solver cache recorded since the last reset.
+             */
+            uint64_t getPeakSolverCacheUsage();
+
+            /*!
+             * Resets the largest recorded solver cache, e.g. before checking the next property.
+             */
+            void resetPeakSolverCacheUsage();
+
+            /*!
+             * Records the memory occupied by the state storage of the last model that was built explicitly. This is to
+             * be called right before the state storage is freed, i.e., before the model builder is destroyed.
+             */
+            void recordStateStorageUsage(uint64_t bytes);
+
+            /*!
+             * Retrieves the memory occupied by the state storage of the last model that was built explicitly, if any.
+             */
+            uint64_t getStateStorageUsage();
+
+            /*!
+             * Collects the memory occupied by the components of some object (e.g. a model) and prints them along with
+             * their share of the total and the resident set size of the process.
+             */
+            class MemoryUsageBreakdown {
+            public:
+                MemoryUsageBreakdown(std::string const& title);
+
+                /*!
+                 * Adds a component with the given name that occupies the given number of bytes.
+                 */
+                void add(std::string const& name, uint64_t bytes);
+
+                /*!
+                 * Retrieves the number of bytes occupied by all components.
+                 */
+                uint64_t getTotal() const;
+
+                void printToStream(std::ostream& out) const;
+
+            private:
+                std::string title;
+                std::vector<std::pair<std::string, uint64_t>> components;
+            };
+
+            std::ostream& operator<<(std::ostream& out, MemoryUsageBreakdown const& breakdown);
+
+        }
+    }
+}
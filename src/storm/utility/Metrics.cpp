@@ -0,0 +1,382 @@
+#include "storm/utility/Metrics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+
+namespace storm {
+    namespace utility {
+        namespace metrics {
+
+            static const std::string unixSocketPrefix = "unix:";
+
+            struct MetricFamily {
+                std::string help;
+                std::string type;
+                // The samples of the family indexed by their labels.
+                std::map<std::string, double> samples;
+            };
+
+            struct PhaseTime {
+                // The time spent in all completed runs of the phase.
+                std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+                bool running = false;
+                std::chrono::steady_clock::time_point start;
+            };
+
+            struct MetricsRegistry;
+            static void stopExportThread(MetricsRegistry& registry);
+
+            struct MetricsRegistry {
+                ~MetricsRegistry() {
+                    stopExportThread(*this);
+                }
+
+                std::atomic<bool> enabled{false};
+                std::chrono::steady_clock::time_point timeOfStart = std::chrono::steady_clock::now();
+
+                // Guards the families and phases.
+                std::mutex mutex;
+                std::map<std::string, MetricFamily> families;
+                std::map<std::string, PhaseTime> phases;
+
+                // The state of the export.
+                std::string target;
+                bool toSocket = false;
+                int socketDescriptor = -1;
+                std::chrono::seconds interval{5};
+                std::thread exportThread;
+                std::mutex exportMutex;
+                std::condition_variable exportStopped;
+                bool stopRequested = false;
+            };
+
+            static MetricsRegistry& getRegistry() {
+                static MetricsRegistry registry;
+                return registry;
+            }
+
+            bool isEnabled() {
+                return getRegistry().enabled.load(std::memory_order_relaxed);
+            }
+
+            void setEnabled(bool enabled) {
+                MetricsRegistry& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                registry.enabled = enabled;
+                if (!enabled) {
+                    registry.families.clear();
+                    registry.phases.clear();
+                }
+            }
+
+            static void updateSample(std::string const& name, std::string const& help, std::string const& type, std::string const& labels, double value, bool add) {
+                MetricsRegistry& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                MetricFamily& family = registry.families[name];
+                if (family.type.empty()) {
+                    family.help = help;
+                    family.type = type;
+                }
+                STORM_LOG_ASSERT(family.type == type, "Metric '" << name << "' is used as " << family.type << " and " << type << ".");
+                if (add) {
+                    family.samples[labels] += value;
+                } else {
+                    family.samples[labels] = value;
+                }
+            }
+
+            void setGauge(std::string const& name, std::string const& help, double value, std::string const& labels) {
+                if (isEnabled()) {
+                    updateSample(name, help, "gauge", labels, value, false);
+                }
+            }
+
+            void incrementCounter(std::string const& name, std::string const& help, double increment, std::string const& labels) {
+                if (isEnabled()) {
+                    STORM_LOG_ASSERT(increment >= 0.0, "Counters may only be incremented.");
+                    updateSample(name, help, "counter", labels, increment, true);
+                }
+            }
+
+            void startPhase(std::string const& phase) {
+                if (isEnabled()) {
+                    MetricsRegistry& registry = getRegistry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    PhaseTime& phaseTime = registry.phases[phase];
+                    if (!phaseTime.running) {
+                        phaseTime.running = true;
+                        phaseTime.start = std::chrono::steady_clock::now();
+                    }
+                }
+            }
+
+            void stopPhase(std::string const& phase) {
+                if (isEnabled()) {
+                    MetricsRegistry& registry = getRegistry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    auto phaseIt = registry.phases.find(phase);
+                    if (phaseIt != registry.phases.end() && phaseIt->second.running) {
+                        phaseIt->second.running = false;
+                        phaseIt->second.elapsed += std::chrono::steady_clock::now() - phaseIt->second.start;
+                    }
+                }
+            }
+
+            ScopedPhase::ScopedPhase(std::string const& phase) : phase(phase) {
+                startPhase(phase);
+            }
+
+            ScopedPhase::~ScopedPhase() {
+                stopPhase(phase);
+            }
+
+            uint64_t getResidentSetSize() {
+#ifdef LINUX
+                // The second entry of statm is the number of resident pages.
+                std::ifstream statm("/proc/self/statm");
+                uint64_t totalPages = 0;
+                uint64_t residentPages = 0;
+                if (statm >> totalPages >> residentPages) {
+                    return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+                }
+                return 0;
+#else
+                // Fall back to the peak, which is the best approximation that is portably available.
+                return getPeakResidentSetSize();
+#endif
+            }
+
+            uint64_t getPeakResidentSetSize() {
+                struct rusage ru;
+                getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+                // For Mac OS, this is returned in bytes.
+                return static_cast<uint64_t>(ru.ru_maxrss);
+#else
+                // For Linux, this is returned in kilobytes.
+                return static_cast<uint64_t>(ru.ru_maxrss) * 1024;
+#endif
+            }
+
+            static std::string escapeLabelValue(std::string const& value) {
+                std::string result;
+                for (auto const& character : value) {
+                    if (character == '\\' || character == '"') {
+                        result.push_back('\\');
+                        result.push_back(character);
+                    } else if (character == '\n') {
+                        result += "\\n";
+                    } else {
+                        result.push_back(character);
+                    }
+                }
+                return result;
+            }
+
+            static void writeFamily(std::ostream& out, std::string const& name, MetricFamily const& family) {
+                out << "# HELP " << name << " " << family.help << '\n';
+                out << "# TYPE " << name << " " << family.type << '\n';
+                for (auto const& sample : family.samples) {
+                    out << name;
+                    if (!sample.first.empty()) {
+                        out << "{" << sample.first << "}";
+                    }
+                    out << " " << sample.second << '\n';
+                }
+            }
+
+            void writeMetrics(std::ostream& out) {
+                MetricsRegistry& registry = getRegistry();
+                auto now = std::chrono::steady_clock::now();
+
+                // The process metrics are computed on demand.
+                std::map<std::string, MetricFamily> processFamilies;
+                processFamilies["storm_resident_memory_bytes"] = {"Resident set size of the process in bytes.", "gauge", {{"", static_cast<double>(getResidentSetSize())}}};
+                processFamilies["storm_peak_resident_memory_bytes"] = {"Peak resident set size of the process in bytes.", "gauge", {{"", static_cast<double>(getPeakResidentSetSize())}}};
+                processFamilies["storm_uptime_seconds"] = {"Time since the collection of metrics was started.", "gauge", {{"", std::chrono::duration<double>(now - registry.timeOfStart).count()}}};
+
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                if (!registry.phases.empty()) {
+                    MetricFamily& phaseFamily = processFamilies["storm_phase_elapsed_seconds"];
+                    phaseFamily.help = "Time spent in the phases of the computation (including the running one).";
+                    phaseFamily.type = "gauge";
+                    for (auto const& phase : registry.phases) {
+                        auto elapsed = phase.second.elapsed;
+                        if (phase.second.running) {
+                            elapsed += now - phase.second.start;
+                        }
+                        phaseFamily.samples["phase=\"" + escapeLabelValue(phase.first) + "\""] = std::chrono::duration<double>(elapsed).count();
+                    }
+                }
+
+                std::streamsize oldPrecision = out.precision(std::numeric_limits<double>::max_digits10);
+                for (auto const& family : processFamilies) {
+                    writeFamily(out, family.first, family.second);
+                }
+                for (auto const& family : registry.families) {
+                    writeFamily(out, family.first, family.second);
+                }
+                out.precision(oldPrecision);
+            }
+
+            static bool writeMetricsFile(std::string const& filename) {
+                // Write to a temporary file first, such that readers never see a partially written file.
+                std::string temporaryFilename = filename + ".tmp";
+                {
+                    std::ofstream file(temporaryFilename, std::ios::out | std::ios::trunc);
+                    if (!file) {
+                        return false;
+                    }
+                    writeMetrics(file);
+                    if (!file) {
+                        return false;
+                    }
+                }
+                return std::rename(temporaryFilename.c_str(), filename.c_str()) == 0;
+            }
+
+            static void answerConnection(int connectionDescriptor) {
+                // Consume (and ignore) the request, if the client sends one in time.
+                pollfd request = {connectionDescriptor, POLLIN, 0};
+                if (poll(&request, 1, 100) > 0) {
+                    char buffer[4096];
+                    if (recv(connectionDescriptor, buffer, sizeof(buffer), 0) < 0) {
+                        return;
+                    }
+                }
+
+                std::stringstream body;
+                writeMetrics(body);
+                std::string content = body.str();
+                std::stringstream response;
+                response << "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " << content.size() << "\r\n\r\n" << content;
+                std::string message = response.str();
+                std::size_t written = 0;
+                while (written < message.size()) {
+                    ssize_t result = send(connectionDescriptor, message.data() + written, message.size() - written, 0);
+                    if (result <= 0) {
+                        return;
+                    }
+                    written += static_cast<std::size_t>(result);
+                }
+            }
+
+            static void exportMetrics() {
+                MetricsRegistry& registry = getRegistry();
+                std::unique_lock<std::mutex> lock(registry.exportMutex);
+                if (registry.toSocket) {
+                    while (!registry.stopRequested) {
+                        lock.unlock();
+                        // Wake up regularly to check whether the export was stopped.
+                        pollfd incoming = {registry.socketDescriptor, POLLIN, 0};
+                        if (poll(&incoming, 1, 200) > 0) {
+                            int connectionDescriptor = accept(registry.socketDescriptor, nullptr, nullptr);
+                            if (connectionDescriptor >= 0) {
+                                answerConnection(connectionDescriptor);
+                                close(connectionDescriptor);
+                            }
+                        }
+                        lock.lock();
+                    }
+                } else {
+                    while (!registry.exportStopped.wait_for(lock, registry.interval, [&registry] () { return registry.stopRequested; })) {
+                        if (!writeMetricsFile(registry.target)) {
+                            STORM_LOG_WARN("Unable to write metrics to file '" << registry.target << "'.");
+                        }
+                    }
+                }
+            }
+
+            static int openUnixSocket(std::string const& path) {
+                sockaddr_un address = {};
+                address.sun_family = AF_UNIX;
+                STORM_LOG_THROW(path.size() < sizeof(address.sun_path), storm::exceptions::FileIoException, "The socket path '" << path << "' is too long.");
+                path.copy(address.sun_path, path.size());
+
+                // Only replace a stale socket, never a regular file.
+                struct stat status;
+                if (stat(path.c_str(), &status) == 0) {
+                    STORM_LOG_THROW(S_ISSOCK(status.st_mode), storm::exceptions::FileIoException, "Refusing to replace '" << path << "' by a socket.");
+                    unlink(path.c_str());
+                }
+
+                int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+                STORM_LOG_THROW(descriptor >= 0, storm::exceptions::FileIoException, "Unable to create a unix socket.");
+                if (bind(descriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(descriptor, 8) != 0) {
+                    close(descriptor);
+                    STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to listen on socket '" << path << "'.");
+                }
+                return descriptor;
+            }
+
+            void startExport(std::string const& target, uint64_t intervalInSeconds) {
+                MetricsRegistry& registry = getRegistry();
+                STORM_LOG_THROW(!registry.exportThread.joinable(), storm::exceptions::FileIoException, "Metrics are already being exported.");
+                STORM_LOG_THROW(!target.empty(), storm::exceptions::FileIoException, "No target for the metrics was given.");
+
+                registry.toSocket = target.compare(0, unixSocketPrefix.size(), unixSocketPrefix) == 0;
+                registry.target = registry.toSocket ? target.substr(unixSocketPrefix.size()) : target;
+                registry.interval = std::chrono::seconds(std::max<uint64_t>(1, intervalInSeconds));
+                registry.stopRequested = false;
+                registry.timeOfStart = std::chrono::steady_clock::now();
+
+                if (registry.toSocket) {
+                    registry.socketDescriptor = openUnixSocket(registry.target);
+                } else {
+                    // Write once right away to detect an unwritable target early.
+                    STORM_LOG_THROW(writeMetricsFile(registry.target), storm::exceptions::FileIoException, "Unable to write metrics to file '" << registry.target << "'.");
+                }
+                registry.enabled = true;
+                registry.exportThread = std::thread(&exportMetrics);
+                STORM_LOG_INFO("Exporting metrics to " << (registry.toSocket ? "socket '" : "file '") << registry.target << "'.");
+            }
+
+            static void stopExportThread(MetricsRegistry& registry) {
+                if (registry.exportThread.joinable()) {
+                    {
+                        std::lock_guard<std::mutex> lock(registry.exportMutex);
+                        registry.stopRequested = true;
+                    }
+                    registry.exportStopped.notify_all();
+                    registry.exportThread.join();
+                }
+                if (registry.socketDescriptor >= 0) {
+                    close(registry.socketDescriptor);
+                    registry.socketDescriptor = -1;
+                    unlink(registry.target.c_str());
+                }
+            }
+
+            void stopExport() {
+                MetricsRegistry& registry = getRegistry();
+                if (!registry.exportThread.joinable()) {
+                    return;
+                }
+                stopExportThread(registry);
+                if (!registry.toSocket && !writeMetricsFile(registry.target)) {
+                    STORM_LOG_WARN("Unable to write metrics to file '" << registry.target << "'.");
+                }
+            }
+
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace storm {
+    namespace utility {
+        namespace metrics {
+
+            /*!
+             * Retrieves whether metrics are collected. As long as this is not the case, all updates are ignored, so
+             * callers may use this to skip computing values that would be discarded anyway.
+             */
+            bool isEnabled();
+
+            /*!
+             * Enables or disables the collection of metrics. Disabling drops all values collected so far.
+             */
+            void setEnabled(bool enabled);
+
+            /*!
+             * Sets the gauge with the given name (and labels) to the given value.
+             *
+             * @param name The name of the metric, e.g. storm_explored_states.
+             * @param help A description of the metric.
+             * @param value The new value.
+             * @param labels The labels of the sample in exposition format (without braces), e.g. phase="building".
+             */
+            void setGauge(std::string const& name, std::string const& help, double value, std::string const& labels = "");
+
+            /*!
+             * Increments the counter with the given name (and labels) by the given (non-negative) amount.
+             */
+            void incrementCounter(std::string const& name, std::string const& help, double increment = 1.0, std::string const& labels = "");
+
+            /*!
+             * Starts (or restarts) measuring the time spent in the given phase. The time of all runs of a phase is
+             * summed up and exported as storm_phase_elapsed_seconds.
+             */
+            void startPhase(std::string const& phase);
+
+            /*!
+             * Stops measuring the time spent in the given phase.
+             */
+            void stopPhase(std::string const& phase);
+
+            /*!
+             * Measures the time spent in the given phase during its lifetime.
+             */
+            class ScopedPhase {
+            public:
+                ScopedPhase(std::string const& phase);
+                ~ScopedPhase();
+
+                ScopedPhase(ScopedPhase const& other) = delete;
+                ScopedPhase& operator=(ScopedPhase const& other) = delete;
+
+            private:
+                std::string phase;
+            };
+
+            /*!
+             * Retrieves the current resident set size of this process in bytes (zero if it can not be determined).
+             */
+            uint64_t getResidentSetSize();
+
+            /*!
+             * Retrieves the peak resident set size of this process in bytes.
+             */
+            uint64_t getPeakResidentSetSize();
+
+            /*!
+             * Writes all collected metrics and the process metrics (resident set size, uptime) to the given stream in
+             * the Prometheus text exposition format.
+             */
+            void writeMetrics(std::ostream& out);
+
+            /*!
+             * Enables the collection of metrics and starts a background thread that periodically exports them.
+             *
+             * @param target Either a file name or "unix:<path>". A file is rewritten atomically (i.e. written to a
+             * temporary file that is then renamed) after every interval, such that it can be picked up by the textfile
+             * collector of the node exporter. For a unix socket, the given path is listened on and every connection is
+             * answered with the current metrics as HTTP response, e.g. for curl --unix-socket <path> http://localhost/.
+             * @param intervalInSeconds The delay between two exports to a file.
+             */
+            void startExport(std::string const& target, uint64_t intervalInSeconds);
+
+            /*!
+             * Stops a running export. A file target is written one last time, such that it holds the final values.
+             */
+            void stopExport();
+
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <algorithm>
+
+namespace storm {
+    namespace utility {
+
+        ThreadPool::ThreadPool(uint64_t numberOfThreads) : stopped(false) {
+            if (numberOfThreads == 0) {
+                numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+            }
+            workers.reserve(numberOfThreads);
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                workers.emplace_back(&ThreadPool::work, this);
+            }
+        }
+
+        ThreadPool::~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopped = true;
+            }
+            jobAvailable.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        uint64_t ThreadPool::getNumberOfThreads() const {
+            return workers.size();
+        }
+
+        void ThreadPool::work() {
+            while (true) {
+                std::function<void()> job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    jobAvailable.wait(lock, [this] () { return stopped || !jobs.empty(); });
+                    // Remaining jobs are still executed after the pool was stopped.
+                    if (jobs.empty()) {
+                        return;
+                    }
+                    job = std::move(jobs.front());
+                    jobs.pop();
+                }
+                job();
+            }
+        }
+
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A fixed number of worker threads that execute submitted jobs in the order of their submission.
+         * Destroying the pool waits until all submitted jobs are finished.
+         */
+        class ThreadPool {
+        public:
+            /*!
+             * Starts the worker threads.
+             *
+             * @param numberOfThreads The number of worker threads. If zero, the number of hardware threads is used.
+             */
+            ThreadPool(uint64_t numberOfThreads = 0);
+
+            ThreadPool(ThreadPool const& other) = delete;
+            ThreadPool& operator=(ThreadPool const& other) = delete;
+
+            ~ThreadPool();
+
+            /*!
+             * Submits the given job to the pool.
+             *
+             * @return A future that holds the result of the job (or the exception thrown by it).
+             */
+            template<typename Job>
+            std::future<typename std::result_of<Job()>::type> submit(Job&& job) {
+                typedef typename std::result_of<Job()>::type ResultType;
+                // A packaged task is not copyable, so it is wrapped in a shared pointer to fit into a std::function.
+                auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Job>(job));
+                std::future<ResultType> result = task->get_future();
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    jobs.emplace([task] () { (*task)(); });
+                }
+                jobAvailable.notify_one();
+                return result;
+            }
+
+            uint64_t getNumberOfThreads() const;
+
+        private:
+            void work();
+
+            std::vector<std::thread> workers;
+            std::queue<std::function<void()>> jobs;
+            std::mutex mutex;
+            std::condition_variable jobAvailable;
+            bool stopped;
+        };
+
+    }
+}
@@ -11,6 +11,7 @@
 
 #include "storm/abstraction/ExplicitGameStrategyPair.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/memorystructure/ImplicitModelMemoryProduct.h"
 
 #include "storm/models/symbolic/DeterministicModel.h"
 #include "storm/models/symbolic/NondeterministicModel.h"
@@ -24,6 +25,7 @@
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include <algorithm>
 #include <queue>
 
 namespace storm {
@@ -950,6 +952,264 @@ namespace storm {
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates, psiStates);
             }
+            
+            namespace {
+                /*!
+                 * Provides the successors and predecessors of the states of a model-memory product. The transitions
+                 * that lead to a model state are collected once, which only requires space in the size of the model.
+                 */
+                template <typename T>
+                class ImplicitProductGraph {
+                public:
+                    ImplicitProductGraph(storm::storage::ImplicitModelMemoryProduct<T> const& product) : product(product) {
+                        storm::storage::SparseMatrix<T> const& transitionMatrix = product.getModelTransitionMatrix();
+                        incomingTransitionIndices.assign(transitionMatrix.getColumnCount() + 1, 0);
+                        for (auto const& entry : transitionMatrix) {
+                            if (!storm::utility::isZero(entry.getValue())) {
+                                ++incomingTransitionIndices[entry.getColumn() + 1];
+                            }
+                        }
+                        for (uint64_t modelState = 1; modelState < incomingTransitionIndices.size(); ++modelState) {
+                            incomingTransitionIndices[modelState] += incomingTransitionIndices[modelState - 1];
+                        }
+                        incomingTransitions.resize(incomingTransitionIndices.back());
+                        std::vector<uint64_t> nextPositions(incomingTransitionIndices.begin(), incomingTransitionIndices.end() - 1);
+                        for (uint64_t modelState = 0; modelState < transitionMatrix.getRowGroupCount(); ++modelState) {
+                            for (uint64_t modelRow = transitionMatrix.getRowGroupIndices()[modelState]; modelRow < transitionMatrix.getRowGroupIndices()[modelState + 1]; ++modelRow) {
+                                for (auto entryIt = transitionMatrix.begin(modelRow), entryIte = transitionMatrix.end(modelRow); entryIt != entryIte; ++entryIt) {
+                                    if (!storm::utility::isZero(entryIt->getValue())) {
+                                        incomingTransitions[nextPositions[entryIt->getColumn()]++] = std::make_pair(modelState, static_cast<uint64_t>(entryIt - transitionMatrix.begin()));
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    
+                    /*!
+                     * Retrieves the successors of the given product row. The returned vector is overwritten by the next call.
+                     */
+                    std::vector<uint64_t> const& getSuccessors(uint64_t productState, uint64_t productRow) {
+                        storm::storage::SparseMatrix<T> const& transitionMatrix = product.getModelTransitionMatrix();
+                        uint64_t memoryState = product.getMemoryState(productState);
+                        uint64_t modelRow = transitionMatrix.getRowGroupIndices()[product.getModelState(productState)] + (productRow - product.getRowGroupIndices()[productState]);
+                        successors.clear();
+                        for (auto entryIt = transitionMatrix.begin(modelRow), entryIte = transitionMatrix.end(modelRow); entryIt != entryIte; ++entryIt) {
+                            if (!storm::utility::isZero(entryIt->getValue())) {
+                                successors.push_back(product.getProductState(entryIt->getColumn(), product.getSuccessorMemoryState(memoryState, entryIt - transitionMatrix.begin())));
+                            }
+                        }
+                        return successors;
+                    }
+                    
+                    /*!
+                     * Retrieves the predecessors of the given product state (possibly with duplicates). The returned
+                     * vector is overwritten by the next call.
+                     */
+                    std::vector<uint64_t> const& getPredecessors(uint64_t productState) {
+                        uint64_t modelState = product.getModelState(productState);
+                        uint64_t memoryState = product.getMemoryState(productState);
+                        predecessors.clear();
+                        for (uint64_t index = incomingTransitionIndices[modelState]; index < incomingTransitionIndices[modelState + 1]; ++index) {
+                            uint64_t predecessorModelState = incomingTransitions[index].first;
+                            // Only the reachable product states of the predecessor model state are considered.
+                            for (uint64_t predecessor = product.getFirstProductState(predecessorModelState); predecessor < product.getFirstProductState(predecessorModelState + 1); ++predecessor) {
+                                if (product.getSuccessorMemoryState(product.getMemoryState(predecessor), incomingTransitions[index].second) == memoryState) {
+                                    predecessors.push_back(predecessor);
+                                }
+                            }
+                        }
+                        return predecessors;
+                    }
+                    
+                private:
+                    storm::storage::ImplicitModelMemoryProduct<T> const& product;
+                    
+                    // For every model state, the (source model state, transition index) pairs of its incoming transitions.
+                    std::vector<uint64_t> incomingTransitionIndices;
+                    std::vector<std::pair<uint64_t, uint64_t>> incomingTransitions;
+                    
+                    std::vector<uint64_t> successors;
+                    std::vector<uint64_t> predecessors;
+                };
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProb0A(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                ImplicitProductGraph<T> graph(product);
+                
+                // Perform a backward search from the psi states through the phi states.
+                storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+                while (!stack.empty()) {
+                    uint_fast64_t currentState = stack.back();
+                    stack.pop_back();
+                    for (auto const& predecessor : graph.getPredecessors(currentState)) {
+                        if (phiStates.get(predecessor) && !statesWithProbabilityGreater0.get(predecessor)) {
+                            statesWithProbabilityGreater0.set(predecessor, true);
+                            stack.push_back(predecessor);
+                        }
+                    }
+                }
+                
+                statesWithProbabilityGreater0.complement();
+                return statesWithProbabilityGreater0;
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProb1E(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                ImplicitProductGraph<T> graph(product);
+                std::vector<uint64_t> const& rowGroupIndices = product.getRowGroupIndices();
+                
+                // Perform the loop as long as the set of states gets smaller.
+                storm::storage::BitVector currentStates(product.getNumberOfStates(), true);
+                std::vector<uint_fast64_t> stack;
+                bool done = false;
+                while (!done) {
+                    storm::storage::BitVector nextStates(psiStates);
+                    stack.assign(psiStates.begin(), psiStates.end());
+                    while (!stack.empty()) {
+                        uint_fast64_t currentState = stack.back();
+                        stack.pop_back();
+                        // The predecessors are copied, because the successors of the predecessors are retrieved below.
+                        std::vector<uint64_t> predecessors = graph.getPredecessors(currentState);
+                        for (auto const& predecessor : predecessors) {
+                            if (phiStates.get(predecessor) && !nextStates.get(predecessor)) {
+                                // Check whether the predecessor has only successors in the current state set for one of the
+                                // nondeterminstic choices.
+                                for (uint64_t row = rowGroupIndices[predecessor]; row < rowGroupIndices[predecessor + 1]; ++row) {
+                                    bool allSuccessorsInCurrentStates = true;
+                                    bool hasNextStateSuccessor = false;
+                                    for (auto const& successor : graph.getSuccessors(predecessor, row)) {
+                                        if (!currentStates.get(successor)) {
+                                            allSuccessorsInCurrentStates = false;
+                                            break;
+                                        } else if (nextStates.get(successor)) {
+                                            hasNextStateSuccessor = true;
+                                        }
+                                    }
+                                    if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                                        nextStates.set(predecessor, true);
+                                        stack.push_back(predecessor);
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    
+                    // Check whether we need to perform an additional iteration.
+                    if (currentStates == nextStates) {
+                        done = true;
+                    } else {
+                        currentStates = std::move(nextStates);
+                    }
+                }
+                return currentStates;
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProb0E(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                ImplicitProductGraph<T> graph(product);
+                std::vector<uint64_t> const& rowGroupIndices = product.getRowGroupIndices();
+                
+                // Perform a backward search from the psi states through the phi states for which every choice has a
+                // successor that was already found.
+                storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+                while (!stack.empty()) {
+                    uint_fast64_t currentState = stack.back();
+                    stack.pop_back();
+                    std::vector<uint64_t> predecessors = graph.getPredecessors(currentState);
+                    for (auto const& predecessor : predecessors) {
+                        if (phiStates.get(predecessor) && !statesWithProbabilityGreater0.get(predecessor)) {
+                            bool addToStatesWithProbabilityGreater0 = true;
+                            for (uint64_t row = rowGroupIndices[predecessor]; row < rowGroupIndices[predecessor + 1]; ++row) {
+                                auto const& successors = graph.getSuccessors(predecessor, row);
+                                if (std::none_of(successors.begin(), successors.end(), [&statesWithProbabilityGreater0] (uint64_t successor) { return statesWithProbabilityGreater0.get(successor); })) {
+                                    addToStatesWithProbabilityGreater0 = false;
+                                    break;
+                                }
+                            }
+                            if (addToStatesWithProbabilityGreater0) {
+                                statesWithProbabilityGreater0.set(predecessor, true);
+                                stack.push_back(predecessor);
+                            }
+                        }
+                    }
+                }
+                
+                statesWithProbabilityGreater0.complement();
+                return statesWithProbabilityGreater0;
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProb1A(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                ImplicitProductGraph<T> graph(product);
+                std::vector<uint64_t> const& rowGroupIndices = product.getRowGroupIndices();
+                
+                // Perform the loop as long as the set of states gets smaller.
+                storm::storage::BitVector currentStates(product.getNumberOfStates(), true);
+                std::vector<uint_fast64_t> stack;
+                bool done = false;
+                while (!done) {
+                    storm::storage::BitVector nextStates(psiStates);
+                    stack.assign(psiStates.begin(), psiStates.end());
+                    while (!stack.empty()) {
+                        uint_fast64_t currentState = stack.back();
+                        stack.pop_back();
+                        std::vector<uint64_t> predecessors = graph.getPredecessors(currentState);
+                        for (auto const& predecessor : predecessors) {
+                            if (phiStates.get(predecessor) && !nextStates.get(predecessor)) {
+                                // Check whether the predecessor has only successors in the current state set for all of the
+                                // nondeterminstic choices and that for each choice there exists a successor that is already
+                                // in the next states.
+                                bool addToStatesWithProbability1 = true;
+                                for (uint64_t row = rowGroupIndices[predecessor]; row < rowGroupIndices[predecessor + 1] && addToStatesWithProbability1; ++row) {
+                                    bool hasAtLeastOneSuccessorWithProbability1 = false;
+                                    for (auto const& successor : graph.getSuccessors(predecessor, row)) {
+                                        if (!currentStates.get(successor)) {
+                                            addToStatesWithProbability1 = false;
+                                            break;
+                                        }
+                                        if (nextStates.get(successor)) {
+                                            hasAtLeastOneSuccessorWithProbability1 = true;
+                                        }
+                                    }
+                                    addToStatesWithProbability1 &= hasAtLeastOneSuccessorWithProbability1;
+                                }
+                                if (addToStatesWithProbability1) {
+                                    nextStates.set(predecessor, true);
+                                    stack.push_back(predecessor);
+                                }
+                            }
+                        }
+                    }
+                    
+                    // Check whether we need to perform an additional iteration.
+                    if (currentStates == nextStates) {
+                        done = true;
+                    } else {
+                        currentStates = std::move(nextStates);
+                    }
+                }
+                return currentStates;
+            }
+            
+            template <typename T>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+                result.first = performProb0A(product, phiStates, psiStates);
+                result.second = performProb1E(product, phiStates, psiStates);
+                return result;
+            }
+            
+            template <typename T>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+                result.first = performProb0E(product, phiStates, psiStates);
+                result.second = performProb1A(product, phiStates, psiStates);
+                return result;
+            }
 
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Bdd<Type> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates) {
@@ -1755,6 +2015,13 @@ namespace storm {
 			template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<storm::Interval>> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 #endif
             
+            template storm::storage::BitVector performProb0A(storm::storage::ImplicitModelMemoryProduct<double> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template storm::storage::BitVector performProb1E(storm::storage::ImplicitModelMemoryProduct<double> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template storm::storage::BitVector performProb0E(storm::storage::ImplicitModelMemoryProduct<double> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template storm::storage::BitVector performProb1A(storm::storage::ImplicitModelMemoryProduct<double> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::ImplicitModelMemoryProduct<double> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::ImplicitModelMemoryProduct<double> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
             template ExplicitGameProb01Result performProb0(storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<uint64_t> const& player1RowGrouping, storm::storage::SparseMatrix<double> const& player1BackwardTransitions, std::vector<uint64_t> const& player2BackwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::OptimizationDirection const& player1Direction, storm::OptimizationDirection const& player2Direction, storm::abstraction::ExplicitGameStrategyPair* strategyPair);
             
             template ExplicitGameProb01Result performProb1(storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<uint64_t> const& player1RowGrouping, storm::storage::SparseMatrix<double> const& player1BackwardTransitions, std::vector<uint64_t> const& player2BackwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::OptimizationDirection const& player1Direction, storm::OptimizationDirection const& player2Direction, storm::abstraction::ExplicitGameStrategyPair* strategyPair, boost::optional<storm::storage::BitVector> const& player1Candidates);
@@ -1815,6 +2082,13 @@ namespace storm {
             
             template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
+            template storm::storage::BitVector performProb0A(storm::storage::ImplicitModelMemoryProduct<storm::RationalNumber> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template storm::storage::BitVector performProb1E(storm::storage::ImplicitModelMemoryProduct<storm::RationalNumber> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template storm::storage::BitVector performProb0E(storm::storage::ImplicitModelMemoryProduct<storm::RationalNumber> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template storm::storage::BitVector performProb1A(storm::storage::ImplicitModelMemoryProduct<storm::RationalNumber> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::ImplicitModelMemoryProduct<storm::RationalNumber> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::ImplicitModelMemoryProduct<storm::RationalNumber> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
             template ExplicitGameProb01Result performProb0(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint64_t> const& player1RowGrouping, storm::storage::SparseMatrix<storm::RationalNumber> const& player1BackwardTransitions, std::vector<uint64_t> const& player2BackwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::OptimizationDirection const& player1Direction, storm::OptimizationDirection const& player2Direction, storm::abstraction::ExplicitGameStrategyPair* strategyPair);
             
             template ExplicitGameProb01Result performProb1(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint64_t> const& player1RowGrouping, storm::storage::SparseMatrix<storm::RationalNumber> const& player1BackwardTransitions, std::vector<uint64_t> const& player2BackwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::OptimizationDirection const& player1Direction, storm::OptimizationDirection const& player2Direction, storm::abstraction::ExplicitGameStrategyPair* strategyPair, boost::optional<storm::storage::BitVector> const& player1Candidates);
@@ -20,6 +20,7 @@ namespace storm {
     namespace storage {
         class BitVector;
         template<typename VT> class SparseMatrix;
+        template<typename ValueType> class ImplicitModelMemoryProduct;
     }
     
     namespace models {
@@ -460,6 +461,34 @@ namespace storm {
              */
             template <typename T, typename RM>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            /*!
+             * Computes the sets of states of a model-memory product that have probability 0 or 1, respectively, of
+             * satisfying phi until psi when maximizing (performProb01Max) or minimizing (performProb01Min) the
+             * probability, as well as the single sets. The product matrix is not materialized. Instead, the
+             * predecessors of a product state are derived from the transitions that lead to its model state.
+             *
+             * @param product The product whose graph structure to search.
+             * @param phiStates The set of all product states satisfying phi.
+             * @param psiStates The set of all product states satisfying psi.
+             */
+            template <typename T>
+            storm::storage::BitVector performProb0A(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template <typename T>
+            storm::storage::BitVector performProb1E(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template <typename T>
+            storm::storage::BitVector performProb0E(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template <typename T>
+            storm::storage::BitVector performProb1A(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template <typename T>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template <typename T>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::ImplicitModelMemoryProduct<T> const& product, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             /*!
              * Computes the set of states for which there exists a scheduler that achieves a probability greater than
@@ -2,6 +2,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/DebugSettings.h"
+#include "storm/utility/Metrics.h"
 
 #include <iostream>
 #include <fstream>
@@ -31,7 +32,8 @@ namespace storm {
         }
 
         void cleanUp() {
-            // Intentionally left empty.
+            // Write the final values of the metrics (if they are exported).
+            storm::utility::metrics::stopExport();
         }
 
         void setLogLevel(l3pp::LogLevel level) {
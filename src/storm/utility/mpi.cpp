@@ -0,0 +1,66 @@
+#include "storm/utility/mpi.h"
+
+#include <cstdlib>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace utility {
+        namespace mpi {
+
+#ifdef STORM_HAVE_MPI
+            static void finalize() {
+                int finalized = 0;
+                MPI_Finalized(&finalized);
+                if (!finalized) {
+                    MPI_Finalize();
+                }
+            }
+#endif
+
+            void initialize(int* argc, char*** argv) {
+#ifdef STORM_HAVE_MPI
+                int initialized = 0;
+                MPI_Initialized(&initialized);
+                if (!initialized) {
+                    STORM_LOG_THROW(MPI_Init(argc, argv) == MPI_SUCCESS, storm::exceptions::UnexpectedException, "Unable to initialize MPI.");
+                    std::atexit(finalize);
+                    STORM_LOG_DEBUG("Initialized MPI on rank " << getRank() << " of " << getNumberOfRanks() << ".");
+                }
+#endif
+            }
+
+            bool isAvailable() {
+#ifdef STORM_HAVE_MPI
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            uint64_t getRank() {
+#ifdef STORM_HAVE_MPI
+                initialize();
+                int rank = 0;
+                MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+                return rank;
+#else
+                return 0;
+#endif
+            }
+
+            uint64_t getNumberOfRanks() {
+#ifdef STORM_HAVE_MPI
+                initialize();
+                int size = 1;
+                MPI_Comm_size(MPI_COMM_WORLD, &size);
+                return size;
+#else
+                return 1;
+#endif
+            }
+
+        }
+    }
+}
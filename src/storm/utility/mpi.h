@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MPI
+#include <mpi.h>
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace mpi {
+
+            /*!
+             * Initializes MPI unless this already happened. If this call initializes MPI, it is finalized at exit.
+             * Without MPI support, this has no effect.
+             *
+             * @param argc A pointer to the number of command line arguments (may be null).
+             * @param argv A pointer to the command line arguments (may be null).
+             */
+            void initialize(int* argc = nullptr, char*** argv = nullptr);
+
+            /*!
+             * Retrieves whether storm was built with MPI support.
+             */
+            bool isAvailable();
+
+            /*!
+             * Retrieves the rank of this process in the world communicator (which is 0 without MPI support).
+             */
+            uint64_t getRank();
+
+            /*!
+             * Retrieves the number of processes in the world communicator (which is 1 without MPI support).
+             */
+            uint64_t getNumberOfRanks();
+
+        }
+    }
+}
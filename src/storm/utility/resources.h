@@ -1,8 +1,12 @@
 #ifndef STORM_UTILITY_RESOURCES_H_
 #define STORM_UTILITY_RESOURCES_H_
 
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <csignal>
+#include <iostream>
+#include <thread>
 #include <sys/time.h>
 #include <sys/times.h>
 #include <sys/resource.h>
@@ -71,10 +75,78 @@ namespace storm {
 #endif
             }
             
-            inline void signalHandler(int signal) {
+            /*!
+             * The number of computations that currently defer the termination of the process (see deferTermination).
+             */
+            inline std::atomic<int>& numberOfTerminationDeferrals() {
+                static std::atomic<int> deferrals(0);
+                return deferrals;
+            }
+            
+            /*!
+             * The signal that asked the process to terminate while the termination was deferred (or zero).
+             */
+            inline volatile std::sig_atomic_t& deferredTerminationSignal() {
+                static volatile std::sig_atomic_t signal = 0;
+                return signal;
+            }
+            
+            /*!
+             * Defers the termination of the process upon a timeout (SIGXCPU), SIGTERM or SIGINT until the calling
+             * computation polled getDeferredTerminationSignal, e.g. to save its progress, and called
+             * terminateAfterSignal. Each call has to be matched by a call to allowTermination.
+             */
+            inline void deferTermination() {
+                ++numberOfTerminationDeferrals();
+            }
+            
+            inline void allowTermination() {
+                --numberOfTerminationDeferrals();
+            }
+            
+            /*!
+             * Retrieves the signal that asked the process to terminate while the termination was deferred, or zero if
+             * there is none.
+             */
+            inline int getDeferredTerminationSignal() {
+                return deferredTerminationSignal();
+            }
+            
+            /*!
+             * Terminates the process as requested by the given signal once no computation (e.g. one running on another
+             * thread) defers the termination anymore. The calling computation must have called allowTermination.
+             */
+            inline void terminateAfterSignal(int signal) {
+                while (numberOfTerminationDeferrals() > 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
                 if (signal == SIGXCPU) {
                     std::cerr << "Timeout." << std::endl;
                     quickest_exit(STORM_EXIT_TIMEOUT);
+                } else {
+                    std::cerr << "Interrupted." << std::endl;
+                    quickest_exit(STORM_EXIT_GENERALERROR);
+                }
+            }
+            
+            inline void signalHandler(int signal) {
+                // Leave the termination to the computations that defer it. Repeated SIGXCPU signals (which are sent
+                // every second after the timeout) are ignored, but a repeated SIGTERM or SIGINT terminates right away.
+                if (numberOfTerminationDeferrals() > 0) {
+                    bool interrupted = deferredTerminationSignal() == SIGTERM || deferredTerminationSignal() == SIGINT;
+                    if (signal == SIGXCPU) {
+                        if (deferredTerminationSignal() == 0) {
+                            deferredTerminationSignal() = signal;
+                        }
+                        return;
+                    } else if ((signal == SIGTERM || signal == SIGINT) && !interrupted) {
+                        deferredTerminationSignal() = signal;
+                        return;
+                    }
+                }
+                
+                if (signal == SIGXCPU || signal == SIGTERM || signal == SIGINT) {
+                    terminateAfterSignal(signal);
                 } else if (signal == ENOMEM) {
                     std::cerr << "Out of memory" << std::endl;
                     quickest_exit(STORM_EXIT_MEMOUT);
@@ -86,6 +158,8 @@ namespace storm {
             
             inline void installSignalHandler() {
                 std::signal(SIGXCPU, signalHandler);
+                std::signal(SIGTERM, signalHandler);
+                std::signal(SIGINT, signalHandler);
                 std::signal(ENOMEM, signalHandler);
             }
             
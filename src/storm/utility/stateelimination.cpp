@@ -1,5 +1,7 @@
 #include "storm/utility/stateelimination.h"
 
+#include <limits>
+#include <numeric>
 #include <random>
 
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
@@ -45,7 +47,8 @@ namespace storm {
             }
             
             bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
-                return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty;
+                return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
+                order == storm::settings::modules::EliminationSettings::EliminationOrder::NestedDissection;
             }
             
             template<typename ValueType>
@@ -95,6 +98,188 @@ namespace storm {
                 return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
             }
             
+            static const uint_fast64_t INFINITY_LEVEL = std::numeric_limits<uint_fast64_t>::max();
+            
+            /*!
+             * Performs a breadth-first search from the given root that only visits vertices of the given part. All
+             * vertices of the part need to have the level INFINITY_LEVEL before the search. The visited vertices are
+             * appended to the given vector in the order of the search.
+             *
+             * @return The number of levels of the level structure rooted in the given vertex.
+             */
+            static uint_fast64_t computeLevelStructure(std::vector<uint_fast64_t> const& adjacencyOffsets, std::vector<uint_fast64_t> const& adjacency, std::vector<uint_fast64_t> const& partOf, uint_fast64_t part, uint_fast64_t root, std::vector<uint_fast64_t>& levels, std::vector<uint_fast64_t>& visited) {
+                uint_fast64_t firstVisited = visited.size();
+                levels[root] = 0;
+                visited.push_back(root);
+                for (uint_fast64_t index = firstVisited; index < visited.size(); ++index) {
+                    uint_fast64_t vertex = visited[index];
+                    for (uint_fast64_t entry = adjacencyOffsets[vertex]; entry < adjacencyOffsets[vertex + 1]; ++entry) {
+                        uint_fast64_t neighbor = adjacency[entry];
+                        if (partOf[neighbor] == part && levels[neighbor] == INFINITY_LEVEL) {
+                            levels[neighbor] = levels[vertex] + 1;
+                            visited.push_back(neighbor);
+                        }
+                    }
+                }
+                return levels[visited.back()] + 1;
+            }
+            
+            /*!
+             * Recursively computes a nested dissection order of the given vertices: the graph is split by a vertex
+             * separator taken from the middle of a level structure rooted in a pseudo-peripheral vertex, both halves are
+             * ordered recursively and the separator is placed after them. Small parts are ordered by ascending degree.
+             */
+            static void dissect(std::vector<uint_fast64_t> const& adjacencyOffsets, std::vector<uint_fast64_t> const& adjacency, std::vector<uint_fast64_t>& partOf, uint_fast64_t& nextPart, std::vector<uint_fast64_t>& levels, std::vector<uint_fast64_t> const& vertices, uint_fast64_t leafSize, std::vector<uint_fast64_t>& order) {
+                if (vertices.empty()) {
+                    return;
+                }
+                
+                uint_fast64_t part = nextPart++;
+                for (auto const& vertex : vertices) {
+                    partOf[vertex] = part;
+                    levels[vertex] = INFINITY_LEVEL;
+                }
+                
+                if (vertices.size() > leafSize) {
+                    // First split the part into its connected components, because they can be ordered independently.
+                    std::vector<uint_fast64_t> visited;
+                    visited.reserve(vertices.size());
+                    computeLevelStructure(adjacencyOffsets, adjacency, partOf, part, vertices.front(), levels, visited);
+                    if (visited.size() < vertices.size()) {
+                        std::vector<std::vector<uint_fast64_t>> components;
+                        components.push_back(std::move(visited));
+                        for (auto const& vertex : vertices) {
+                            if (levels[vertex] == INFINITY_LEVEL) {
+                                components.emplace_back();
+                                computeLevelStructure(adjacencyOffsets, adjacency, partOf, part, vertex, levels, components.back());
+                            }
+                        }
+                        for (auto const& component : components) {
+                            dissect(adjacencyOffsets, adjacency, partOf, nextPart, levels, component, leafSize, order);
+                        }
+                        return;
+                    }
+                    
+                    // The part is connected, so we search from the last vertex found by the previous search, which is a
+                    // pseudo-peripheral vertex and typically gives a deep (and thus narrow) level structure.
+                    uint_fast64_t root = visited.back();
+                    for (auto const& vertex : vertices) {
+                        levels[vertex] = INFINITY_LEVEL;
+                    }
+                    visited.clear();
+                    uint_fast64_t numberOfLevels = computeLevelStructure(adjacencyOffsets, adjacency, partOf, part, root, levels, visited);
+                    
+                    if (numberOfLevels >= 3) {
+                        // Select the level at which half of the vertices have been seen as the separating level.
+                        uint_fast64_t separatingLevel = 1;
+                        for (uint_fast64_t index = 0; index < visited.size(); ++index) {
+                            if (2 * (index + 1) >= visited.size()) {
+                                separatingLevel = std::max<uint_fast64_t>(1, std::min(levels[visited[index]], numberOfLevels - 2));
+                                break;
+                            }
+                        }
+                        
+                        // Vertices of the separating level without a neighbor in the next level do not need to be in the
+                        // separator and are moved to the first half instead.
+                        std::vector<uint_fast64_t> firstHalf;
+                        std::vector<uint_fast64_t> secondHalf;
+                        std::vector<uint_fast64_t> separator;
+                        for (auto const& vertex : visited) {
+                            if (levels[vertex] < separatingLevel) {
+                                firstHalf.push_back(vertex);
+                            } else if (levels[vertex] > separatingLevel) {
+                                secondHalf.push_back(vertex);
+                            } else {
+                                bool isSeparating = false;
+                                for (uint_fast64_t entry = adjacencyOffsets[vertex]; entry < adjacencyOffsets[vertex + 1]; ++entry) {
+                                    uint_fast64_t neighbor = adjacency[entry];
+                                    if (partOf[neighbor] == part && levels[neighbor] > separatingLevel) {
+                                        isSeparating = true;
+                                        break;
+                                    }
+                                }
+                                if (isSeparating) {
+                                    separator.push_back(vertex);
+                                } else {
+                                    firstHalf.push_back(vertex);
+                                }
+                            }
+                        }
+                        
+                        dissect(adjacencyOffsets, adjacency, partOf, nextPart, levels, firstHalf, leafSize, order);
+                        dissect(adjacencyOffsets, adjacency, partOf, nextPart, levels, secondHalf, leafSize, order);
+                        order.insert(order.end(), separator.begin(), separator.end());
+                        return;
+                    }
+                }
+                
+                // If we get here, the part is small (or cannot be split), so we order it by ascending degree within the part.
+                std::vector<std::pair<uint_fast64_t, uint_fast64_t>> vertexDegrees;
+                vertexDegrees.reserve(vertices.size());
+                for (auto const& vertex : vertices) {
+                    uint_fast64_t degree = 0;
+                    for (uint_fast64_t entry = adjacencyOffsets[vertex]; entry < adjacencyOffsets[vertex + 1]; ++entry) {
+                        if (partOf[adjacency[entry]] == part) {
+                            ++degree;
+                        }
+                    }
+                    vertexDegrees.emplace_back(vertex, degree);
+                }
+                std::stable_sort(vertexDegrees.begin(), vertexDegrees.end(), [] (std::pair<uint_fast64_t, uint_fast64_t> const& first, std::pair<uint_fast64_t, uint_fast64_t> const& second) { return first.second < second.second; } );
+                for (auto const& vertexDegree : vertexDegrees) {
+                    order.push_back(vertexDegree.first);
+                }
+            }
+            
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& states, uint_fast64_t leafSize) {
+                // Map the states to consecutive (local) indices.
+                std::vector<storm::storage::sparse::state_type> localToState(states.begin(), states.end());
+                std::vector<uint_fast64_t> stateToLocal(transitionMatrix.getRowCount(), INFINITY_LEVEL);
+                for (uint_fast64_t index = 0; index < localToState.size(); ++index) {
+                    stateToLocal[localToState[index]] = index;
+                }
+                
+                // Build the underlying undirected graph (without self-loops) of the sub-matrix induced by the states.
+                std::vector<std::vector<uint_fast64_t>> neighbors(localToState.size());
+                for (uint_fast64_t index = 0; index < localToState.size(); ++index) {
+                    for (auto const& entry : transitionMatrix.getRow(localToState[index])) {
+                        if (entry.getColumn() < stateToLocal.size() && stateToLocal[entry.getColumn()] != INFINITY_LEVEL && entry.getColumn() != localToState[index] && !storm::utility::isZero(entry.getValue())) {
+                            uint_fast64_t target = stateToLocal[entry.getColumn()];
+                            neighbors[index].push_back(target);
+                            neighbors[target].push_back(index);
+                        }
+                    }
+                }
+                
+                std::vector<uint_fast64_t> adjacencyOffsets;
+                adjacencyOffsets.reserve(localToState.size() + 1);
+                adjacencyOffsets.push_back(0);
+                std::vector<uint_fast64_t> adjacency;
+                for (auto& vertexNeighbors : neighbors) {
+                    std::sort(vertexNeighbors.begin(), vertexNeighbors.end());
+                    auto end = std::unique(vertexNeighbors.begin(), vertexNeighbors.end());
+                    adjacency.insert(adjacency.end(), vertexNeighbors.begin(), end);
+                    adjacencyOffsets.push_back(adjacency.size());
+                    std::vector<uint_fast64_t>().swap(vertexNeighbors);
+                }
+                
+                std::vector<uint_fast64_t> vertices(localToState.size());
+                std::iota(vertices.begin(), vertices.end(), 0);
+                std::vector<uint_fast64_t> partOf(localToState.size(), 0);
+                std::vector<uint_fast64_t> levels(localToState.size(), INFINITY_LEVEL);
+                uint_fast64_t nextPart = 1;
+                std::vector<uint_fast64_t> order;
+                order.reserve(localToState.size());
+                dissect(adjacencyOffsets, adjacency, partOf, nextPart, levels, vertices, std::max<uint_fast64_t>(leafSize, 1), order);
+                STORM_LOG_ASSERT(order.size() == localToState.size(), "Nested dissection order is incomplete.");
+                
+                for (auto& vertex : order) {
+                    vertex = localToState[vertex];
+                }
+                return order;
+            }
+            
             template<typename ValueType>
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states) {
                 
@@ -134,6 +319,8 @@ namespace storm {
                             // For the dynamic penalty version, we need to give the full state-penalty pairs.
                             return std::make_unique<DynamicStatePriorityQueue<ValueType>>(statePenalties, transitionMatrix, backwardTransitions, oneStepProbabilities, penaltyFunction);
                         }
+                    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::NestedDissection) {
+                        return std::make_unique<StaticStatePriorityQueue>(getNestedDissectionOrder(transitionMatrix, states));
                     }
                 }
                 STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Illegal elimination order selected.");
@@ -196,6 +383,7 @@ namespace storm {
             }
             
             template uint_fast64_t estimateComplexity(double const& value);
+            template std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& states, uint_fast64_t leafSize);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
@@ -204,12 +392,14 @@ namespace storm {
             
 #ifdef STORM_HAVE_CARL
             template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
+            template std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& states, uint_fast64_t leafSize);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
             template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward, bool reverse);
             template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward);
 
+            template std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& states, uint_fast64_t leafSize);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
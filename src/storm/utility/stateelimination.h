@@ -53,6 +53,20 @@ namespace storm {
             template<typename ValueType>
             uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities);
             
+            /*!
+             * Computes a nested dissection elimination order of the given states. For this, the underlying undirected
+             * graph of the transition matrix (restricted to the states) is recursively split by vertex separators,
+             * which are eliminated after the parts they separate. This keeps the fill-in low on grid-like or modular
+             * models.
+             *
+             * @param transitionMatrix The transition matrix whose underlying graph is considered.
+             * @param states The states to order.
+             * @param leafSize Parts with at most this many states are not split any further.
+             * @return The states in the order in which they are to be eliminated.
+             */
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& states, uint_fast64_t leafSize = 16);
+            
             template<typename ValueType>
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states);
             
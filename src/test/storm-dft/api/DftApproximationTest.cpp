@@ -48,17 +48,17 @@ namespace {
         DftApproximationTest() : config(TestType::createConfig()) {
         }
 
-        DftApproximationTest const& getConfig() const {
+        DftAnalysisConfig const& getConfig() const {
             return config;
         }
 
-        std::pair<double, double> analyzeMTTF(std::string const& file, double errorBound) {
+        std::pair<double, double> analyzeMTTF(std::string const& file, double errorBound, bool useSmtBounds = false) {
             std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
             EXPECT_TRUE(storm::api::isWellFormed(*dft));
             std::string property = "T=? [F \"failed\"]";
             std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
             typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, false, {}, true, errorBound,
-                                                                                                                        config.heuristic, false);
+                                                                                                                        config.heuristic, false, useSmtBounds);
             return boost::get<storm::modelchecker::DFTModelChecker<double>::approximation_result>(results[0]);
         }
 
@@ -95,6 +95,41 @@ namespace {
         EXPECT_GE(approxResult.second - approxResult.first, errorBound * approxResult.first / 10);
     }
 
+#ifdef STORM_HAVE_Z3
+    TYPED_TEST(DftApproximationTest, HecsMTTFSmtBounds) {
+        double errorBound = 2;
+        std::pair<double, double> approxResult = this->analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/hecs_3_2_2_np.dft", errorBound, true);
+        EXPECT_LE(approxResult.first, 417.9436693);
+        EXPECT_GE(approxResult.second, 417.9436693);
+        EXPECT_LE(2 * (approxResult.second - approxResult.first) / (approxResult.first + approxResult.second), errorBound);
+    }
+
+    TYPED_TEST(DftApproximationTest, VotingMTTFSmtBounds) {
+        // Five BE failures are necessary, so the SMT bound tightens the lower bound of all skipped states
+        double errorBound = 2;
+        std::pair<double, double> approxResult = this->analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/voting5.dft", errorBound);
+        std::pair<double, double> approxResultSmt = this->analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/voting5.dft", errorBound, true);
+        EXPECT_LE(approxResult.first, 1.45);
+        EXPECT_GE(approxResult.second, 1.45);
+        EXPECT_LE(approxResultSmt.first, 1.45);
+        EXPECT_GE(approxResultSmt.second, 1.45);
+        EXPECT_NE(approxResult.first, approxResultSmt.first);
+        if (this->getConfig().heuristic != storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+            // The explored state space does not depend on the bounds
+            EXPECT_GT(approxResultSmt.first, approxResult.first);
+            EXPECT_EQ(approxResult.second, approxResultSmt.second);
+        }
+    }
+
+    TYPED_TEST(DftApproximationTest, VotingConstMTTFSmtBounds) {
+        // Constant BEs are not supported by the SMT encoding, the approximation continues without the bound
+        double errorBound = 2;
+        std::pair<double, double> approxResult = this->analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/voting6.dft", errorBound, true);
+        EXPECT_LE(approxResult.first, 1.5);
+        EXPECT_GE(approxResult.second, 1.5);
+    }
+#endif
+
     TYPED_TEST(DftApproximationTest, HecsTimebound) {
         //double errorBound = 0.01;
         double errorBound = 0.1;
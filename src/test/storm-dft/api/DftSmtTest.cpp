@@ -44,6 +44,12 @@ namespace {
         smtChecker.toSolver();
         EXPECT_EQ(smtChecker.getLeastFailureBound(30), uint64_t(2));
         EXPECT_EQ(smtChecker.getAlwaysFailedBound(30), uint64_t(4));
+        EXPECT_EQ(smtChecker.checkTleFailsWithLeq(1), storm::solver::SmtSolver::CheckResult::Unsat);
+        EXPECT_EQ(smtChecker.checkTleFailsWithGeq(4), storm::solver::SmtSolver::CheckResult::Sat);
+        EXPECT_EQ(smtChecker.checkTleFailsWithGeq(5), storm::solver::SmtSolver::CheckResult::Unsat);
+        // Repeated queries reuse the bound constraints
+        EXPECT_EQ(smtChecker.checkTleFailsWithLeq(2), storm::solver::SmtSolver::CheckResult::Sat);
+        EXPECT_EQ(smtChecker.checkTleFailsWithLeq(1), storm::solver::SmtSolver::CheckResult::Unsat);
     }
 
     TEST(DftSmtTest, FDEPBoundTest) {
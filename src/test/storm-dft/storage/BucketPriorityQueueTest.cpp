@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <limits>
+#include <vector>
+
+#include "storm-dft/storage/BucketPriorityQueue.h"
+#include "storm/exceptions/OutOfRangeException.h"
+
+namespace {
+
+    typedef storm::storage::BucketPriorityQueue::IdType IdType;
+
+    std::vector<IdType> popAll(storm::storage::BucketPriorityQueue& queue) {
+        std::vector<IdType> result;
+        while (!queue.empty()) {
+            IdType top = queue.top();
+            EXPECT_EQ(top, queue.pop());
+            result.push_back(top);
+        }
+        return result;
+    }
+
+    TEST(BucketPriorityQueueTest, PushAndPop) {
+        storm::storage::BucketPriorityQueue queue(200, 0, 0.9, true);
+        EXPECT_TRUE(queue.empty());
+
+        queue.push(0, 0.5);
+        queue.push(1, 2.0);
+        queue.push(2, 0.1);
+        queue.push(3, 1.0);
+        queue.push(4, 3.0);
+        EXPECT_FALSE(queue.empty());
+        EXPECT_EQ(5ul, queue.size());
+        EXPECT_EQ(4ul, queue.top());
+
+        EXPECT_EQ(4ul, queue.pop());
+        EXPECT_EQ(1ul, queue.pop());
+        EXPECT_EQ(3ul, queue.top());
+        EXPECT_EQ(3ul, queue.size());
+
+        // Ids may be pushed again after they were popped.
+        queue.push(4, 0.2);
+        EXPECT_EQ(std::vector<IdType>({3, 0, 4, 2}), popAll(queue));
+        EXPECT_TRUE(queue.empty());
+        EXPECT_EQ(0ul, queue.size());
+    }
+
+    TEST(BucketPriorityQueueTest, ExpandFirst) {
+        storm::storage::BucketPriorityQueue queue(200, 0, 0.9, true);
+        queue.push(0, 3.0);
+        queue.push(1, 0.1, true);
+        queue.push(2, 2.0);
+        queue.push(3, 0.2, true);
+        EXPECT_EQ(4ul, queue.size());
+        // Elements marked for expansion come first, the most recent one first.
+        EXPECT_EQ(std::vector<IdType>({3, 1, 0, 2}), popAll(queue));
+    }
+
+    TEST(BucketPriorityQueueTest, Direction) {
+        // 0.95 and 1.0 fall into the same bucket, so their order is determined by the heap of that bucket.
+        std::vector<double> priorities = {1.0, 0.1, 3.0, 0.95, 2.0, 0.5};
+
+        storm::storage::BucketPriorityQueue higherQueue(200, 0, 0.9, true);
+        storm::storage::BucketPriorityQueue lowerQueue(200, 0, 0.9, false);
+        for (IdType id = 0; id < priorities.size(); ++id) {
+            higherQueue.push(id, priorities[id]);
+            lowerQueue.push(id, priorities[id]);
+        }
+        EXPECT_EQ(std::vector<IdType>({2, 4, 0, 3, 5, 1}), popAll(higherQueue));
+        EXPECT_EQ(std::vector<IdType>({1, 5, 3, 0, 4, 2}), popAll(lowerQueue));
+    }
+
+    TEST(BucketPriorityQueueTest, Update) {
+        storm::storage::BucketPriorityQueue queue(200, 0, 0.9, true);
+        queue.push(0, 1.0);
+        queue.push(1, 0.95);
+        queue.push(2, 0.5);
+        queue.push(3, 0.1);
+        queue.push(4, 2.0);
+        EXPECT_EQ(4ul, queue.top());
+
+        // Move an element from a later bucket before the current one.
+        queue.update(3, 3.0);
+        EXPECT_EQ(3ul, queue.top());
+        // Move the top element to a later bucket.
+        queue.update(3, 0.2);
+        EXPECT_EQ(4ul, queue.top());
+        // Move the top element to a later bucket which then becomes the current one.
+        queue.update(4, 0.3);
+        EXPECT_EQ(0ul, queue.top());
+        // Update within the current bucket.
+        queue.update(1, 0.99);
+        queue.update(0, 0.96);
+        EXPECT_EQ(1ul, queue.top());
+        // Update within a later bucket.
+        queue.update(2, 0.6);
+        EXPECT_EQ(5ul, queue.size());
+
+        EXPECT_EQ(std::vector<IdType>({1, 0, 2, 4, 3}), popAll(queue));
+
+        // The same with the preference for lower priorities.
+        storm::storage::BucketPriorityQueue lowerQueue(200, 0, 0.9, false);
+        lowerQueue.push(0, 1.0);
+        lowerQueue.push(1, 0.5);
+        lowerQueue.push(2, 2.0);
+        EXPECT_EQ(1ul, lowerQueue.top());
+        lowerQueue.update(2, 0.1);
+        EXPECT_EQ(2ul, lowerQueue.top());
+        lowerQueue.update(2, 3.0);
+        lowerQueue.update(0, 0.3);
+        EXPECT_EQ(std::vector<IdType>({0, 1, 2}), popAll(lowerQueue));
+    }
+
+    TEST(BucketPriorityQueueTest, IdOutOfRange) {
+        storm::storage::BucketPriorityQueue queue(200, 0, 0.9, true);
+        uint64_t maxId = std::numeric_limits<IdType>::max();
+        EXPECT_THROW(queue.push(maxId + 1, 1.0), storm::exceptions::OutOfRangeException);
+        EXPECT_THROW(queue.push(maxId + 1, 1.0, true), storm::exceptions::OutOfRangeException);
+        EXPECT_TRUE(queue.empty());
+    }
+}
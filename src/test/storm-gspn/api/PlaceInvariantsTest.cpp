@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm-gspn/builder/JaniGSPNBuilder.h"
+#include "storm-gspn/storage/gspn/GspnBuilder.h"
+#include "storm-gspn/storage/gspn/PlaceInvariants.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+    /*!
+     * A cycle of three places p0 -> p1 -> p2 -> p0 in which two tokens circulate.
+     */
+    std::shared_ptr<storm::gspn::GSPN> buildCycle(boost::optional<uint64_t> capacityOfP1 = boost::none) {
+        storm::gspn::GspnBuilder builder;
+        builder.setGspnName("cycle");
+        uint64_t p0 = builder.addPlace(boost::none, 2, "p0");
+        uint64_t p1 = builder.addPlace(capacityOfP1, 0, "p1");
+        uint64_t p2 = builder.addPlace(boost::none, 0, "p2");
+        uint64_t t0 = builder.addTimedTransition(0, 1.0, "t0");
+        uint64_t t1 = builder.addTimedTransition(0, 2.0, "t1");
+        uint64_t t2 = builder.addTimedTransition(0, 3.0, "t2");
+        builder.addInputArc(p0, t0);
+        builder.addOutputArc(t0, p1);
+        builder.addInputArc(p1, t1);
+        builder.addOutputArc(t1, p2);
+        builder.addInputArc(p2, t2);
+        builder.addOutputArc(t2, p0);
+        return std::shared_ptr<storm::gspn::GSPN>(builder.buildGspn());
+    }
+
+    std::vector<double> checkCycle(storm::gspn::GSPN const& gspn, bool eliminatePlaces) {
+        storm::builder::JaniGSPNBuilder builder(gspn, eliminatePlaces);
+        std::shared_ptr<storm::jani::Model> model(builder.build());
+        storm::parser::FormulaParser formulaParser(gspn.getExpressionManager());
+        auto properties = storm::api::parseProperties(formulaParser, "P=? [F<=1 p2=2]; P=? [F<=0.5 p0=0]; P=? [F<=1 p1=1 & p2=1]");
+        for (auto& property : properties) {
+            property = property.substitute(builder.getEliminatedPlacesSubstitution());
+        }
+        auto formulas = storm::api::extractFormulasFromProperties(properties);
+        auto ctmc = storm::api::buildSparseModel<double>(*model, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        EXPECT_EQ(6ul, ctmc->getNumberOfStates());
+
+        std::vector<double> result;
+        for (auto const& formula : formulas) {
+            auto checkResult = storm::api::verifyWithSparseEngine<double>(ctmc, storm::api::createTask<double>(formula, true));
+            result.push_back(checkResult->asExplicitQuantitativeCheckResult<double>()[*ctmc->getInitialStates().begin()]);
+        }
+        return result;
+    }
+
+    TEST(PlaceInvariantsTest, Cycle) {
+        auto gspn = buildCycle();
+        storm::gspn::PlaceInvariants invariants(*gspn);
+
+        ASSERT_EQ(1ul, invariants.getInvariants().size());
+        EXPECT_EQ(std::vector<int64_t>({1, 1, 1}), invariants.getInvariants().front());
+        ASSERT_EQ(1ul, invariants.getSemiPositiveInvariants().size());
+        EXPECT_EQ(std::vector<int64_t>({1, 1, 1}), invariants.getSemiPositiveInvariants().front());
+
+        for (uint64_t place = 0; place < 3; ++place) {
+            ASSERT_TRUE(static_cast<bool>(invariants.getUpperBound(place)));
+            EXPECT_EQ(2ul, invariants.getUpperBound(place).get());
+        }
+
+        // p0 is the first place of the invariant and thus expressed as 2 - p1 - p2.
+        EXPECT_EQ(1ul, invariants.getNumberOfEliminatedPlaces());
+        ASSERT_TRUE(invariants.isEliminated(0));
+        EXPECT_FALSE(invariants.isEliminated(1));
+        EXPECT_FALSE(invariants.isEliminated(2));
+        auto const& representation = invariants.getEliminatedPlaceRepresentation(0);
+        EXPECT_EQ(2, representation.first);
+        EXPECT_EQ((std::map<uint64_t, int64_t>({{1, -1}, {2, -1}})), representation.second);
+        EXPECT_THROW(invariants.getEliminatedPlaceRepresentation(1), storm::exceptions::InvalidArgumentException);
+
+        std::map<uint_fast64_t, uint_fast64_t> numberOfBits = {{0, 2}, {1, 2}, {2, 2}};
+        storm::gspn::Marking marking(3, numberOfBits, 6);
+        marking.setNumberOfTokensAt(1, 1);
+        marking.setNumberOfTokensAt(2, 1);
+        EXPECT_TRUE(invariants.satisfiesInvariants(marking));
+        marking.setNumberOfTokensAt(0, 1);
+        EXPECT_FALSE(invariants.satisfiesInvariants(marking));
+    }
+
+    TEST(PlaceInvariantsTest, BoundsWithCapacityAndUnboundedPlace) {
+        // A capacity below the invariant bound restricts the net, so the place is bounded by it and not eliminated.
+        auto gspn = buildCycle(1);
+        storm::gspn::PlaceInvariants invariants(*gspn);
+        EXPECT_EQ(2ul, invariants.getUpperBound(0).get());
+        EXPECT_EQ(1ul, invariants.getUpperBound(1).get());
+        EXPECT_EQ(2ul, invariants.getUpperBound(2).get());
+        EXPECT_TRUE(invariants.isEliminated(0));
+        EXPECT_FALSE(invariants.isEliminated(1));
+
+        // A transition that produces tokens without consuming any makes its output place unbounded.
+        storm::gspn::GspnBuilder builder;
+        builder.setGspnName("producer");
+        uint64_t source = builder.addPlace(boost::none, 1, "source");
+        uint64_t sink = builder.addPlace(boost::none, 0, "sink");
+        uint64_t produce = builder.addTimedTransition(0, 1.0, "produce");
+        builder.addInputArc(source, produce);
+        builder.addOutputArc(produce, source);
+        builder.addOutputArc(produce, sink);
+        std::unique_ptr<storm::gspn::GSPN> producer(builder.buildGspn());
+        storm::gspn::PlaceInvariants producerInvariants(*producer);
+        ASSERT_EQ(1ul, producerInvariants.getInvariants().size());
+        EXPECT_EQ(std::vector<int64_t>({1, 0}), producerInvariants.getInvariants().front());
+        EXPECT_EQ(1ul, producerInvariants.getUpperBound(source).get());
+        EXPECT_FALSE(static_cast<bool>(producerInvariants.getUpperBound(sink)));
+    }
+
+    TEST(PlaceInvariantsTest, EliminatedPlacesCheckToSameResult) {
+        auto gspn = buildCycle();
+        std::vector<double> expected = checkCycle(*gspn, false);
+        std::vector<double> withEliminatedPlaces = checkCycle(*gspn, true);
+        ASSERT_EQ(expected.size(), withEliminatedPlaces.size());
+        for (uint64_t index = 0; index < expected.size(); ++index) {
+            EXPECT_GT(expected[index], 0.0);
+            EXPECT_NEAR(expected[index], withEliminatedPlaces[index], 1e-10);
+        }
+
+        storm::builder::JaniGSPNBuilder builder(*gspn, true);
+        std::unique_ptr<storm::jani::Model> model(builder.build());
+        EXPECT_THROW(builder.getPlaceVariable(0), storm::exceptions::InvalidArgumentException);
+        EXPECT_NO_THROW(builder.getPlaceVariable(1));
+        EXPECT_EQ(1ul, builder.getPlaceInvariants().getNumberOfEliminatedPlaces());
+    }
+}
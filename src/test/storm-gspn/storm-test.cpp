@@ -0,0 +1,8 @@
+#include "gtest/gtest.h"
+#include "storm/settings/SettingsManager.h"
+
+int main(int argc, char **argv) {
+  storm::settings::initializeAll("Storm-gspn (Functional) Testing Suite", "test-gspn");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
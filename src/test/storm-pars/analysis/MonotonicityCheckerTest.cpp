@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/analysis/MonotonicityChecker.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/utility/vector.h"
+
+TEST(MonotonicityCheckerTest, SimpleDtmc) {
+    carl::VariablePool::getInstance().clear();
+    std::string programString =
+        "dtmc\n"
+        "const double p;\n"
+        "const double q;\n"
+        "const double r;\n"
+        "module m\n"
+        "  s : [0..4] init 0;\n"
+        "  [] s=0 -> p : (s'=1) + (1-p) : (s'=2);\n"
+        "  [] s=1 -> q : (s'=3) + (1-q) : (s'=0);\n"
+        "  [] s=2 -> r : (s'=4) + (1-r) : (s'=3);\n"
+        "  [] s>=3 -> 1 : (s'=s);\n"
+        "endmodule\n"
+        "label \"one\" = s=1;\n"
+        "label \"two\" = s=2;\n"
+        "label \"goal\" = s=3;\n"
+        "label \"sink\" = s=4;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "simple.pm");
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, std::vector<std::shared_ptr<storm::logic::Formula const>>())->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    ASSERT_EQ(5ul, model->getNumberOfStates());
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    std::map<std::string, storm::RationalFunctionVariable> parameterByName;
+    for (auto const& parameter : modelParameters) {
+        std::stringstream parameterName;
+        parameterName << parameter;
+        parameterByName.emplace(parameterName.str(), parameter);
+    }
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=p<=0.9,0.5<=q<=0.6,0.8<=r<=0.9", modelParameters);
+
+    storm::storage::BitVector goal = model->getStates("goal");
+    storm::storage::BitVector sink = model->getStates("sink");
+    storm::storage::BitVector maybeStates = ~(goal | sink);
+    storm::analysis::MonotonicityChecker<storm::RationalFunction, double> checker(model->getTransitionMatrix(), maybeStates);
+
+    // Only the trivial bounds for the reachability probabilities are known.
+    std::vector<double> lowerBounds(5, 0.0), upperBounds(5, 1.0);
+    storm::utility::vector::setVectorValues(lowerBounds, goal, 1.0);
+    storm::utility::vector::setVectorValues(upperBounds, sink, 0.0);
+    storm::storage::BitVector allStates(5, true);
+    auto monotonicity = checker.checkMonotonicity(region, lowerBounds, upperBounds, allStates);
+    EXPECT_EQ(storm::analysis::Monotonicity::Unknown, monotonicity[parameterByName.at("p")]);
+    EXPECT_EQ(storm::analysis::Monotonicity::Increasing, monotonicity[parameterByName.at("q")]);
+    EXPECT_EQ(storm::analysis::Monotonicity::Decreasing, monotonicity[parameterByName.at("r")]);
+
+    // Within the region, state 'one' is better than state 'two'.
+    storm::utility::vector::setVectorValues(lowerBounds, model->getStates("one"), 0.5);
+    storm::utility::vector::setVectorValues(upperBounds, model->getStates("two"), 0.2);
+    monotonicity = checker.checkMonotonicity(region, lowerBounds, upperBounds, allStates);
+    EXPECT_EQ(storm::analysis::Monotonicity::Increasing, monotonicity[parameterByName.at("p")]);
+    EXPECT_EQ(storm::analysis::Monotonicity::Increasing, monotonicity[parameterByName.at("q")]);
+    EXPECT_EQ(storm::analysis::Monotonicity::Decreasing, monotonicity[parameterByName.at("r")]);
+
+    // Without upper bounds, nothing can be concluded for p.
+    monotonicity = checker.checkMonotonicity(region, lowerBounds, upperBounds, goal | sink);
+    EXPECT_EQ(storm::analysis::Monotonicity::Unknown, monotonicity[parameterByName.at("p")]);
+    EXPECT_EQ(storm::analysis::Monotonicity::Unknown, monotonicity[parameterByName.at("q")]);
+    EXPECT_EQ(storm::analysis::Monotonicity::Decreasing, monotonicity[parameterByName.at("r")]);
+    carl::VariablePool::getInstance().clear();
+}
+
+#endif
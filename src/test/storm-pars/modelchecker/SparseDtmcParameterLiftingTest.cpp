@@ -441,5 +441,77 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllSat, regionChecker->analyzeRegion(this->env(), allSatRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
     
     }
+
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_Monotonicity) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+    
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true), false, true, true);
+        auto plainRegionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        
+        //start testing
+        auto allSatRegion=storm::api::parseRegion<storm::RationalFunction>("0.7<=pL<=0.9,0.75<=pK<=0.95", modelParameters);
+        auto exBothRegion=storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.65,0.75<=pK<=0.95", modelParameters);
+        auto allVioRegion=storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.73,0.2<=pK<=0.715", modelParameters);
+    
+        EXPECT_EQ(storm::modelchecker::RegionResult::AllSat, regionChecker->analyzeRegion(this->env(), allSatRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+        EXPECT_EQ(storm::modelchecker::RegionResult::ExistsBoth, regionChecker->analyzeRegion(this->env(), exBothRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
+        EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
+        
+        // The bounds obtained when exploiting monotonicity are at least as tight as the plain ones.
+        double lowerBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), exBothRegion, storm::solver::OptimizationDirection::Minimize));
+        double upperBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), exBothRegion, storm::solver::OptimizationDirection::Maximize));
+        EXPECT_LE(lowerBound, upperBound);
+        EXPECT_GE(lowerBound, storm::utility::convertNumber<double>(plainRegionChecker->getBoundAtInitState(this->env(), exBothRegion, storm::solver::OptimizationDirection::Minimize)) - 1e-6);
+        EXPECT_LE(upperBound, storm::utility::convertNumber<double>(plainRegionChecker->getBoundAtInitState(this->env(), exBothRegion, storm::solver::OptimizationDirection::Maximize)) + 1e-6);
+    }
+
+    TYPED_TEST(SparseDtmcParameterLiftingTest, TwoAttempts_Prob_Monotonicity) {
+        typedef typename TestFixture::ValueType ValueType;
+        typedef storm::modelchecker::SparseDtmcParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, ValueType> CheckerType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/two_attempts.pm";
+        std::string formulaAsString = "P<=0.9 [F \"success\" ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true), false, true, true);
+        auto plainRegionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        auto& checker = dynamic_cast<CheckerType&>(*regionChecker);
+        auto& plainChecker = dynamic_cast<CheckerType&>(*plainRegionChecker);
+
+        // The probability p + (1-p)*q to succeed increases in both parameters. Each parameter only occurs in one
+        // state whose successors are ordered by the trivial bounds, so both parameters are fixed and nothing is lifted.
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.2<=p<=0.5,0.3<=q<=0.6", modelParameters);
+        double lowerBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), region, storm::solver::OptimizationDirection::Minimize));
+        EXPECT_EQ(modelParameters, checker.getLastFixedParameters());
+        uint_fast64_t choicesWithMonotonicity = checker.getLastNumberOfLiftedChoices();
+        double upperBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), region, storm::solver::OptimizationDirection::Maximize));
+        EXPECT_EQ(modelParameters, checker.getLastFixedParameters());
+        EXPECT_NEAR(0.44, lowerBound, 1e-6);
+        EXPECT_NEAR(0.8, upperBound, 1e-6);
+
+        double plainLowerBound = storm::utility::convertNumber<double>(plainRegionChecker->getBoundAtInitState(this->env(), region, storm::solver::OptimizationDirection::Minimize));
+        EXPECT_TRUE(plainChecker.getLastFixedParameters().empty());
+        EXPECT_NEAR(plainLowerBound, lowerBound, 1e-6);
+        // Without monotonicity, both choices for the value of the parameter are kept in each state.
+        EXPECT_LT(choicesWithMonotonicity, plainChecker.getLastNumberOfLiftedChoices());
+    }
 }
 #endif
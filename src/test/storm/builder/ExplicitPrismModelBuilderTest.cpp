@@ -5,6 +5,11 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#ifdef STORM_HAVE_MPI
+#include <boost/filesystem.hpp>
+#include "storm/storage/OnDiskSparseMatrix.h"
+#endif
+
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -125,3 +130,69 @@ TEST(ExplicitPrismModelBuilderTest, FailComposition) {
 
     ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+#ifdef STORM_HAVE_MPI
+TEST(ExplicitPrismModelBuilderTest, Distributed) {
+    // Small batches enforce several exchanges of discovered states between the ranks.
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    options.distributedBatchSize = 4;
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto components = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), options).buildDistributed(MPI_COMM_WORLD);
+    uint64_t localTransitions = components.transitionMatrix.getEntryCount();
+    uint64_t transitions = 0;
+    MPI_Allreduce(&localTransitions, &transitions, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(13ul, components.getNumberOfStates());
+    EXPECT_EQ(20ul, transitions);
+    EXPECT_EQ(components.getNumberOfLocalStates(), components.transitionMatrix.getRowGroupCount());
+    EXPECT_EQ(13ul, components.transitionMatrix.getColumnCount());
+    uint64_t localInitialStates = components.stateLabeling.getStates("init").getNumberOfSetBits();
+    uint64_t initialStates = 0;
+    MPI_Allreduce(&localInitialStates, &initialStates, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(1ul, initialStates);
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    components = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), options).buildDistributed(MPI_COMM_WORLD);
+    localTransitions = components.transitionMatrix.getEntryCount();
+    MPI_Allreduce(&localTransitions, &transitions, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(169ul, components.getNumberOfStates());
+    EXPECT_EQ(436ul, transitions);
+
+    // Every rank writes its own part of the partitioned file. The name is chosen by the first rank such that all
+    // parts belong to the same file.
+    std::string filename;
+    if (components.rank == 0) {
+        filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-partitioned-%%%%-%%%%.bin")).string();
+    }
+    uint64_t filenameLength = filename.size();
+    MPI_Bcast(&filenameLength, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+    filename.resize(filenameLength);
+    MPI_Bcast(&filename[0], static_cast<int>(filenameLength), MPI_CHAR, 0, MPI_COMM_WORLD);
+    storm::storage::sparse::writePartitionedModel(components, filename);
+    uint64_t localRows = components.transitionMatrix.getRowCount();
+    uint64_t rows = 0;
+    MPI_Allreduce(&localRows, &rows, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // The first rank checks the parts written by all ranks.
+    if (components.rank == 0) {
+        EXPECT_TRUE(boost::filesystem::exists(filename));
+        uint64_t partRows = 0;
+        uint64_t partEntries = 0;
+        for (uint64_t part = 0; part + 1 < components.stateOffsets.size(); ++part) {
+            std::string partFilename = filename + "." + std::to_string(part);
+            ASSERT_TRUE(boost::filesystem::exists(partFilename));
+            {
+                storm::storage::OnDiskSparseMatrix<double> partMatrix(partFilename, 16);
+                partRows += partMatrix.getRowCount();
+                partEntries += partMatrix.getEntryCount();
+            }
+            boost::filesystem::remove(partFilename);
+        }
+        EXPECT_EQ(rows, partRows);
+        EXPECT_EQ(transitions, partEntries);
+        boost::filesystem::remove(filename);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+#endif
@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/AbstractionSettings.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
+namespace {
+
+    /*!
+     * Checks the given formula on the model with the bisimulation-based abstraction refinement. Each refinement step
+     * splits the blocks at most ten times, so the models below are refined over several rounds before the bounds meet.
+     */
+    template<typename ModelType>
+    double checkWithAbstractionRefinement(ModelType const& model, std::string const& formulaString, bool incrementalPartialQuotient) {
+        storm::settings::mutableBisimulationSettings().setIncrementalPartialQuotient(incrementalPartialQuotient);
+
+        storm::parser::FormulaParser formulaParser;
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+
+        storm::Environment env;
+        storm::modelchecker::BisimulationAbstractionRefinementModelChecker<ModelType> checker(model);
+        EXPECT_TRUE(checker.canHandle(task));
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+
+        storm::settings::mutableBisimulationSettings().restoreDefaults();
+        return result->asQuantitativeCheckResult<double>().getMin();
+    }
+
+    template<storm::dd::DdType DdType>
+    void checkCrowds() {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-4-3.pm");
+        std::shared_ptr<storm::models::symbolic::Model<DdType, double>> model = storm::builder::DdPrismModelBuilder<DdType, double>().build(program);
+        ASSERT_EQ(storm::models::ModelType::Dtmc, model->getType());
+        auto dtmc = model->template as<storm::models::symbolic::Dtmc<DdType, double>>();
+
+        double precision = storm::settings::getModule<storm::settings::modules::AbstractionSettings>().getPrecision();
+        double incrementalResult = checkWithAbstractionRefinement(*dtmc, "P=? [F \"observeIGreater1\"]", true);
+        double fullResult = checkWithAbstractionRefinement(*dtmc, "P=? [F \"observeIGreater1\"]", false);
+        EXPECT_NEAR(40300855878315123.0 / 1268858272000000000.0, incrementalResult, precision);
+        EXPECT_NEAR(fullResult, incrementalResult, 1e-10);
+    }
+
+    template<storm::dd::DdType DdType>
+    void checkTwoDice() {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        std::shared_ptr<storm::models::symbolic::Model<DdType, double>> model = storm::builder::DdPrismModelBuilder<DdType, double>().build(program);
+        ASSERT_EQ(storm::models::ModelType::Mdp, model->getType());
+        auto mdp = model->template as<storm::models::symbolic::Mdp<DdType, double>>();
+
+        double precision = storm::settings::getModule<storm::settings::modules::AbstractionSettings>().getPrecision();
+        for (auto const& formulaString : {"Pmin=? [F \"four\"]", "Pmax=? [F \"four\"]"}) {
+            double incrementalResult = checkWithAbstractionRefinement(*mdp, formulaString, true);
+            double fullResult = checkWithAbstractionRefinement(*mdp, formulaString, false);
+            EXPECT_NEAR(2.0 / 36.0, incrementalResult, precision);
+            EXPECT_NEAR(fullResult, incrementalResult, 1e-10);
+        }
+    }
+
+    TEST(BisimulationAbstractionRefinementModelCheckerTest, IncrementalPartialQuotientCrowds_Cudd) {
+        checkCrowds<storm::dd::DdType::CUDD>();
+    }
+
+    TEST(BisimulationAbstractionRefinementModelCheckerTest, IncrementalPartialQuotientCrowds_Sylvan) {
+        checkCrowds<storm::dd::DdType::Sylvan>();
+    }
+
+    TEST(BisimulationAbstractionRefinementModelCheckerTest, IncrementalPartialQuotientTwoDice_Cudd) {
+        checkTwoDice<storm::dd::DdType::CUDD>();
+    }
+
+    TEST(BisimulationAbstractionRefinementModelCheckerTest, IncrementalPartialQuotientTwoDice_Sylvan) {
+        checkTwoDice<storm::dd::DdType::Sylvan>();
+    }
+}
@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/verification.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/properties.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/results/CheckResultCache.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> buildDie(std::vector<std::shared_ptr<storm::logic::Formula const>>& formulas, std::string const& formulasString) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        return storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+    }
+}
+
+TEST(CheckResultCacheTest, ReuseAcrossProperties) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    auto model = buildDie(formulas, "P=? [F \"one\"]; P=? [F \"one\"]; P>=0.1 [F \"two\"]; P=? [F P>=0.1 [F \"two\"]]");
+    ASSERT_EQ(4ul, formulas.size());
+
+    storm::Environment env;
+    auto cache = std::make_shared<storm::modelchecker::CheckResultCache>();
+    env.modelchecker().setResultCache(cache);
+
+    auto result1 = storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    EXPECT_EQ(0ul, cache->getNumberOfHits());
+    EXPECT_EQ(1ul, cache->getNumberOfEntries());
+    EXPECT_LT(0ul, cache->getMemoryUsage());
+
+    auto result2 = storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[1]));
+    EXPECT_EQ(1ul, cache->getNumberOfHits());
+    EXPECT_EQ(1ul, cache->getNumberOfEntries());
+    EXPECT_EQ(result1->asExplicitQuantitativeCheckResult<double>().getValueVector(), result2->asExplicitQuantitativeCheckResult<double>().getValueVector());
+    EXPECT_NEAR(1.0 / 6.0, result2->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+
+    // The nested operator formula is answered from the cache.
+    auto result3 = storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[2]));
+    EXPECT_TRUE(result3->asExplicitQualitativeCheckResult()[0]);
+    uint64_t hits = cache->getNumberOfHits();
+    auto result4 = storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[3]));
+    EXPECT_EQ(hits + 1, cache->getNumberOfHits());
+    EXPECT_NEAR(1.0, result4->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+
+    // Without a cache, nothing is stored.
+    storm::Environment uncachedEnv;
+    auto result5 = storm::api::verifyWithSparseEngine<double>(uncachedEnv, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    EXPECT_EQ(result1->asExplicitQuantitativeCheckResult<double>().getValueVector(), result5->asExplicitQuantitativeCheckResult<double>().getValueVector());
+    EXPECT_EQ(hits + 1, cache->getNumberOfHits());
+}
+
+TEST(CheckResultCacheTest, Eviction) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    auto model = buildDie(formulas, "P=? [F \"one\"]; P=? [F \"two\"]");
+    ASSERT_EQ(2ul, formulas.size());
+
+    // The limit only allows for a single result of the 13 states.
+    storm::Environment env;
+    auto cache = std::make_shared<storm::modelchecker::CheckResultCache>(450);
+    env.modelchecker().setResultCache(cache);
+
+    storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[1]));
+    EXPECT_EQ(1ul, cache->getNumberOfEntries());
+    EXPECT_EQ(1ul, cache->getNumberOfEvictions());
+    EXPECT_GE(450ul, cache->getMemoryUsage());
+
+    // The evicted result is recomputed.
+    storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    EXPECT_EQ(0ul, cache->getNumberOfHits());
+    EXPECT_EQ(3ul, cache->getNumberOfMisses());
+
+    cache->clear();
+    EXPECT_EQ(0ul, cache->getNumberOfEntries());
+    EXPECT_EQ(0ul, cache->getMemoryUsage());
+
+    // Results of other models are not cached.
+    int otherModel = 0;
+    cache->restrictToModel(&otherModel);
+    storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    EXPECT_EQ(0ul, cache->getNumberOfEntries());
+    cache->restrictToModel(model.get());
+    storm::api::verifyWithSparseEngine<double>(env, model, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    EXPECT_EQ(1ul, cache->getNumberOfEntries());
+}
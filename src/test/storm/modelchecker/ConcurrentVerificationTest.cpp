@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <set>
+#include <boost/filesystem.hpp>
+
+#include "storm/api/builder.h"
+#include "storm/api/verification.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/properties.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/ThreadPool.h"
+
+TEST(ConcurrentVerificationTest, SharedMdp) {
+    std::string formulasString = "Pmin=? [F \"two\"]; Pmax=? [F \"two\"]; Pmin=? [F \"three\"]; Pmax=? [F \"three\"]; Pmin=? [F \"four\"]; Pmax=? [F \"four\"]";
+    formulasString += "; Pmin=? [F \"seven\"]; Pmax=? [F \"seven\"]; Rmin=? [F \"done\"]; Rmax=? [F \"done\"]; Pmin=? [F<=10 \"done\"]; Pmax=? [F<=10 \"done\"]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(program, formulas);
+    EXPECT_EQ(169ul, model->getNumberOfStates());
+
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (auto const& formula : formulas) {
+        tasks.emplace_back(*formula, true);
+    }
+
+    storm::Environment env;
+    std::vector<double> expected;
+    for (auto const& task : tasks) {
+        auto result = storm::api::verifyWithSparseEngine<double>(env, model, task);
+        ASSERT_TRUE(result != nullptr);
+        expected.push_back(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()]);
+    }
+
+    storm::utility::ThreadPool threadPool(4);
+    // Check every task several times to have more jobs than threads.
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> repeatedTasks;
+    for (uint64_t repetition = 0; repetition < 3; ++repetition) {
+        repeatedTasks.insert(repeatedTasks.end(), tasks.begin(), tasks.end());
+    }
+    auto futures = storm::api::verifyWithSparseEngine<double>(env, model, repeatedTasks, threadPool);
+    ASSERT_EQ(repeatedTasks.size(), futures.size());
+    for (uint64_t index = 0; index < futures.size(); ++index) {
+        auto result = futures[index].get();
+        ASSERT_TRUE(result != nullptr);
+        EXPECT_NEAR(expected[index % tasks.size()], result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-12);
+    }
+}
+
+TEST(ConcurrentVerificationTest, SharedMdpWithCheckpoints) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Rmin=? [F \"done\"]; Rmax=? [F \"done\"]", program));
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(program, formulas);
+
+    // Checking each task twice lets jobs perform the very same computation at the same time.
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (uint64_t repetition = 0; repetition < 2; ++repetition) {
+        for (auto const& formula : formulas) {
+            tasks.emplace_back(*formula, true);
+        }
+    }
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    std::vector<double> expected;
+    for (auto const& task : tasks) {
+        auto result = storm::api::verifyWithSparseEngine<double>(env, model, task);
+        ASSERT_TRUE(result != nullptr);
+        expected.push_back(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()]);
+    }
+
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-checkpoints-%%%%-%%%%-%%%%");
+    boost::filesystem::create_directory(directory);
+    env.solver().setCheckpointFilename((directory / "checkpoint").string());
+    env.solver().setCheckpointInterval(0);
+
+    storm::utility::ThreadPool threadPool(2);
+    auto futures = storm::api::verifyWithSparseEngine<double>(env, model, tasks, threadPool);
+    for (uint64_t index = 0; index < futures.size(); ++index) {
+        auto result = futures[index].get();
+        ASSERT_TRUE(result != nullptr);
+        EXPECT_NEAR(expected[index], result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-12);
+    }
+
+    // Each job has its own checkpoints.
+    std::set<std::string> jobPrefixes;
+    for (auto const& entry : boost::filesystem::directory_iterator(directory)) {
+        std::string filename = entry.path().filename().string();
+        jobPrefixes.insert(filename.substr(0, filename.find('.', std::string("checkpoint.job").size())));
+    }
+    EXPECT_EQ(tasks.size(), jobPrefixes.size());
+    boost::filesystem::remove_all(directory);
+}
@@ -0,0 +1,252 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-parsers/parser/RecursiveDescentPrismParser.h"
+
+#include <sstream>
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    void expectSamePrograms(storm::prism::Program const& expected, storm::prism::Program const& actual) {
+        EXPECT_EQ(expected.getModelType(), actual.getModelType());
+        EXPECT_EQ(expected.getNumberOfModules(), actual.getNumberOfModules());
+        EXPECT_EQ(expected.getNumberOfCommands(), actual.getNumberOfCommands());
+        EXPECT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+        EXPECT_EQ(expected.getNumberOfLabels(), actual.getNumberOfLabels());
+        EXPECT_EQ(expected.getActionNameToIndexMapping(), actual.getActionNameToIndexMapping());
+
+        std::stringstream expectedStream;
+        expectedStream << expected;
+        std::stringstream actualStream;
+        actualStream << actual;
+        EXPECT_EQ(expectedStream.str(), actualStream.str());
+    }
+}
+
+TEST(RecursiveDescentPrismParser, StandardModelTest) {
+    for (std::string const& filename : {STORM_TEST_RESOURCES_DIR "/mdp/coin2.nm", STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2_2.nm", STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", STORM_TEST_RESOURCES_DIR "/mdp/firewire.nm", STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm", STORM_TEST_RESOURCES_DIR "/dtmc/leader3_5.pm", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", STORM_TEST_RESOURCES_DIR "/mdp/wlan0_collide.nm"}) {
+        storm::prism::Program result;
+        ASSERT_NO_THROW(result = storm::parser::RecursiveDescentPrismParser::parse(filename)) << filename;
+        expectSamePrograms(storm::parser::PrismParser::parse(filename), result);
+    }
+}
+
+TEST(RecursiveDescentPrismParser, ComplexTest) {
+    std::string testInput =
+    R"(ma
+
+    const int a;
+    const int b = 10;
+    const bool c;
+    const bool d = true | false;
+    const double e;
+    const double f = 9.5e-1;
+
+    formula test = a >= 10 & (max(a,b) > floor(e));
+    formula test2 = a+b;
+    formula test3 = (a + b > 10 ? floor(e) : h) + a;
+
+    global g : bool init false;
+    global h : [0 .. b];
+
+    module mod1
+        i : bool;
+        j : bool init c;
+        k : [125..a] init a;
+
+        [a] test&false -> (i'=true)&(k'=1+1) + 1 : (k'=floor(e) + max(k, b) - 1 + k);
+        [b] true -> (i'=i);
+    endmodule
+
+    module mod2
+        [] (k > 3) & false & (min(a, 0) < max(h, k)) -> 1-e: (g'=(1-a) * 2 + floor(f) > 2);
+        <> k<-1 -> pow(2, k) : true;
+    endmodule
+
+    module mod3 = mod1 [ i = i1, j = j1, k = k1, b = c1 ] endmodule
+
+    label "mal" = max(a, 10) > 0;
+
+    rewards "testrewards"
+        [a] true : a + 7;
+        max(f, a) <= 8 : 2*b;
+    endrewards
+
+    rewards "testrewards2"
+        [b] true : a + 7;
+        [c1] true : 0.25;
+        max(f, a) <= 8 : 2*b;
+    endrewards)";
+
+    storm::prism::Program result;
+    ASSERT_NO_THROW(result = storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile"));
+    EXPECT_EQ(storm::prism::Program::ModelType::MA, result.getModelType());
+    EXPECT_EQ(3ul, result.getNumberOfModules());
+    EXPECT_EQ(2ul, result.getNumberOfRewardModels());
+    EXPECT_EQ(1ul, result.getNumberOfLabels());
+    expectSamePrograms(storm::parser::PrismParser::parseFromString(testInput, "testfile"), result);
+}
+
+TEST(RecursiveDescentPrismParser, IllegalInputTest) {
+    std::string testInput =
+    R"(dtmc
+
+    module mod1
+        c : [0 .. 8] init 1;
+        [] c < 3 -> 1: (c' = c+1);
+        [] c = 3 -> 1: (c' = d);
+    endmodule)";
+
+    storm::prism::Program result;
+    try {
+        result = storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile");
+        FAIL() << "Undeclared identifier was not detected.";
+    } catch (storm::exceptions::WrongFormatException const& e) {
+        EXPECT_NE(std::string::npos, std::string(e.what()).find("line 6")) << e.what();
+    }
+
+    testInput =
+    R"(dtmc
+
+    const int a;
+    const bool a = true;
+
+    module mod1
+        c : [0 .. 8] init 1;
+        [] c < 3 -> 1: (c' = c+1);
+    endmodule)";
+    EXPECT_THROW(result = storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile"), storm::exceptions::WrongFormatException);
+
+    testInput =
+    R"(dtmc
+
+    module mod1
+        c : [0 .. 8] init 1;
+        [] c < 3 -> 1: (c' = true || false);
+    endmodule)";
+    EXPECT_THROW(result = storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile"), storm::exceptions::WrongFormatException);
+
+    testInput =
+    R"(dtmc
+
+    module mod1
+        c : [0 .. 8] init 1;
+        [] c + 3 -> 1: (c' = 1);
+    endmodule)";
+    EXPECT_THROW(result = storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile"), storm::exceptions::WrongFormatException);
+}
+
+TEST(RecursiveDescentPrismParser, ExponentWithoutDotTest) {
+    std::string testInput =
+    R"(dtmc
+
+    const double p = 1e-3;
+    const double q = 25E2;
+    const double r = 2.5e+1;
+
+    module mod1
+        c : [0 .. 1] init 0;
+        [] c = 0 -> p : (c' = 1) + 1 - p : (c' = 0);
+    endmodule)";
+
+    storm::prism::Program result;
+    ASSERT_NO_THROW(result = storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile"));
+    ASSERT_EQ(3ul, result.getNumberOfConstants());
+    EXPECT_NEAR(0.001, result.getConstants()[0].getExpression().evaluateAsDouble(), 1e-12);
+    EXPECT_EQ(2500.0, result.getConstants()[1].getExpression().evaluateAsDouble());
+    EXPECT_EQ(25.0, result.getConstants()[2].getExpression().evaluateAsDouble());
+    expectSamePrograms(storm::parser::PrismParser::parseFromString(testInput, "testfile"), result);
+}
+
+TEST(RecursiveDescentPrismParser, RenamedModuleActionsTest) {
+    // The reward model refers to an action that only occurs in the renamed module, which is declared afterwards.
+    std::string testInput =
+    R"(mdp
+
+    module A
+        x : bool init false;
+        [a] !x -> (x' = true);
+    endmodule
+
+    rewards "r"
+        [b] true : 1;
+    endrewards
+
+    module B = A [ x = y, a = b ] endmodule
+
+    module C
+        z : bool init false;
+        [c] !z -> (z' = true);
+    endmodule)";
+
+    storm::prism::Program result;
+    ASSERT_NO_THROW(result = storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile"));
+    EXPECT_EQ(1ul, result.getActionIndex("a"));
+    EXPECT_EQ(2ul, result.getActionIndex("b"));
+    EXPECT_EQ(3ul, result.getActionIndex("c"));
+    expectSamePrograms(storm::parser::PrismParser::parseFromString(testInput, "testfile"), result);
+}
+
+TEST(RecursiveDescentPrismParser, StrictSyntaxTest) {
+    // The updates of a command need to be separated by '+'.
+    std::string testInput =
+    R"(dtmc
+
+    module mod1
+        x : [0 .. 2] init 0;
+        [] x = 0 -> 0.5 : (x' = 1) 0.5 : (x' = 2);
+    endmodule)";
+    EXPECT_THROW(storm::parser::RecursiveDescentPrismParser::parseFromString(testInput, "testfile"), storm::exceptions::WrongFormatException);
+
+    // The remaining inputs are rejected by both parsers.
+    std::vector<std::string> testInputs;
+
+    // The model type is mandatory.
+    testInputs.push_back(
+    R"(module mod1
+        x : bool init false;
+        [] !x -> (x' = true);
+    endmodule)");
+
+    // The model type has to be given first.
+    testInputs.push_back(
+    R"(const int N = 2;
+
+    dtmc
+
+    module mod1
+        x : bool init false;
+        [] !x -> (x' = true);
+    endmodule)");
+
+    // Reward models must not be empty.
+    testInputs.push_back(
+    R"(dtmc
+
+    module mod1
+        x : bool init false;
+        [] !x -> (x' = true);
+    endmodule
+
+    rewards "r"
+    endrewards)");
+
+    // The system composition construct has to be the last construct.
+    testInputs.push_back(
+    R"(dtmc
+
+    module mod1
+        x : bool init false;
+        [] !x -> (x' = true);
+    endmodule
+
+    system mod1 endsystem
+
+    label "done" = x;)");
+
+    for (auto const& input : testInputs) {
+        EXPECT_THROW(storm::parser::RecursiveDescentPrismParser::parseFromString(input, "testfile"), storm::exceptions::WrongFormatException) << input;
+        EXPECT_THROW(storm::parser::PrismParser::parseFromString(input, "testfile"), storm::exceptions::WrongFormatException) << input;
+    }
+}
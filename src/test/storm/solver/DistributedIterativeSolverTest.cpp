@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MPI
+#include "test/storm_gtest.h"
+
+#include "storm/solver/DistributedIterativeSolver.h"
+#include "storm/storage/DistributedSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/utility/mpi.h"
+
+// These tests also work if they are executed on several ranks, e.g., via mpirun.
+namespace {
+
+    TEST(DistributedIterativeSolverTest, Partition) {
+        storm::storage::SparseMatrixBuilder<double> builder(4, 4, 7);
+        builder.addNextValue(0, 0, 0.5);
+        builder.addNextValue(0, 1, 0.5);
+        builder.addNextValue(1, 0, 0.2);
+        builder.addNextValue(1, 1, 0.4);
+        builder.addNextValue(1, 2, 0.4);
+        builder.addNextValue(2, 3, 1.0);
+        builder.addNextValue(3, 3, 1.0);
+        storm::storage::SparseMatrix<double> matrix = builder.build();
+
+        std::vector<uint64_t> offsets = storm::storage::DistributedSparseMatrix<double>::computeBalancedPartition(matrix, 2);
+        EXPECT_EQ(std::vector<uint64_t>({0, 2, 4}), offsets);
+        offsets = storm::storage::DistributedSparseMatrix<double>::computeBalancedPartition(matrix, 6);
+        ASSERT_EQ(7ull, offsets.size());
+        EXPECT_EQ(4ull, offsets.back());
+        for (uint64_t part = 1; part < offsets.size(); ++part) {
+            EXPECT_LE(offsets[part - 1], offsets[part]);
+        }
+    }
+
+    TEST(DistributedIterativeSolverTest, Jacobi) {
+        storm::storage::SparseMatrixBuilder<double> builder(3, 3, 7);
+        builder.addNextValue(0, 0, 4.0);
+        builder.addNextValue(0, 1, 2.0);
+        builder.addNextValue(1, 0, 1.0);
+        builder.addNextValue(1, 1, 5.0);
+        builder.addNextValue(1, 2, -1.0);
+        builder.addNextValue(2, 0, 0.5);
+        builder.addNextValue(2, 2, 2.0);
+        storm::storage::SparseMatrix<double> matrix = builder.build();
+        std::vector<double> b = {8.0, 8.0, 6.5};
+
+        auto distributedMatrix = storm::storage::DistributedSparseMatrix<double>::distribute(MPI_COMM_WORLD, matrix);
+        EXPECT_EQ(3ull, distributedMatrix.getNumberOfStates());
+        std::vector<double> x(distributedMatrix.getNumberOfLocalStates(), 0.0);
+        std::vector<double> localB = distributedMatrix.getLocalStateValues(b);
+
+        storm::Environment env;
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        storm::solver::DistributedIterativeSolver<double> solver(distributedMatrix);
+        ASSERT_TRUE(solver.solveEquationsJacobi(env, x, localB));
+
+        std::vector<double> result = distributedMatrix.gatherStateValues(x);
+        EXPECT_NEAR(1.0, result[0], 1e-8);
+        EXPECT_NEAR(2.0, result[1], 1e-8);
+        EXPECT_NEAR(3.0, result[2], 1e-8);
+    }
+
+    TEST(DistributedIterativeSolverTest, MinMaxValueIteration) {
+        // A chain of states where each state can either move on or stay with some probability.
+        uint64_t numberOfStates = 20;
+        storm::storage::SparseMatrixBuilder<double> builder(2 * numberOfStates - 1, numberOfStates, 0, true, true, numberOfStates);
+        std::vector<double> rewards;
+        for (uint64_t state = 0; state + 1 < numberOfStates; ++state) {
+            builder.newRowGroup(2 * state);
+            builder.addNextValue(2 * state, state + 1, 1.0);
+            rewards.push_back(3.0);
+            builder.addNextValue(2 * state + 1, state, 0.5);
+            builder.addNextValue(2 * state + 1, state + 1, 0.5);
+            rewards.push_back(1.0);
+        }
+        // The last state is absorbing and collects no reward.
+        builder.newRowGroup(2 * numberOfStates - 2);
+        builder.addNextValue(2 * numberOfStates - 2, numberOfStates - 1, 1.0);
+        rewards.push_back(0.0);
+        storm::storage::SparseMatrix<double> matrix = builder.build();
+
+        auto distributedMatrix = storm::storage::DistributedSparseMatrix<double>::distribute(MPI_COMM_WORLD, matrix);
+        std::vector<double> localRewards = distributedMatrix.getLocalRowValues(rewards);
+
+        storm::Environment env;
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        storm::solver::DistributedIterativeSolver<double> solver(distributedMatrix);
+
+        // Staying takes two steps in expectation, yielding a reward of two, which is less than three.
+        std::vector<double> x(distributedMatrix.getNumberOfLocalStates(), 0.0);
+        ASSERT_TRUE(solver.solveEquationsValueIteration(env, storm::OptimizationDirection::Minimize, x, localRewards));
+        std::vector<double> result = distributedMatrix.gatherStateValues(x);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(2.0 * (numberOfStates - 1 - state), result[state], 1e-8);
+        }
+
+        x.assign(distributedMatrix.getNumberOfLocalStates(), 0.0);
+        ASSERT_TRUE(solver.solveEquationsValueIteration(env, storm::OptimizationDirection::Maximize, x, localRewards));
+        result = distributedMatrix.gatherStateValues(x);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(3.0 * (numberOfStates - 1 - state), result[state], 1e-8);
+        }
+    }
+
+}
+#endif
@@ -3,6 +3,7 @@
 
 #ifdef STORM_HAVE_GUROBI
 #include "storm/solver/GurobiLpSolver.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidAccessException.h"
 #include "storm/settings/SettingsManager.h"
@@ -43,6 +44,47 @@ TEST(GurobiLpSolver, LPOptimizeMax) {
     ASSERT_LT(std::abs(objectiveValue - 14.75), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(GurobiLpSolver, LPOptimizeMaxMatrixConstraints) {
+    storm::solver::GurobiLpSolver<double> solver(storm::OptimizationDirection::Maximize);
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    ASSERT_NO_THROW(x = solver.addBoundedContinuousVariable("x", 0, 1, -1));
+    ASSERT_NO_THROW(y = solver.addLowerBoundedContinuousVariable("y", 0, 2));
+    ASSERT_NO_THROW(z = solver.addLowerBoundedContinuousVariable("z", 0, 1));
+    ASSERT_NO_THROW(solver.update());
+    
+    // The same constraints as in LPOptimizeMax, given as matrices over the variables x, y and z.
+    storm::storage::SparseMatrixBuilder<double> inequalityBuilder(2, 3);
+    inequalityBuilder.addNextValue(0, 0, 1);
+    inequalityBuilder.addNextValue(0, 1, 1);
+    inequalityBuilder.addNextValue(0, 2, 1);
+    inequalityBuilder.addNextValue(1, 0, -1);
+    inequalityBuilder.addNextValue(1, 1, 1);
+    storm::storage::SparseMatrixBuilder<double> equalityBuilder(1, 3);
+    equalityBuilder.addNextValue(0, 0, -1);
+    equalityBuilder.addNextValue(0, 1, 0.5);
+    equalityBuilder.addNextValue(0, 2, 1);
+    ASSERT_NO_THROW(solver.addConstraints(inequalityBuilder.build(), {x, y, z}, storm::expressions::OperatorType::LessOrEqual, {12, 5.5}));
+    ASSERT_NO_THROW(solver.addConstraints(equalityBuilder.build(), {x, y, z}, storm::expressions::OperatorType::Equal, {5}));
+    ASSERT_NO_THROW(solver.update());
+    
+    ASSERT_NO_THROW(solver.optimize());
+    ASSERT_TRUE(solver.isOptimal());
+    double xValue = 0;
+    ASSERT_NO_THROW(xValue = solver.getContinuousValue(x));
+    ASSERT_LT(std::abs(xValue - 1), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    double yValue = 0;
+    ASSERT_NO_THROW(yValue = solver.getContinuousValue(y));
+    ASSERT_LT(std::abs(yValue - 6.5), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    double zValue = 0;
+    ASSERT_NO_THROW(zValue = solver.getContinuousValue(z));
+    ASSERT_LT(std::abs(zValue - 2.75), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    double objectiveValue = 0;
+    ASSERT_NO_THROW(objectiveValue = solver.getObjectiveValue());
+    ASSERT_LT(std::abs(objectiveValue - 14.75), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
 TEST(GurobiLpSolver, LPOptimizeMin) {
     storm::solver::GurobiLpSolver<double> solver(storm::OptimizationDirection::Minimize);
     storm::expressions::Variable x;
@@ -3,10 +3,13 @@
 #include "test/storm_gtest.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/AggregationDisaggregationHelper.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/exceptions/InvalidEnvironmentException.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -24,6 +27,20 @@ namespace {
         }
     };
     
+    class NativeDoublePowerAndersonEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+            env.solver().native().setAndersonAccelerationDepth(3);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeDoubleSoundValueIterationEnvironment {
     public:
         typedef double ValueType;
@@ -107,6 +124,48 @@ namespace {
         }
     };
     
+    class NativeDoubleAggregationDisaggregationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::AggregationDisaggregation);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleGmresIluEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+            env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleBicgstabBlockJacobiEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+            env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::BlockJacobi);
+            env.solver().native().setPreconditionerBlockSize(2);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeRationalRationalSearchEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -293,12 +352,16 @@ namespace {
   
     typedef ::testing::Types<
             NativeDoublePowerEnvironment,
+            NativeDoublePowerAndersonEnvironment,
             NativeDoubleSoundValueIterationEnvironment,
             NativeDoubleIntervalIterationEnvironment,
             NativeDoubleJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
+            NativeDoubleAggregationDisaggregationEnvironment,
+            NativeDoubleGmresIluEnvironment,
+            NativeDoubleBicgstabBlockJacobiEnvironment,
             NativeRationalRationalSearchEnvironment,
             EliminationRationalEnvironment,
             GmmGmresIluEnvironment,
@@ -353,4 +416,121 @@ namespace {
         EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
         EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
     }
+    
+    TEST(LinearEquationSolverTest, OutOfCorePowerIteration) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        builder.addNextValue(0, 0, 0.2);
+        builder.addNextValue(0, 1, 0.4);
+        builder.addNextValue(0, 2, 0.4);
+        builder.addNextValue(1, 0, 0.02);
+        builder.addNextValue(1, 1, 0.96);
+        builder.addNextValue(1, 2, 0.02);
+        builder.addNextValue(2, 0, 0.4);
+        builder.addNextValue(2, 1, 0.3);
+        storm::storage::SparseMatrix<double> A = builder.build();
+        
+        storm::Environment env = NativeDoublePowerEnvironment::createEnvironment();
+        env.solver().multiplier().setType(storm::solver::MultiplierType::OutOfCore);
+        env.solver().multiplier().setOutOfCoreBlockSize(2);
+        
+        // The solver owns the matrix, so the matrix is moved to disk.
+        std::vector<double> x(3);
+        std::vector<double> b = {3, -0.01, 12};
+        auto solver = storm::solver::GeneralLinearEquationSolverFactory<double>().create(env, std::move(A));
+        ASSERT_NO_THROW(solver->solveEquations(env, x, b));
+        EXPECT_NEAR(x[0], 481.0 / 9.0, 1e-6);
+        EXPECT_NEAR(x[1], 457.0 / 9.0, 1e-6);
+        EXPECT_NEAR(x[2], 875.0 / 18.0, 1e-6);
+        
+        // The multiplier is recreated from the matrix on disk.
+        x.assign(3, 0.0);
+        ASSERT_NO_THROW(solver->solveEquations(env, x, b));
+        EXPECT_NEAR(x[0], 481.0 / 9.0, 1e-6);
+        
+        // Other methods require the entries of the matrix in memory.
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        EXPECT_THROW(solver->solveEquations(env, x, b), storm::exceptions::InvalidEnvironmentException);
+    }
+    
+    TEST(LinearEquationSolverTest, SteadyStateAggregationDisaggregationNcd) {
+        // Two clusters of three states that are only weakly connected and a separate bottom SCC.
+        storm::storage::SparseMatrixBuilder<double> builder;
+        builder.addNextValue(0, 0, 0.2);
+        builder.addNextValue(0, 1, 0.5);
+        builder.addNextValue(0, 2, 0.3);
+        builder.addNextValue(1, 0, 0.1);
+        builder.addNextValue(1, 1, 0.3);
+        builder.addNextValue(1, 2, 0.6);
+        builder.addNextValue(2, 0, 0.7);
+        builder.addNextValue(2, 1, 0.299);
+        builder.addNextValue(2, 3, 0.001);
+        builder.addNextValue(3, 3, 0.4);
+        builder.addNextValue(3, 4, 0.4);
+        builder.addNextValue(3, 5, 0.2);
+        builder.addNextValue(4, 3, 0.5);
+        builder.addNextValue(4, 4, 0.1);
+        builder.addNextValue(4, 5, 0.4);
+        builder.addNextValue(5, 0, 0.002);
+        builder.addNextValue(5, 3, 0.3);
+        builder.addNextValue(5, 4, 0.698);
+        builder.addNextValue(6, 6, 0.9);
+        builder.addNextValue(6, 7, 0.1);
+        builder.addNextValue(7, 6, 0.3);
+        builder.addNextValue(7, 7, 0.7);
+        storm::storage::SparseMatrix<double> transposedMatrix = builder.build().transpose();
+        std::vector<uint64_t> componentOfState = {0, 0, 0, 0, 0, 0, 1, 1};
+        
+        storm::Environment env = NativeDoubleAggregationDisaggregationEnvironment::createEnvironment();
+        storm::solver::helper::SteadyStateAggregationDisaggregationHelper<double> helper(env, transposedMatrix, componentOfState, 2);
+        EXPECT_EQ(3ull, helper.getNumberOfAggregates());
+        EXPECT_FALSE(helper.isCoarseChainAggregated());
+        
+        std::vector<double> x = {1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0, 0.5, 0.5};
+        ASSERT_TRUE(helper.computeSteadyStateDistribution(env, x));
+        EXPECT_NEAR(x[0], 0.1896124709, 1e-9);
+        EXPECT_NEAR(x[1], 0.2147800117, 1e-9);
+        EXPECT_NEAR(x[2], 0.1857517483, 1e-9);
+        EXPECT_NEAR(x[3], 0.1695804196, 1e-9);
+        EXPECT_NEAR(x[4], 0.1473994755, 1e-9);
+        EXPECT_NEAR(x[5], 0.0928758741, 1e-9);
+        EXPECT_NEAR(x[6], 0.75, 1e-9);
+        EXPECT_NEAR(x[7], 0.25, 1e-9);
+    }
+    
+    TEST(LinearEquationSolverTest, SteadyStateAggregationDisaggregationRecursive) {
+        // A birth-death chain of strongly coupled pairs, whose 2000 aggregates are aggregated once more.
+        uint64_t const numberOfStates = 4000;
+        storm::storage::SparseMatrixBuilder<double> builder;
+        for (uint64_t state = 0; state < numberOfStates; state += 2) {
+            if (state > 0) {
+                builder.addNextValue(state, state - 1, 0.002);
+                builder.addNextValue(state, state, 0.398);
+            } else {
+                builder.addNextValue(state, state, 0.4);
+            }
+            builder.addNextValue(state, state + 1, 0.6);
+            builder.addNextValue(state + 1, state, 0.3);
+            if (state + 2 < numberOfStates) {
+                builder.addNextValue(state + 1, state + 1, 0.699);
+                builder.addNextValue(state + 1, state + 2, 0.001);
+            } else {
+                builder.addNextValue(state + 1, state + 1, 0.7);
+            }
+        }
+        storm::storage::SparseMatrix<double> transposedMatrix = builder.build().transpose();
+        std::vector<uint64_t> componentOfState(numberOfStates, 0);
+        
+        storm::Environment env = NativeDoubleAggregationDisaggregationEnvironment::createEnvironment();
+        storm::solver::helper::SteadyStateAggregationDisaggregationHelper<double> helper(env, transposedMatrix, componentOfState, 1);
+        EXPECT_EQ(2000ull, helper.getNumberOfAggregates());
+        EXPECT_TRUE(helper.isCoarseChainAggregated());
+        
+        // By detailed balance, the second state of each pair is twice as likely as the first one.
+        std::vector<double> x(numberOfStates, 1.0 / numberOfStates);
+        ASSERT_TRUE(helper.computeSteadyStateDistribution(env, x));
+        for (uint64_t state = 0; state < numberOfStates; state += 2) {
+            EXPECT_NEAR(x[state], 1.0 / 6000.0, 1e-9);
+            EXPECT_NEAR(x[state + 1], 2.0 / 6000.0, 1e-9);
+        }
+    }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
 
@@ -23,6 +24,32 @@ namespace {
             return env;
         }
     };
+    class DoubleViAndersonEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setAndersonAccelerationDepth(3);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    class DoubleViPrioritizedEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::GaussSeidel);
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setPrioritizedGaussSeidel(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
     class DoubleSoundViEnvironment {
     public:
         typedef double ValueType;
@@ -122,6 +149,8 @@ namespace {
   
     typedef ::testing::Types<
             DoubleViEnvironment,
+            DoubleViAndersonEnvironment,
+            DoubleViPrioritizedEnvironment,
             DoubleSoundViEnvironment,
             DoubleIntervalIterationEnvironment,
             DoubleTopologicalViEnvironment,
@@ -160,7 +189,26 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TEST(MinMaxLinearEquationSolverTest, OutOfCoreValueIteration) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 0, 0.9);
+        storm::storage::SparseMatrix<double> A = builder.build(2);
+        
+        storm::Environment env = DoubleViEnvironment::createEnvironment();
+        env.solver().multiplier().setType(storm::solver::MultiplierType::OutOfCore);
+        
+        // The solver owns the matrix, so the matrix is moved to disk.
+        std::vector<double> x(1);
+        std::vector<double> b = {0.099, 0.5};
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, std::move(A));
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0], 0.5, 1e-6);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], 0.99, 1e-6);
+    }
 }
-
-
-
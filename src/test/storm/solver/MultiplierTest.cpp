@@ -5,8 +5,12 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/storage/OnDiskSparseMatrix.h"
 
 #include "storm/utility/vector.h"
+
+#include <boost/filesystem.hpp>
+
 namespace {
     
     class NativeEnvironment {
@@ -18,6 +22,9 @@ namespace {
             env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
             return env;
         }
+        static std::unique_ptr<storm::solver::Multiplier<ValueType>> createMultiplier(storm::Environment const& env, storm::storage::SparseMatrix<ValueType> const& A) {
+            return storm::solver::MultiplierFactory<ValueType>().create(env, A);
+        }
     };
     
     class GmmxxEnvironment {
@@ -29,6 +36,27 @@ namespace {
             env.solver().multiplier().setType(storm::solver::MultiplierType::Gmmxx);
             return env;
         }
+        static std::unique_ptr<storm::solver::Multiplier<ValueType>> createMultiplier(storm::Environment const& env, storm::storage::SparseMatrix<ValueType> const& A) {
+            return storm::solver::MultiplierFactory<ValueType>().create(env, A);
+        }
+    };
+    
+    class OutOfCoreEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::OutOfCore);
+            // Use tiny blocks such that row groups span multiple blocks.
+            env.solver().multiplier().setOutOfCoreBlockSize(2);
+            return env;
+        }
+        static std::unique_ptr<storm::solver::Multiplier<ValueType>> createMultiplier(storm::Environment const& env, storm::storage::SparseMatrix<ValueType> const& A) {
+            // The file is deleted together with the multiplier.
+            auto onDiskA = storm::storage::OnDiskSparseMatrix<ValueType>::moveToTemporaryFile(storm::storage::SparseMatrix<ValueType>(A), env.solver().multiplier().getOutOfCoreDirectory(), env.solver().multiplier().getOutOfCoreBlockSize());
+            return storm::solver::MultiplierFactory<ValueType>().create(env, onDiskA);
+        }
     };
     
     template<typename TestType>
@@ -37,6 +65,7 @@ namespace {
         typedef typename TestType::ValueType ValueType;
         MultiplierTest() : _environment(TestType::createEnvironment()) {}
         storm::Environment const& env() const { return _environment; }
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> createMultiplier(storm::storage::SparseMatrix<ValueType> const& A) const { return TestType::createMultiplier(_environment, A); }
         ValueType precision() const { return TestType::isExact ? parseNumber("0") : parseNumber("1e-15");}
         ValueType parseNumber(std::string const& input) const { return storm::utility::convertNumber<ValueType>(input);}
     private:
@@ -45,7 +74,8 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
-            GmmxxEnvironment
+            GmmxxEnvironment,
+            OutOfCoreEnvironment
     > TestingTypes;
     
     TYPED_TEST_CASE(MultiplierTest, TestingTypes);
@@ -69,8 +99,7 @@ namespace {
         std::vector<ValueType> x(5);
         x[4] = this->parseNumber("1");
 
-        auto factory = storm::solver::MultiplierFactory<ValueType>();
-        auto multiplier = factory.create(this->env(), A);
+        auto multiplier = this->createMultiplier(A);
         ASSERT_NO_THROW(multiplier->repeatedMultiply(this->env(), x, nullptr, 4));
         EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
     }
@@ -96,8 +125,7 @@ namespace {
         std::vector<ValueType> initialX = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
         std::vector<ValueType> x;
         
-        auto factory = storm::solver::MultiplierFactory<ValueType>();
-        auto multiplier = factory.create(this->env(), A);
+        auto multiplier = this->createMultiplier(A);
         
         x = initialX;
         ASSERT_NO_THROW(multiplier->repeatedMultiplyAndReduce(this->env(), storm::OptimizationDirection::Minimize, x, nullptr, 1));
@@ -120,4 +148,64 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+    TEST(PrioritizedGaussSeidelTest, ExternallyModifiedVector) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        builder.addNextValue(0, 1, 0.5);
+        builder.addNextValue(0, 4, 0.5);
+        builder.addNextValue(1, 2, 0.5);
+        builder.addNextValue(1, 4, 0.5);
+        builder.addNextValue(2, 3, 0.5);
+        builder.addNextValue(2, 4, 0.5);
+        builder.addNextValue(3, 4, 1);
+        builder.addNextValue(4, 4, 1);
+        storm::storage::SparseMatrix<double> A = builder.build();
+
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setPrioritizedGaussSeidel(true);
+        auto multiplier = storm::solver::MultiplierFactory<double>().create(env, A);
+
+        // As the matrix is acyclic (apart from the self-loop), a single backward sweep yields the fixed point.
+        std::vector<double> x = {0, 0, 0, 0, 1};
+        multiplier->multiplyGaussSeidel(env, x, nullptr);
+        EXPECT_EQ(std::vector<double>({1, 1, 1, 1, 1}), x);
+        multiplier->declareGaussSeidelContinuation();
+        multiplier->multiplyGaussSeidel(env, x, nullptr);
+        EXPECT_EQ(std::vector<double>({1, 1, 1, 1, 1}), x);
+
+        // Without a declared continuation, the modification has to be taken into account although all residuals of
+        // the previous sweep vanished.
+        x = {0, 0, 0, 0, 0.5};
+        multiplier->multiplyGaussSeidel(env, x, nullptr);
+        EXPECT_EQ(std::vector<double>({0.5, 0.5, 0.5, 0.5, 0.5}), x);
+    }
+    
+    TEST(OnDiskSparseMatrixTest, ReadRowWhileStreamingBlocks) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        for (uint64_t row = 0; row < 64; ++row) {
+            builder.addNextValue(row, row, static_cast<double>(row));
+            builder.addNextValue(row, 64, 1.0);
+        }
+        storm::storage::SparseMatrix<double> matrix = builder.build();
+        std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-ondisk-matrix-%%%%-%%%%.bin")).string();
+        storm::storage::OnDiskSparseMatrix<double>::write(matrix, filename);
+        storm::storage::OnDiskSparseMatrix<double> onDiskMatrix(filename, 4, true);
+
+        // The next block is read in the background while single rows are read from the same file.
+        std::vector<storm::storage::OnDiskSparseMatrix<double>::Entry> rowEntries;
+        uint64_t numberOfRows = 0;
+        onDiskMatrix.forEachBlock([&] (storm::storage::OnDiskSparseMatrix<double>::Block const& block) {
+            for (uint64_t row = block.firstRow; row < block.endRow; ++row) {
+                auto const& blockEntry = block.entries[onDiskMatrix.getRowIndications()[row] - block.firstEntry];
+                EXPECT_EQ(row, blockEntry.column);
+                EXPECT_EQ(static_cast<double>(row), blockEntry.value);
+                onDiskMatrix.readRow(63 - row, rowEntries);
+                ASSERT_EQ(2ul, rowEntries.size());
+                EXPECT_EQ(static_cast<double>(63 - row), rowEntries[0].value);
+                ++numberOfRows;
+            }
+        });
+        EXPECT_EQ(64ul, numberOfRows);
+    }
+    
+}
@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "test/storm_gtest.h"
+
+#include <csignal>
+#include <boost/filesystem.hpp>
+
+#include "storm/solver/helper/SolverCheckpoint.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/resources.h"
+
+namespace {
+
+    std::string getCheckpointFilename() {
+        return (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-checkpoint-%%%%-%%%%-%%%%")).string();
+    }
+
+    std::vector<std::string> getCheckpointFiles(std::string const& prefix) {
+        std::vector<std::string> result;
+        boost::filesystem::path prefixPath(prefix);
+        for (auto const& entry : boost::filesystem::directory_iterator(prefixPath.parent_path())) {
+            if (entry.path().filename().string().find(prefixPath.filename().string() + ".") == 0) {
+                result.push_back(entry.path().string());
+            }
+        }
+        return result;
+    }
+
+    void removeCheckpointFiles(std::string const& prefix) {
+        for (auto const& file : getCheckpointFiles(prefix)) {
+            boost::filesystem::remove(file);
+        }
+    }
+
+    TEST(SolverCheckpointTest, WriteAndRestore) {
+        std::string filename = getCheckpointFilename();
+        storm::Environment env;
+        env.solver().setCheckpointFilename(filename);
+        env.solver().setCheckpointInterval(0);
+
+        std::vector<double> x = {0.1, 0.2, 0.3};
+        double bound = 0.5;
+        storm::solver::helper::SolverCheckpoint<double> writer(env, "test", [] () { return 42; });
+        ASSERT_TRUE(writer.isEnabled());
+        EXPECT_TRUE(writer.update(17, {&x}, {bound}));
+
+        // A subsequent computation does not overwrite the checkpoint.
+        std::vector<double> otherX = {0.4, 0.5, 0.6};
+        storm::solver::helper::SolverCheckpoint<double> otherWriter(env, "test", [] () { return 43; });
+        EXPECT_NE(writer.getFilename(), otherWriter.getFilename());
+        EXPECT_TRUE(otherWriter.update(3, {&otherX}, {bound}));
+        EXPECT_EQ(2ull, getCheckpointFiles(filename).size());
+
+        // Without the resume option, nothing is restored.
+        std::vector<double> y(3);
+        double restoredBound = 0.0;
+        storm::solver::helper::SolverCheckpoint<double> reader(env, "test", [] () { return 42; });
+        EXPECT_FALSE(reader.restore({&y}, {&restoredBound}));
+
+        env.solver().setResumeFromCheckpoint(true);
+        storm::solver::helper::SolverCheckpoint<double> resumingReader(env, "test", [] () { return 42; });
+        auto iteration = resumingReader.restore({&y}, {&restoredBound});
+        ASSERT_TRUE(static_cast<bool>(iteration));
+        EXPECT_EQ(17ull, iteration.get());
+        EXPECT_EQ(x, y);
+        EXPECT_EQ(bound, restoredBound);
+
+        // Checkpoints of other computations are ignored.
+        storm::solver::helper::SolverCheckpoint<double> otherFingerprint(env, "test", [] () { return 43; });
+        EXPECT_FALSE(otherFingerprint.restore({&y}, {&restoredBound}));
+        storm::solver::helper::SolverCheckpoint<double> otherIdentifier(env, "other", [] () { return 42; });
+        EXPECT_FALSE(otherIdentifier.restore({&y}, {&restoredBound}));
+        std::vector<double> otherSize(4);
+        EXPECT_FALSE(resumingReader.restore({&otherSize}, {&restoredBound}));
+
+        removeCheckpointFiles(filename);
+    }
+
+    TEST(SolverCheckpointTest, WriteBeforeTermination) {
+        std::string filename = getCheckpointFilename();
+        storm::Environment env;
+        env.solver().setCheckpointFilename(filename);
+
+        // With the default interval, only the termination triggers a checkpoint.
+        std::vector<double> x = {0.1, 0.2, 0.3};
+        EXPECT_EXIT({
+            storm::utility::resources::installSignalHandler();
+            storm::solver::helper::SolverCheckpoint<double> writer(env, "test", [] () { return 42; });
+            EXPECT_FALSE(writer.update(1, {&x}));
+            std::raise(SIGTERM);
+            writer.update(2, {&x});
+        }, ::testing::ExitedWithCode(static_cast<uint8_t>(storm::utility::resources::STORM_EXIT_GENERALERROR)), "Interrupted");
+
+        std::vector<double> y(3);
+        env.solver().setResumeFromCheckpoint(true);
+        storm::solver::helper::SolverCheckpoint<double> reader(env, "test", [] () { return 42; });
+        auto iteration = reader.restore({&y});
+        ASSERT_TRUE(static_cast<bool>(iteration));
+        EXPECT_EQ(2ull, iteration.get());
+        EXPECT_EQ(x, y);
+
+        removeCheckpointFiles(filename);
+    }
+
+    TEST(SolverCheckpointTest, ResumeValueIteration) {
+        std::string filename = getCheckpointFilename();
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setCheckpointFilename(filename);
+        env.solver().setCheckpointInterval(0);
+
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 0, 0.9);
+        storm::storage::SparseMatrix<double> A = builder.build(2);
+        std::vector<double> b = {0.099, 0.5};
+
+        std::vector<double> otherB = {0.03, 0.9};
+
+        auto solve = [&] (storm::Environment const& solverEnv, std::vector<double> const& rhs) {
+            std::vector<double> x(1);
+            auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(solverEnv, A);
+            solver->setHasUniqueSolution(true);
+            solver->setHasNoEndComponents(true);
+            solver->setBounds(0.0, 2.0);
+            EXPECT_TRUE(solver->solveEquations(solverEnv, storm::OptimizationDirection::Minimize, x, rhs));
+            return x[0];
+        };
+
+        // Two subsequent solves keep separate checkpoints.
+        EXPECT_NEAR(0.5, solve(env, b), 1e-7);
+        EXPECT_NEAR(0.3, solve(env, otherB), 1e-7);
+        ASSERT_EQ(2ull, getCheckpointFiles(filename).size());
+
+        // Resuming starts from the last checkpoint, which is already close to the solution.
+        env.solver().setResumeFromCheckpoint(true);
+        EXPECT_NEAR(0.5, solve(env, b), 1e-7);
+        EXPECT_NEAR(0.3, solve(env, otherB), 1e-7);
+
+        removeCheckpointFiles(filename);
+    }
+}
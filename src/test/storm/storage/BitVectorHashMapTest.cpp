@@ -67,3 +67,18 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, MemoryUsage) {
+    storm::storage::BitVectorHashMap<uint64_t> map(64, 3);
+    uint64_t initialUsage = map.getMemoryUsage();
+    EXPECT_LE(map.capacity() * sizeof(uint64_t), initialUsage);
+    
+    for (uint64_t index = 0; index < 64; ++index) {
+        storm::storage::BitVector state(64);
+        state.set(index);
+        map.findOrAdd(state, index);
+    }
+    
+    // Adding the states grows the buckets of the map.
+    EXPECT_LT(initialUsage, map.getMemoryUsage());
+}
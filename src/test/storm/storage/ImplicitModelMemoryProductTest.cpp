@@ -0,0 +1,176 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/memorystructure/MemoryStructureBuilder.h"
+#include "storm/storage/memorystructure/SparseModelMemoryProduct.h"
+#include "storm/storage/memorystructure/ImplicitModelMemoryProduct.h"
+#include "storm/environment/Environment.h"
+#include "storm/solver/Multiplier.h"
+#include "storm/utility/graph.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Mdp<double>> buildTwoDice() {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        return storm::api::buildSparseModel<double>(program, std::vector<std::shared_ptr<storm::logic::Formula const>>())->template as<storm::models::sparse::Mdp<double>>();
+    }
+
+    // The memory counts whether the "done" states have been entered an even or odd number of times.
+    storm::storage::MemoryStructure buildParityMemory(storm::models::sparse::Mdp<double> const& model) {
+        storm::storage::BitVector done = model.getStates("done");
+        storm::storage::MemoryStructureBuilder<double> memoryBuilder(2, model);
+        memoryBuilder.setTransition(0, 0, ~done);
+        memoryBuilder.setTransition(0, 1, done);
+        memoryBuilder.setTransition(1, 1, ~done);
+        memoryBuilder.setTransition(1, 0, done);
+        return memoryBuilder.build();
+    }
+}
+
+TEST(ImplicitModelMemoryProductTest, AgreesWithSparseProduct) {
+    auto model = buildTwoDice();
+    storm::storage::BitVector done = model->getStates("done");
+    storm::storage::MemoryStructure memory = buildParityMemory(*model);
+
+    auto explicitProduct = storm::storage::SparseModelMemoryProduct<double>(*model, memory).build()->template as<storm::models::sparse::Mdp<double>>();
+    storm::storage::ImplicitModelMemoryProduct<double> implicitProduct(model->getTransitionMatrix(), model->getInitialStates(), memory);
+
+    ASSERT_EQ(explicitProduct->getNumberOfStates(), implicitProduct.getNumberOfStates());
+    ASSERT_EQ(explicitProduct->getNumberOfChoices(), implicitProduct.getNumberOfRows());
+    EXPECT_LT(model->getNumberOfStates(), implicitProduct.getNumberOfStates());
+    EXPECT_EQ(explicitProduct->getInitialStates(), implicitProduct.getInitialStates());
+    EXPECT_EQ(explicitProduct->getTransitionMatrix().getRowGroupIndices(), implicitProduct.getRowGroupIndices());
+    EXPECT_TRUE(explicitProduct->getTransitionMatrix() == implicitProduct.buildTransitionMatrix());
+
+    for (uint64_t productState = 0; productState < implicitProduct.getNumberOfStates(); ++productState) {
+        uint64_t modelState = implicitProduct.getModelState(productState);
+        EXPECT_TRUE(implicitProduct.isReachable(modelState, implicitProduct.getMemoryState(productState)));
+        EXPECT_EQ(productState, implicitProduct.getProductState(modelState, implicitProduct.getMemoryState(productState)));
+        EXPECT_EQ(model->getTransitionMatrix().getRowGroupIndices()[modelState], implicitProduct.getModelRow(implicitProduct.getRowGroupIndices()[productState]));
+    }
+    uint64_t numberOfReachablePairs = 0;
+    for (uint64_t modelState = 0; modelState < model->getNumberOfStates(); ++modelState) {
+        for (uint64_t memoryState = 0; memoryState < memory.getNumberOfStates(); ++memoryState) {
+            if (implicitProduct.isReachable(modelState, memoryState)) {
+                ++numberOfReachablePairs;
+            }
+        }
+    }
+    EXPECT_EQ(implicitProduct.getNumberOfStates(), numberOfReachablePairs);
+    EXPECT_EQ(explicitProduct->getStates("done"), implicitProduct.liftStates(done));
+
+    std::vector<double> x(implicitProduct.getNumberOfStates());
+    for (uint64_t productState = 0; productState < x.size(); ++productState) {
+        x[productState] = static_cast<double>(productState % 7) / 7.0;
+    }
+    std::vector<double> b = implicitProduct.liftRowValues(std::vector<double>(model->getNumberOfChoices(), 0.5));
+
+    std::vector<double> explicitResult, implicitResult;
+    explicitProduct->getTransitionMatrix().multiplyWithVector(x, explicitResult, &b);
+    implicitProduct.multiply(x, &b, implicitResult);
+    ASSERT_EQ(explicitResult.size(), implicitResult.size());
+    for (uint64_t row = 0; row < explicitResult.size(); ++row) {
+        EXPECT_NEAR(explicitResult[row], implicitResult[row], 1e-12);
+    }
+
+    std::vector<double> maxResult;
+    std::vector<uint64_t> maxChoices;
+    implicitProduct.multiplyAndReduce(storm::OptimizationDirection::Maximize, x, &b, maxResult, &maxChoices);
+    ASSERT_EQ(implicitProduct.getNumberOfStates(), maxResult.size());
+    for (uint64_t productState = 0; productState < maxResult.size(); ++productState) {
+        auto const& groups = implicitProduct.getRowGroupIndices();
+        double expected = *std::max_element(explicitResult.begin() + groups[productState], explicitResult.begin() + groups[productState + 1]);
+        EXPECT_NEAR(expected, maxResult[productState], 1e-12);
+        EXPECT_NEAR(expected, explicitResult[groups[productState] + maxChoices[productState]], 1e-12);
+    }
+}
+
+TEST(ImplicitModelMemoryProductTest, GraphAnalysis) {
+    auto model = buildTwoDice();
+    storm::storage::MemoryStructure memory = buildParityMemory(*model);
+    auto explicitProduct = storm::storage::SparseModelMemoryProduct<double>(*model, memory).build()->template as<storm::models::sparse::Mdp<double>>();
+    storm::storage::ImplicitModelMemoryProduct<double> implicitProduct(model->getTransitionMatrix(), model->getInitialStates(), memory);
+    ASSERT_EQ(explicitProduct->getNumberOfStates(), implicitProduct.getNumberOfStates());
+
+    // Reach a "seven" state with memory state 1 while avoiding the "two" states with memory state 0.
+    storm::storage::BitVector psiStates = implicitProduct.liftStates(model->getStates("seven"));
+    storm::storage::BitVector phiStates = ~implicitProduct.liftStates(model->getStates("two"));
+    for (uint64_t productState = 0; productState < implicitProduct.getNumberOfStates(); ++productState) {
+        if (implicitProduct.getMemoryState(productState) == 0) {
+            psiStates.set(productState, false);
+        } else {
+            phiStates.set(productState, true);
+        }
+    }
+
+    auto explicitMax = storm::utility::graph::performProb01Max(*explicitProduct, phiStates, psiStates);
+    auto implicitMax = storm::utility::graph::performProb01Max(implicitProduct, phiStates, psiStates);
+    EXPECT_EQ(explicitMax.first, implicitMax.first);
+    EXPECT_EQ(explicitMax.second, implicitMax.second);
+    EXPECT_FALSE(implicitMax.first.empty());
+    EXPECT_LT(psiStates.getNumberOfSetBits(), implicitMax.second.getNumberOfSetBits());
+
+    auto explicitMin = storm::utility::graph::performProb01Min(*explicitProduct, phiStates, psiStates);
+    auto implicitMin = storm::utility::graph::performProb01Min(implicitProduct, phiStates, psiStates);
+    EXPECT_EQ(explicitMin.first, implicitMin.first);
+    EXPECT_EQ(explicitMin.second, implicitMin.second);
+}
+
+TEST(ImplicitModelMemoryProductTest, Multiplier) {
+    auto model = buildTwoDice();
+    storm::storage::MemoryStructure memory = buildParityMemory(*model);
+    auto explicitProduct = storm::storage::SparseModelMemoryProduct<double>(*model, memory).build()->template as<storm::models::sparse::Mdp<double>>();
+    storm::storage::ImplicitModelMemoryProduct<double> implicitProduct(model->getTransitionMatrix(), model->getInitialStates(), memory);
+    ASSERT_EQ(explicitProduct->getNumberOfStates(), implicitProduct.getNumberOfStates());
+
+    storm::Environment env;
+    auto explicitMultiplier = storm::solver::MultiplierFactory<double>().create(env, explicitProduct->getTransitionMatrix());
+    auto implicitMultiplier = storm::solver::MultiplierFactory<double>().create(env, implicitProduct);
+
+    std::vector<double> b = implicitProduct.liftRowValues(std::vector<double>(model->getNumberOfChoices(), 0.25));
+    std::vector<double> explicitX(implicitProduct.getNumberOfStates());
+    for (uint64_t productState = 0; productState < explicitX.size(); ++productState) {
+        explicitX[productState] = static_cast<double>(productState % 5) / 5.0;
+    }
+    std::vector<double> implicitX = explicitX;
+
+    std::vector<double> explicitResult, implicitResult;
+    explicitMultiplier->multiply(env, explicitX, &b, explicitResult);
+    implicitMultiplier->multiply(env, implicitX, &b, implicitResult);
+    ASSERT_EQ(explicitResult.size(), implicitResult.size());
+    for (uint64_t row = 0; row < explicitResult.size(); ++row) {
+        EXPECT_NEAR(explicitResult[row], implicitResult[row], 1e-12);
+    }
+
+    // The reductions are performed in place.
+    std::vector<uint_fast64_t> explicitChoices(implicitProduct.getNumberOfStates(), 0);
+    std::vector<uint_fast64_t> implicitChoices = explicitChoices;
+    for (uint64_t iteration = 0; iteration < 3; ++iteration) {
+        explicitMultiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, explicitX, &b, explicitX, &explicitChoices);
+        implicitMultiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, implicitX, &b, implicitX, &implicitChoices);
+    }
+    for (uint64_t productState = 0; productState < implicitX.size(); ++productState) {
+        EXPECT_NEAR(explicitX[productState], implicitX[productState], 1e-12);
+    }
+
+    // The chosen rows have to attain the result.
+    std::vector<double> result;
+    implicitMultiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, implicitX, &b, result, &implicitChoices);
+    for (uint64_t productState = 0; productState < implicitX.size(); ++productState) {
+        uint64_t row = implicitProduct.getRowGroupIndices()[productState] + implicitChoices[productState];
+        double choiceValue = b[row];
+        implicitMultiplier->multiplyRow(row, implicitX, choiceValue);
+        EXPECT_NEAR(result[productState], choiceValue, 1e-12);
+    }
+
+    for (uint64_t iteration = 0; iteration < 3; ++iteration) {
+        explicitMultiplier->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Minimize, explicitX, &b);
+        implicitMultiplier->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Minimize, implicitX, &b);
+    }
+    for (uint64_t productState = 0; productState < implicitX.size(); ++productState) {
+        EXPECT_NEAR(explicitX[productState], implicitX[productState], 1e-12);
+    }
+}
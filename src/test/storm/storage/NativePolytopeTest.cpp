@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/geometry/NativePolytope.h"
+#include "storm/utility/constants.h"
+
+namespace {
+    template <typename ValueType>
+    std::shared_ptr<storm::storage::geometry::Polytope<ValueType>> createUnitCube(uint64_t dimension) {
+        std::vector<storm::storage::geometry::Halfspace<ValueType>> halfspaces;
+        for (uint64_t i = 0; i < dimension; ++i) {
+            std::vector<ValueType> normal(dimension, storm::utility::zero<ValueType>());
+            normal[i] = storm::utility::one<ValueType>();
+            halfspaces.emplace_back(normal, storm::utility::one<ValueType>());
+            normal[i] = -storm::utility::one<ValueType>();
+            halfspaces.emplace_back(normal, storm::utility::zero<ValueType>());
+        }
+        return std::make_shared<storm::storage::geometry::NativePolytope<ValueType>>(halfspaces);
+    }
+
+    template <typename ValueType>
+    bool containsVertex(std::vector<std::vector<ValueType>> const& vertices, std::vector<double> const& expected) {
+        for (auto const& vertex : vertices) {
+            bool equal = true;
+            for (uint64_t i = 0; i < vertex.size(); ++i) {
+                equal &= std::abs(storm::utility::convertNumber<double>(vertex[i]) - expected[i]) < 1e-9;
+            }
+            if (equal) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TEST(NativePolytopeTest, IncrementalVertices) {
+    auto cube = createUnitCube<double>(3);
+    EXPECT_EQ(8ul, cube->getVertices().size());
+
+    // Cutting off a corner replaces it by the intersection points on the adjacent edges.
+    auto cut = cube->intersection(storm::storage::geometry::Halfspace<double>({1.0, 1.0, 1.0}, 1.5));
+    auto vertices = cut->getVertices();
+    EXPECT_EQ(10ul, vertices.size());
+    EXPECT_TRUE(containsVertex(vertices, {0.0, 0.0, 0.0}));
+    EXPECT_TRUE(containsVertex(vertices, {1.0, 0.5, 0.0}));
+    EXPECT_TRUE(containsVertex(vertices, {0.0, 0.5, 1.0}));
+    EXPECT_FALSE(containsVertex(vertices, {1.0, 1.0, 0.0}));
+
+    // A redundant halfspace does not change the vertices.
+    auto redundant = cut->intersection(storm::storage::geometry::Halfspace<double>({1.0, 0.0, 0.0}, 2.0));
+    EXPECT_EQ(10ul, redundant->getVertices().size());
+    EXPECT_FALSE(redundant->isEmpty());
+
+    auto empty = cut->intersection(storm::storage::geometry::Halfspace<double>({-1.0, 0.0, 0.0}, -2.0));
+    EXPECT_TRUE(empty->getVertices().empty());
+    EXPECT_TRUE(empty->isEmpty());
+
+    // The vertices of a polytope that is obtained from scratch coincide with the incrementally computed ones.
+    auto scratch = std::make_shared<storm::storage::geometry::NativePolytope<double>>(cut->getHalfspaces());
+    EXPECT_EQ(vertices.size(), scratch->getVertices().size());
+    for (auto const& vertex : scratch->getVertices()) {
+        EXPECT_TRUE(containsVertex(vertices, vertex));
+    }
+}
+
+TEST(NativePolytopeTest, IncrementalVerticesUnbounded) {
+    // As for the over-approximation of Pareto curves, start with the whole space and add one halfspace at a time.
+    std::shared_ptr<storm::storage::geometry::Polytope<storm::RationalNumber>> polytope = std::make_shared<storm::storage::geometry::NativePolytope<storm::RationalNumber>>(std::vector<storm::storage::geometry::Halfspace<storm::RationalNumber>>());
+    polytope = polytope->intersection(storm::storage::geometry::Halfspace<storm::RationalNumber>({storm::utility::one<storm::RationalNumber>(), storm::utility::zero<storm::RationalNumber>()}, storm::utility::one<storm::RationalNumber>()));
+    EXPECT_TRUE(polytope->getVertices().empty());
+    polytope = polytope->intersection(storm::storage::geometry::Halfspace<storm::RationalNumber>({storm::utility::zero<storm::RationalNumber>(), storm::utility::one<storm::RationalNumber>()}, storm::utility::one<storm::RationalNumber>()));
+    auto vertices = polytope->getVertices();
+    ASSERT_EQ(1ul, vertices.size());
+    EXPECT_TRUE(containsVertex(vertices, {1.0, 1.0}));
+
+    polytope = polytope->intersection(storm::storage::geometry::Halfspace<storm::RationalNumber>({storm::utility::one<storm::RationalNumber>(), storm::utility::one<storm::RationalNumber>()}, storm::utility::convertNumber<storm::RationalNumber>(std::string("3/2"))));
+    vertices = polytope->getVertices();
+    ASSERT_EQ(2ul, vertices.size());
+    EXPECT_TRUE(containsVertex(vertices, {0.5, 1.0}));
+    EXPECT_TRUE(containsVertex(vertices, {1.0, 0.5}));
+    EXPECT_FALSE(polytope->isEmpty());
+}
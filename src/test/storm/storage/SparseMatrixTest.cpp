@@ -694,3 +694,26 @@ TEST(SparseMatrix, IsSubmatrix) {
     ASSERT_FALSE(matrix3.isSubmatrixOf(matrix));
     ASSERT_FALSE(matrix3.isSubmatrixOf(matrix2));
 }
+
+TEST(SparseMatrix, MemoryUsage) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 8);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    uint64_t minimalUsage = 8 * sizeof(storm::storage::MatrixEntry<uint_fast64_t, double>) + 6 * sizeof(uint_fast64_t);
+    EXPECT_LE(minimalUsage, matrix.getMemoryUsage());
+    
+    storm::storage::BitVector rowConstraint(5);
+    rowConstraint.set(0);
+    rowConstraint.set(1);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(false, rowConstraint, storm::storage::BitVector(4, true));
+    EXPECT_LT(submatrix.getMemoryUsage(), matrix.getMemoryUsage());
+}
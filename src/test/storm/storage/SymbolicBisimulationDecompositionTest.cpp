@@ -14,6 +14,12 @@
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/environment/Environment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/solver/SymbolicLinearEquationSolver.h"
 #include "storm/solver/SymbolicMinMaxLinearEquationSolver.h"
@@ -21,6 +27,7 @@
 #include "storm/logic/Formulas.h"
 #include "storm-parsers/parser/FormulaParser.h"
 
+#include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -467,3 +474,117 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+namespace {
+    /*!
+     * Computes the bisimulation quotient of the given model (with respect to the given formulas, if any) and extracts
+     * it as a sparse model.
+     */
+    template<storm::dd::DdType DdType>
+    std::shared_ptr<storm::models::sparse::Model<double>> computeSparseQuotient(storm::models::symbolic::Model<DdType, double> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+        storm::settings::mutableBisimulationSettings().setQuotientFormat(storm::settings::modules::BisimulationSettings::QuotientFormat::Sparse);
+        
+        std::unique_ptr<storm::dd::BisimulationDecomposition<DdType, double>> decomposition;
+        if (formulas.empty()) {
+            decomposition = std::make_unique<storm::dd::BisimulationDecomposition<DdType, double>>(model, storm::storage::BisimulationType::Strong);
+        } else {
+            decomposition = std::make_unique<storm::dd::BisimulationDecomposition<DdType, double>>(model, formulas, storm::storage::BisimulationType::Strong);
+        }
+        decomposition->compute();
+        std::shared_ptr<storm::models::Model<double>> quotient = decomposition->getQuotient();
+        
+        storm::settings::mutableBisimulationSettings().restoreDefaults();
+        EXPECT_TRUE(quotient->isSparseModel());
+        return quotient->as<storm::models::sparse::Model<double>>();
+    }
+    
+    void expectStochasticRows(storm::storage::SparseMatrix<double> const& matrix) {
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(1.0, matrix.getRowSum(row), 1e-6) << "Row " << row << " is not a probability distribution.";
+        }
+    }
+}
+
+TEST(SymbolicModelBisimulationDecomposition, CrowdsSparseQuotient) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> cuddModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(smd.asPrismProgram());
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> sylvanModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram());
+    
+    // The quotient has more rows than are extracted by a single task, so Sylvan distributes the extraction over several tasks.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    std::shared_ptr<storm::models::sparse::Model<double>> cuddQuotient = computeSparseQuotient(*cuddModel, formulas);
+    std::shared_ptr<storm::models::sparse::Model<double>> sylvanQuotient = computeSparseQuotient(*sylvanModel, formulas);
+    
+    EXPECT_EQ(2007ul, cuddQuotient->getNumberOfStates());
+    EXPECT_EQ(3738ul, cuddQuotient->getNumberOfTransitions());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, sylvanQuotient->getType());
+    EXPECT_EQ(cuddQuotient->getNumberOfStates(), sylvanQuotient->getNumberOfStates());
+    EXPECT_EQ(cuddQuotient->getNumberOfTransitions(), sylvanQuotient->getNumberOfTransitions());
+    EXPECT_EQ(cuddQuotient->getInitialStates().getNumberOfSetBits(), sylvanQuotient->getInitialStates().getNumberOfSetBits());
+    expectStochasticRows(sylvanQuotient->getTransitionMatrix());
+    
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+    formulas.push_back(formula);
+    
+    storm::Environment env;
+    std::vector<double> results;
+    for (auto const& quotient : {cuddQuotient, sylvanQuotient, computeSparseQuotient(*cuddModel, formulas), computeSparseQuotient(*sylvanModel, formulas)}) {
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*quotient->as<storm::models::sparse::Dtmc<double>>());
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+        results.push_back(result->asExplicitQuantitativeCheckResult<double>()[*quotient->getInitialStates().begin()]);
+    }
+    for (auto const& value : results) {
+        EXPECT_NEAR(results.front(), value, 1e-6);
+    }
+}
+
+TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeaderSparseQuotient) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Rmax=? [F \"elected\"]");
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> cuddModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(smd.asPrismProgram(), *formula);
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> sylvanModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram(), *formula);
+    
+    // The rows of the quotient are split along the nondeterminism variables before the state variables.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    std::shared_ptr<storm::models::sparse::Model<double>> cuddQuotient = computeSparseQuotient(*cuddModel, formulas);
+    std::shared_ptr<storm::models::sparse::Model<double>> sylvanQuotient = computeSparseQuotient(*sylvanModel, formulas);
+    
+    EXPECT_EQ(252ul, cuddQuotient->getNumberOfStates());
+    EXPECT_EQ(624ul, cuddQuotient->getNumberOfTransitions());
+    EXPECT_EQ(500ul, cuddQuotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    EXPECT_EQ(storm::models::ModelType::Mdp, sylvanQuotient->getType());
+    EXPECT_EQ(cuddQuotient->getNumberOfStates(), sylvanQuotient->getNumberOfStates());
+    EXPECT_EQ(cuddQuotient->getNumberOfTransitions(), sylvanQuotient->getNumberOfTransitions());
+    EXPECT_EQ(cuddQuotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices(), sylvanQuotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    expectStochasticRows(sylvanQuotient->getTransitionMatrix());
+    
+    formulas.push_back(formula);
+    cuddQuotient = computeSparseQuotient(*cuddModel, formulas);
+    sylvanQuotient = computeSparseQuotient(*sylvanModel, formulas);
+    
+    EXPECT_EQ(1107ul, sylvanQuotient->getNumberOfStates());
+    EXPECT_EQ(2684ul, sylvanQuotient->getNumberOfTransitions());
+    EXPECT_EQ(2152ul, sylvanQuotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    EXPECT_EQ(cuddQuotient->getTransitionMatrix().getRowGroupCount(), sylvanQuotient->getTransitionMatrix().getRowGroupCount());
+    expectStochasticRows(sylvanQuotient->getTransitionMatrix());
+    
+    storm::Environment env;
+    std::vector<double> results;
+    for (auto const& quotient : {cuddQuotient, sylvanQuotient}) {
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*quotient->as<storm::models::sparse::Mdp<double>>());
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+        results.push_back(result->asExplicitQuantitativeCheckResult<double>()[*quotient->getInitialStates().begin()]);
+    }
+    EXPECT_NEAR(results.front(), results.back(), 1e-6);
+}
@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/Metrics.h"
+
+TEST(MetricsTest, DisabledByDefault) {
+    storm::utility::metrics::setEnabled(false);
+    storm::utility::metrics::setGauge("storm_test_gauge", "A gauge.", 1.0);
+    std::stringstream stream;
+    storm::utility::metrics::writeMetrics(stream);
+    EXPECT_EQ(std::string::npos, stream.str().find("storm_test_gauge"));
+    // The process metrics are always available.
+    EXPECT_NE(std::string::npos, stream.str().find("storm_resident_memory_bytes "));
+}
+
+TEST(MetricsTest, TextFormat) {
+    storm::utility::metrics::setEnabled(true);
+    storm::utility::metrics::setGauge("storm_test_gauge", "A gauge.", 3.0);
+    storm::utility::metrics::setGauge("storm_test_gauge", "A gauge.", 2.5);
+    storm::utility::metrics::incrementCounter("storm_test_total", "A counter.", 2.0, "kind=\"a\"");
+    storm::utility::metrics::incrementCounter("storm_test_total", "A counter.", 3.0, "kind=\"a\"");
+    storm::utility::metrics::incrementCounter("storm_test_total", "A counter.", 1.0, "kind=\"b\"");
+    {
+        storm::utility::metrics::ScopedPhase phase("test \"phase\"");
+    }
+
+    std::stringstream stream;
+    storm::utility::metrics::writeMetrics(stream);
+    std::string text = stream.str();
+    EXPECT_NE(std::string::npos, text.find("# HELP storm_test_gauge A gauge.\n# TYPE storm_test_gauge gauge\nstorm_test_gauge 2.5\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE storm_test_total counter\nstorm_test_total{kind=\"a\"} 5\nstorm_test_total{kind=\"b\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("storm_phase_elapsed_seconds{phase=\"test \\\"phase\\\"\"} "));
+    storm::utility::metrics::setEnabled(false);
+}
+
+TEST(MetricsTest, FileExport) {
+    std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-metrics-%%%%-%%%%.prom")).string();
+    storm::utility::metrics::startExport(filename, 1);
+    EXPECT_TRUE(storm::utility::metrics::isEnabled());
+    storm::utility::metrics::setGauge("storm_test_gauge", "A gauge.", 42.0);
+    storm::utility::metrics::stopExport();
+
+    // Stopping the export writes the final values.
+    std::ifstream file(filename);
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_NE(std::string::npos, content.str().find("storm_test_gauge 42\n"));
+    std::remove(filename.c_str());
+    storm::utility::metrics::setEnabled(false);
+}
@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <sstream>
+
+#include "storm-cli-utilities/model-handling.h"
+#include "storm-parsers/parser/PrismParser.h"
+
+namespace {
+
+    uint64_t countOccurrences(std::string const& text, std::string const& pattern) {
+        uint64_t result = 0;
+        for (std::size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + pattern.size())) {
+            ++result;
+        }
+        return result;
+    }
+
+    storm::cli::SymbolicInput createInput() {
+        std::string const program = R"(dtmc
+const int N;
+const int K;
+module walk
+    x : [0..N+K] init 0;
+    [] x<N+K -> 0.5 : (x'=x+1) + 0.5 : (x'=x);
+endmodule
+label "done" = x=N+K;
+)";
+        storm::cli::SymbolicInput input;
+        input.model = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parseFromString(program, "walk.pm"));
+        return input;
+    }
+
+    TEST(ModelServerTest, ReusesModels) {
+        storm::cli::ModelServer<storm::dd::DdType::Sylvan, double> server(createInput(), storm::settings::modules::CoreSettings::Engine::Sparse);
+
+        std::stringstream out;
+        EXPECT_TRUE(server.handleQuery("constants N=2,K=1", out));
+        EXPECT_EQ("ok\n", out.str());
+
+        // The first query builds the model, the second one reuses it.
+        out.str("");
+        EXPECT_TRUE(server.handleQuery("check P=? [F \"done\"]", out));
+        EXPECT_EQ(1ul, countOccurrences(out.str(), "Model type:"));
+        EXPECT_EQ(1ul, countOccurrences(out.str(), "Result (for initial states): 1"));
+        EXPECT_EQ("ok\n", out.str().substr(out.str().size() - 3));
+        out.str("");
+        EXPECT_TRUE(server.handleQuery("check P=? [F<=3 \"done\"]", out));
+        EXPECT_EQ(0ul, countOccurrences(out.str(), "Model type:"));
+        EXPECT_EQ(1ul, countOccurrences(out.str(), "Result (for initial states): 0.125"));
+
+        // Equivalent constant definitions refer to the same model.
+        out.str("");
+        EXPECT_TRUE(server.handleQuery("constants K = 1, N=2", out));
+        EXPECT_TRUE(server.handleQuery("check P=? [F \"done\"]", out));
+        EXPECT_EQ(0ul, countOccurrences(out.str(), "Model type:"));
+        out.str("");
+        EXPECT_TRUE(server.handleQuery("models", out));
+        EXPECT_EQ(1ul, countOccurrences(out.str(), "Model type:"));
+        EXPECT_EQ(1ul, countOccurrences(out.str(), "'K=1,N=2'"));
+
+        // Other constants require another model.
+        out.str("");
+        EXPECT_TRUE(server.handleQuery("constants N=1,K=1", out));
+        EXPECT_TRUE(server.handleQuery("check P=? [F \"done\"]", out));
+        EXPECT_EQ(1ul, countOccurrences(out.str(), "Model type:"));
+        out.str("");
+        EXPECT_TRUE(server.handleQuery("models", out));
+        EXPECT_EQ(2ul, countOccurrences(out.str(), "Model type:"));
+
+        out.str("");
+        EXPECT_TRUE(server.handleQuery("unknown", out));
+        EXPECT_EQ(0ul, out.str().find("error:"));
+        EXPECT_FALSE(server.handleQuery("quit", out));
+    }
+}
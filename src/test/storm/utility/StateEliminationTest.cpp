@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/stateelimination.h"
+
+TEST(StateEliminationTest, NestedDissectionOrderPath) {
+    // A chain of states in which every state moves to both of its neighbors.
+    uint_fast64_t numberOfStates = 50;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        if (state > 0) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(state, state - 1, 0.5));
+        }
+        if (state + 1 < numberOfStates) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(state, state + 1, 0.5));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+
+    std::vector<storm::storage::sparse::state_type> order = storm::utility::stateelimination::getNestedDissectionOrder(flexibleMatrix, storm::storage::BitVector(numberOfStates, true), 4);
+
+    // Every state is eliminated exactly once.
+    ASSERT_EQ(numberOfStates, order.size());
+    storm::storage::BitVector seen(numberOfStates);
+    for (auto const& state : order) {
+        EXPECT_FALSE(seen.get(state));
+        seen.set(state);
+    }
+
+    // The top-level separator of a chain is a single state in its middle and is eliminated last.
+    EXPECT_TRUE(order.back() == 24 || order.back() == 25);
+}
+
+TEST(StateEliminationTest, NestedDissectionOrderSubset) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 3, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 3, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+
+    storm::storage::BitVector states(4);
+    states.set(0);
+    states.set(2);
+    states.set(3);
+    std::vector<storm::storage::sparse::state_type> order = storm::utility::stateelimination::getNestedDissectionOrder(flexibleMatrix, states);
+
+    // Only the requested states are ordered. State 0 is isolated in the sub-graph and therefore has the smallest degree.
+    ASSERT_EQ(3ul, order.size());
+    EXPECT_EQ(0ul, order[0]);
+}
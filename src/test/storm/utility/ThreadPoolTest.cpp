@@ -0,0 +1,33 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <stdexcept>
+
+#include "storm/utility/ThreadPool.h"
+
+TEST(ThreadPoolTest, Results) {
+    std::vector<std::future<uint64_t>> results;
+    {
+        storm::utility::ThreadPool threadPool(3);
+        EXPECT_EQ(3ul, threadPool.getNumberOfThreads());
+        for (uint64_t job = 0; job < 100; ++job) {
+            results.push_back(threadPool.submit([job] () { return job * job; }));
+        }
+    }
+    // All jobs are finished when the pool is destroyed.
+    uint64_t sum = 0;
+    for (auto& result : results) {
+        EXPECT_TRUE(result.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        sum += result.get();
+    }
+    EXPECT_EQ(328350ul, sum);
+}
+
+TEST(ThreadPoolTest, Exceptions) {
+    storm::utility::ThreadPool threadPool;
+    EXPECT_LE(1ul, threadPool.getNumberOfThreads());
+    auto failed = threadPool.submit([] () -> int { throw std::runtime_error("failed"); });
+    auto succeeded = threadPool.submit([] () { return std::make_unique<int>(42); });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+    EXPECT_EQ(42, *succeeded.get());
+}